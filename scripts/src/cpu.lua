@@ -15,13 +15,15 @@
 
 files {
 	MAME_DIR .. "src/emu/cpu/vtlb.c",
+	MAME_DIR .. "src/emu/cpu/predecode.h",
+	MAME_DIR .. "src/emu/cpu/lazyflags.h",
 }
 
 --------------------------------------------------
 -- Dynamic recompiler objects
 --------------------------------------------------
 
-if (CPUS["SH2"]~=null or CPUS["MIPS"]~=null or CPUS["POWERPC"]~=null or CPUS["RSP"]~=null or CPUS["ARM7"]~=null) then
+if (CPUS["SH2"]~=null or CPUS["MIPS"]~=null or CPUS["POWERPC"]~=null or CPUS["RSP"]~=null or CPUS["ARM7"]~=null or CPUS["I386"]~=null or CPUS["SH4"]~=null or CPUS["M680X0"]~=null) then
 	files {
 		MAME_DIR .. "src/emu/cpu/drcbec.c",
 		MAME_DIR .. "src/emu/cpu/drcbec.h",
@@ -213,6 +215,7 @@ if (CPUS["ADSP21062"]~=null) then
 	files {
 		MAME_DIR .. "src/emu/cpu/sharc/sharc.c",
 		MAME_DIR .. "src/emu/cpu/sharc/sharc.h",
+		MAME_DIR .. "src/emu/cpu/sharc/sharcpre.h",
 	}
 end
 
@@ -642,7 +645,14 @@ if (CPUS["SH4"]~=null) then
 		MAME_DIR .. "src/emu/cpu/sh4/sh4tmu.h",
 		MAME_DIR .. "src/emu/cpu/sh4/sh4dmac.c",
 		MAME_DIR .. "src/emu/cpu/sh4/sh4dmac.h",
+		MAME_DIR .. "src/emu/cpu/sh4/sh4fe.c",
 	}
+	-- the SH-4 front end derives from the SH-2 one
+	if (CPUS["SH2"]==null) then
+		files {
+			MAME_DIR .. "src/emu/cpu/sh2/sh2fe.c",
+		}
+	end
 end
 
 if (CPUS["SH4"]~=null or _OPTIONS["with-tools"]) then
@@ -881,6 +891,7 @@ if (CPUS["I386"]~=null) then
 	files {
 		MAME_DIR .. "src/emu/cpu/i386/i386.c",
 		MAME_DIR .. "src/emu/cpu/i386/i386.h",
+		MAME_DIR .. "src/emu/cpu/i386/i386fe.c",
 	}
 end
 
@@ -1307,6 +1318,7 @@ if (CPUS["M680X0"]~=null) then
 		MAME_DIR .. "src/emu/cpu/m68000/m68kcpu.h",
 		MAME_DIR .. "src/emu/cpu/m68000/m68kops.c",
 		MAME_DIR .. "src/emu/cpu/m68000/m68kops.h",
+		MAME_DIR .. "src/emu/cpu/m68000/m68kfe.c",
 	}
 end
 
@@ -1941,6 +1953,7 @@ if (CPUS["Z80"]~=null) then
 	files {
 		MAME_DIR .. "src/emu/cpu/z80/z80.c",
 		MAME_DIR .. "src/emu/cpu/z80/z80.h",
+		MAME_DIR .. "src/emu/cpu/z80/z80flags.h",
 		MAME_DIR .. "src/emu/cpu/z80/z80daisy.c",
 		MAME_DIR .. "src/emu/cpu/z80/z80daisy.h",
 		MAME_DIR .. "src/emu/cpu/z80/tmpz84c011.c",
@@ -32,11 +32,19 @@ links {
 includedirs {
 	MAME_DIR .. "3rdparty/unittest-cpp",
 	MAME_DIR .. "src/osd",
+	MAME_DIR .. "src/emu",
 	MAME_DIR .. "src/lib/util",
 }
 
 files {
 	MAME_DIR .. "tests/main.c",
 	MAME_DIR .. "tests/lib/util/corestr.c",
+	MAME_DIR .. "tests/emu/cpu/rsp/rspcp2.c",
+	MAME_DIR .. "tests/emu/cpu/predecode.c",
+	MAME_DIR .. "tests/emu/cpu/lazyflags.c",
+	MAME_DIR .. "tests/emu/cpu/sharcpre.c",
+	MAME_DIR .. "tests/emu/rendspan.c",
+	MAME_DIR .. "tests/emu/tilespan.c",
+	MAME_DIR .. "tests/emu/gfxspan.c",
 }
 
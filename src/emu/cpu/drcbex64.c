@@ -204,6 +204,9 @@ const UINT32 PTYPE_MR   = PTYPE_M | PTYPE_R;
 const UINT32 PTYPE_MRI  = PTYPE_M | PTYPE_R | PTYPE_I;
 const UINT32 PTYPE_MF   = PTYPE_M | PTYPE_F;
 
+// number of HASHJMP inline caches allocated at a time
+const UINT32 HASHJMP_CACHE_CHUNK = 64;
+
 #ifdef X64_WINDOWS_ABI
 
 const int REG_PARAM1    = REG_RCX;
@@ -596,6 +599,8 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, U
 		m_nocode(NULL),
 		m_fixup_label(FUNC(drcbe_x64::fixup_label), this),
 		m_fixup_exception(FUNC(drcbe_x64::fixup_exception), this),
+		m_hashjmp_next(NULL),
+		m_hashjmp_free(0),
 		m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
 {
 	// build up necessary arrays
@@ -609,6 +614,8 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, U
 	memcpy(m_near.ssecontrol, sse_control, sizeof(m_near.ssecontrol));
 	m_near.single1 = 1.0f;
 	m_near.double1 = 1.0;
+	m_near.hashjmp_hits = 0;
+	m_near.hashjmp_misses = 0;
 
 	// create absolute value masks that are aligned to SSE boundaries
 	m_absmask32 = (UINT32 *)(((FPTR)m_absmask32 + 15) & ~15);
@@ -751,6 +758,11 @@ void drcbe_x64::reset()
 	// reset our hash tables
 	m_hash.reset();
 	m_hash.set_default_codeptr(m_nocode);
+
+	// the inline caches were flushed along with the code
+	m_hashjmp_chunks.clear();
+	m_hashjmp_next = NULL;
+	m_hashjmp_free = 0;
 }
 
 
@@ -772,10 +784,19 @@ int drcbe_x64::execute(code_handle &entry)
 
 void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, UINT32 numinst)
 {
+	// replacing code for a mode/PC leaves inline caches pointing at the old code, so drop them all
+	for (UINT32 inum = 0; inum < numinst; inum++)
+		if (instlist[inum].opcode() == OP_HASH && m_hash.code_exists(instlist[inum].param(0).immediate(), instlist[inum].param(1).immediate()))
+		{
+			flush_hashjmp_caches();
+			break;
+		}
+
 	// tell all of our utility objects that a block is beginning
 	m_hash.block_begin(block, instlist, numinst);
 	m_labels.block_begin(block);
 	m_map.block_begin(block);
+	reserve_hashjmp_caches(block, instlist, numinst);
 
 	// begin codegen; fail if we can't
 	drccodeptr *cachetop = m_cache.begin_codegen(numinst * 8 * 4);
@@ -857,6 +878,68 @@ void drcbe_x64::get_info(drcbe_info &info)
 }
 
 
+//-------------------------------------------------
+//  get_stats - add the run-time statistics kept
+//  by generated code
+//-------------------------------------------------
+
+void drcbe_x64::get_stats(drcuml_stats &stats)
+{
+	stats.dynamic_predicted = m_near.hashjmp_hits;
+	stats.dynamic_lookups = m_near.hashjmp_misses;
+}
+
+
+//-------------------------------------------------
+//  reserve_hashjmp_caches - make sure there are
+//  enough inline caches for the computed HASHJMPs
+//  in a block before codegen begins
+//-------------------------------------------------
+
+void drcbe_x64::reserve_hashjmp_caches(drcuml_block &block, const instruction *instlist, UINT32 numinst)
+{
+	// count the HASHJMPs that need one
+	UINT32 needed = 0;
+	for (UINT32 inum = 0; inum < numinst; inum++)
+		if (instlist[inum].opcode() == OP_HASHJMP && !instlist[inum].param(1).is_immediate())
+			needed++;
+	if (needed <= m_hashjmp_free)
+		return;
+
+	// allocate a new chunk on its own cache lines, since misses write to it
+	UINT32 count = MAX(needed, HASHJMP_CACHE_CHUNK);
+	UINT8 *memory = (UINT8 *)m_cache.alloc_temporary(count * sizeof(hashjmp_cache) + 63);
+	if (memory == NULL)
+		block.abort();
+
+	hashjmp_cache_chunk chunk;
+	chunk.base = (hashjmp_cache *)(((FPTR)memory + 63) & ~63);
+	chunk.count = count;
+	m_hashjmp_chunks.push_back(chunk);
+	m_hashjmp_next = chunk.base;
+	m_hashjmp_free = count;
+}
+
+
+//-------------------------------------------------
+//  flush_hashjmp_caches - forget the targets of
+//  all inline caches
+//-------------------------------------------------
+
+void drcbe_x64::flush_hashjmp_caches()
+{
+	for (size_t chunknum = 0; chunknum < m_hashjmp_chunks.size(); chunknum++)
+	{
+		const hashjmp_cache_chunk &chunk = m_hashjmp_chunks[chunknum];
+		for (UINT32 index = 0; index < chunk.count; index++)
+		{
+			chunk.base[index].key = ~U64(0);
+			chunk.base[index].code = m_nocode;
+		}
+	}
+}
+
+
 
 /***************************************************************************
     EMITTERS FOR 32-BIT OPERATIONS WITH PARAMETERS
@@ -2830,6 +2913,42 @@ void drcbe_x64::op_hashjmp(x86code *&dst, const instruction &inst)
 	// load the stack base one word early so we end up at the right spot after our call below
 	emit_mov_r64_m64(dst, REG_RSP, MABS(&m_near.hashstacksave));                        // mov   rsp,[hashstacksave]
 
+	// computed targets first try the target this HASHJMP went to last time
+	hashjmp_cache *cache = NULL;
+	if (!pcp.is_immediate())
+	{
+		assert(m_hashjmp_free > 0);
+		cache = m_hashjmp_next++;
+		m_hashjmp_free--;
+		cache->key = ~U64(0);
+		cache->code = m_nocode;
+
+		// build the mode/PC key in r8
+		emit_mov_r32_p32(dst, REG_EAX, pcp);                                            // mov   eax,pcp
+		if (!modep.is_immediate())
+		{
+			emit_mov_r32_p32(dst, REG_R8D, modep);                                      // mov   r8d,modep
+			emit_shl_r64_imm(dst, REG_R8, 32);                                          // shl   r8,32
+			emit_or_r64_r64(dst, REG_R8, REG_RAX);                                      // or    r8,rax
+		}
+		else if (modep.immediate() != 0)
+		{
+			emit_mov_r64_imm(dst, REG_R8, (UINT64)modep.immediate() << 32);             // mov   r8,modep << 32
+			emit_or_r64_r64(dst, REG_R8, REG_RAX);                                      // or    r8,rax
+		}
+		else
+			emit_mov_r32_r32(dst, REG_R8D, REG_EAX);                                    // mov   r8d,eax
+
+		// on a hit, go straight there; a cached nocode returns here and falls into the lookup
+		emit_link miss;
+		emit_cmp_r64_m64(dst, REG_R8, MABS(&cache->key));                               // cmp   r8,[cache.key]
+		emit_jcc_short_link(dst, x64emit::COND_NE, miss);                               // jne   miss
+		emit_add_m64_imm(dst, MABS(&m_near.hashjmp_hits), 1);                           // add   [hashjmp_hits],1
+		emit_call_m64(dst, MABS(&cache->code));                                         // call  [cache.code]
+		resolve_link(dst, miss);                                                    // miss:
+		emit_add_m64_imm(dst, MABS(&m_near.hashjmp_misses), 1);                         // add   [hashjmp_misses],1
+	}
+
 	// fixed mode cases
 	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
 	{
@@ -2851,7 +2970,10 @@ void drcbe_x64::op_hashjmp(x86code *&dst, const instruction &inst)
 			emit_and_r32_imm(dst, REG_EAX, m_hash.l2mask() << m_hash.l2shift());        // and  eax,l2mask << l2shift
 			emit_mov_r64_m64(dst, REG_RDX, MBISD(REG_RBP, REG_RDX, 8, offset_from_rbp(&m_hash.base()[modep.immediate()][0])));
 																						// mov   rdx,hash[modep+edx*8]
-			emit_call_m64(dst, MBISD(REG_RDX, REG_RAX, 8 >> m_hash.l2shift(), 0));      // call  [rdx+rax*shift]
+			emit_mov_r64_m64(dst, REG_RDX, MBISD(REG_RDX, REG_RAX, 8 >> m_hash.l2shift(), 0));// mov   rdx,[rdx+rax*shift]
+			emit_mov_m64_r64(dst, MABS(&cache->key), REG_R8);                           // mov   [cache.key],r8
+			emit_mov_m64_r64(dst, MABS(&cache->code), REG_RDX);                         // mov   [cache.code],rdx
+			emit_call_r64(dst, REG_RDX);                                                // call  rdx
 		}
 	}
 	else
@@ -2879,7 +3001,10 @@ void drcbe_x64::op_hashjmp(x86code *&dst, const instruction &inst)
 			emit_shr_r32_imm(dst, REG_EDX, m_hash.l1shift());                           // shr   edx,l1shift
 			emit_mov_r64_m64(dst, REG_RDX, MBISD(REG_RCX, REG_RDX, 8, 0));              // mov   rdx,[rcx+rdx*8]
 			emit_and_r32_imm(dst, REG_EAX, m_hash.l2mask() << m_hash.l2shift());        // and  eax,l2mask << l2shift
-			emit_call_m64(dst, MBISD(REG_RDX, REG_RAX, 8 >> m_hash.l2shift(), 0));      // call  [rdx+rax*shift]
+			emit_mov_r64_m64(dst, REG_RDX, MBISD(REG_RDX, REG_RAX, 8 >> m_hash.l2shift(), 0));// mov   rdx,[rdx+rax*shift]
+			emit_mov_m64_r64(dst, MABS(&cache->key), REG_R8);                           // mov   [cache.key],r8
+			emit_mov_m64_r64(dst, MABS(&cache->code), REG_RDX);                         // mov   [cache.code],rdx
+			emit_call_r64(dst, REG_RDX);                                                // call  rdx
 		}
 	}
 
@@ -42,6 +42,7 @@ public:
 	virtual bool hash_exists(UINT32 mode, UINT32 pc);
 	virtual void get_info(drcbe_info &info);
 	virtual bool logging() const { return m_log != NULL; }
+	virtual void get_stats(drcuml_stats &stats);
 
 private:
 	// a be_parameter is similar to a uml::parameter but maps to native registers/memory
@@ -290,6 +291,23 @@ private:
 	void emit_movsd_r128_p64(x86code *&dst, UINT8 reg, const be_parameter &param);
 	void emit_movsd_p64_r128(x86code *&dst, const be_parameter &param, UINT8 reg);
 
+	// inline cache for a HASHJMP with a computed target
+	struct hashjmp_cache
+	{
+		UINT64              key;                    // (mode << 32) | PC of the last target, or ~0
+		x86code *           code;                   // code pointer looked up for that target
+	};
+
+	struct hashjmp_cache_chunk
+	{
+		hashjmp_cache *     base;                   // first cache in the chunk
+		UINT32              count;                  // number of caches in the chunk
+	};
+
+	// inline cache management
+	void reserve_hashjmp_caches(drcuml_block &block, const uml::instruction *instlist, UINT32 numinst);
+	void flush_hashjmp_caches();
+
 	// internal state
 	drc_hash_table          m_hash;                 // hash table state
 	drc_map_variables       m_map;                  // code map
@@ -308,6 +326,10 @@ private:
 	drc_label_fixup_delegate m_fixup_label;         // precomputed delegate for fixups
 	drc_oob_delegate        m_fixup_exception;      // precomputed delegate for exception fixups
 
+	std::vector<hashjmp_cache_chunk> m_hashjmp_chunks;  // chunks of inline caches in the code cache
+	hashjmp_cache *         m_hashjmp_next;         // next free inline cache
+	UINT32                  m_hashjmp_free;         // number of free inline caches left in the chunk
+
 	// state to live in the near cache
 	struct near_state
 	{
@@ -324,6 +346,8 @@ private:
 
 		void *              stacksave;              // saved stack pointer
 		void *              hashstacksave;          // saved stack pointer for hashjmp
+		UINT64              hashjmp_hits;           // computed hashjmps that hit their inline cache
+		UINT64              hashjmp_misses;         // computed hashjmps that walked the hash tables
 
 		UINT8               flagsmap[0x1000];       // flags map
 		UINT64              flagsunmap[0x20];       // flags unmapper
@@ -52,6 +52,7 @@ drc_frontend::drc_frontend(device_t &cpu, UINT32 window_start, UINT32 window_end
 	: m_window_start(window_start),
 		m_window_end(window_end),
 		m_max_sequence(max_sequence),
+		m_superblocks(false),
 		m_cpudevice(downcast<cpu_device &>(cpu)),
 		m_program(m_cpudevice.space(AS_PROGRAM)),
 		m_pageshift(m_cpudevice.space_config(AS_PROGRAM)->m_page_shift),
@@ -254,6 +255,7 @@ void drc_frontend::build_sequence(int start, int end, UINT32 endflag)
 			}
 
 			// if we are the last instruction, indicate end-of-sequence and redispatch
+			bool sidejoin = false;
 			if (nextdesc == NULL)
 			{
 				curdesc->flags |= OPFLAG_END_SEQUENCE;
@@ -276,9 +278,15 @@ void drc_frontend::build_sequence(int start, int end, UINT32 endflag)
 				if (scandesc != nextdesc)
 					curdesc->flags |= OPFLAG_END_SEQUENCE;
 
-				// if the next instruction is a branch target, mark this instruction as end of sequence
+				// if the next instruction is a branch target, mark this instruction as end of sequence;
+				// when building superblocks, keep going through it unless we expect to branch away
 				if (nextdesc->flags & OPFLAG_IS_BRANCH_TARGET)
-					curdesc->flags |= OPFLAG_END_SEQUENCE;
+				{
+					if (m_superblocks && curdesc->skipslots == 0 && !predict_taken(*curdesc))
+						sidejoin = true;
+					else
+						curdesc->flags |= OPFLAG_END_SEQUENCE;
+				}
 			}
 
 			// if we exceed the maximum consecutive count, cut off the sequence
@@ -287,6 +295,10 @@ void drc_frontend::build_sequence(int start, int end, UINT32 endflag)
 			if (curdesc->flags & OPFLAG_END_SEQUENCE)
 				consecutive = 0;
 
+			// if the sequence carries on through a branch target, it becomes a side entry
+			else if (sidejoin)
+				nextdesc->flags |= OPFLAG_SIDE_ENTRY;
+
 			// if this is the end of a sequence, work backwards
 			if (curdesc->flags & OPFLAG_END_SEQUENCE)
 			{
@@ -325,6 +337,23 @@ void drc_frontend::build_sequence(int start, int end, UINT32 endflag)
 }
 
 
+//-------------------------------------------------
+//  predict_taken - statically predict whether
+//  control leaves the fall-through path after
+//  this instruction; backward conditional
+//  branches are assumed to close loops
+//-------------------------------------------------
+
+bool drc_frontend::predict_taken(const opcode_desc &desc) const
+{
+	if (desc.flags & OPFLAG_IS_UNCONDITIONAL_BRANCH)
+		return true;
+	if (desc.flags & OPFLAG_IS_CONDITIONAL_BRANCH)
+		return (desc.targetpc != BRANCH_TARGET_DYNAMIC && desc.targetpc <= desc.pc);
+	return false;
+}
+
+
 //-------------------------------------------------
 //  accumulate_required_backwards - recursively
 //  accumulate live register liveness information
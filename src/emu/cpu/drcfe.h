@@ -27,6 +27,14 @@
     walkthrough is finished, these descriptions are assembled together into
     a linked list and returned for further processing by the backend.
 
+    Frontends may optionally request "superblocks". In this mode, sequences
+    are no longer cut at every branch target inside the window. Instead
+    the sequence runs on along the predicted path, and join points are
+    flagged with OPFLAG_SIDE_ENTRY. The backend flushes cycles, labels
+    these points, and gives them a hash entry, so branches from within the
+    block and from other blocks can still land there. Conditional branches
+    inside a superblock become its side exits.
+
 ***************************************************************************/
 
 #pragma once
@@ -73,6 +81,7 @@ const UINT32 OPFLAG_REDISPATCH              = 0x00010000;       // instruction m
 const UINT32 OPFLAG_RETURN_TO_START         = 0x00020000;       // instruction must jump back to the beginning after completion
 const UINT32 OPFLAG_END_SEQUENCE            = 0x00040000;       // this is the last instruction in a sequence
 const UINT32 OPFLAG_CAN_CHANGE_MODES        = 0x00080000;       // instruction can change modes
+const UINT32 OPFLAG_SIDE_ENTRY              = 0x00400000;       // instruction is a branch target in the middle of a superblock
 
 // execution semantics
 const UINT32 OPFLAG_READS_MEMORY            = 0x00100000;       // instruction reads memory
@@ -130,6 +139,9 @@ public:
 	drc_frontend(device_t &cpu, UINT32 window_start, UINT32 window_end, UINT32 max_sequence);
 	virtual ~drc_frontend();
 
+	// configuration
+	void set_superblocks(bool enable) { m_superblocks = enable; }
+
 	// describe a block
 	const opcode_desc *describe_code(offs_t startpc);
 
@@ -141,6 +153,7 @@ private:
 	// internal helpers
 	opcode_desc *describe_one(offs_t curpc, const opcode_desc *prevdesc);
 	void build_sequence(int start, int end, UINT32 endflag);
+	bool predict_taken(const opcode_desc &desc) const;
 	void accumulate_required_backwards(opcode_desc &desc, UINT32 *reqmask);
 	void release_descriptions();
 
@@ -148,6 +161,7 @@ private:
 	UINT32              m_window_start;             // code window start offset = startpc - window_start
 	UINT32              m_window_end;               // code window end offset = startpc + window_end
 	UINT32              m_max_sequence;             // maximum instructions to include in a sequence
+	bool                m_superblocks;              // run sequences through branch targets
 
 	// CPU parameters
 	cpu_device &        m_cpudevice;                // CPU device object
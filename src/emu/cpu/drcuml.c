@@ -53,10 +53,46 @@ using namespace uml;
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// maximum number of register/memory pairings tracked by the optimizer
+const int MAX_MEMORY_ALIASES = 16;
+
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+// what the optimizer knows about the contents of an integer register
+struct optimizer_value
+{
+	bool                    known;              // value is known
+	UINT8                   size;               // number of low bytes that are known
+	UINT64                  value;              // the known value
+};
+
+
+// a pairing of an integer register with the memory it was loaded from or stored to
+struct optimizer_alias
+{
+	int                     ireg;               // integer register, or -1 if unused
+	UINT8                   size;               // size of the access
+	const UINT8 *           base;               // base of the memory
+};
+
+// state the optimizer pass tests run against
+struct pass_test_state
+{
+	UINT32                  r[8];               // 32-bit CPU registers
+	UINT64                  d[2];               // 64-bit CPU registers
+	UINT32                  in[REG_I_COUNT];    // UML integer registers on entry
+	UINT32                  out[REG_I_COUNT];   // UML integer registers on exit
+	UINT32                  calls;              // number of times the C callback ran
+};
+
 // structure describing back-end validation test
 struct bevalidate_test
 {
@@ -121,11 +157,14 @@ drcbe_interface::~drcbe_interface()
 drcuml_state::drcuml_state(device_t &device, drc_cache &cache, UINT32 flags, int modes, int addrbits, int ignorebits)
 	: m_device(device),
 		m_cache(cache),
+		m_flags(flags | (device.machine().options().drc_passes() ? DRCUML_OPTION_PASSES : 0)),
 		m_beintf(device.machine().options().drc_use_c() ?
 			*static_cast<drcbe_interface *>(auto_alloc(device.machine(), drcbe_c(*this, device, cache, flags, modes, addrbits, ignorebits))) :
 			*static_cast<drcbe_interface *>(auto_alloc(device.machine(), drcbe_native(*this, device, cache, flags, modes, addrbits, ignorebits)))),
 		m_umllog(NULL)
 {
+	memset(&m_stats, 0, sizeof(m_stats));
+
 	// if we're to log, create the logfile
 	if (device.machine().options().drc_log_uml())
 	{
@@ -141,6 +180,24 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, UINT32 flags, int
 
 drcuml_state::~drcuml_state()
 {
+	// report how well blocks chained together
+	m_beintf.get_stats(m_stats);
+	if (m_stats.blocks != 0)
+	{
+		UINT64 fixed = m_stats.chain_hits + m_stats.chain_misses;
+		osd_printf_verbose("%s: DRC generated %d blocks, %d entries, %d instructions, %d flushes\n", m_device.tag(),
+				(UINT32)m_stats.blocks, (UINT32)m_stats.entries, (UINT32)m_stats.instructions, (UINT32)m_stats.flushes);
+		osd_printf_verbose("%s: DRC chained %d of %d fixed-target jumps (%d%%), %d local jumps, %d dynamic jumps\n", m_device.tag(),
+				(UINT32)m_stats.chain_hits, (UINT32)fixed, (fixed != 0) ? (UINT32)(m_stats.chain_hits * 100 / fixed) : 0,
+				(UINT32)m_stats.local_jumps, (UINT32)m_stats.dynamic_jumps);
+		UINT64 dynamic = m_stats.dynamic_predicted + m_stats.dynamic_lookups;
+		if (dynamic != 0)
+			osd_printf_verbose("%s: DRC predicted %d of %d dynamic jumps at run time (%d%%)\n", m_device.tag(),
+					(UINT32)m_stats.dynamic_predicted, (UINT32)dynamic, (UINT32)(m_stats.dynamic_predicted * 100 / dynamic));
+		osd_printf_verbose("%s: DRC optimizer propagated %d values, removed %d loads/stores and %d dead instructions\n", m_device.tag(),
+				(UINT32)m_stats.propagated, (UINT32)m_stats.loads_stores, (UINT32)m_stats.dead);
+	}
+
 	// free the back-end
 	auto_free(m_device.machine(), &m_beintf);
 
@@ -160,8 +217,23 @@ void drcuml_state::reset()
 	// if we error here, we are screwed
 	try
 	{
+		// check the optimizer passes against unoptimized code once, if they are enabled,
+		// and time them as well when running verbose
+		if (m_flags & DRCUML_OPTION_PASSES)
+		{
+			static bool passes_validated = false;
+			if (!passes_validated)
+			{
+				passes_validated = true;
+				validate_passes();
+				if (m_device.machine().options().verbose())
+					benchmark_passes();
+			}
+		}
+
 		// flush the cache
 		m_cache.flush();
+		m_stats.flushes++;
 
 		// reset all handle code pointers
 		for (code_handle *handle = m_handlelist.first(); handle != NULL; handle = handle->next())
@@ -210,6 +282,339 @@ drcuml_block *drcuml_state::begin_block(UINT32 maxinst)
 }
 
 
+//-------------------------------------------------
+//  update_stats - account for a block that is
+//  about to be generated; fixed-target hash
+//  jumps count as chained if their target is
+//  already in the hash table or in this block
+//-------------------------------------------------
+
+void drcuml_state::update_stats(const instruction *instructions, UINT32 count)
+{
+	m_stats.blocks++;
+	m_stats.instructions += count;
+
+	for (UINT32 instnum = 0; instnum < count; instnum++)
+	{
+		const instruction &inst = instructions[instnum];
+		switch (inst.opcode())
+		{
+			case OP_HASH:
+				m_stats.entries++;
+				break;
+
+			case OP_JMP:
+				m_stats.local_jumps++;
+				break;
+
+			case OP_HASHJMP:
+				if (inst.param(0).is_immediate() && inst.param(1).is_immediate())
+				{
+					UINT32 mode = inst.param(0).immediate();
+					UINT32 pc = inst.param(1).immediate();
+					bool found = hash_exists(mode, pc);
+					for (UINT32 scannum = 0; scannum < count && !found; scannum++)
+						if (instructions[scannum].opcode() == OP_HASH && instructions[scannum].param(0).immediate() == mode && instructions[scannum].param(1).immediate() == pc)
+							found = true;
+					if (found)
+						m_stats.chain_hits++;
+					else
+						m_stats.chain_misses++;
+				}
+				else
+					m_stats.dynamic_jumps++;
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  benchmark_passes - compile and run a canned
+//  block with and without the optimizer passes
+//  on whichever backend is active; run once
+//  with -drc_use_c to compare against the C
+//  backend
+//-------------------------------------------------
+
+void drcuml_state::benchmark_passes()
+{
+	const int iterations = 1000;
+	const int runs = 1000;
+
+	// a small register file, laid out like a CPU core's state
+	struct bench_state
+	{
+		UINT32  r[8];
+		UINT32  count;
+	};
+	bench_state *state = (bench_state *)m_cache.alloc_near(sizeof(*state));
+	code_handle &entry = *handle_alloc("bench_entry");
+	UINT32 origflags = m_flags;
+
+	osd_printf_verbose("%s: UML optimizer pass benchmark on the %s backend\n", m_device.tag(), m_device.machine().options().drc_use_c() ? "C" : "native");
+	for (int passes = 0; passes < 2; passes++)
+	{
+		if (passes)
+			m_flags |= DRCUML_OPTION_PASSES;
+		else
+			m_flags &= ~DRCUML_OPTION_PASSES;
+
+		// flush everything from the previous round
+		m_cache.flush();
+		*entry.m_code = NULL;
+		m_beintf.reset();
+		drcuml_stats before = m_stats;
+
+		// the canned block is the kind of code frontends emit for simple ALU instructions:
+		// every instruction loads its operands and stores its result
+		osd_ticks_t compile = osd_ticks();
+		drcuml_block *block = begin_block(64);
+		block->append().handle(entry);
+		block->append().mov(mem(&state->count), iterations);
+		block->append().label(1);
+		block->append().mov(I0, mem(&state->r[1]));
+		block->append().add(I0, I0, mem(&state->r[2]));
+		block->append().mov(mem(&state->r[1]), I0);
+		block->append().mov(I1, 4);
+		block->append().mov(I0, mem(&state->r[1]));
+		block->append().shl(I2, I0, I1);
+		block->append().mov(mem(&state->r[3]), I2);
+		block->append().mov(I2, mem(&state->r[3]));
+		block->append()._and(I2, I2, 0xff);
+		block->append().mov(mem(&state->r[4]), I2);
+		block->append().mov(I3, 0);
+		block->append().mov(I3, mem(&state->r[4]));
+		block->append().add(I3, I3, I1);
+		block->append().mov(mem(&state->r[5]), I3);
+		block->append().sub(mem(&state->count), mem(&state->count), 1);
+		block->append().jmp(COND_NZ, code_label(1));
+		block->append().exit(0);
+		block->append().mov(I0, 0);
+		block->end();
+		compile = osd_ticks() - compile;
+
+		// run it
+		osd_ticks_t run = osd_ticks();
+		for (int runnum = 0; runnum < runs; runnum++)
+		{
+			memset(state->r, 0, sizeof(state->r));
+			state->r[2] = runnum;
+			execute(entry);
+		}
+		run = osd_ticks() - run;
+
+		osd_printf_verbose("%s: %s passes: compile %d us, %d runs of %d iterations in %d us; propagated %d, removed %d loads/stores and %d dead instructions\n",
+				m_device.tag(), passes ? "with" : "without", (int)(compile * 1000000 / osd_ticks_per_second()), runs, iterations, (int)(run * 1000000 / osd_ticks_per_second()),
+				(int)(m_stats.propagated - before.propagated), (int)(m_stats.loads_stores - before.loads_stores), (int)(m_stats.dead - before.dead));
+	}
+
+	// put things back the way they were
+	m_flags = origflags;
+	m_cache.flush();
+	*entry.m_code = NULL;
+	m_beintf.reset();
+}
+
+
+//-------------------------------------------------
+//  pass_test_callback - C function called from
+//  the optimizer pass tests; changes memory the
+//  optimizer may have a register copy of
+//-------------------------------------------------
+
+static void pass_test_callback(void *param)
+{
+	pass_test_state *state = (pass_test_state *)param;
+	state->r[2] += 0x1111;
+	state->calls++;
+}
+
+
+//-------------------------------------------------
+//  generate_pass_test - append the body of one
+//  of the optimizer pass tests to a block; each
+//  one targets something the passes must not
+//  get wrong
+//-------------------------------------------------
+
+static void generate_pass_test(drcuml_block *block, int testnum, pass_test_state *state)
+{
+	switch (testnum)
+	{
+		// load/operate/store chains with redundant reloads and dead register writes
+		case 0:
+			block->append().mov(I0, mem(&state->r[1]));
+			block->append().add(I0, I0, mem(&state->r[2]));
+			block->append().mov(mem(&state->r[1]), I0);
+			block->append().mov(I1, 4);
+			block->append().mov(I0, mem(&state->r[1]));
+			block->append().shl(I2, I0, I1);
+			block->append().mov(mem(&state->r[3]), I2);
+			block->append().mov(I2, mem(&state->r[3]));
+			block->append()._and(I2, I2, 0xff);
+			block->append().mov(mem(&state->r[4]), I2);
+			block->append().mov(I3, 0);
+			block->append().mov(I3, mem(&state->r[4]));
+			block->append().add(I3, I3, I1);
+			block->append().mov(mem(&state->r[5]), I3);
+			break;
+
+		// constants moving between registers and folding through 32- and 64-bit operations
+		case 1:
+			block->append().mov(I0, 0x89abcdef);
+			block->append().mov(I1, I0);
+			block->append().add(I1, I1, 0x10);
+			block->append().dmov(I4, mem(&state->d[0]));
+			block->append().dadd(I4, I4, I4);
+			block->append().dmov(mem(&state->d[1]), I4);
+			block->append().mov(I2, I1);
+			block->append().shr(I2, I2, 4);
+			block->append().sub(I3, I2, mem(&state->r[0]));
+			block->append().mov(mem(&state->r[6]), I3);
+			break;
+
+		// register copies of memory that later writes to the register or the memory invalidate
+		case 2:
+			block->append().mov(mem(&state->r[1]), I5);
+			block->append().add(I5, I5, 1);
+			block->append().mov(I6, mem(&state->r[1]));
+			block->append().dmov(I7, mem(&state->d[0]));
+			block->append().mov(mem(&state->d[0]), I6);
+			block->append().dmov(I8, mem(&state->d[0]));
+			block->append().dmov(mem(&state->d[1]), I8);
+			block->append().mov(I9, mem(&state->r[1]));
+			block->append().mov(mem(&state->r[7]), I9);
+			break;
+
+		// flags that later instructions consume, conditional moves and labels
+		case 3:
+			block->append().mov(I0, mem(&state->r[0]));
+			block->append().add(I1, I0, mem(&state->r[1]));
+			block->append().set(COND_C, I2);
+			block->append().mov(I3, 7);
+			block->append().cmp(I0, mem(&state->r[2]));
+			block->append().jmp(COND_A, code_label(1));
+			block->append().mov(I3, 9);
+			block->append().mov(mem(&state->r[3]), I3);
+			block->append().label(code_label(1));
+			block->append().add(I3, I3, 1);
+			block->append().mov(mem(&state->r[4]), I3);
+			block->append().mov(I4, 5);
+			block->append().cmp(I0, mem(&state->r[3]));
+			block->append().mov(COND_Z, I4, I0);
+			block->append().sub(I5, I0, I1);
+			block->append().jmp(COND_NZ, code_label(2));
+			block->append().mov(I6, 1);
+			block->append().label(code_label(2));
+			block->append().add(I6, I6, I4);
+			block->append().mov(mem(&state->r[5]), I6);
+			break;
+
+		// C calls and indexed stores that change memory behind the optimizer's back
+		case 4:
+			block->append().mov(I0, mem(&state->r[2]));
+			block->append().mov(mem(&state->r[2]), I0);
+			block->append().callc(pass_test_callback, state);
+			block->append().mov(I1, mem(&state->r[2]));
+			block->append().mov(I2, 3);
+			block->append().mov(I4, mem(&state->r[3]));
+			block->append().store(state->r, I2, I1, SIZE_DWORD, SCALE_x4);
+			block->append().mov(I3, mem(&state->r[3]));
+			block->append().add(I3, I3, I1);
+			block->append().mov(mem(&state->r[5]), I3);
+			block->append().mov(mem(&state->r[6]), I4);
+			break;
+	}
+}
+
+
+//-------------------------------------------------
+//  validate_passes - compile each optimizer pass
+//  test with and without the passes, run both
+//  from the same random starting state on the
+//  active backend, and stop if the registers or
+//  memory they leave behind differ; run with
+//  -drc_use_c to check on the C backend
+//-------------------------------------------------
+
+void drcuml_state::validate_passes()
+{
+	const int tests = 5;
+	const int seeds = 16;
+
+	pass_test_state *state = (pass_test_state *)m_cache.alloc_near(sizeof(*state));
+	code_handle *entry[2] = { handle_alloc("pass_test_plain"), handle_alloc("pass_test_optimized") };
+	UINT32 origflags = m_flags;
+	UINT32 seed = 1;
+	drcuml_stats before = m_stats;
+
+	for (int testnum = 0; testnum < tests; testnum++)
+	{
+		// compile the test both ways
+		m_cache.flush();
+		*entry[0]->m_code = *entry[1]->m_code = NULL;
+		m_beintf.reset();
+		for (int passes = 0; passes < 2; passes++)
+		{
+			if (passes)
+				m_flags = origflags | DRCUML_OPTION_PASSES;
+			else
+				m_flags = origflags & ~DRCUML_OPTION_PASSES;
+
+			drcuml_block *block = begin_block(128);
+			block->append().handle(*entry[passes]);
+			for (int regnum = 0; regnum < REG_I_COUNT; regnum++)
+				block->append().mov(ireg(regnum), mem(&state->in[regnum]));
+			generate_pass_test(block, testnum, state);
+			for (int regnum = 0; regnum < REG_I_COUNT; regnum++)
+				block->append().mov(mem(&state->out[regnum]), ireg(regnum));
+			block->append().exit(0);
+			block->end();
+		}
+		m_flags = origflags;
+
+		// run both from the same random states and compare what they leave behind
+		for (int seednum = 0; seednum < seeds; seednum++)
+		{
+			pass_test_state initial, expected;
+			UINT32 *words = (UINT32 *)&initial;
+			for (int wordnum = 0; wordnum < sizeof(initial) / sizeof(UINT32); wordnum++)
+			{
+				seed = seed * 1103515245 + 12345;
+				UINT32 upper = seed >> 16;
+				seed = seed * 1103515245 + 12345;
+				words[wordnum] = (upper << 16) | (seed >> 16);
+			}
+
+			// make some of the compares come out equal
+			if (seednum & 1)
+				initial.r[2] = initial.r[3] = initial.r[0];
+
+			// copy the whole thing, padding included, so memcmp sees only what the code did
+			memcpy(state, &initial, sizeof(initial));
+			execute(*entry[0]);
+			memcpy(&expected, state, sizeof(expected));
+			memcpy(state, &initial, sizeof(initial));
+			execute(*entry[1]);
+			if (memcmp(&expected, state, sizeof(expected)) != 0)
+				fatalerror("UML optimizer passes changed the result of test %d (seed %d)\n", testnum, seednum);
+		}
+	}
+	osd_printf_verbose("%s: UML optimizer passes matched unoptimized code in %d tests from %d states each on the %s backend; propagated %d, removed %d loads/stores and %d dead instructions\n",
+			m_device.tag(), tests, seeds, m_device.machine().options().drc_use_c() ? "C" : "native",
+			(int)(m_stats.propagated - before.propagated), (int)(m_stats.loads_stores - before.loads_stores), (int)(m_stats.dead - before.dead));
+
+	// put things back the way they were
+	m_cache.flush();
+	*entry[0]->m_code = *entry[1]->m_code = NULL;
+	m_beintf.reset();
+}
+
+
 //-------------------------------------------------
 //  handle_alloc - allocate a new handle
 //-------------------------------------------------
@@ -339,7 +744,8 @@ void drcuml_block::end()
 	if (m_drcuml.logging())
 		disassemble();
 
-	// generate the code via the back-end
+	// account for the block, then generate the code via the back-end
+	m_drcuml.update_stats(&m_inst[0], m_nextinst);
 	m_drcuml.generate(*this, &m_inst[0], m_nextinst);
 
 	// block is no longer in use
@@ -447,6 +853,288 @@ void drcuml_block::optimize()
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
 	}
+
+	// run the optimizer passes
+	if (m_drcuml.flags() & DRCUML_OPTION_PASSES)
+	{
+		propagate_values();
+		eliminate_dead_code();
+	}
+}
+
+
+//-------------------------------------------------
+//  propagate_values - forward pass that replaces
+//  register reads with known constants and
+//  removes loads and stores that move a value
+//  between a register and memory that already
+//  match; knowledge is dropped at every point
+//  that can be entered from elsewhere
+//-------------------------------------------------
+
+void drcuml_block::propagate_values()
+{
+	optimizer_value regs[REG_I_COUNT];
+	optimizer_alias aliases[MAX_MEMORY_ALIASES];
+	memset(regs, 0, sizeof(regs));
+	for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+		aliases[anum].ireg = -1;
+
+	drcuml_stats &stats = m_drcuml.stats();
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		instruction &inst = m_inst[instnum];
+		bool forget_memory = false;
+		bool forget_regs = false;
+
+		switch (inst.opcode())
+		{
+			// nothing to learn from these
+			case OP_NOP:
+			case OP_COMMENT:
+			case OP_MAPVAR:
+				continue;
+
+			// entry points: code can arrive here from anywhere
+			case OP_HANDLE:
+			case OP_HASH:
+			case OP_LABEL:
+				memset(regs, 0, sizeof(regs));
+				for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+					aliases[anum].ireg = -1;
+				continue;
+
+			// indexed stores, C code and memory handlers may touch any memory; handlers may touch anything
+			case OP_STORE:
+			case OP_FSTORE:
+			case OP_CALLC:
+			case OP_READ:
+			case OP_READM:
+			case OP_WRITE:
+			case OP_WRITEM:
+			case OP_FREAD:
+			case OP_FWRITE:
+			case OP_SAVE:
+				forget_memory = true;
+				break;
+
+			case OP_CALLH:
+			case OP_EXH:
+			case OP_RECOVER:
+			case OP_RESTORE:
+			case OP_DEBUG:
+				forget_memory = forget_regs = true;
+				break;
+
+			default:
+				break;
+		}
+
+		// replace register reads with their known values
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param(pnum).is_int_register() && inst.param_is_input(pnum) && !inst.param_is_output(pnum) && inst.param_allows_immediate(pnum))
+			{
+				const optimizer_value &reg = regs[inst.param(pnum).ireg() - REG_I0];
+				int size = inst.param_size(pnum);
+				if (reg.known && reg.size >= size)
+				{
+					inst.set_param(pnum, (size == 8) ? reg.value : (reg.value & ((U64(1) << (8 * size)) - 1)));
+					stats.propagated++;
+				}
+			}
+		inst.simplify();
+
+		// look for loads and stores that don't change anything
+		if (inst.opcode() == OP_MOV && inst.condition() == COND_ALWAYS)
+		{
+			const parameter &dst = inst.param(0);
+			const parameter &src = inst.param(1);
+			const parameter &reg = dst.is_int_register() ? dst : src;
+			const parameter &mem = dst.is_int_register() ? src : dst;
+			if (reg.is_int_register() && mem.is_memory())
+			{
+				for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+					if (aliases[anum].ireg != -1 && aliases[anum].base == mem.memory() && aliases[anum].size == inst.size())
+					{
+						// same register: the move is redundant
+						if (aliases[anum].ireg == reg.ireg())
+						{
+							inst.nop();
+							stats.loads_stores++;
+							break;
+						}
+
+						// another register holds the value: load from it instead
+						if (dst.is_int_register())
+						{
+							inst.set_param(1, parameter::make_ireg(aliases[anum].ireg));
+							stats.loads_stores++;
+							break;
+						}
+					}
+				if (inst.opcode() == OP_NOP)
+					continue;
+			}
+		}
+
+		// forget everything this instruction can overwrite
+		if (forget_regs)
+			memset(regs, 0, sizeof(regs));
+		if (forget_regs || forget_memory)
+			for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+				aliases[anum].ireg = -1;
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param_is_output(pnum))
+			{
+				const parameter &param = inst.param(pnum);
+				if (param.is_int_register())
+				{
+					regs[param.ireg() - REG_I0].known = false;
+					for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+						if (aliases[anum].ireg == param.ireg())
+							aliases[anum].ireg = -1;
+				}
+				else if (param.is_memory())
+				{
+					const UINT8 *base = (const UINT8 *)param.memory();
+					int size = inst.param_size(pnum);
+					for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+						if (aliases[anum].ireg != -1 && aliases[anum].base < base + size && base < aliases[anum].base + aliases[anum].size)
+							aliases[anum].ireg = -1;
+				}
+			}
+
+		// learn from unconditional moves
+		if (inst.opcode() == OP_MOV && inst.condition() == COND_ALWAYS)
+		{
+			const parameter &dst = inst.param(0);
+			const parameter &src = inst.param(1);
+			if (dst.is_int_register() && src.is_immediate())
+			{
+				optimizer_value &reg = regs[dst.ireg() - REG_I0];
+				reg.known = true;
+				reg.size = inst.size();
+				reg.value = src.immediate();
+			}
+			else if ((dst.is_int_register() && src.is_memory()) || (dst.is_memory() && src.is_int_register()))
+			{
+				const parameter &reg = dst.is_int_register() ? dst : src;
+				const parameter &mem = dst.is_int_register() ? src : dst;
+				for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+					if (aliases[anum].ireg == -1)
+					{
+						aliases[anum].ireg = reg.ireg();
+						aliases[anum].size = inst.size();
+						aliases[anum].base = (const UINT8 *)mem.memory();
+						break;
+					}
+			}
+		}
+
+		// nothing carries past an unconditional change of flow
+		if (inst.condition() == COND_ALWAYS && (inst.opcode() == OP_JMP || inst.opcode() == OP_EXIT || inst.opcode() == OP_HASHJMP || inst.opcode() == OP_RET))
+		{
+			memset(regs, 0, sizeof(regs));
+			for (int anum = 0; anum < MAX_MEMORY_ALIASES; anum++)
+				aliases[anum].ireg = -1;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  eliminate_dead_code - remove instructions
+//  that can never execute, and register writes
+//  that are overwritten before anything reads
+//  them
+//-------------------------------------------------
+
+void drcuml_block::eliminate_dead_code()
+{
+	drcuml_stats &stats = m_drcuml.stats();
+	bool reachable = true;
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		instruction &inst = m_inst[instnum];
+
+		// anything that can be jumped to is reachable again
+		opcode_t opcode = inst.opcode();
+		if (opcode == OP_HANDLE || opcode == OP_HASH || opcode == OP_LABEL)
+		{
+			reachable = true;
+			continue;
+		}
+
+		// comments and mapvars stay in place; the latter still define values for what follows
+		if (opcode == OP_NOP || opcode == OP_COMMENT || opcode == OP_MAPVAR)
+			continue;
+
+		// drop anything that follows an unconditional change of flow
+		if (!reachable)
+		{
+			inst.nop();
+			stats.dead++;
+			continue;
+		}
+		if (inst.condition() == COND_ALWAYS && (opcode == OP_JMP || opcode == OP_EXIT || opcode == OP_HASHJMP || opcode == OP_RET))
+		{
+			reachable = false;
+			continue;
+		}
+
+		// only consider simple, unconditional register writes that nobody looks at the flags of
+		if (inst.condition() != COND_ALWAYS || inst.flags() != 0 || inst.numparams() == 0 || !inst.param(0).is_int_register())
+			continue;
+		switch (opcode)
+		{
+			case OP_MOV:    case OP_SET:    case OP_SEXT:   case OP_ROLAND:
+			case OP_ADD:    case OP_SUB:    case OP_AND:    case OP_OR:
+			case OP_XOR:    case OP_SHL:    case OP_SHR:    case OP_SAR:
+			case OP_ROL:    case OP_ROR:    case OP_LZCNT:  case OP_BSWAP:
+				break;
+
+			default:
+				continue;
+		}
+
+		// scan forward within the straight-line code for the next use or redefinition
+		const parameter &target = inst.param(0);
+		for (int scannum = instnum + 1; scannum < m_nextinst; scannum++)
+		{
+			const instruction &scan = m_inst[scannum];
+			opcode_t scanop = scan.opcode();
+			if (scanop == OP_NOP || scanop == OP_COMMENT || scanop == OP_MAPVAR)
+				continue;
+
+			// anything that leaves the straight line, or that may look at all registers, keeps us alive
+			if (scanop == OP_HANDLE || scanop == OP_HASH || scanop == OP_LABEL || scanop == OP_JMP || scanop == OP_EXIT ||
+				scanop == OP_HASHJMP || scanop == OP_RET || scanop == OP_CALLH || scanop == OP_EXH || scanop == OP_CALLC ||
+				scanop == OP_DEBUG || scanop == OP_SAVE || scanop == OP_RESTORE || scanop == OP_RECOVER)
+				break;
+
+			// if the register is read, we're alive
+			bool reads = false, writes = false;
+			for (int pnum = 0; pnum < scan.numparams(); pnum++)
+				if (scan.param(pnum) == target)
+				{
+					if (scan.param_is_input(pnum))
+						reads = true;
+					if (scan.param_is_output(pnum) && scan.param_size(pnum) >= inst.size())
+						writes = true;
+				}
+			if (reads)
+				break;
+
+			// if it's fully overwritten first, we're dead
+			if (writes && scan.condition() == COND_ALWAYS)
+			{
+				inst.nop();
+				stats.dead++;
+				break;
+			}
+		}
+	}
 }
 
 
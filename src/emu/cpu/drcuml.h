@@ -22,7 +22,7 @@
 //**************************************************************************
 
 // these options are passed into drcuml_alloc() and control global behaviors
-
+const UINT32 DRCUML_OPTION_PASSES           = 0x0001;       // run the optimizer passes after flag analysis and simplification
 
 
 //**************************************************************************
@@ -86,6 +86,25 @@ struct drcbe_info
 };
 
 
+// statistics gathered as blocks are committed to the cache
+struct drcuml_stats
+{
+	UINT64              blocks;             // number of blocks generated
+	UINT64              instructions;       // number of UML instructions generated
+	UINT64              entries;            // number of hash entry points created
+	UINT64              flushes;            // number of full cache resets
+	UINT64              local_jumps;        // jumps resolved to labels within their block
+	UINT64              chain_hits;         // fixed hash jumps whose target was already generated
+	UINT64              chain_misses;       // fixed hash jumps whose target must be looked up later
+	UINT64              dynamic_jumps;      // hash jumps with a computed mode or PC
+	UINT64              dynamic_predicted;  // dynamic hash jumps taken through an inline cache (run time)
+	UINT64              dynamic_lookups;    // dynamic hash jumps that walked the hash tables (run time)
+	UINT64              propagated;         // register reads replaced by known values
+	UINT64              loads_stores;       // redundant loads and stores removed
+	UINT64              dead;               // dead or unreachable instructions removed
+};
+
+
 // a drcuml_block describes a basic block of instructions
 class drcuml_block
 {
@@ -120,6 +139,8 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void propagate_values();
+	void eliminate_dead_code();
 	void disassemble();
 	const char *get_comment_text(const uml::instruction &inst, std::string &comment);
 
@@ -148,6 +169,7 @@ public:
 	virtual bool hash_exists(UINT32 mode, UINT32 pc) = 0;
 	virtual void get_info(drcbe_info &info) = 0;
 	virtual bool logging() const { return false; }
+	virtual void get_stats(drcuml_stats &stats) { }
 
 protected:
 	// internal state
@@ -171,11 +193,17 @@ public:
 	// getters
 	device_t &device() const { return m_device; }
 	drc_cache &cache() const { return m_cache; }
+	UINT32 flags() const { return m_flags; }
 
 	// reset the state
 	void reset();
 	int execute(uml::code_handle &entry) { return m_beintf.execute(entry); }
 
+	// statistics
+	const drcuml_stats &stats() const { return m_stats; }
+	drcuml_stats &stats() { return m_stats; }
+	void update_stats(const uml::instruction *instructions, UINT32 count);
+
 	// code generation
 	drcuml_block *begin_block(UINT32 maxinst);
 
@@ -198,6 +226,10 @@ public:
 	bool logging_native() const { return m_beintf.logging(); }
 
 private:
+	// internal helpers
+	void benchmark_passes();
+	void validate_passes();
+
 	// symbol class
 	class symbol
 	{
@@ -226,11 +258,13 @@ private:
 	// internal state
 	device_t &                  m_device;           // CPU device we are associated with
 	drc_cache &                 m_cache;            // pointer to the codegen cache
+	UINT32                      m_flags;            // DRCUML_OPTION_* flags
 	drcbe_interface &           m_beintf;           // backend interface pointer
 	FILE *                      m_umllog;           // handle to the UML logfile
 	simple_list<drcuml_block>   m_blocklist;        // list of active blocks
 	simple_list<uml::code_handle> m_handlelist;     // list of active handles
 	simple_list<symbol>         m_symlist;          // list of symbols
+	drcuml_stats                m_stats;            // code generation statistics
 };
 
 
@@ -24,6 +24,20 @@
 
 #include "debug/debugcpu.h"
 
+/***************************************************************************
+    CONFIGURATION
+***************************************************************************/
+
+#define SINGLE_INSTRUCTION_MODE         (0)
+
+/* size of the execution code cache */
+#define CACHE_SIZE                      (32 * 1024 * 1024)
+
+/* compilation boundaries -- how far back/forward does the analysis extend? */
+#define COMPILE_BACKWARDS_BYTES         128
+#define COMPILE_FORWARDS_BYTES          512
+#define COMPILE_MAX_SEQUENCE            64
+
 /* seems to be defined on mingw-gcc */
 #undef i386
 
@@ -44,7 +58,20 @@ i386_device::i386_device(const machine_config &mconfig, const char *tag, device_
 	, m_program_config("program", ENDIANNESS_LITTLE, 32, 32, 0)
 	, m_io_config("io", ENDIANNESS_LITTLE, 32, 16, 0)
 	, m_smiact(*this)
+	, m_cache(CACHE_SIZE + sizeof(internal_i386_state))
+	, m_drcuml(NULL)
+	, m_drcfe(NULL)
+	, m_drcoptions(I386DRC_COMPATIBLE_OPTIONS)
+	, m_drc_core(NULL)
+	, m_cache_dirty(TRUE)
+	, m_drc_tlbmiss_pc(~0)
+	, m_entry(NULL)
+	, m_nocode(NULL)
+	, m_out_of_cycles(NULL)
+	, m_tlb_mismatch(NULL)
+	, m_resync(NULL)
 {
+	m_isdrc = (mconfig.options().drc() && mconfig.options().drc_i386() && !mconfig.m_force_no_drc) ? true : false;
 	m_program_config.m_logaddr_width = 32;
 	m_program_config.m_page_shift = 12;
 }
@@ -55,7 +82,20 @@ i386_device::i386_device(const machine_config &mconfig, device_type type, const
 	, m_program_config("program", ENDIANNESS_LITTLE, program_data_width, program_addr_width, 0)
 	, m_io_config("io", ENDIANNESS_LITTLE, io_data_width, 16, 0)
 	, m_smiact(*this)
+	, m_cache(CACHE_SIZE + sizeof(internal_i386_state))
+	, m_drcuml(NULL)
+	, m_drcfe(NULL)
+	, m_drcoptions(I386DRC_COMPATIBLE_OPTIONS)
+	, m_drc_core(NULL)
+	, m_cache_dirty(TRUE)
+	, m_drc_tlbmiss_pc(~0)
+	, m_entry(NULL)
+	, m_nocode(NULL)
+	, m_out_of_cycles(NULL)
+	, m_tlb_mismatch(NULL)
+	, m_resync(NULL)
 {
+	m_isdrc = (mconfig.options().drc() && mconfig.options().drc_i386() && !mconfig.m_force_no_drc) ? true : false;
 	m_program_config.m_logaddr_width = 32;
 	m_program_config.m_page_shift = 12;
 }
@@ -3293,6 +3333,47 @@ void i386_device::i386_common_init(int tlbsize)
 	m_smiact.resolve_safe();
 
 	m_icountptr = &m_cycles;
+
+	if (m_isdrc)
+	{
+		/* allocate the state shared with generated code from the cache */
+		m_drc_core = (internal_i386_state *)m_cache.alloc_near(sizeof(internal_i386_state));
+		memset(m_drc_core, 0, sizeof(*m_drc_core));
+
+		/* initialize the UML generator */
+		m_drcuml = auto_alloc(machine(), drcuml_state(*this, m_cache, 0, DRCMODE_COUNT, 32, 0));
+
+		/* add symbols for our stuff */
+		m_drcuml->symbol_add(&m_drc_core->pc, sizeof(m_drc_core->pc), "pc");
+		m_drcuml->symbol_add(&m_drc_core->icount, sizeof(m_drc_core->icount), "icount");
+		static const char *const regnames[8] = { "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi" };
+		for (int regnum = 0; regnum < 8; regnum++)
+			m_drcuml->symbol_add(&m_drc_core->r[regnum], sizeof(m_drc_core->r[regnum]), regnames[regnum]);
+		m_drcuml->symbol_add(&m_drc_core->mode, sizeof(m_drc_core->mode), "mode");
+		m_drcuml->symbol_add(&m_drc_core->status, sizeof(m_drc_core->status), "status");
+
+		/* initialize the front-end helper */
+		m_drcfe = auto_alloc(machine(), i386_frontend(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE));
+		m_drcfe->set_superblocks(true);
+
+		/* one recompile counter per 4k page of the linear address space */
+		m_drc_pages.resize(1 << 20, 0);
+
+		/* mark the cache dirty so it is updated on next execute */
+		m_cache_dirty = TRUE;
+	}
+}
+
+void i386_device::device_stop()
+{
+	/* clean up the DRC */
+	if (m_drcfe != NULL)
+		auto_free(machine(), m_drcfe);
+	if (m_drcuml != NULL)
+		auto_free(machine(), m_drcuml);
+
+	/* release the TLB */
+	vtlb_free(m_vtlb);
 }
 
 void i386_device::device_start()
@@ -3696,6 +3777,7 @@ void i386_device::zero_state()
 	memset( m_opcode_bytes, 0, sizeof(m_opcode_bytes) );
 	m_opcode_pc = 0;
 	m_opcode_bytes_length = 0;
+	m_cache_dirty = TRUE;
 }
 
 void i386_device::device_reset()
@@ -3894,10 +3976,63 @@ void i386_device::i386_set_a20_line(int state)
 	}
 	// TODO: how does A20M and the tlb interact
 	vtlb_flush_dynamic(m_vtlb);
+
+	/* compiled code was translated with the old mask */
+	m_cache_dirty = TRUE;
+}
+
+void i386_device::i386_execute_instruction()
+{
+	m_operand_size = m_sreg[CS].d;
+	m_xmm_operand_size = 0;
+	m_address_size = m_sreg[CS].d;
+	m_operand_prefix = 0;
+	m_address_prefix = 0;
+
+	m_ext = 1;
+	int old_tf = m_TF;
+
+	m_segment_prefix = 0;
+	m_prev_eip = m_eip;
+
+	debugger_instruction_hook(this, m_pc);
+
+	if(m_delayed_interrupt_enable != 0)
+	{
+		m_IF = 1;
+		m_delayed_interrupt_enable = 0;
+	}
+#ifdef DEBUG_MISSING_OPCODE
+	m_opcode_bytes_length = 0;
+	m_opcode_pc = m_pc;
+#endif
+	try
+	{
+		i386_decode_opcode();
+		if(m_TF && old_tf)
+		{
+			m_prev_eip = m_eip;
+			m_ext = 1;
+			i386_trap(1,0,0);
+		}
+		if(m_lock && (m_opcode != 0xf0))
+			m_lock = false;
+	}
+	catch(UINT64 e)
+	{
+		m_ext = 1;
+		i386_trap_with_error(e&0xffffffff,0,0,e>>32);
+	}
 }
 
 void i386_device::execute_run()
 {
+	if (m_isdrc)
+	{
+		execute_run_drc();
+		return;
+	}
+
 	int cycles = m_cycles;
 	m_base_cycles = cycles;
 	CHANGE_PC(m_eip);
@@ -3912,46 +4047,7 @@ void i386_device::execute_run()
 	while( m_cycles > 0 )
 	{
 		i386_check_irq_line();
-		m_operand_size = m_sreg[CS].d;
-		m_xmm_operand_size = 0;
-		m_address_size = m_sreg[CS].d;
-		m_operand_prefix = 0;
-		m_address_prefix = 0;
-
-		m_ext = 1;
-		int old_tf = m_TF;
-
-		m_segment_prefix = 0;
-		m_prev_eip = m_eip;
-
-		debugger_instruction_hook(this, m_pc);
-
-		if(m_delayed_interrupt_enable != 0)
-		{
-			m_IF = 1;
-			m_delayed_interrupt_enable = 0;
-		}
-#ifdef DEBUG_MISSING_OPCODE
-		m_opcode_bytes_length = 0;
-		m_opcode_pc = m_pc;
-#endif
-		try
-		{
-			i386_decode_opcode();
-			if(m_TF && old_tf)
-			{
-				m_prev_eip = m_eip;
-				m_ext = 1;
-				i386_trap(1,0,0);
-			}
-			if(m_lock && (m_opcode != 0xf0))
-				m_lock = false;
-		}
-		catch(UINT64 e)
-		{
-			m_ext = 1;
-			i386_trap_with_error(e&0xffffffff,0,0,e>>32);
-		}
+		i386_execute_instruction();
 	}
 	m_tsc += (cycles - m_cycles);
 }
@@ -4523,3 +4619,5 @@ void pentium4_device::device_reset()
 
 	CHANGE_PC(m_eip);
 }
+
+#include "i386drc.c"
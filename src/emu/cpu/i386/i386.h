@@ -9,6 +9,8 @@
 #include "softfloat/softfloat.h"
 #include "debug/debugcpu.h"
 #include "cpu/vtlb.h"
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
 
 
 #define INPUT_LINE_A20      1
@@ -23,8 +25,23 @@
 	i386_device::set_smiact(*device, DEVCB_##_devcb);
 
 
+/***************************************************************************
+    COMPILER-SPECIFIC OPTIONS
+***************************************************************************/
+
+#define I386DRC_STRICT_VERIFY       0x0001          /* verify all instructions */
+#define I386DRC_AUTO_INTERPRET      0x0002          /* interpret pages whose code keeps changing */
+
+#define I386DRC_COMPATIBLE_OPTIONS  (I386DRC_STRICT_VERIFY | I386DRC_AUTO_INTERPRET)
+#define I386DRC_FASTEST_OPTIONS     (0)
+
+
+class i386_frontend;
+
 class i386_device : public cpu_device
 {
+	friend class i386_frontend;
+
 public:
 	// construction/destruction
 	i386_device(const machine_config &mconfig, const char *tag, device_t *owner, UINT32 clock);
@@ -38,11 +55,16 @@ public:
 	UINT64 debug_segofftovirt(symbol_table &table, int params, const UINT64 *param);
 	UINT64 debug_virttophys(symbol_table &table, int params, const UINT64 *param);
 
+	// DRC configuration helpers
+	void i386drc_set_options(UINT32 options);
+	void i386drc_set_interpreted_page(offs_t address, bool interpreted);
+
 protected:
 	// device-level overrides
 	virtual void device_start();
 	virtual void device_reset();
 	virtual void device_debug_setup();
+	virtual void device_stop();
 
 	// device_execute_interface overrides
 	virtual UINT32 execute_min_cycles() const { return 1; }
@@ -1411,7 +1433,116 @@ struct I386_CALL_GATE
 	void pentium_smi();
 	void zero_state();
 	void i386_set_a20_line(int state);
+	void i386_execute_instruction();
+
+	// DRC code modes; the mode selects the hash table a block is compiled into
+	enum
+	{
+		DRCMODE_CODE32      = 0x01,     // CS default operand/address size is 32 bits
+		DRCMODE_PROTECTED   = 0x02,     // CR0.PE set
+		DRCMODE_V86         = 0x04,     // EFLAGS.VM set
+		DRCMODE_PAGING      = 0x08,     // CR0.PG set
+		DRCMODE_USER        = 0x10,     // CPL is 3
+		DRCMODE_COUNT       = 0x20
+	};
+
+	// Data that needs to be stored close to the generated DRC code
+	struct internal_i386_state
+	{
+		UINT32  r[8];               // general purpose registers
+		UINT32  pc;                 // linear PC; EIP is rederived from the CS base
+		UINT32  cf;                 // arithmetic flags, one per word so UML can SET them
+		UINT32  zf;
+		UINT32  sf;
+		UINT32  of;
+		UINT32  pf;
+		UINT32  af;
+		INT32   icount;
+		UINT32  mode;               // current DRCMODE_* bits
+		UINT32  csbase;             // CS base, needed for 16-bit IP wraparound
+		UINT32  status;             // result of the last interpreter call
+		UINT32  nextpc;             // PC an interpreted instruction is expected to fall through to
+	};
 
+	/* internal compiler state */
+	struct compiler_state
+	{
+		UINT32          cycles;                     /* accumulated cycles */
+		UINT32          mode;                       /* mode being compiled */
+		uml::code_label  labelnum;                   /* index for local labels */
+	};
+
+	bool                m_isdrc;
+	drc_cache           m_cache;                    /* pointer to the DRC code cache */
+	drcuml_state *      m_drcuml;                   /* DRC UML generator state */
+	i386_frontend *     m_drcfe;                    /* pointer to the DRC front-end state */
+	UINT32              m_drcoptions;               /* configurable DRC options */
+	internal_i386_state *m_drc_core;                /* state shared with the generated code */
+	UINT8               m_cache_dirty;              /* true if we need to flush the cache */
+	offs_t              m_drc_tlbmiss_pc;           /* PC of the last TLB miss exit */
+	std::vector<UINT8>  m_drc_pages;                /* per 4k linear page recompile counts */
+
+	uml::code_handle *  m_entry;                    /* entry point */
+	uml::code_handle *  m_nocode;                   /* nocode exception handler */
+	uml::code_handle *  m_out_of_cycles;            /* out of cycles exception handler */
+	uml::code_handle *  m_tlb_mismatch;             /* tlb mismatch handler */
+	uml::code_handle *  m_resync;                   /* interpreter resync handler */
+
+	static void cfunc_execute_interpreted(void *param);
+	void func_execute_interpreted();
+
+	inline void alloc_handle(drcuml_state *drcuml, uml::code_handle **handleptr, const char *name);
+	inline UINT32 drc_compute_mode();
+	inline UINT32 drc_cycles(int op);
+	inline bool drc_page_interpreted(offs_t address);
+	void drc_export_state();
+	void drc_import_state();
+	void drc_update_status(UINT32 oldmode);
+	void code_flush_cache();
+	void execute_run_drc();
+	void code_compile_block(UINT8 mode, offs_t pc);
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+	void static_generate_tlb_mismatch();
+	void static_generate_resync();
+	void log_add_disasm_comment(drcuml_block *block, UINT32 pc, const UINT8 *oprom);
+	void generate_update_cycles(drcuml_block *block, compiler_state *compiler, uml::parameter param, int allow_exception);
+	void generate_validate_tlb(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, offs_t target);
+	bool generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_load_reg(drcuml_block *block, uml::parameter dst, int size, int regnum);
+	void generate_store_reg(drcuml_block *block, int size, int regnum, uml::parameter src);
+	void generate_alu(drcuml_block *block, int aluop, int size, int regnum, bool isimm, UINT32 src);
+	void generate_incdec(drcuml_block *block, bool dec, int size, int regnum);
+	void generate_parity(drcuml_block *block, uml::parameter result, int size);
+	void generate_condition(drcuml_block *block, int cc);
+	void generate_jcc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int cc, int taken_cycles, int nottaken_cycles, bool wrap16);
+};
+
+
+class i386_frontend : public drc_frontend
+{
+public:
+	i386_frontend(i386_device *device, UINT32 window_start, UINT32 window_end, UINT32 max_sequence);
+
+protected:
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev);
+
+private:
+	inline UINT8 fetch(opcode_desc &desc, UINT32 offset);
+	bool translate(offs_t address, offs_t &physical);
+	UINT32 modrm_length(opcode_desc &desc, UINT32 offset, bool addr32);
+
+	i386_device *m_i386;
+	UINT32 m_mode;                  // mode of the code being described
+	UINT32 m_fetched;               // bytes of the current instruction fetched so far
+	offs_t m_lastpage;              // last linear page translated
+	offs_t m_lastphys;              // physical base of that page
+	bool m_fault;                   // a fetch hit a page that isn't present
 };
 
 
@@ -0,0 +1,1295 @@
+// license:BSD-3-Clause
+// copyright-holders:Ville Linde, Barry Rodewald, Carl, Philip Bennett
+/***************************************************************************
+
+    i386drc.c
+    Universal machine language-based i386 emulator.
+
+    Register-to-register integer operations and relative branches are
+    translated directly to UML.  Everything else is handed back to the
+    interpreter one instruction at a time; the generated code then checks
+    whether it can keep running the block or has to redispatch.
+
+    Blocks are validated against the vtlb when paging is enabled, and
+    pages whose code keeps being rewritten can be left to the
+    interpreter entirely.
+
+***************************************************************************/
+
+#include "cpu/drcumlsh.h"
+
+using namespace uml;
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* exit codes */
+#define EXECUTE_OUT_OF_CYCLES       0
+#define EXECUTE_MISSING_CODE        1
+#define EXECUTE_TLB_MISS            2
+#define EXECUTE_INTERPRET           3
+#define EXECUTE_RESYNC              4
+
+/* interpreter call status */
+#define STATUS_CONTINUE             0           /* carry on with the block */
+#define STATUS_REDISPATCH           1           /* control went somewhere the block doesn't know about */
+#define STATUS_EXIT                 2           /* return to the execute loop */
+
+/* per-page recompile tracking */
+#define PAGE_RECOMPILE_LIMIT        16          /* recompiles before a page is left to the interpreter */
+#define PAGE_INTERPRETED            0xff
+
+/* ALU operations, in opcode order */
+enum
+{
+	ALU_ADD = 0,
+	ALU_OR,
+	ALU_ADC,
+	ALU_SBB,
+	ALU_AND,
+	ALU_SUB,
+	ALU_XOR,
+	ALU_CMP,
+	ALU_TEST
+};
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+inline void i386_device::alloc_handle(drcuml_state *drcuml, code_handle **handleptr, const char *name)
+{
+	if (*handleptr == NULL)
+		*handleptr = drcuml->handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    drc_compute_mode - work out the DRC mode for
+    the current CPU state
+-------------------------------------------------*/
+
+inline UINT32 i386_device::drc_compute_mode()
+{
+	UINT32 mode = 0;
+
+	if (m_sreg[CS].d)
+		mode |= DRCMODE_CODE32;
+	if (PROTECTED_MODE)
+		mode |= DRCMODE_PROTECTED;
+	if (V8086_MODE)
+		mode |= DRCMODE_V86;
+	if (m_cr[0] & 0x80000000)
+		mode |= DRCMODE_PAGING;
+	if (m_CPL == 3)
+		mode |= DRCMODE_USER;
+	return mode;
+}
+
+
+/*-------------------------------------------------
+    drc_cycles - cycle count for an operation in
+    the current mode
+-------------------------------------------------*/
+
+inline UINT32 i386_device::drc_cycles(int op)
+{
+	return PROTECTED_MODE ? m_cycle_table_pm[op] : m_cycle_table_rm[op];
+}
+
+
+/*-------------------------------------------------
+    drc_page_interpreted - return true if code in
+    the given linear page is never compiled
+-------------------------------------------------*/
+
+inline bool i386_device::drc_page_interpreted(offs_t address)
+{
+	return m_drc_pages[address >> 12] == PAGE_INTERPRETED;
+}
+
+
+/*-------------------------------------------------
+    cfunc_execute_interpreted - C wrapper for the
+    interpreter thunk
+-------------------------------------------------*/
+
+void i386_device::cfunc_execute_interpreted(void *param)
+{
+	((i386_device *)param)->func_execute_interpreted();
+}
+
+
+/***************************************************************************
+    STATE TRANSFER
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_export_state - copy the state the
+    generated code works on out of the device
+-------------------------------------------------*/
+
+void i386_device::drc_export_state()
+{
+	internal_i386_state *core = m_drc_core;
+
+	for (int regnum = 0; regnum < 8; regnum++)
+		core->r[regnum] = REG32(regnum);
+	core->pc = m_pc;
+	core->cf = m_CF ? 1 : 0;
+	core->zf = m_ZF ? 1 : 0;
+	core->sf = m_SF ? 1 : 0;
+	core->of = m_OF ? 1 : 0;
+	core->pf = m_PF ? 1 : 0;
+	core->af = m_AF ? 1 : 0;
+	core->icount = m_cycles;
+	core->mode = drc_compute_mode();
+	core->csbase = m_sreg[CS].base;
+}
+
+
+/*-------------------------------------------------
+    drc_import_state - copy the state the
+    generated code works on back into the device
+-------------------------------------------------*/
+
+void i386_device::drc_import_state()
+{
+	internal_i386_state *core = m_drc_core;
+
+	for (int regnum = 0; regnum < 8; regnum++)
+		REG32(regnum) = core->r[regnum];
+	m_pc = core->pc;
+	m_eip = core->pc - m_sreg[CS].base;
+	m_CF = core->cf;
+	m_ZF = core->zf;
+	m_SF = core->sf;
+	m_OF = core->of;
+	m_PF = core->pf;
+	m_AF = core->af;
+	m_cycles = core->icount;
+}
+
+
+/*-------------------------------------------------
+    drc_update_status - export the state after an
+    interpreted instruction and decide whether
+    the generated code may carry on
+-------------------------------------------------*/
+
+void i386_device::drc_update_status(UINT32 oldmode)
+{
+	internal_i386_state *core = m_drc_core;
+	UINT32 status = STATUS_CONTINUE;
+
+	drc_export_state();
+
+	/* anything the execute loop has to look at sends us back there */
+	if (m_cycles <= 0 || m_halted || m_cache_dirty || m_TF || m_delayed_interrupt_enable || m_lock ||
+		(m_irq_state && m_IF) || (m_smi && !m_smm))
+		status = STATUS_EXIT;
+
+	/* a mode change or an unexpected PC means we need a different block */
+	else if (core->mode != oldmode || (core->nextpc != 0xffffffff && core->pc != core->nextpc))
+		status = STATUS_REDISPATCH;
+
+	core->status = status;
+}
+
+
+/*-------------------------------------------------
+    func_execute_interpreted - run a single
+    instruction through the interpreter on
+    behalf of the generated code
+-------------------------------------------------*/
+
+void i386_device::func_execute_interpreted()
+{
+	UINT32 oldmode = m_drc_core->mode;
+
+	drc_import_state();
+	i386_execute_instruction();
+	drc_update_status(oldmode);
+}
+
+
+/***************************************************************************
+    CORE EXECUTION
+***************************************************************************/
+
+/*-------------------------------------------------
+    i386drc_set_options - configure DRC options
+-------------------------------------------------*/
+
+void i386_device::i386drc_set_options(UINT32 options)
+{
+	if (!m_isdrc)
+		return;
+	m_drcoptions = options;
+}
+
+
+/*-------------------------------------------------
+    i386drc_set_interpreted_page - force code in
+    a linear page to always (or no longer) be
+    interpreted
+-------------------------------------------------*/
+
+void i386_device::i386drc_set_interpreted_page(offs_t address, bool interpreted)
+{
+	if (!m_isdrc)
+		return;
+	m_drc_pages[address >> 12] = interpreted ? PAGE_INTERPRETED : 0;
+	m_cache_dirty = TRUE;
+}
+
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void i386_device::code_flush_cache()
+{
+	drcuml_state *drcuml = m_drcuml;
+
+	/* empty the transient cache contents */
+	drcuml->reset();
+
+	try
+	{
+		/* generate the entry point and exception handlers */
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+		static_generate_tlb_mismatch();
+		static_generate_resync();
+		static_generate_entry_point();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unable to generate i386 static code\n");
+	}
+
+	m_cache_dirty = FALSE;
+}
+
+
+/*-------------------------------------------------
+    execute_run_drc - execute cycles using the
+    recompiler
+-------------------------------------------------*/
+
+void i386_device::execute_run_drc()
+{
+	drcuml_state *drcuml = m_drcuml;
+	int cycles = m_cycles;
+	int execute_result;
+
+	m_base_cycles = cycles;
+	CHANGE_PC(m_eip);
+
+	if (m_halted)
+	{
+		m_tsc += cycles;
+		m_cycles = 0;
+		return;
+	}
+
+	while (m_cycles > 0)
+	{
+		i386_check_irq_line();
+
+		/* reset the cache if dirty */
+		if (m_cache_dirty)
+			code_flush_cache();
+
+		/* single-step anything the generated code doesn't model */
+		if (m_TF || m_delayed_interrupt_enable || m_lock || drc_page_interpreted(m_pc))
+		{
+			i386_execute_instruction();
+			continue;
+		}
+
+		/* run as much as we can */
+		drc_export_state();
+		execute_result = drcuml->execute(*m_entry);
+		drc_import_state();
+
+		switch (execute_result)
+		{
+			case EXECUTE_MISSING_CODE:
+				code_compile_block(drc_compute_mode(), m_pc);
+				break;
+
+			case EXECUTE_TLB_MISS:
+			{
+				UINT32 address = m_pc;
+				UINT32 error;
+
+				/* missing again straight after a refill: the block was built for another mapping */
+				if (m_pc == m_drc_tlbmiss_pc)
+				{
+					m_drc_tlbmiss_pc = ~0;
+					code_compile_block(drc_compute_mode(), m_pc);
+				}
+
+				/* refill the vtlb; if the page isn't there, let the interpreter take the fault */
+				else if (translate_address(m_CPL, TRANSLATE_FETCH, &address, &error))
+					m_drc_tlbmiss_pc = m_pc;
+				else
+					i386_execute_instruction();
+				break;
+			}
+
+			case EXECUTE_INTERPRET:
+			case EXECUTE_OUT_OF_CYCLES:
+			case EXECUTE_RESYNC:
+				break;
+		}
+	}
+
+	m_tsc += (cycles - m_cycles);
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block of the
+    given mode at the specified pc
+-------------------------------------------------*/
+
+void i386_device::code_compile_block(UINT8 mode, offs_t pc)
+{
+	drcuml_state *drcuml = m_drcuml;
+	compiler_state compiler = { 0 };
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
+	int override = FALSE;
+	drcuml_block *block;
+
+	g_profiler.start(PROFILER_DRC_COMPILE);
+
+	/* a page that keeps getting recompiled is probably being written to; give up on it */
+	if ((m_drcoptions & I386DRC_AUTO_INTERPRET) && drcuml->hash_exists(mode, pc) && !drc_page_interpreted(pc))
+		if (++m_drc_pages[pc >> 12] >= PAGE_RECOMPILE_LIMIT)
+			m_drc_pages[pc >> 12] = PAGE_INTERPRETED;
+
+	compiler.mode = mode;
+
+	/* get a description of this sequence */
+	desclist = drc_page_interpreted(pc) ? NULL : m_drcfe->describe_code(pc);
+
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			/* start the block */
+			block = drcuml->begin_block(8192);
+
+			/* interpreted pages just get a stub that sends the execute loop back to the interpreter */
+			if (desclist == NULL)
+			{
+				UML_HASH(block, mode, pc);                                                  // hash    mode,pc
+				UML_MOV(block, mem(&m_drc_core->pc), pc);                                   // mov     [pc],pc
+				UML_EXIT(block, EXECUTE_INTERPRET);                                         // exit    EXECUTE_INTERPRET
+			}
+
+			/* loop until we get through all instruction sequences */
+			for (seqhead = desclist; seqhead != NULL; seqhead = seqlast->next())
+			{
+				const opcode_desc *curdesc;
+				UINT32 nextpc;
+
+				/* add a code log entry */
+				if (drcuml->logging())
+					block->append_comment("-------------------------");                     // comment
+
+				/* determine the last instruction in this sequence */
+				for (seqlast = seqhead; seqlast != NULL; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != NULL);
+
+				/* if we don't have a hash for this mode/pc, or if we are overriding all, add one */
+				if (override || !drcuml->hash_exists(mode, seqhead->pc))
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+
+				/* if we already have a hash, and this is the first sequence, assume that we */
+				/* are recompiling due to being out of sync and allow future overrides */
+				else if (seqhead == desclist)
+				{
+					override = TRUE;
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+				}
+
+				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
+				else
+				{
+					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
+					UML_HASHJMP(block, mode, seqhead->pc, *m_nocode);                       // hashjmp <mode>,seqhead->pc,nocode
+					continue;
+				}
+
+				/* validate this code block if we're not pointing into ROM */
+				if (!(seqhead->flags & OPFLAG_COMPILER_PAGE_FAULT) && m_program->get_write_ptr(seqhead->physpc) != NULL)
+					generate_checksum_block(block, &compiler, seqhead, seqlast);
+
+				/* label this instruction, if it may be jumped to locally */
+				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
+					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
+
+				/* iterate over instructions in the sequence and compile them */
+				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+				{
+					/* superblock side entries need settled cycles, a hash entry and a label */
+					if (curdesc->flags & OPFLAG_SIDE_ENTRY)
+					{
+						generate_update_cycles(block, &compiler, curdesc->pc, FALSE);      // <subtract cycles>
+						if (override || !drcuml->hash_exists(mode, curdesc->pc))
+						{
+							/* jumps from other blocks land here without passing the check above; */
+							/* falling through and local branches go straight to the label */
+							if (!(curdesc->flags & OPFLAG_COMPILER_PAGE_FAULT) && m_program->get_write_ptr(curdesc->physpc) != NULL)
+							{
+								code_label skip = compiler.labelnum++;
+								UML_JMP(block, skip);                                      // jmp     skip
+								UML_HASH(block, mode, curdesc->pc);                      // hash    mode,pc
+								generate_checksum_block(block, &compiler, curdesc, seqlast);
+								UML_LABEL(block, skip);                                    // skip:
+							}
+							else
+								UML_HASH(block, mode, curdesc->pc);                      // hash    mode,pc
+						}
+						UML_LABEL(block, curdesc->pc | 0x80000000);                     // label   curdesc->pc | 0x80000000
+					}
+					generate_sequence_instruction(block, &compiler, curdesc);
+				}
+
+				/* if we need to return to the start, do it */
+				if (seqlast->flags & OPFLAG_RETURN_TO_START)
+					nextpc = pc;
+
+				/* otherwise we just go to the next instruction */
+				else
+					nextpc = seqlast->pc + seqlast->length;
+
+				/* count off cycles and go there */
+				generate_update_cycles(block, &compiler, nextpc, TRUE);                    // <subtract cycles>
+				if (seqlast->next() == NULL || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, mode, nextpc, *m_nocode);                            // hashjmp <mode>,nextpc,nocode
+			}
+
+			/* end the sequence */
+			block->end();
+			g_profiler.stop();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+/***************************************************************************
+    C FUNCTION CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void i386_device::static_generate_entry_point()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(20);
+
+	/* forward references */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+
+	alloc_handle(drcuml, &m_entry, "entry");
+	UML_HANDLE(block, *m_entry);                                                            // handle  entry
+
+	/* generate a hash jump via the current mode and PC */
+	UML_HASHJMP(block, mem(&m_drc_core->mode), mem(&m_drc_core->pc), *m_nocode);            // hashjmp <mode>,<pc>,nocode
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void i386_device::static_generate_nocode_handler()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	/* generate a hash jump via the current mode and PC */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	UML_HANDLE(block, *m_nocode);                                                           // handle  nocode
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_drc_core->pc), I0);                                               // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                                  // exit    EXECUTE_MISSING_CODE
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_out_of_cycles - generate an
+    out of cycles exception handler
+-------------------------------------------------*/
+
+void i386_device::static_generate_out_of_cycles()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);                                                    // handle  out_of_cycles
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_drc_core->pc), I0);                                               // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                                 // exit    EXECUTE_OUT_OF_CYCLES
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_tlb_mismatch - generate a
+    TLB mismatch handler
+-------------------------------------------------*/
+
+void i386_device::static_generate_tlb_mismatch()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_tlb_mismatch, "tlb_mismatch");
+	UML_HANDLE(block, *m_tlb_mismatch);                                                     // handle  tlb_mismatch
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_drc_core->pc), I0);                                               // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_TLB_MISS);                                                      // exit    EXECUTE_TLB_MISS
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_resync - generate the handler
+    taken when an interpreted instruction didn't
+    go where the block expected
+-------------------------------------------------*/
+
+void i386_device::static_generate_resync()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	alloc_handle(drcuml, &m_resync, "resync");
+	UML_HANDLE(block, *m_resync);                                                           // handle  resync
+	UML_CMP(block, mem(&m_drc_core->status), STATUS_EXIT);                                  // cmp     [status],STATUS_EXIT
+	UML_JMPc(block, COND_E, 1);                                                             // je      1
+	UML_HASHJMP(block, mem(&m_drc_core->mode), mem(&m_drc_core->pc), *m_nocode);            // hashjmp <mode>,<pc>,nocode
+	UML_LABEL(block, 1);                                                                    // 1:
+	UML_EXIT(block, EXECUTE_RESYNC);                                                        // exit    EXECUTE_RESYNC
+
+	block->end();
+}
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    log_add_disasm_comment - add a comment
+    including disassembly of an i386 instruction
+-------------------------------------------------*/
+
+void i386_device::log_add_disasm_comment(drcuml_block *block, UINT32 pc, const UINT8 *oprom)
+{
+	if (m_drcuml->logging())
+	{
+		char buffer[100];
+		i386_dasm_one(buffer, pc, oprom, m_sreg[CS].d ? 32 : 16);
+		block->append_comment("%08X: %s", pc, buffer);                                      // comment
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and generate
+    an exception if out
+-------------------------------------------------*/
+
+void i386_device::generate_update_cycles(drcuml_block *block, compiler_state *compiler, uml::parameter param, int allow_exception)
+{
+	/* account for cycles */
+	if (compiler->cycles > 0)
+	{
+		UML_SUB(block, mem(&m_drc_core->icount), mem(&m_drc_core->icount), compiler->cycles);   // sub     icount,icount,cycles
+		if (allow_exception)
+			UML_EXHc(block, COND_LE, *m_out_of_cycles, param);                              // exh     out_of_cycles,nextpc
+	}
+	compiler->cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    generate_validate_tlb - check that the pages
+    an instruction was fetched from are still
+    mapped the way they were at compile time
+-------------------------------------------------*/
+
+void i386_device::generate_validate_tlb(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	const vtlb_entry *table = vtlb_table(m_vtlb);
+	UINT32 mask = 0xfffff000 | VTLB_FLAG_VALID | ((compiler->mode & DRCMODE_USER) ? VTLB_USER_READ_ALLOWED : VTLB_READ_ALLOWED);
+	offs_t page = desc->pc >> 12;
+	offs_t lastpage = (desc->pc + desc->length - 1) >> 12;
+
+	/* an instruction can straddle two pages */
+	while (1)
+	{
+		offs_t address = page << 12;
+		if (!i386_translate_address(TRANSLATE_READ_DEBUG, &address, NULL))
+			break;
+
+		UML_LOAD(block, I0, (void *)table, page, SIZE_DWORD, SCALE_x4);                     // load    i0,table,page,dword
+		UML_AND(block, I0, I0, mask);                                                       // and     i0,i0,mask
+		UML_CMP(block, I0, (address & 0xfffff000) | (mask & 0xfff));                        // cmp     i0,expected
+		UML_EXHc(block, COND_NE, *m_tlb_mismatch, desc->pc);                                // exh     tlb_mismatch,pc,ne
+
+		if (page == lastpage)
+			break;
+		page = (page + 1) & 0xfffff;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void i386_device::generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	const opcode_desc *curdesc;
+
+	if (m_drcuml->logging())
+		block->append_comment("[Validation for %08X]", seqhead->pc);                        // comment
+
+	/* compare the opcode bytes of each instruction, up to the end of the page it starts on */
+	for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+	{
+		if (curdesc != seqhead && !(m_drcoptions & I386DRC_STRICT_VERIFY))
+			break;
+		if (curdesc->flags & OPFLAG_COMPILER_PAGE_FAULT)
+			continue;
+
+		UINT32 offs = 0;
+		while (offs < curdesc->length && ((curdesc->physpc & 0xfff) + offs) < 0x1000)
+		{
+			UINT32 avail = MIN(curdesc->length - offs, 0x1000 - ((curdesc->physpc + offs) & 0xfff));
+			UINT32 size = (avail >= 4) ? 4 : (avail >= 2) ? 2 : 1;
+			void *base = m_direct->read_ptr(curdesc->physpc + offs);
+
+			if (base != NULL)
+			{
+				UINT32 expected;
+				if (size == 4)
+				{
+					UINT32 value;
+					memcpy(&value, &curdesc->opptr.b[offs], 4);
+					expected = value;
+				}
+				else if (size == 2)
+				{
+					UINT16 value;
+					memcpy(&value, &curdesc->opptr.b[offs], 2);
+					expected = value;
+				}
+				else
+					expected = curdesc->opptr.b[offs];
+
+				UML_LOAD(block, I0, base, 0, (size == 4) ? SIZE_DWORD : (size == 2) ? SIZE_WORD : SIZE_BYTE, SCALE_x1);
+																							// load    i0,base,0,size
+				UML_CMP(block, I0, expected);                                               // cmp     i0,expected
+				UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                           // exne    nocode,seqhead->pc
+			}
+			offs += size;
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void i386_device::generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* add an entry for the log */
+	if (m_drcuml->logging() && !(desc->flags & OPFLAG_COMPILER_PAGE_FAULT))
+		log_add_disasm_comment(block, desc->pc, desc->opptr.b);
+
+	/* validate our TLB entry at this PC; if we fail, we need to handle it */
+	if ((desc->flags & OPFLAG_VALIDATE_TLB) && (compiler->mode & DRCMODE_PAGING) && !(desc->flags & OPFLAG_COMPILER_PAGE_FAULT))
+		generate_validate_tlb(block, compiler, desc);
+
+	/* the interpreter calls the debugger hook itself, so native code is only used when not debugging */
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0 || (desc->flags & OPFLAG_COMPILER_PAGE_FAULT) ||
+		!generate_opcode(block, compiler, desc))
+		generate_interpreted(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_interpreted - generate a call into
+    the interpreter for a single instruction
+-------------------------------------------------*/
+
+void i386_device::generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* the interpreter needs an accurate cycle count */
+	generate_update_cycles(block, compiler, desc->pc, TRUE);                                // <subtract cycles>
+
+	UML_MOV(block, mem(&m_drc_core->pc), desc->pc);                                         // mov     [pc],desc->pc
+	UML_MOV(block, mem(&m_drc_core->nextpc), (desc->flags & OPFLAG_IS_BRANCH) ? 0xffffffff : desc->pc + desc->length);
+																							// mov     [nextpc],nextpc
+	UML_CALLC(block, cfunc_execute_interpreted, this);                                      // callc   execute_interpreted
+	UML_CMP(block, mem(&m_drc_core->status), STATUS_CONTINUE);                              // cmp     [status],STATUS_CONTINUE
+	UML_EXHc(block, COND_NE, *m_resync, 0);                                                 // exh     resync,0,ne
+
+	/* anything that may have remapped memory or changed modes starts a fresh block */
+	if (desc->flags & (OPFLAG_MODIFIES_TRANSLATION | OPFLAG_CAN_CHANGE_MODES))
+	{
+		UML_HASHJMP(block, mem(&m_drc_core->mode), mem(&m_drc_core->pc), *m_nocode);        // hashjmp <mode>,<pc>,nocode
+		return;
+	}
+
+	/* branches go wherever the interpreter sent them */
+	if (desc->flags & OPFLAG_IS_BRANCH)
+	{
+		code_label skip = compiler->labelnum++;
+
+		if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
+		{
+			code_label nottaken = compiler->labelnum++;
+			UML_CMP(block, mem(&m_drc_core->pc), desc->targetpc);                           // cmp     [pc],desc->targetpc
+			UML_JMPc(block, COND_NE, nottaken);                                             // jne     nottaken
+			generate_branch(block, compiler, desc, desc->targetpc);                         // <branch>
+			UML_LABEL(block, nottaken);                                                     // nottaken:
+		}
+		if (desc->flags & OPFLAG_IS_CONDITIONAL_BRANCH)
+		{
+			UML_CMP(block, mem(&m_drc_core->pc), desc->pc + desc->length);                  // cmp     [pc],nextpc
+			UML_JMPc(block, COND_E, skip);                                                  // je      skip
+		}
+		UML_HASHJMP(block, compiler->mode, mem(&m_drc_core->pc), *m_nocode);                // hashjmp <mode>,<pc>,nocode
+		UML_LABEL(block, skip);                                                             // skip:
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_branch - generate a jump to a known
+    target
+-------------------------------------------------*/
+
+void i386_device::generate_branch(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, offs_t target)
+{
+	compiler_state compiler_temp = *compiler;
+
+	/* update the cycles and jump through the hash table to the target */
+	generate_update_cycles(block, &compiler_temp, target, TRUE);                            // <subtract cycles>
+	if ((desc->flags & OPFLAG_INTRABLOCK_BRANCH) && target == desc->targetpc)
+		UML_JMP(block, target | 0x80000000);                                                // jmp     target | 0x80000000
+	else
+		UML_HASHJMP(block, compiler->mode, target, *m_nocode);                              // hashjmp <mode>,target,nocode
+
+	/* update the label */
+	compiler->labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_load_reg - load a general purpose
+    register of the given size into dst
+-------------------------------------------------*/
+
+void i386_device::generate_load_reg(drcuml_block *block, uml::parameter dst, int size, int regnum)
+{
+	switch (size)
+	{
+		case 1:
+			if (regnum < 4)
+				UML_AND(block, dst, mem(&m_drc_core->r[regnum]), 0xff);                     // and     dst,r,0xff
+			else
+				UML_ROLAND(block, dst, mem(&m_drc_core->r[regnum & 3]), 24, 0xff);          // roland  dst,r,24,0xff
+			break;
+
+		case 2:
+			UML_AND(block, dst, mem(&m_drc_core->r[regnum]), 0xffff);                       // and     dst,r,0xffff
+			break;
+
+		default:
+			UML_MOV(block, dst, mem(&m_drc_core->r[regnum]));                               // mov     dst,r
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_store_reg - store src into a general
+    purpose register of the given size
+-------------------------------------------------*/
+
+void i386_device::generate_store_reg(drcuml_block *block, int size, int regnum, uml::parameter src)
+{
+	switch (size)
+	{
+		case 1:
+			if (regnum < 4)
+				UML_ROLINS(block, mem(&m_drc_core->r[regnum]), src, 0, 0xff);               // rolins  r,src,0,0xff
+			else
+				UML_ROLINS(block, mem(&m_drc_core->r[regnum & 3]), src, 8, 0xff00);         // rolins  r,src,8,0xff00
+			break;
+
+		case 2:
+			UML_ROLINS(block, mem(&m_drc_core->r[regnum]), src, 0, 0xffff);                 // rolins  r,src,0,0xffff
+			break;
+
+		default:
+			UML_MOV(block, mem(&m_drc_core->r[regnum]), src);                               // mov     r,src
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_parity - set PF from the low byte of
+    a result held in the top of a register
+-------------------------------------------------*/
+
+void i386_device::generate_parity(drcuml_block *block, uml::parameter result, int size)
+{
+	int shift = 32 - size * 8;
+
+	if (shift != 0)
+		UML_ROLAND(block, I3, result, 32 - shift, 0xff);                                    // roland  i3,result,32-shift,0xff
+	else
+		UML_AND(block, I3, result, 0xff);                                                   // and     i3,result,0xff
+	UML_LOAD(block, I3, (void *)i386_parity_table, I3, SIZE_DWORD, SCALE_x4);               // load    i3,parity_table,i3,dword
+	UML_MOV(block, mem(&m_drc_core->pf), I3);                                               // mov     [pf],i3
+}
+
+
+/*-------------------------------------------------
+    generate_alu - generate one of the eight
+    basic ALU operations, or TEST, on a register
+-------------------------------------------------*/
+
+void i386_device::generate_alu(drcuml_block *block, int aluop, int size, int regnum, bool isimm, UINT32 src)
+{
+	/* operands live at the top of the register so the host flags match the operand size */
+	int shift = 32 - size * 8;
+	bool arith = (aluop == ALU_ADD || aluop == ALU_ADC || aluop == ALU_SBB || aluop == ALU_SUB || aluop == ALU_CMP);
+
+	generate_load_reg(block, I0, size, regnum);
+	if (isimm)
+		UML_MOV(block, I1, (src << shift));                                                 // mov     i1,src << shift
+	else
+	{
+		generate_load_reg(block, I1, size, src);
+		if (shift != 0)
+			UML_SHL(block, I1, I1, shift);                                                  // shl     i1,i1,shift
+	}
+	if (shift != 0)
+		UML_SHL(block, I0, I0, shift);                                                      // shl     i0,i0,shift
+
+	switch (aluop)
+	{
+		case ALU_ADD:   UML_ADD(block, I2, I0, I1);                                         break;
+		case ALU_OR:    UML_OR(block, I2, I0, I1);                                          break;
+		case ALU_ADC:   UML_CARRY(block, mem(&m_drc_core->cf), 0);
+						UML_ADDC(block, I2, I0, I1);                                        break;
+		case ALU_SBB:   UML_CARRY(block, mem(&m_drc_core->cf), 0);
+						UML_SUBB(block, I2, I0, I1);                                        break;
+		case ALU_AND:   UML_AND(block, I2, I0, I1);                                         break;
+		case ALU_SUB:   UML_SUB(block, I2, I0, I1);                                         break;
+		case ALU_XOR:   UML_XOR(block, I2, I0, I1);                                         break;
+		case ALU_CMP:   UML_SUB(block, I2, I0, I1);                                         break;
+		case ALU_TEST:  UML_AND(block, I2, I0, I1);                                         break;
+	}
+
+	/* capture the flags straight away; logical ops clear CF and OF and leave AF alone */
+	if (arith)
+	{
+		UML_SETc(block, COND_C, mem(&m_drc_core->cf));                                      // setc    [cf],c
+		UML_SETc(block, COND_V, mem(&m_drc_core->of));                                      // setc    [of],v
+	}
+	UML_SETc(block, COND_Z, mem(&m_drc_core->zf));                                          // setc    [zf],z
+	UML_SETc(block, COND_S, mem(&m_drc_core->sf));                                          // setc    [sf],s
+	if (arith)
+	{
+		UML_XOR(block, I3, I0, I1);                                                         // xor     i3,i0,i1
+		UML_XOR(block, I3, I3, I2);                                                         // xor     i3,i3,i2
+		UML_ROLAND(block, I3, I3, (32 - 4 - shift) & 31, 1);                                // roland  i3,i3,aux bit,1
+		UML_MOV(block, mem(&m_drc_core->af), I3);                                           // mov     [af],i3
+	}
+	else
+	{
+		UML_MOV(block, mem(&m_drc_core->cf), 0);                                            // mov     [cf],0
+		UML_MOV(block, mem(&m_drc_core->of), 0);                                            // mov     [of],0
+	}
+	generate_parity(block, I2, size);
+
+	/* write back the result */
+	if (aluop != ALU_CMP && aluop != ALU_TEST)
+	{
+		if (shift != 0)
+			UML_SHR(block, I2, I2, shift);                                                  // shr     i2,i2,shift
+		generate_store_reg(block, size, regnum, I2);
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_incdec - generate INC or DEC of a
+    register; CF is not affected
+-------------------------------------------------*/
+
+void i386_device::generate_incdec(drcuml_block *block, bool dec, int size, int regnum)
+{
+	int shift = 32 - size * 8;
+
+	generate_load_reg(block, I0, size, regnum);
+	if (shift != 0)
+		UML_SHL(block, I0, I0, shift);                                                      // shl     i0,i0,shift
+	UML_MOV(block, I1, 1 << shift);                                                         // mov     i1,1 << shift
+	if (dec)
+		UML_SUB(block, I2, I0, I1);                                                         // sub     i2,i0,i1
+	else
+		UML_ADD(block, I2, I0, I1);                                                         // add     i2,i0,i1
+	UML_SETc(block, COND_V, mem(&m_drc_core->of));                                          // setc    [of],v
+	UML_SETc(block, COND_Z, mem(&m_drc_core->zf));                                          // setc    [zf],z
+	UML_SETc(block, COND_S, mem(&m_drc_core->sf));                                          // setc    [sf],s
+	UML_XOR(block, I3, I0, I1);                                                             // xor     i3,i0,i1
+	UML_XOR(block, I3, I3, I2);                                                             // xor     i3,i3,i2
+	UML_ROLAND(block, I3, I3, (32 - 4 - shift) & 31, 1);                                    // roland  i3,i3,aux bit,1
+	UML_MOV(block, mem(&m_drc_core->af), I3);                                               // mov     [af],i3
+	generate_parity(block, I2, size);
+
+	if (shift != 0)
+		UML_SHR(block, I2, I2, shift);                                                      // shr     i2,i2,shift
+	generate_store_reg(block, size, regnum, I2);
+}
+
+
+/*-------------------------------------------------
+    generate_condition - evaluate the positive
+    sense of a Jcc condition into I0
+-------------------------------------------------*/
+
+void i386_device::generate_condition(drcuml_block *block, int cc)
+{
+	internal_i386_state *core = m_drc_core;
+
+	switch (cc >> 1)
+	{
+		case 0: UML_MOV(block, I0, mem(&core->of));                         break;  // O
+		case 1: UML_MOV(block, I0, mem(&core->cf));                         break;  // B
+		case 2: UML_MOV(block, I0, mem(&core->zf));                         break;  // Z
+		case 3: UML_OR(block, I0, mem(&core->cf), mem(&core->zf));          break;  // BE
+		case 4: UML_MOV(block, I0, mem(&core->sf));                         break;  // S
+		case 5: UML_MOV(block, I0, mem(&core->pf));                         break;  // P
+		case 6: UML_XOR(block, I0, mem(&core->sf), mem(&core->of));         break;  // L
+		case 7: UML_XOR(block, I0, mem(&core->sf), mem(&core->of));
+				UML_OR(block, I0, I0, mem(&core->zf));                      break;  // LE
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_jcc - generate a relative jump,
+    conditional if cc is non-negative
+-------------------------------------------------*/
+
+void i386_device::generate_jcc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int cc, int taken_cycles, int nottaken_cycles, bool wrap16)
+{
+	code_label skip = compiler->labelnum++;
+
+	if (cc >= 0)
+	{
+		generate_condition(block, cc);
+		UML_TEST(block, I0, 1);                                                             // test    i0,1
+		UML_JMPc(block, (cc & 1) ? COND_NZ : COND_Z, skip);                                 // jcc     skip
+	}
+
+	compiler_state compiler_temp = *compiler;
+	compiler_temp.cycles += drc_cycles(taken_cycles);
+
+	if (!wrap16)
+		generate_branch(block, &compiler_temp, desc, desc->targetpc);
+	else
+	{
+		/* a 16-bit IP wraps at 64k, so the target depends on the CS base */
+		code_label other = compiler_temp.labelnum++;
+		compiler_state compiler_other = compiler_temp;
+
+		UML_SUB(block, I0, desc->targetpc, mem(&m_drc_core->csbase));                       // sub     i0,targetpc,[csbase]
+		UML_AND(block, I0, I0, 0xffff);                                                     // and     i0,i0,0xffff
+		UML_ADD(block, I0, I0, mem(&m_drc_core->csbase));                                   // add     i0,i0,[csbase]
+		UML_CMP(block, I0, desc->targetpc);                                                 // cmp     i0,targetpc
+		UML_JMPc(block, COND_NE, other);                                                    // jne     other
+		generate_branch(block, &compiler_temp, desc, desc->targetpc);
+		UML_LABEL(block, other);                                                            // other:
+		compiler_other.labelnum = compiler_temp.labelnum;
+		generate_update_cycles(block, &compiler_other, I0, TRUE);                           // <subtract cycles>
+		UML_HASHJMP(block, compiler->mode, I0, *m_nocode);                                  // hashjmp <mode>,i0,nocode
+		compiler_temp.labelnum = compiler_other.labelnum;
+	}
+	compiler->labelnum = compiler_temp.labelnum;
+
+	if (cc >= 0)
+	{
+		UML_LABEL(block, skip);                                                             // skip:
+		compiler->cycles += drc_cycles(nottaken_cycles);
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate native code for a
+    single instruction; returns false if the
+    interpreter has to handle it
+-------------------------------------------------*/
+
+bool i386_device::generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	const UINT8 *op = desc->opptr.b;
+	bool code32 = (compiler->mode & DRCMODE_CODE32) != 0;
+	bool op32 = code32;
+	UINT32 offs = 0;
+	UINT8 opcode, modrm;
+	int size, osize;
+	UINT32 imm;
+
+	/* the operand size prefix is the only one we understand */
+	if (op[0] == 0x66)
+	{
+		op32 = !code32;
+		offs++;
+	}
+	opcode = op[offs++];
+	size = op32 ? 4 : 2;
+
+	/* ALU ops: xx0-xx3 are register/register with a ModRM, xx4-xx5 are accumulator/immediate */
+	if (opcode < 0x40 && (opcode & 7) < 6)
+	{
+		int aluop = opcode >> 3;
+
+		osize = (opcode & 1) ? size : 1;
+		if ((aluop == ALU_ADC || aluop == ALU_SBB) && osize != 4)
+			return false;
+
+		if ((opcode & 7) < 4)
+		{
+			modrm = op[offs];
+			if (modrm < 0xc0)
+				return false;
+			if (opcode & 2)
+				generate_alu(block, aluop, osize, (modrm >> 3) & 7, false, modrm & 7);
+			else
+				generate_alu(block, aluop, osize, modrm & 7, false, (modrm >> 3) & 7);
+			compiler->cycles += drc_cycles((aluop == ALU_CMP) ? CYCLES_CMP_REG_REG : CYCLES_ALU_REG_REG);
+		}
+		else
+		{
+			imm = (osize == 1) ? op[offs] : (osize == 2) ? (op[offs] | (op[offs + 1] << 8)) :
+				(op[offs] | (op[offs + 1] << 8) | (op[offs + 2] << 16) | (op[offs + 3] << 24));
+			generate_alu(block, aluop, osize, 0, true, imm);
+			compiler->cycles += drc_cycles((aluop == ALU_CMP) ? CYCLES_CMP_IMM_ACC : CYCLES_ALU_IMM_ACC);
+		}
+		return true;
+	}
+
+	switch (opcode)
+	{
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:    /* INC reg */
+			generate_incdec(block, false, size, opcode & 7);
+			compiler->cycles += drc_cycles(CYCLES_INC_REG);
+			return true;
+
+		case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e: case 0x4f:    /* DEC reg */
+			generate_incdec(block, true, size, opcode & 7);
+			compiler->cycles += drc_cycles(CYCLES_DEC_REG);
+			return true;
+
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:    /* Jcc rel8 */
+		case 0x78: case 0x79: case 0x7a: case 0x7b: case 0x7c: case 0x7d: case 0x7e: case 0x7f:
+			generate_jcc(block, compiler, desc, opcode & 15, CYCLES_JCC_DISP8, CYCLES_JCC_DISP8_NOBRANCH, !op32 && !code32);
+			return true;
+
+		case 0x80: case 0x81: case 0x83:                                                            /* ALU reg,imm */
+			modrm = op[offs++];
+			if (modrm < 0xc0)
+				return false;
+			osize = (opcode == 0x80) ? 1 : size;
+			if ((((modrm >> 3) & 7) == ALU_ADC || ((modrm >> 3) & 7) == ALU_SBB) && osize != 4)
+				return false;
+			if (opcode == 0x80)
+				imm = op[offs];
+			else if (opcode == 0x83)
+				imm = (INT32)(INT8)op[offs] & ((osize == 4) ? 0xffffffff : 0xffff);
+			else
+				imm = (osize == 2) ? (op[offs] | (op[offs + 1] << 8)) :
+					(op[offs] | (op[offs + 1] << 8) | (op[offs + 2] << 16) | (op[offs + 3] << 24));
+			generate_alu(block, (modrm >> 3) & 7, osize, modrm & 7, true, imm);
+			compiler->cycles += drc_cycles((((modrm >> 3) & 7) == ALU_CMP) ? CYCLES_CMP_REG_REG : CYCLES_ALU_REG_REG);
+			return true;
+
+		case 0x84: case 0x85:                                                                       /* TEST reg,reg */
+			modrm = op[offs];
+			if (modrm < 0xc0)
+				return false;
+			generate_alu(block, ALU_TEST, (opcode & 1) ? size : 1, modrm & 7, false, (modrm >> 3) & 7);
+			compiler->cycles += drc_cycles(CYCLES_TEST_REG_REG);
+			return true;
+
+		case 0x88: case 0x89: case 0x8a: case 0x8b:                                                 /* MOV reg,reg */
+			modrm = op[offs];
+			if (modrm < 0xc0)
+				return false;
+			osize = (opcode & 1) ? size : 1;
+			if (opcode & 2)
+			{
+				generate_load_reg(block, I0, osize, modrm & 7);
+				generate_store_reg(block, osize, (modrm >> 3) & 7, I0);
+			}
+			else
+			{
+				generate_load_reg(block, I0, osize, (modrm >> 3) & 7);
+				generate_store_reg(block, osize, modrm & 7, I0);
+			}
+			compiler->cycles += drc_cycles(CYCLES_MOV_REG_REG);
+			return true;
+
+		case 0x90:                                                                                  /* NOP */
+			compiler->cycles += drc_cycles(CYCLES_NOP);
+			return true;
+
+		case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97:               /* XCHG eAX,reg */
+			generate_load_reg(block, I0, size, 0);
+			generate_load_reg(block, I1, size, opcode & 7);
+			generate_store_reg(block, size, 0, I1);
+			generate_store_reg(block, size, opcode & 7, I0);
+			compiler->cycles += drc_cycles(CYCLES_XCHG_REG_REG);
+			return true;
+
+		case 0xa8:                                                                                  /* TEST AL,imm8 */
+			generate_alu(block, ALU_TEST, 1, 0, true, op[offs]);
+			compiler->cycles += drc_cycles(CYCLES_ALU_IMM_ACC);
+			return true;
+
+		case 0xa9:                                                                                  /* TEST eAX,imm */
+			imm = (size == 2) ? (op[offs] | (op[offs + 1] << 8)) :
+				(op[offs] | (op[offs + 1] << 8) | (op[offs + 2] << 16) | (op[offs + 3] << 24));
+			generate_alu(block, ALU_TEST, size, 0, true, imm);
+			compiler->cycles += drc_cycles(CYCLES_TEST_IMM_ACC);
+			return true;
+
+		case 0xb0: case 0xb1: case 0xb2: case 0xb3: case 0xb4: case 0xb5: case 0xb6: case 0xb7:    /* MOV reg8,imm8 */
+			UML_MOV(block, I0, op[offs]);                                                   // mov     i0,imm
+			generate_store_reg(block, 1, opcode & 7, I0);
+			compiler->cycles += drc_cycles(CYCLES_MOV_IMM_REG);
+			return true;
+
+		case 0xb8: case 0xb9: case 0xba: case 0xbb: case 0xbc: case 0xbd: case 0xbe: case 0xbf:    /* MOV reg,imm */
+			imm = (size == 2) ? (op[offs] | (op[offs + 1] << 8)) :
+				(op[offs] | (op[offs + 1] << 8) | (op[offs + 2] << 16) | (op[offs + 3] << 24));
+			UML_MOV(block, I0, imm);                                                        // mov     i0,imm
+			generate_store_reg(block, size, opcode & 7, I0);
+			compiler->cycles += drc_cycles(CYCLES_MOV_IMM_REG);
+			return true;
+
+		case 0xe9:                                                                                  /* JMP rel16/32 */
+			generate_jcc(block, compiler, desc, -1, CYCLES_JMP, 0, !op32 && !code32);
+			return true;
+
+		case 0xeb:                                                                                  /* JMP rel8 */
+			generate_jcc(block, compiler, desc, -1, CYCLES_JMP_SHORT, 0, !op32 && !code32);
+			return true;
+
+		case 0xf5:                                                                                  /* CMC */
+			UML_XOR(block, mem(&m_drc_core->cf), mem(&m_drc_core->cf), 1);                 // xor     [cf],[cf],1
+			compiler->cycles += drc_cycles(CYCLES_CMC);
+			return true;
+
+		case 0xf8:                                                                                  /* CLC */
+			UML_MOV(block, mem(&m_drc_core->cf), 0);                                        // mov     [cf],0
+			compiler->cycles += drc_cycles(CYCLES_CLC);
+			return true;
+
+		case 0xf9:                                                                                  /* STC */
+			UML_MOV(block, mem(&m_drc_core->cf), 1);                                        // mov     [cf],1
+			compiler->cycles += drc_cycles(CYCLES_STC);
+			return true;
+
+		case 0x0f:
+			opcode = op[offs++];
+			switch (opcode)
+			{
+				case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:    /* Jcc rel16/32 */
+				case 0x88: case 0x89: case 0x8a: case 0x8b: case 0x8c: case 0x8d: case 0x8e: case 0x8f:
+					generate_jcc(block, compiler, desc, opcode & 15, CYCLES_JCC_FULL_DISP, CYCLES_JCC_FULL_DISP_NOBRANCH, !op32 && !code32);
+					return true;
+
+				case 0xb6: case 0xb7: case 0xbe: case 0xbf:                                         /* MOVZX/MOVSX reg,reg */
+					modrm = op[offs];
+					if (modrm < 0xc0)
+						return false;
+					generate_load_reg(block, I0, (opcode & 1) ? 2 : 1, modrm & 7);
+					if (opcode & 8)
+						UML_SEXT(block, I0, I0, (opcode & 1) ? SIZE_WORD : SIZE_BYTE);      // sext    i0,i0,size
+					generate_store_reg(block, size, (modrm >> 3) & 7, I0);
+					compiler->cycles += drc_cycles((opcode & 8) ? CYCLES_MOVSX_REG_REG : CYCLES_MOVZX_REG_REG);
+					return true;
+			}
+			break;
+	}
+
+	return false;
+}
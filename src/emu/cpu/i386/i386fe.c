@@ -0,0 +1,403 @@
+// license:BSD-3-Clause
+// copyright-holders:Ville Linde, Barry Rodewald, Carl, Philip Bennett
+/***************************************************************************
+
+    i386fe.c
+
+    Front end for i386 recompiler
+
+    The front end only needs to know instruction lengths and control
+    flow; anything the code generator can't emit natively is handed to
+    the interpreter one instruction at a time, so the opcode attributes
+    below only cover what is required to step over each instruction.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "i386.h"
+#include "cpu/drcfe.h"
+
+
+/***************************************************************************
+    OPCODE ATTRIBUTES
+***************************************************************************/
+
+#define OA_MODRM        0x01        /* has a ModR/M byte */
+#define OA_IMM8         0x02        /* has an 8-bit immediate */
+#define OA_IMMV         0x04        /* has an operand-sized immediate */
+#define OA_IMM16        0x08        /* has a 16-bit immediate */
+#define OA_MOFFS        0x10        /* has an address-sized offset */
+#define OA_FAR          0x20        /* has a selector:offset pointer */
+#define OA_GROUP3       0x40        /* TEST form of group 3 carries an immediate */
+#define OA_PREFIX       0x80        /* instruction prefix */
+
+#define M   OA_MODRM
+#define B   OA_IMM8
+#define V   OA_IMMV
+#define W   OA_IMM16
+#define A   OA_MOFFS
+#define F   OA_FAR
+#define G   OA_GROUP3
+#define P   OA_PREFIX
+#define _   0
+
+static const UINT8 s_onebyte_attr[256] =
+{
+	/*        0     1     2     3     4     5     6     7     8     9     A     B     C     D     E     F   */
+	/* 0 */   M,    M,    M,    M,    B,    V,    _,    _,    M,    M,    M,    M,    B,    V,    _,    _,
+	/* 1 */   M,    M,    M,    M,    B,    V,    _,    _,    M,    M,    M,    M,    B,    V,    _,    _,
+	/* 2 */   M,    M,    M,    M,    B,    V,    P,    _,    M,    M,    M,    M,    B,    V,    P,    _,
+	/* 3 */   M,    M,    M,    M,    B,    V,    P,    _,    M,    M,    M,    M,    B,    V,    P,    _,
+	/* 4 */   _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,
+	/* 5 */   _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    _,
+	/* 6 */   _,    _,    M,    M,    P,    P,    P,    P,    V,  M|V,    B,  M|B,    _,    _,    _,    _,
+	/* 7 */   B,    B,    B,    B,    B,    B,    B,    B,    B,    B,    B,    B,    B,    B,    B,    B,
+	/* 8 */ M|B,  M|V,  M|B,  M|B,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 9 */   _,    _,    _,    _,    _,    _,    _,    _,    _,    _,    F,    _,    _,    _,    _,    _,
+	/* A */   A,    A,    A,    A,    _,    _,    _,    _,    B,    V,    _,    _,    _,    _,    _,    _,
+	/* B */   B,    B,    B,    B,    B,    B,    B,    B,    V,    V,    V,    V,    V,    V,    V,    V,
+	/* C */ M|B,  M|B,    W,    _,    M,    M,  M|B,  M|V,  W|B,    _,    W,    _,    _,    B,    _,    _,
+	/* D */   M,    M,    M,    M,    B,    B,    _,    _,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* E */   B,    B,    B,    B,    B,    B,    B,    B,    V,    V,    F,    B,    _,    _,    _,    _,
+	/* F */   P,    _,    P,    P,    _,    _,  M|G,  M|G,    _,    _,    _,    _,    _,    _,    M,    M
+};
+
+static const UINT8 s_twobyte_attr[256] =
+{
+	/*        0     1     2     3     4     5     6     7     8     9     A     B     C     D     E     F   */
+	/* 0 */   M,    M,    M,    M,    _,    _,    _,    _,    _,    _,    _,    _,    _,    M,    _,  M|B,
+	/* 1 */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 2 */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 3 */   _,    _,    _,    _,    _,    _,    _,    _,    M,    _,  M|B,    _,    _,    _,    _,    _,
+	/* 4 */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 5 */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 6 */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 7 */ M|B,  M|B,  M|B,  M|B,    M,    M,    M,    _,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* 8 */   V,    V,    V,    V,    V,    V,    V,    V,    V,    V,    V,    V,    V,    V,    V,    V,
+	/* 9 */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* A */   _,    _,    _,    M,  M|B,    M,    M,    M,    _,    _,    _,    M,  M|B,    M,    M,    M,
+	/* B */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,  M|B,    M,    M,    M,    M,    M,
+	/* C */   M,    M,  M|B,    M,  M|B,  M|B,  M|B,    M,    _,    _,    _,    _,    _,    _,    _,    _,
+	/* D */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* E */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,
+	/* F */   M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M,    M
+};
+
+#undef M
+#undef B
+#undef V
+#undef W
+#undef A
+#undef F
+#undef G
+#undef P
+#undef _
+
+/* the longest legal instruction */
+#define MAX_INSTRUCTION_LENGTH  15
+
+
+
+/***************************************************************************
+    INSTRUCTION PARSERS
+***************************************************************************/
+
+i386_frontend::i386_frontend(i386_device *device, UINT32 window_start, UINT32 window_end, UINT32 max_sequence)
+	: drc_frontend(*device, window_start, window_end, max_sequence)
+	, m_i386(device)
+	, m_mode(0)
+	, m_fetched(0)
+	, m_lastpage(~0)
+	, m_lastphys(0)
+	, m_fault(false)
+{
+}
+
+
+/*-------------------------------------------------
+    translate - convert a linear code address to
+    a physical one without touching the TLB
+-------------------------------------------------*/
+
+bool i386_frontend::translate(offs_t address, offs_t &physical)
+{
+	offs_t page = address & ~0xfff;
+
+	if (page != m_lastpage)
+	{
+		offs_t phys = page;
+		if ((m_mode & i386_device::DRCMODE_PAGING) && !m_i386->i386_translate_address(TRANSLATE_READ | TRANSLATE_DEBUG_MASK, &phys, NULL))
+			return false;
+		m_lastpage = page;
+		m_lastphys = phys & ~0xfff;
+	}
+	physical = (m_lastphys | (address & 0xfff)) & m_i386->m_a20_mask;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    fetch - return the byte at the given offset
+    into the current instruction
+-------------------------------------------------*/
+
+UINT8 i386_frontend::fetch(opcode_desc &desc, UINT32 offset)
+{
+	/* fetch lazily so we never read past the end of the instruction */
+	while (m_fetched <= offset && !m_fault)
+	{
+		offs_t physical;
+		if (m_fetched >= MAX_INSTRUCTION_LENGTH || !translate(desc.pc + m_fetched, physical))
+		{
+			m_fault = true;
+			break;
+		}
+		if (m_fetched == 0)
+			desc.physpc = physical;
+		desc.opptr.b[m_fetched++] = m_i386->m_direct->read_byte(physical);
+	}
+	return m_fault ? 0 : desc.opptr.b[offset];
+}
+
+
+/*-------------------------------------------------
+    modrm_length - return the number of bytes in
+    a ModR/M operand, including SIB and
+    displacement
+-------------------------------------------------*/
+
+UINT32 i386_frontend::modrm_length(opcode_desc &desc, UINT32 offset, bool addr32)
+{
+	UINT8 modrm = fetch(desc, offset);
+	int mod = modrm >> 6;
+	int rm = modrm & 7;
+
+	if (mod == 3)
+		return 1;
+
+	if (!addr32)
+	{
+		if (mod == 0)
+			return (rm == 6) ? 3 : 1;
+		return (mod == 1) ? 2 : 3;
+	}
+
+	UINT32 length = 1;
+	if (rm == 4)
+	{
+		UINT8 sib = fetch(desc, offset + 1);
+		length++;
+		if (mod == 0 && (sib & 7) == 5)
+			return length + 4;
+	}
+	else if (mod == 0 && rm == 5)
+		return length + 4;
+
+	if (mod == 1)
+		return length + 1;
+	if (mod == 2)
+		return length + 4;
+	return length;
+}
+
+
+/*-------------------------------------------------
+    describe_instruction - build a description
+    of a single instruction
+-------------------------------------------------*/
+
+bool i386_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	i386_device::internal_i386_state *core = m_i386->m_drc_core;
+	bool code32 = (core->mode & i386_device::DRCMODE_CODE32) != 0;
+	bool op32 = code32;
+	bool addr32 = code32;
+	bool twobyte = false;
+	UINT32 offset = 0;
+	UINT32 modrmoffs = 0;
+	UINT8 attr, opcode;
+
+	/* reset the fetch state for this instruction */
+	m_mode = core->mode;
+	m_fetched = 0;
+	m_fault = false;
+	m_lastpage = ~0;
+
+	/* skip over any prefixes */
+	for (;;)
+	{
+		opcode = fetch(desc, offset++);
+		if (m_fault || !(s_onebyte_attr[opcode] & OA_PREFIX))
+			break;
+		if (opcode == 0x66)
+			op32 = !code32;
+		else if (opcode == 0x67)
+			addr32 = !code32;
+
+		/* lock and repeat prefixes change how the interpreter steps */
+		if (opcode == 0xf0 || opcode == 0xf2 || opcode == 0xf3)
+			desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+	}
+
+	/* two and three byte opcodes */
+	if (opcode == 0x0f)
+	{
+		twobyte = true;
+		opcode = fetch(desc, offset++);
+		attr = s_twobyte_attr[opcode];
+		if (opcode == 0x38 || opcode == 0x3a)
+			fetch(desc, offset++);
+	}
+	else
+		attr = s_onebyte_attr[opcode];
+
+	/* operand bytes */
+	if (attr & OA_MODRM)
+	{
+		modrmoffs = offset;
+		if (attr & OA_GROUP3)
+		{
+			/* TEST is the only form of F6/F7 with an immediate */
+			if (((fetch(desc, offset) >> 3) & 7) < 2)
+				attr |= (opcode & 1) ? OA_IMMV : OA_IMM8;
+		}
+		if ((fetch(desc, offset) & 0xc0) != 0xc0)
+			desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+		offset += modrm_length(desc, offset, addr32);
+	}
+	if (attr & OA_IMM8)
+		offset += 1;
+	if (attr & OA_IMM16)
+		offset += 2;
+	if (attr & OA_IMMV)
+		offset += op32 ? 4 : 2;
+	if (attr & OA_MOFFS)
+		offset += addr32 ? 4 : 2;
+	if (attr & OA_FAR)
+		offset += op32 ? 6 : 4;
+
+	/* make sure every byte of the instruction is present */
+	if (offset > MAX_INSTRUCTION_LENGTH)
+	{
+		desc.length = m_fetched;
+		desc.flags |= OPFLAG_WILL_CAUSE_EXCEPTION | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+	fetch(desc, offset - 1);
+	desc.length = offset;
+	if (m_fault)
+	{
+		if (m_fetched == 0)
+			desc.length = 1;
+		desc.flags |= OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+
+	/* compute static branch targets the same way the interpreter does */
+	UINT32 eip = desc.pc - core->csbase;
+	UINT32 nexteip = eip + desc.length;
+	INT32 disp;
+
+	if (!twobyte)
+	{
+		switch (opcode)
+		{
+			case 0x70:  case 0x71:  case 0x72:  case 0x73:  case 0x74:  case 0x75:  case 0x76:  case 0x77:
+			case 0x78:  case 0x79:  case 0x7a:  case 0x7b:  case 0x7c:  case 0x7d:  case 0x7e:  case 0x7f:
+			case 0xe0:  case 0xe1:  case 0xe2:  case 0xe3:  /* Jcc/LOOPcc/JCXZ rel8 */
+				disp = (INT8)desc.opptr.b[desc.length - 1];
+				desc.targetpc = desc.pc + desc.length + disp;
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+				return true;
+
+			case 0xeb:  /* JMP rel8 */
+				disp = (INT8)desc.opptr.b[desc.length - 1];
+				desc.targetpc = desc.pc + desc.length + disp;
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+				return true;
+
+			case 0xe8:  /* CALL rel */
+			case 0xe9:  /* JMP rel */
+				if (op32)
+					disp = desc.opptr.b[desc.length - 4] | (desc.opptr.b[desc.length - 3] << 8) | (desc.opptr.b[desc.length - 2] << 16) | (desc.opptr.b[desc.length - 1] << 24);
+				else
+					disp = (INT16)(desc.opptr.b[desc.length - 2] | (desc.opptr.b[desc.length - 1] << 8));
+				nexteip += disp;
+				if (!op32 && !code32)
+					nexteip &= 0xffff;
+				desc.targetpc = core->csbase + nexteip;
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+				return true;
+
+			case 0xc2:  case 0xc3:  /* RET */
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_CAN_CAUSE_EXCEPTION;
+				return true;
+
+			case 0x9a:  case 0xea:  /* far CALL/JMP */
+			case 0xca:  case 0xcb:  /* RETF */
+			case 0xcc:  case 0xcd:  /* INT */
+			case 0xcf:              /* IRET */
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_CAN_CHANGE_MODES | OPFLAG_CAN_CAUSE_EXCEPTION;
+				return true;
+
+			case 0xff:  /* group 5: indirect CALL/JMP */
+				switch ((desc.opptr.b[modrmoffs] >> 3) & 7)
+				{
+					case 2:     case 4:
+						desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+						break;
+
+					case 3:     case 5:
+						desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_CAN_CHANGE_MODES;
+						break;
+				}
+				return true;
+
+			case 0x9d:  /* POPF */
+			case 0xce:  /* INTO */
+			case 0xf1:  /* ICEBP */
+			case 0xf4:  /* HLT */
+			case 0xfa:  /* CLI */
+			case 0xfb:  /* STI */
+				desc.flags |= OPFLAG_END_SEQUENCE | OPFLAG_CAN_CHANGE_MODES | OPFLAG_CAN_CAUSE_EXCEPTION;
+				return true;
+		}
+	}
+	else
+	{
+		switch (opcode)
+		{
+			case 0x80:  case 0x81:  case 0x82:  case 0x83:  case 0x84:  case 0x85:  case 0x86:  case 0x87:
+			case 0x88:  case 0x89:  case 0x8a:  case 0x8b:  case 0x8c:  case 0x8d:  case 0x8e:  case 0x8f:
+				/* Jcc rel16/32 */
+				if (op32)
+					disp = desc.opptr.b[desc.length - 4] | (desc.opptr.b[desc.length - 3] << 8) | (desc.opptr.b[desc.length - 2] << 16) | (desc.opptr.b[desc.length - 1] << 24);
+				else
+					disp = (INT16)(desc.opptr.b[desc.length - 2] | (desc.opptr.b[desc.length - 1] << 8));
+				nexteip += disp;
+				if (!op32 && !code32)
+					nexteip &= 0xffff;
+				desc.targetpc = core->csbase + nexteip;
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+				return true;
+
+			case 0x05:  case 0x07:  /* LOADALL/SYSCALL/SYSRET */
+			case 0x34:  case 0x35:  /* SYSENTER/SYSEXIT */
+			case 0xaa:              /* RSM */
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_CAN_CHANGE_MODES | OPFLAG_CAN_CAUSE_EXCEPTION;
+				return true;
+
+			case 0x00:  case 0x01:  /* descriptor tables, LMSW, INVLPG */
+			case 0x06:              /* CLTS */
+			case 0x08:  case 0x09:  /* INVD/WBINVD */
+			case 0x0b:              /* UD2 */
+			case 0x20:  case 0x21:  case 0x22:  case 0x23:  /* MOV CRx/DRx */
+			case 0x30:              /* WRMSR */
+				desc.flags |= OPFLAG_END_SEQUENCE | OPFLAG_CAN_CHANGE_MODES | OPFLAG_CAN_CAUSE_EXCEPTION;
+				if (opcode == 0x01 || opcode == 0x22)
+					desc.flags |= OPFLAG_MODIFIES_TRANSLATION;
+				return true;
+		}
+	}
+	return true;
+}
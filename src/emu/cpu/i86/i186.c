@@ -285,6 +285,7 @@ void i80186_cpu_device::execute_run()
 					DEF_r16w();
 					tmp = fetch_word();
 					m_dst = (INT32)((INT16)m_src)*(INT32)((INT16)tmp);
+					sync_flags();
 					m_CarryVal = m_OverVal = (((INT32)m_dst) >> 15 != 0) && (((INT32)m_dst) >> 15 != -1);
 					RegWord(m_dst);
 					CLKM(IMUL_RRI16, IMUL_RMI16);
@@ -302,6 +303,7 @@ void i80186_cpu_device::execute_run()
 					DEF_r16w();
 					src2= (UINT16)((INT16)((INT8)fetch()));
 					m_dst = (INT32)((INT16)m_src)*(INT32)((INT16)src2);
+					sync_flags();
 					m_CarryVal = m_OverVal = (((INT32)m_dst) >> 15 != 0) && (((INT32)m_dst) >> 15 != -1);
 					RegWord(m_dst);
 					CLKM(IMUL_RRI8, IMUL_RMI8);
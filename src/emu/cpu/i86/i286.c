@@ -1069,6 +1069,8 @@ void i80286_cpu_device::execute_run()
 					UINT8 r;
 					UINT32 addr;
 
+					/* the protected mode checks below set ZF by hand */
+					sync_flags();
 					switch (next)
 					{
 						case 0:
@@ -1380,6 +1382,7 @@ reg.base = BASE(desc); (void)(r); reg.limit = LIMIT(desc); }
 					tmp=GetRMWord();
 					source=RegWord();
 
+					sync_flags();
 					if (RPL(tmp)<RPL(source))
 					{
 						m_ZeroVal = 0;
@@ -1401,6 +1404,7 @@ reg.base = BASE(desc); (void)(r); reg.limit = LIMIT(desc); }
 					DEF_r16w();
 					tmp = fetch_word();
 					m_dst = (INT32)((INT16)m_src)*(INT32)((INT16)tmp);
+					sync_flags();
 					m_CarryVal = m_OverVal = (((INT32)m_dst) >> 15 != 0) && (((INT32)m_dst) >> 15 != -1);
 					RegWord(m_dst);
 					CLKM(IMUL_RRI16, IMUL_RMI16);
@@ -1418,6 +1422,7 @@ reg.base = BASE(desc); (void)(r); reg.limit = LIMIT(desc); }
 					DEF_r16w();
 					src2= (UINT16)((INT16)((INT8)fetch()));
 					m_dst = (INT32)((INT16)m_src)*(INT32)((INT16)src2);
+					sync_flags();
 					m_CarryVal = m_OverVal = (((INT32)m_dst) >> 15 != 0) && (((INT32)m_dst) >> 15 != -1);
 					RegWord(m_dst);
 					CLKM(IMUL_RRI8, IMUL_RMI8);
@@ -1766,17 +1771,13 @@ reg.base = BASE(desc); (void)(r); reg.limit = LIMIT(desc); }
 						{
 						case 0x00:  /* INC */
 							tmp1 = tmp+1;
-							m_OverVal = (tmp==0x7fff);
-							set_AF(tmp1,tmp,1);
-							set_SZPF_Word(tmp1);
+							m_lazy.set(LAZY_FLAGS_ADD, 16, tmp, 1, tmp1);
 							PutbackRMWord(tmp1);
 							CLKM(INCDEC_R16,INCDEC_M16);
 							break;
 						case 0x08:  /* DEC */
 							tmp1 = tmp-1;
-							m_OverVal = (tmp==0x8000);
-							set_AF(tmp1,tmp,1);
-							set_SZPF_Word(tmp1);
+							m_lazy.set(LAZY_FLAGS_SUB, 16, tmp, 1, tmp1);
 							PutbackRMWord(tmp1);
 							CLKM(INCDEC_R16,INCDEC_M16);
 							break;
@@ -400,6 +400,7 @@ void i8086_common_cpu_device::device_start()
 
 void i8086_common_cpu_device::device_reset()
 {
+	m_lazy.clear();
 	m_ZeroVal = 1;
 	m_ParityVal = 1;
 	m_regs.w[AX] = 0;
@@ -446,6 +447,18 @@ void i8086_common_cpu_device::device_reset()
 }
 
 
+void i8086_common_cpu_device::device_pre_save()
+{
+	sync_flags();
+}
+
+
+void i8086_common_cpu_device::device_post_load()
+{
+	m_lazy.clear();
+}
+
+
 
 void i8086_common_cpu_device::interrupt(int int_num, int trap)
 {
@@ -1774,6 +1787,7 @@ bool i8086_common_cpu_device::common_op(UINT8 op)
 			m_src = GetRMByte();
 			m_dst = m_src;
 			CLKM(ROT_REG_1,ROT_M8_1);
+			sync_flags();
 			switch ( m_modrm & 0x38 )
 			{
 			case 0x00: ROL_BYTE();  PutbackRMByte(m_dst); m_OverVal = (m_src ^ m_dst) & 0x80; break;
@@ -1792,6 +1806,7 @@ bool i8086_common_cpu_device::common_op(UINT8 op)
 			m_src = GetRMWord();
 			m_dst = m_src;
 			CLKM(ROT_REG_1,ROT_M8_1);
+			sync_flags();
 			switch ( m_modrm & 0x38 )
 			{
 			case 0x00: ROL_WORD();  PutbackRMWord(m_dst); m_OverVal = (m_src ^ m_dst) & 0x8000; break;
@@ -2108,6 +2123,7 @@ bool i8086_common_cpu_device::common_op(UINT8 op)
 
 				m_modrm = fetch();
 				tmp = GetRMByte();
+				sync_flags();
 				switch ( m_modrm & 0x38 )
 				{
 				case 0x00:  /* TEST */
@@ -2197,6 +2213,7 @@ bool i8086_common_cpu_device::common_op(UINT8 op)
 
 				m_modrm = fetch();
 				tmp = GetRMWord();
+				sync_flags();
 				switch ( m_modrm & 0x38 )
 				{
 				case 0x00:  /* TEST */
@@ -2320,17 +2337,13 @@ bool i8086_common_cpu_device::common_op(UINT8 op)
 				{
 				case 0x00:  /* INC */
 					tmp1 = tmp+1;
-					m_OverVal = (tmp==0x7f);
-					set_AF(tmp1,tmp,1);
-					set_SZPF_Byte(tmp1);
+					m_lazy.set(LAZY_FLAGS_ADD, 8, tmp, 1, tmp1);
 					PutbackRMByte(tmp1);
 					CLKM(INCDEC_R8,INCDEC_M8);
 					break;
 				case 0x08:  /* DEC */
 					tmp1 = tmp-1;
-					m_OverVal = (tmp==0x80);
-					set_AF(tmp1,tmp,1);
-					set_SZPF_Byte(tmp1);
+					m_lazy.set(LAZY_FLAGS_SUB, 8, tmp, 1, tmp1);
 					PutbackRMByte(tmp1);
 					CLKM(INCDEC_R8,INCDEC_M8);
 					break;
@@ -2350,17 +2363,13 @@ bool i8086_common_cpu_device::common_op(UINT8 op)
 				{
 				case 0x00:  /* INC */
 					tmp1 = tmp+1;
-					m_OverVal = (tmp==0x7fff);
-					set_AF(tmp1,tmp,1);
-					set_SZPF_Word(tmp1);
+					m_lazy.set(LAZY_FLAGS_ADD, 16, tmp, 1, tmp1);
 					PutbackRMWord(tmp1);
 					CLKM(INCDEC_R16,INCDEC_M16);
 					break;
 				case 0x08:  /* DEC */
 					tmp1 = tmp-1;
-					m_OverVal = (tmp==0x8000);
-					set_AF(tmp1,tmp,1);
-					set_SZPF_Word(tmp1);
+					m_lazy.set(LAZY_FLAGS_SUB, 16, tmp, 1, tmp1);
 					PutbackRMWord(tmp1);
 					CLKM(INCDEC_R16,INCDEC_M16);
 					break;
@@ -4,6 +4,7 @@
 #define __I8086_H__
 
 #include "emu.h"
+#include "cpu/lazyflags.h"
 
 /////////////////////////////////////////////////////////////////
 
@@ -115,6 +116,8 @@ protected:
 	// device-level overrides
 	virtual void device_start();
 	virtual void device_reset();
+	virtual void device_pre_save();
+	virtual void device_post_load();
 
 	// device_execute_interface overrides
 	virtual UINT32 execute_min_cycles() const { return 1; }
@@ -180,6 +183,7 @@ protected:
 	inline void DEF_axd16();
 
 	// Flags
+	inline void sync_flags();
 	inline void set_CFB(UINT32 x);
 	inline void set_CFW(UINT32 x);
 	inline void set_AF(UINT32 x,UINT32 y,UINT32 z);
@@ -287,6 +291,7 @@ protected:
 
 	INT32   m_SignVal;
 	UINT32  m_AuxVal, m_OverVal, m_ZeroVal, m_CarryVal, m_ParityVal; /* 0 or non-0 valued flags */
+	lazy_flags m_lazy;          /* last ALU op, while the flags other than CF are out of date */
 	UINT8   m_TF, m_IF, m_DF;     /* 0 or 1 valued flags */
 	UINT8   m_IOPL, m_NT, m_MF;
 	UINT32  m_int_vector;
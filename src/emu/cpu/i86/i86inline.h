@@ -3,11 +3,11 @@
 #include "i86.h"
 
 #define CF      (m_CarryVal!=0)
-#define SF      (m_SignVal<0)
-#define ZF      (m_ZeroVal==0)
-#define PF      m_parity_table[(UINT8)m_ParityVal]
-#define AF      (m_AuxVal!=0)
-#define OF      (m_OverVal!=0)
+#define SF      (m_lazy.pending() ? m_lazy.sign() : (m_SignVal<0))
+#define ZF      (m_lazy.pending() ? m_lazy.zero() : (m_ZeroVal==0))
+#define PF      (m_lazy.pending() ? m_lazy.parity() : (m_parity_table[(UINT8)m_ParityVal]!=0))
+#define AF      (m_lazy.pending() ? m_lazy.half() : (m_AuxVal!=0))
+#define OF      (m_lazy.pending() ? m_lazy.overflow() : (m_OverVal!=0))
 
 /* The interrupt number of a pending external interrupt pending NMI is 2.   */
 /* For INTR interrupts, the level is caught on the bus during an INTA cycle */
@@ -443,6 +443,21 @@ inline UINT16 i8086_common_cpu_device::GetMemW(int seg, UINT16 offset)
 
 // Setting flags
 
+// ADD/SUB/logic ops and INC/DEC only record themselves in m_lazy; everything
+// that sets some of OF/AF/SF/ZF/PF by hand must fold the record back first
+inline void i8086_common_cpu_device::sync_flags()
+{
+	if (m_lazy.pending())
+	{
+		m_OverVal = m_lazy.overflow();
+		m_AuxVal = m_lazy.half();
+		m_SignVal = m_lazy.sign() ? -1 : 0;
+		m_ZeroVal = !m_lazy.zero();
+		m_ParityVal = !m_lazy.parity();
+		m_lazy.clear();
+	}
+}
+
 inline void i8086_common_cpu_device::set_CFB(UINT32 x)
 {
 	m_CarryVal = x & 0x100;
@@ -455,51 +470,61 @@ inline void i8086_common_cpu_device::set_CFW(UINT32 x)
 
 inline void i8086_common_cpu_device::set_AF(UINT32 x,UINT32 y,UINT32 z)
 {
+	sync_flags();
 	m_AuxVal = (x ^ (y ^ z)) & 0x10;
 }
 
 inline void i8086_common_cpu_device::set_SF(UINT32 x)
 {
+	sync_flags();
 	m_SignVal = x;
 }
 
 inline void i8086_common_cpu_device::set_ZF(UINT32 x)
 {
+	sync_flags();
 	m_ZeroVal = x;
 }
 
 inline void i8086_common_cpu_device::set_PF(UINT32 x)
 {
+	sync_flags();
 	m_ParityVal = x;
 }
 
 inline void i8086_common_cpu_device::set_SZPF_Byte(UINT32 x)
 {
+	sync_flags();
 	m_SignVal = m_ZeroVal = m_ParityVal = (INT8)x;
 }
 
 inline void i8086_common_cpu_device::set_SZPF_Word(UINT32 x)
 {
+	sync_flags();
 	m_SignVal = m_ZeroVal = m_ParityVal = (INT16)x;
 }
 
 inline void i8086_common_cpu_device::set_OFW_Add(UINT32 x,UINT32 y,UINT32 z)
 {
+	sync_flags();
 	m_OverVal = (x ^ y) & (x ^ z) & 0x8000;
 }
 
 inline void i8086_common_cpu_device::set_OFB_Add(UINT32 x,UINT32 y,UINT32 z)
 {
+	sync_flags();
 	m_OverVal = (x ^ y) & (x ^ z) & 0x80;
 }
 
 inline void i8086_common_cpu_device::set_OFW_Sub(UINT32 x,UINT32 y,UINT32 z)
 {
+	sync_flags();
 	m_OverVal = (z ^ y) & (z ^ x) & 0x8000;
 }
 
 inline void i8086_common_cpu_device::set_OFB_Sub(UINT32 x,UINT32 y,UINT32 z)
 {
+	sync_flags();
 	m_OverVal = (z ^ y) & (z ^ x) & 0x80;
 }
 
@@ -523,6 +548,7 @@ inline UINT16 i8086_common_cpu_device::CompressFlags()
 
 inline void i8086_common_cpu_device::ExpandFlags(UINT16 f)
 {
+	m_lazy.clear();
 	m_CarryVal = (f) & 1;
 	m_ParityVal = !((f) & 4);
 	m_AuxVal = (f) & 16;
@@ -669,9 +695,7 @@ inline UINT32 i8086_common_cpu_device::ADDB()
 {
 	UINT32 res = m_dst + m_src;
 
-	set_OFB_Add(res,m_src,m_dst);
-	set_AF(res,m_src,m_dst);
-	set_SZPF_Byte(res);
+	m_lazy.set(LAZY_FLAGS_ADD, 8, m_dst, m_src, res);
 	m_dst = res & 0xff;
 	return res;
 }
@@ -681,9 +705,7 @@ inline UINT32 i8086_common_cpu_device::ADDX()
 {
 	UINT32 res = m_dst + m_src;
 
-	set_OFW_Add(res,m_src,m_dst);
-	set_AF(res,m_src,m_dst);
-	set_SZPF_Word(res);
+	m_lazy.set(LAZY_FLAGS_ADD, 16, m_dst, m_src, res);
 	m_dst = res & 0xffff;
 	return res;
 }
@@ -693,9 +715,7 @@ inline UINT32 i8086_common_cpu_device::SUBB()
 {
 	UINT32 res = m_dst - m_src;
 
-	set_OFB_Sub(res,m_src,m_dst);
-	set_AF(res,m_src,m_dst);
-	set_SZPF_Byte(res);
+	m_lazy.set(LAZY_FLAGS_SUB, 8, m_dst, m_src, res);
 	m_dst = res & 0xff;
 	return res;
 }
@@ -705,9 +725,7 @@ inline UINT32 i8086_common_cpu_device::SUBX()
 {
 	UINT32 res = m_dst - m_src;
 
-	set_OFW_Sub(res,m_src,m_dst);
-	set_AF(res,m_src,m_dst);
-	set_SZPF_Word(res);
+	m_lazy.set(LAZY_FLAGS_SUB, 16, m_dst, m_src, res);
 	m_dst = res & 0xffff;
 	return res;
 }
@@ -716,48 +734,48 @@ inline UINT32 i8086_common_cpu_device::SUBX()
 inline void i8086_common_cpu_device::ORB()
 {
 	m_dst |= m_src;
-	m_CarryVal = m_OverVal = m_AuxVal = 0;
-	set_SZPF_Byte(m_dst);
+	m_CarryVal = 0;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 8, m_dst, m_src, m_dst);
 }
 
 
 inline void i8086_common_cpu_device::ORW()
 {
 	m_dst |= m_src;
-	m_CarryVal = m_OverVal = m_AuxVal = 0;
-	set_SZPF_Word(m_dst);
+	m_CarryVal = 0;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 16, m_dst, m_src, m_dst);
 }
 
 
 inline void i8086_common_cpu_device::ANDB()
 {
 	m_dst &= m_src;
-	m_CarryVal = m_OverVal = m_AuxVal = 0;
-	set_SZPF_Byte(m_dst);
+	m_CarryVal = 0;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 8, m_dst, m_src, m_dst);
 }
 
 
 inline void i8086_common_cpu_device::ANDX()
 {
 	m_dst &= m_src;
-	m_CarryVal = m_OverVal = m_AuxVal = 0;
-	set_SZPF_Word(m_dst);
+	m_CarryVal = 0;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 16, m_dst, m_src, m_dst);
 }
 
 
 inline void i8086_common_cpu_device::XORB()
 {
 	m_dst ^= m_src;
-	m_CarryVal = m_OverVal = m_AuxVal = 0;
-	set_SZPF_Byte(m_dst);
+	m_CarryVal = 0;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 8, m_dst, m_src, m_dst);
 }
 
 
 inline void i8086_common_cpu_device::XORW()
 {
 	m_dst ^= m_src;
-	m_CarryVal = m_OverVal = m_AuxVal = 0;
-	set_SZPF_Word(m_dst);
+	m_CarryVal = 0;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 16, m_dst, m_src, m_dst);
 }
 
 
@@ -894,9 +912,7 @@ inline void i8086_common_cpu_device::IncWordReg(UINT8 reg)
 	UINT32 tmp = m_regs.w[reg];
 	UINT32 tmp1 = tmp+1;
 
-	m_OverVal = (tmp == 0x7fff);
-	set_AF(tmp1,tmp,1);
-	set_SZPF_Word(tmp1);
+	m_lazy.set(LAZY_FLAGS_ADD, 16, tmp, 1, tmp1);
 	m_regs.w[reg] = tmp1;
 }
 
@@ -906,9 +922,7 @@ inline void i8086_common_cpu_device::DecWordReg(UINT8 reg)
 	UINT32 tmp = m_regs.w[reg];
 	UINT32 tmp1 = tmp-1;
 
-	m_OverVal = (tmp == 0x8000);
-	set_AF(tmp1,tmp,1);
-	set_SZPF_Word(tmp1);
+	m_lazy.set(LAZY_FLAGS_SUB, 16, tmp, 1, tmp1);
 	m_regs.w[reg] = tmp1;
 }
 
@@ -945,6 +959,7 @@ inline void i8086_common_cpu_device::JMP(bool cond)
 
 inline void i8086_common_cpu_device::ADJ4(INT8 param1,INT8 param2)
 {
+	sync_flags();
 	if (AF || ((m_regs.b[AL] & 0xf) > 9))
 	{
 		UINT16 tmp;
@@ -964,6 +979,7 @@ inline void i8086_common_cpu_device::ADJ4(INT8 param1,INT8 param2)
 
 inline void i8086_common_cpu_device::ADJB(INT8 param1, INT8 param2)
 {
+	sync_flags();
 	if (AF || ((m_regs.b[AL] & 0xf) > 9))
 	{
 		m_regs.b[AL] += param1;
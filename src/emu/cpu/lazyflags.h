@@ -0,0 +1,135 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    lazyflags.h
+
+    Deferred condition flag evaluation for 8- and 16-bit interpreters.
+
+****************************************************************************
+
+    Most ALU instructions set every arithmetic flag, but nearly all of
+    those flags are overwritten by the next ALU instruction before
+    anything looks at them. Instead of building the flag byte after
+    each operation, a core can record the operation kind, its operands
+    and its full precision result here, and only work the individual
+    flags out when an instruction, an interrupt, the debugger or a save
+    state actually needs them.
+
+    The helper only answers questions about the last recorded operation;
+    the core decides how the answers map onto its own flag register, and
+    is responsible for folding them back (and calling clear()) before
+    anything reads or writes that register directly.
+
+    Results must be computed without masking, so that the carry or
+    borrow out of the top bit lands in bit 'bits' of the result. Both
+    add with carry and subtract with borrow fit this scheme by simply
+    adding/subtracting the incoming carry into the result. Widths up to
+    16 bits are supported.
+
+    The variant field is not interpreted here; cores use it to tell
+    apart operations that share a kind but differ in the flags they
+    produce (compare vs. subtract, AND vs. OR, carry-preserving
+    increment, and so on).
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __LAZYFLAGS_H__
+#define __LAZYFLAGS_H__
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// kinds of operation that can be recorded
+enum
+{
+	LAZY_FLAGS_NONE = 0,        // nothing pending, the core's flag register is current
+	LAZY_FLAGS_ADD,             // result = dst + src [+ carry]
+	LAZY_FLAGS_SUB,             // result = dst - src [- borrow]
+	LAZY_FLAGS_LOGIC            // result = dst AND/OR/XOR src; no carry, half carry or overflow
+};
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> lazy_flags
+
+class lazy_flags
+{
+public:
+	// construction/destruction
+	lazy_flags()
+		: m_op(LAZY_FLAGS_NONE),
+			m_variant(0),
+			m_bits(8),
+			m_dst(0),
+			m_src(0),
+			m_result(0) { }
+
+	// recording
+	void set(UINT8 op, UINT8 bits, UINT32 dst, UINT32 src, UINT32 result, UINT8 variant = 0)
+	{
+		m_op = op;
+		m_variant = variant;
+		m_bits = bits;
+		m_dst = dst;
+		m_src = src;
+		m_result = result;
+	}
+	void clear() { m_op = LAZY_FLAGS_NONE; }
+
+	// getters
+	bool pending() const { return (m_op != LAZY_FLAGS_NONE); }
+	UINT8 op() const { return m_op; }
+	UINT8 variant() const { return m_variant; }
+	UINT8 bits() const { return m_bits; }
+	UINT32 dst() const { return m_dst; }
+	UINT32 src() const { return m_src; }
+	UINT32 result() const { return m_result & mask(); }
+
+	// flags of the recorded operation
+	bool carry() const { return (m_op != LAZY_FLAGS_LOGIC) && ((m_result >> m_bits) & 1); }
+	bool zero() const { return ((m_result & mask()) == 0); }
+	bool sign() const { return (m_result >> (m_bits - 1)) & 1; }
+	bool half() const { return (m_op != LAZY_FLAGS_LOGIC) && ((m_dst ^ m_src ^ m_result) & 0x10); }
+	bool overflow() const
+	{
+		switch (m_op)
+		{
+			case LAZY_FLAGS_ADD:    return (((m_dst ^ m_result) & (m_src ^ m_result)) >> (m_bits - 1)) & 1;
+			case LAZY_FLAGS_SUB:    return (((m_dst ^ m_src) & (m_dst ^ m_result)) >> (m_bits - 1)) & 1;
+			default:                return false;
+		}
+	}
+	bool parity() const
+	{
+		// even parity of the low byte, as every CPU we care about defines it
+		UINT8 value = m_result;
+		value ^= value >> 4;
+		value ^= value >> 2;
+		value ^= value >> 1;
+		return !(value & 1);
+	}
+
+private:
+	UINT32 mask() const { return (1 << m_bits) - 1; }
+
+	// internal state
+	UINT8               m_op;               // LAZY_FLAGS_* kind of the last operation
+	UINT8               m_variant;          // core-specific refinement of the kind
+	UINT8               m_bits;             // operand width in bits
+	UINT32              m_dst;              // first operand
+	UINT32              m_src;              // second operand
+	UINT32              m_result;           // unmasked result
+};
+
+
+#endif /* __LAZYFLAGS_H__ */
@@ -10,6 +10,8 @@
 
 #include "softfloat/milieu.h"
 #include "softfloat/softfloat.h"
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
 
 
 /* MMU constants */
@@ -18,6 +20,12 @@
 /* instruction cache constants */
 #define M68K_IC_SIZE 128
 
+/* recompiler options */
+#define M68KDRC_STRICT_VERIFY       0x0001          /* verify all instructions */
+
+#define M68KDRC_COMPATIBLE_OPTIONS  (M68KDRC_STRICT_VERIFY)
+#define M68KDRC_FASTEST_OPTIONS     (0)
+
 
 
 
@@ -116,12 +124,15 @@ enum
 unsigned int m68k_disassemble_raw(char* str_buff, unsigned int pc, const unsigned char* opdata, const unsigned char* argdata, unsigned int cpu_type);
 
 class m68000_base_device;
+class m68k_frontend;
 
 
 extern const device_type M68K;
 
 class m68000_base_device : public cpu_device
 {
+	friend class m68k_frontend;
+
 public:
 
 	// construction/destruction
@@ -179,6 +190,9 @@ public:
 	void set_instruction_hook(read32_delegate ihook);
 	void set_buserror_details(UINT32 fault_addr, UINT8 rw, UINT8 fc);
 
+	// DRC configuration helpers
+	void m68kdrc_set_options(UINT32 options);
+
 public:
 
 
@@ -248,8 +262,8 @@ public:
 	UINT32 virq_state;
 	UINT32 nmi_pending;
 
-	void (**jump_table)(m68000_base_device *m68k);
-	const UINT8* cyc_instruction;
+	const UINT16* jump_index;       /* opcode -> index into m68ki_instruction_handlers */
+	const UINT8* cyc_instruction;   /* cycles taken by each handler */
 	const UINT8* cyc_exception;
 
 	/* Callbacks to host */
@@ -400,6 +414,105 @@ public:
 
 	// device_memory_interface overrides
 	virtual bool memory_translate(address_spacenum space, int intention, offs_t &address);
+
+private:
+	// Data that needs to be stored close to the generated DRC code
+	struct internal_m68k_state
+	{
+		UINT32  dar[16];            // data and address registers
+		UINT32  pc;
+		UINT32  x_flag;             // flags, in the interpreter's encoding
+		UINT32  n_flag;
+		UINT32  not_z_flag;
+		UINT32  v_flag;
+		UINT32  c_flag;
+		INT32   icount;
+		UINT32  status;             // result of the last interpreter call
+		UINT32  nextpc;             // PC an interpreted instruction is expected to fall through to
+	};
+
+	/* internal compiler state */
+	struct compiler_state
+	{
+		UINT32          cycles;                     /* accumulated cycles */
+		uml::code_label  labelnum;                   /* index for local labels */
+	};
+
+	/* an effective address decoded at compile time */
+	struct drc_ea
+	{
+		int             mode;                       /* 0-6 as encoded; 7 + register for abs.W, abs.L and #imm */
+		int             reg;                        /* index into dar[] */
+		UINT32          ext;                        /* displacement, address, immediate or index extension word */
+		offs_t          pc;                         /* PC once the extension words have been fetched */
+
+		bool is_memory() const { return mode >= 2 && mode <= 8; }
+	};
+
+	bool                m_isdrc;
+	drc_cache           m_cache;                    /* pointer to the DRC code cache */
+	drcuml_state *      m_drcuml;                   /* DRC UML generator state */
+	m68k_frontend *     m_drcfe;                    /* pointer to the DRC front-end state */
+	UINT32              m_drcoptions;               /* configurable DRC options */
+	internal_m68k_state *m_drc_core;                /* state shared with the generated code */
+	UINT8               m_cache_dirty;              /* true if we need to flush the cache */
+
+	uml::code_handle *  m_entry;                    /* entry point */
+	uml::code_handle *  m_nocode;                   /* nocode exception handler */
+	uml::code_handle *  m_out_of_cycles;            /* out of cycles exception handler */
+	uml::code_handle *  m_resync;                   /* interpreter resync handler */
+
+	static void cfunc_execute_interpreted(void *param);
+	void func_execute_interpreted();
+
+	inline void alloc_handle(drcuml_state *drcuml, uml::code_handle **handleptr, const char *name);
+	inline bool drc_usable();
+	inline int ea_step(const drc_ea &ea, int size);
+	inline uml::operand_size ea_operand_size(int size);
+	void init_drc();
+	void drc_export_state();
+	void drc_import_state();
+	void drc_update_status();
+	void code_flush_cache();
+	void execute_run_drc();
+	void code_compile_block(offs_t pc);
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+	void static_generate_resync();
+	void log_add_disasm_comment(drcuml_block *block, UINT32 pc, const opcode_desc *desc);
+	void generate_update_cycles(drcuml_block *block, compiler_state *compiler, uml::parameter param, int allow_exception);
+	void generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, offs_t target);
+	bool generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_logic_flags(drcuml_block *block, uml::parameter result, int size);
+	void generate_alu(drcuml_block *block, int aluop, int dstreg, uml::parameter src);
+	bool decode_ea(const opcode_desc *desc, int mode, int reg, int size, int &word, drc_ea &ea);
+	void generate_ea_address(drcuml_block *block, const drc_ea &ea, int size, uml::parameter dst, int biasreg, INT32 bias);
+	bool generate_memory_begin(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, const drc_ea *src, const drc_ea *dst, int size, uml::code_label &slow);
+	void generate_memory_end(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, const drc_ea *src, const drc_ea *dst, bool checked, uml::code_label slow);
+	void generate_load_operand(drcuml_block *block, const drc_ea &ea, int size);
+	void generate_store_operand(drcuml_block *block, const drc_ea &ea, int size);
+	bool generate_move(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	bool generate_ea_source(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int size, int aluop, int dstreg);
+	void generate_condition(drcuml_block *block, int cc);
+	void generate_bcc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int cc, INT32 notake_cycles);
+	void generate_dbcc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int cc, int regnum);
+};
+
+
+class m68k_frontend : public drc_frontend
+{
+public:
+	m68k_frontend(m68000_base_device *device, UINT32 window_start, UINT32 window_end, UINT32 max_sequence);
+
+protected:
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev);
+
+private:
+	m68000_base_device *m_m68k;
 };
 
 
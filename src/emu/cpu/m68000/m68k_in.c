@@ -95,8 +95,9 @@ M68KMAKE_PROTOTYPE_FOOTER
 /* Build the opcode handler table */
 void m68ki_build_opcode_table(void);
 
-extern void (*m68ki_instruction_jump_table[][0x10000])(m68000_base_device *m68k); /* opcode handler jump table */
-extern unsigned char m68ki_cycles[][0x10000];
+extern void (*m68ki_instruction_handlers[])(m68000_base_device *m68k); /* opcode handlers, shared by all CPU types */
+extern const UINT16 *m68ki_instruction_index[];                         /* opcode -> handler index, by CPU type */
+extern unsigned char m68ki_cycles[][M68K_NUM_OPCODE_HANDLERS];          /* handler index -> cycles, by CPU type */
 
 
 /* ======================================================================== */
@@ -117,8 +118,19 @@ M68KMAKE_TABLE_HEADER
 
 #define NUM_CPU_TYPES 7
 
-void (*m68ki_instruction_jump_table[NUM_CPU_TYPES][0x10000])(m68000_base_device *m68k); /* opcode handler jump table */
-unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
+/*
+   Rather than a 64k entry table of handler pointers and another of cycle
+   counts for every CPU type, each opcode maps to a 16-bit index into one
+   shared list of handlers.  The cycle counts depend only on the handler and
+   the CPU type, so they are kept per handler, and CPU types that decode
+   every opcode the same way share a single index map.  This keeps the
+   tables a 68000 and a 68020 system touch down to a few hundred kilobytes.
+*/
+void (*m68ki_instruction_handlers[M68K_NUM_OPCODE_HANDLERS])(m68000_base_device *m68k); /* opcode handlers */
+const UINT16 *m68ki_instruction_index[NUM_CPU_TYPES];                                   /* opcode -> handler index */
+unsigned char m68ki_cycles[NUM_CPU_TYPES][M68K_NUM_OPCODE_HANDLERS];                    /* handler index -> cycles */
+
+static UINT16 m68ki_instruction_index_maps[NUM_CPU_TYPES][0x10000];
 
 /* This is used to generate the opcode handler jump table */
 struct opcode_handler_struct
@@ -148,11 +160,12 @@ M68KMAKE_TABLE_FOOTER
 
 static void m68ki_set_one(unsigned short opcode, const opcode_handler_struct *s)
 {
+	/* handler 0 is the illegal instruction handler, the table entries follow it */
+	UINT16 index = s - m68k_opcode_handler_table + 1;
+
 	for(int i=0; i<NUM_CPU_TYPES; i++)
-		if(s->cycles[i] != 0xff) {
-			m68ki_cycles[i][opcode] = s->cycles[i];
-			m68ki_instruction_jump_table[i][opcode] = s->opcode_handler;
-		}
+		if(s->cycles[i] != 0xff)
+			m68ki_instruction_index_maps[i][opcode] = index;
 }
 
 void m68ki_build_opcode_table(void)
@@ -162,14 +175,18 @@ void m68ki_build_opcode_table(void)
 	int j;
 	int k;
 
-	for(i = 0; i < 0x10000; i++)
+	/* default to illegal */
+	m68ki_instruction_handlers[0] = m68000_base_device_ops::m68k_op_illegal;
+	for(k=0;k<NUM_CPU_TYPES;k++)
+		m68ki_cycles[k][0] = 0;
+	memset(m68ki_instruction_index_maps, 0, sizeof(m68ki_instruction_index_maps));
+
+	for(ostruct = m68k_opcode_handler_table; ostruct->mask != 0; ostruct++)
 	{
-		/* default to illegal */
+		i = ostruct - m68k_opcode_handler_table + 1;
+		m68ki_instruction_handlers[i] = ostruct->opcode_handler;
 		for(k=0;k<NUM_CPU_TYPES;k++)
-		{
-			m68ki_instruction_jump_table[k][i] = m68000_base_device_ops::m68k_op_illegal;
-			m68ki_cycles[k][i] = 0;
-		}
+			m68ki_cycles[k][i] = (ostruct->cycles[k] != 0xff) ? ostruct->cycles[k] : 0;
 	}
 
 	ostruct = m68k_opcode_handler_table;
@@ -248,6 +265,18 @@ void m68ki_build_opcode_table(void)
 	{
 		fatalerror("m68ki_build_opcode_table: unhandled opcode mask %x (match %x), m68k core will not function!\n", ostruct->mask, ostruct->match);
 	}
+
+	/* let CPU types that decode everything the same way share one map */
+	for(k=0;k<NUM_CPU_TYPES;k++)
+	{
+		m68ki_instruction_index[k] = m68ki_instruction_index_maps[k];
+		for(j=0;j<k;j++)
+			if(memcmp(m68ki_instruction_index_maps[j], m68ki_instruction_index_maps[k], sizeof(m68ki_instruction_index_maps[k])) == 0)
+			{
+				m68ki_instruction_index[k] = m68ki_instruction_index[j];
+				break;
+			}
+	}
 }
 
 
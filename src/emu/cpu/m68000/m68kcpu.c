@@ -36,6 +36,20 @@ extern void m68040_fpu_op0(m68000_base_device *m68k);
 extern void m68040_fpu_op1(m68000_base_device *m68k);
 extern void m68881_mmu_ops(m68000_base_device *m68k);
 
+/* ======================================================================== */
+/* ============================= RECOMPILER =============================== */
+/* ======================================================================== */
+
+#define SINGLE_INSTRUCTION_MODE         (0)
+
+/* size of the execution code cache */
+#define CACHE_SIZE                      (16 * 1024 * 1024)
+
+/* compilation boundaries -- how far back/forward does the analysis extend? */
+#define COMPILE_BACKWARDS_BYTES         128
+#define COMPILE_FORWARDS_BYTES          512
+#define COMPILE_MAX_SEQUENCE            64
+
 /* ======================================================================== */
 /* ================================= DATA ================================= */
 /* ======================================================================== */
@@ -850,8 +864,9 @@ inline void m68000_base_device::cpu_execute(void)
 				run_mode = RUN_MODE_NORMAL;
 				/* Read an instruction and call its handler */
 				ir = m68ki_read_imm_16(this);
-				jump_table[ir](this);
-				remaining_cycles -= cyc_instruction[ir];
+				UINT16 index = jump_index[ir];
+				m68ki_instruction_handlers[index](this);
+				remaining_cycles -= cyc_instruction[index];
 			}
 			else
 			{
@@ -872,8 +887,9 @@ inline void m68000_base_device::cpu_execute(void)
 
 				if (!mmu_tmp_buserror_occurred)
 				{
-					jump_table[ir](this);
-					remaining_cycles -= cyc_instruction[ir];
+					UINT16 index = jump_index[ir];
+					m68ki_instruction_handlers[index](this);
+					remaining_cycles -= cyc_instruction[index];
 				}
 
 				if (mmu_tmp_buserror_occurred)
@@ -921,7 +937,7 @@ inline void m68000_base_device::cpu_execute(void)
 
 					// TODO:
 					/* Use up some clock cycles and undo the instruction's cycles */
-					// remaining_cycles -= cyc_exception[EXCEPTION_BUS_ERROR] - cyc_instruction[ir];
+					// remaining_cycles -= cyc_exception[EXCEPTION_BUS_ERROR] - cyc_instruction[jump_index[ir]];
 				}
 			}
 			}
@@ -1788,7 +1804,7 @@ void m68000_base_device::init_cpu_m68000(void)
 
 	init16(*program, *oprogram);
 	sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[0];
+	jump_index       = m68ki_instruction_index[0];
 	cyc_instruction  = m68ki_cycles[0];
 	cyc_exception    = m68ki_exception_cycle_table[0];
 	cyc_bcc_notake_b = -2;
@@ -1804,6 +1820,7 @@ void m68000_base_device::init_cpu_m68000(void)
 	has_hmmu         = 0;
 	has_fpu          = 0;
 
+	init_drc();
 	define_state();
 
 }
@@ -1818,7 +1835,7 @@ void m68000_base_device::init_cpu_m68008(void)
 
 	init8(*program, *oprogram);
 	sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[0];
+	jump_index       = m68ki_instruction_index[0];
 	cyc_instruction  = m68ki_cycles[0];
 	cyc_exception    = m68ki_exception_cycle_table[0];
 	cyc_bcc_notake_b = -2;
@@ -1846,7 +1863,7 @@ void m68000_base_device::init_cpu_m68010(void)
 
 	init16(*program, *oprogram);
 	sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[1];
+	jump_index       = m68ki_instruction_index[1];
 	cyc_instruction  = m68ki_cycles[1];
 	cyc_exception    = m68ki_exception_cycle_table[1];
 	cyc_bcc_notake_b = -4;
@@ -1861,6 +1878,7 @@ void m68000_base_device::init_cpu_m68010(void)
 	has_pmmu         = 0;
 	has_fpu          = 0;
 
+	init_drc();
 	define_state();
 }
 
@@ -1873,7 +1891,7 @@ void m68000_base_device::init_cpu_m68020(void)
 
 	init32(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[2];
+	jump_index       = m68ki_instruction_index[2];
 	cyc_instruction  = m68ki_cycles[2];
 	cyc_exception    = m68ki_exception_cycle_table[2];
 	cyc_bcc_notake_b = -2;
@@ -1886,6 +1904,7 @@ void m68000_base_device::init_cpu_m68020(void)
 	cyc_shift        = 0;
 	cyc_reset        = 518;
 
+	init_drc();
 	define_state();
 }
 
@@ -1930,7 +1949,7 @@ void m68000_base_device::init_cpu_m68ec020(void)
 
 	init32(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[2];
+	jump_index       = m68ki_instruction_index[2];
 	cyc_instruction  = m68ki_cycles[2];
 	cyc_exception    = m68ki_exception_cycle_table[2];
 	cyc_bcc_notake_b = -2;
@@ -1945,6 +1964,7 @@ void m68000_base_device::init_cpu_m68ec020(void)
 	has_pmmu         = 0;
 	has_fpu          = 0;
 
+	init_drc();
 	define_state();
 }
 
@@ -1959,7 +1979,7 @@ void m68000_base_device::init_cpu_m68030(void)
 
 	init32mmu(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[3];
+	jump_index       = m68ki_instruction_index[3];
 	cyc_instruction  = m68ki_cycles[3];
 	cyc_exception    = m68ki_exception_cycle_table[3];
 	cyc_bcc_notake_b = -2;
@@ -1989,7 +2009,7 @@ void m68000_base_device::init_cpu_m68ec030(void)
 
 	init32(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[3];
+	jump_index       = m68ki_instruction_index[3];
 	cyc_instruction  = m68ki_cycles[3];
 	cyc_exception    = m68ki_exception_cycle_table[3];
 	cyc_bcc_notake_b = -2;
@@ -2019,7 +2039,7 @@ void m68000_base_device::init_cpu_m68040(void)
 
 	init32mmu(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[4];
+	jump_index       = m68ki_instruction_index[4];
 	cyc_instruction  = m68ki_cycles[4];
 	cyc_exception    = m68ki_exception_cycle_table[4];
 	cyc_bcc_notake_b = -2;
@@ -2048,7 +2068,7 @@ void m68000_base_device::init_cpu_m68ec040(void)
 
 	init32(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[4];
+	jump_index       = m68ki_instruction_index[4];
 	cyc_instruction  = m68ki_cycles[4];
 	cyc_exception    = m68ki_exception_cycle_table[4];
 	cyc_bcc_notake_b = -2;
@@ -2077,7 +2097,7 @@ void m68000_base_device::init_cpu_m68lc040(void)
 
 	init32mmu(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[4];
+	jump_index       = m68ki_instruction_index[4];
 	cyc_instruction  = m68ki_cycles[4];
 	cyc_exception    = m68ki_exception_cycle_table[4];
 	cyc_bcc_notake_b = -2;
@@ -2113,7 +2133,7 @@ void m68000_base_device::init_cpu_fscpu32(void)
 
 	init32(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[5];
+	jump_index       = m68ki_instruction_index[5];
 	cyc_instruction  = m68ki_cycles[5];
 	cyc_exception    = m68ki_exception_cycle_table[5];
 	cyc_bcc_notake_b = -2;
@@ -2141,7 +2161,7 @@ void m68000_base_device::init_cpu_coldfire(void)
 
 	init32(*program, *oprogram);
 	sr_mask          = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	jump_table       = m68ki_instruction_jump_table[6];
+	jump_index       = m68ki_instruction_index[6];
 	cyc_instruction  = m68ki_cycles[6];
 	cyc_exception    = m68ki_exception_cycle_table[6];
 	cyc_bcc_notake_b = -2;
@@ -2337,8 +2357,19 @@ const device_type M68K = &device_creator<m68000_base_device>;
 m68000_base_device::m68000_base_device(const machine_config &mconfig, const char *tag, device_t *owner, UINT32 clock)
 	: cpu_device(mconfig, M68K, "M68K", tag, owner, clock, "m68k", __FILE__),
 		m_program_config("program", ENDIANNESS_BIG, 16, 24),
-		m_oprogram_config("decrypted_opcodes", ENDIANNESS_BIG, 16, 24)
-{
+		m_oprogram_config("decrypted_opcodes", ENDIANNESS_BIG, 16, 24),
+		m_cache(CACHE_SIZE + sizeof(internal_m68k_state)),
+		m_drcuml(NULL),
+		m_drcfe(NULL),
+		m_drcoptions(M68KDRC_COMPATIBLE_OPTIONS),
+		m_drc_core(NULL),
+		m_cache_dirty(TRUE),
+		m_entry(NULL),
+		m_nocode(NULL),
+		m_out_of_cycles(NULL),
+		m_resync(NULL)
+{
+	m_isdrc = (mconfig.options().drc() && mconfig.options().drc_m68k() && !mconfig.m_force_no_drc) ? true : false;
 	clear_all();
 }
 
@@ -2349,8 +2380,19 @@ m68000_base_device::m68000_base_device(const machine_config &mconfig, const char
 										const device_type type, UINT32 prg_data_width, UINT32 prg_address_bits, address_map_constructor internal_map, const char *shortname, const char *source)
 	: cpu_device(mconfig, type, name, tag, owner, clock, shortname, source),
 		m_program_config("program", ENDIANNESS_BIG, prg_data_width, prg_address_bits, 0, internal_map),
-		m_oprogram_config("decrypted_opcodes", ENDIANNESS_BIG, prg_data_width, prg_address_bits, 0, internal_map)
-{
+		m_oprogram_config("decrypted_opcodes", ENDIANNESS_BIG, prg_data_width, prg_address_bits, 0, internal_map),
+		m_cache(CACHE_SIZE + sizeof(internal_m68k_state)),
+		m_drcuml(NULL),
+		m_drcfe(NULL),
+		m_drcoptions(M68KDRC_COMPATIBLE_OPTIONS),
+		m_drc_core(NULL),
+		m_cache_dirty(TRUE),
+		m_entry(NULL),
+		m_nocode(NULL),
+		m_out_of_cycles(NULL),
+		m_resync(NULL)
+{
+	m_isdrc = (mconfig.options().drc() && mconfig.options().drc_m68k() && !mconfig.m_force_no_drc) ? true : false;
 	clear_all();
 }
 
@@ -2359,8 +2401,19 @@ m68000_base_device::m68000_base_device(const machine_config &mconfig, const char
 										const device_type type, UINT32 prg_data_width, UINT32 prg_address_bits, const char *shortname, const char *source)
 	: cpu_device(mconfig, type, name, tag, owner, clock, shortname, source),
 		m_program_config("program", ENDIANNESS_BIG, prg_data_width, prg_address_bits),
-		m_oprogram_config("decrypted_opcodes", ENDIANNESS_BIG, prg_data_width, prg_address_bits)
-{
+		m_oprogram_config("decrypted_opcodes", ENDIANNESS_BIG, prg_data_width, prg_address_bits),
+		m_cache(CACHE_SIZE + sizeof(internal_m68k_state)),
+		m_drcuml(NULL),
+		m_drcfe(NULL),
+		m_drcoptions(M68KDRC_COMPATIBLE_OPTIONS),
+		m_drc_core(NULL),
+		m_cache_dirty(TRUE),
+		m_entry(NULL),
+		m_nocode(NULL),
+		m_out_of_cycles(NULL),
+		m_resync(NULL)
+{
+	m_isdrc = (mconfig.options().drc() && mconfig.options().drc_m68k() && !mconfig.m_force_no_drc) ? true : false;
 	clear_all();
 }
 
@@ -2494,6 +2547,12 @@ void m68000_base_device::clear_all()
 
 void m68000_base_device::execute_run()
 {
+	if (m_drcuml != NULL && drc_usable())
+	{
+		execute_run_drc();
+		return;
+	}
+
 	cpu_execute();
 }
 
@@ -2504,10 +2563,16 @@ void m68000_base_device::device_start()
 void m68000_base_device::device_reset()
 {
 	reset_cpu();
+	m_cache_dirty = TRUE;
 }
 
 void m68000_base_device::device_stop()
 {
+	/* clean up the DRC */
+	if (m_drcfe != NULL)
+		auto_free(machine(), m_drcfe);
+	if (m_drcuml != NULL)
+		auto_free(machine(), m_drcuml);
 }
 
 
@@ -2813,3 +2878,5 @@ void mcf5206e_device::device_start()
 {
 	init_cpu_coldfire();
 }
+
+#include "m68kdrc.c"
@@ -1590,7 +1590,7 @@ INLINE void m68ki_exception_privilege_violation(m68000_base_device *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_PRIVILEGE_VIOLATION);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_PRIVILEGE_VIOLATION] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_PRIVILEGE_VIOLATION] - m68k->cyc_instruction[m68k->jump_index[m68k->ir]];
 }
 
 /* Exception for A-Line instructions */
@@ -1603,7 +1603,7 @@ INLINE void m68ki_exception_1010(m68000_base_device *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_1010);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1010] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1010] - m68k->cyc_instruction[m68k->jump_index[m68k->ir]];
 }
 
 /* Exception for F-Line instructions */
@@ -1616,7 +1616,7 @@ INLINE void m68ki_exception_1111(m68000_base_device *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_1111);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1111] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1111] - m68k->cyc_instruction[m68k->jump_index[m68k->ir]];
 }
 
 /* Exception for illegal instructions */
@@ -1635,7 +1635,7 @@ INLINE void m68ki_exception_illegal(m68000_base_device *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_ILLEGAL_INSTRUCTION);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ILLEGAL_INSTRUCTION] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ILLEGAL_INSTRUCTION] - m68k->cyc_instruction[m68k->jump_index[m68k->ir]];
 }
 
 /* Exception for format errror in RTE */
@@ -1646,7 +1646,7 @@ INLINE void m68ki_exception_format_error(m68000_base_device *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_FORMAT_ERROR);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_FORMAT_ERROR] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_FORMAT_ERROR] - m68k->cyc_instruction[m68k->jump_index[m68k->ir]];
 }
 
 /* Exception for address error */
@@ -1672,7 +1672,7 @@ INLINE void m68ki_exception_address_error(m68000_base_device *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_ADDRESS_ERROR);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ADDRESS_ERROR] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ADDRESS_ERROR] - m68k->cyc_instruction[m68k->jump_index[m68k->ir]];
 }
 
 
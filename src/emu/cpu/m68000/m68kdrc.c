@@ -0,0 +1,1539 @@
+// license:BSD-3-Clause
+// copyright-holders:Karl Stenerud
+/***************************************************************************
+
+    m68kdrc.c
+    Universal machine language-based 68000 emulator.
+
+    Register-to-register moves and arithmetic, MOVEQ and the relative
+    branches are translated directly to UML, as are MOVE, TST and the
+    long ADD/SUB/CMP/AND/OR forms when their operands are registers,
+    immediates, (An), (An)+, -(An), d16(An), d8(An,Xn) or absolute
+    addresses; those read and write memory with UML READ/WRITE.
+    Misaligned accesses and everything else are handed back to the
+    interpreter one instruction at a time; the generated code then checks
+    whether it can keep running the block or has to redispatch.
+
+    Only the 68000, 68010 and 68EC020/68020 are recompiled, and only
+    while neither the PMMU nor the HMMU is translating addresses.
+
+***************************************************************************/
+
+#include "cpu/drcumlsh.h"
+
+using namespace uml;
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* exit codes */
+#define EXECUTE_OUT_OF_CYCLES       0
+#define EXECUTE_MISSING_CODE        1
+#define EXECUTE_RESYNC              2
+
+/* interpreter call status */
+#define STATUS_CONTINUE             0           /* carry on with the block */
+#define STATUS_REDISPATCH           1           /* control went somewhere the block doesn't know about */
+#define STATUS_EXIT                 2           /* return to the execute loop */
+
+/* ALU operations handled by generate_alu */
+enum
+{
+	ALU_ADD = 0,
+	ALU_SUB,
+	ALU_CMP,
+	ALU_AND,
+	ALU_OR,
+	ALU_EOR
+};
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+inline void m68000_base_device::alloc_handle(drcuml_state *drcuml, code_handle **handleptr, const char *name)
+{
+	if (*handleptr == NULL)
+		*handleptr = drcuml->handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    ea_step - return how far (An)+ and -(An) move
+    the register; byte accesses keep A7 even
+-------------------------------------------------*/
+
+inline int m68000_base_device::ea_step(const drc_ea &ea, int size)
+{
+	return (size == 1 && ea.reg == 15) ? 2 : size;
+}
+
+
+/*-------------------------------------------------
+    ea_operand_size - return the UML size for an
+    operand size in bytes
+-------------------------------------------------*/
+
+inline uml::operand_size m68000_base_device::ea_operand_size(int size)
+{
+	return (size == 1) ? SIZE_BYTE : (size == 2) ? SIZE_WORD : SIZE_DWORD;
+}
+
+
+/*-------------------------------------------------
+    drc_usable - return true if the current
+    state can be run by the recompiler
+-------------------------------------------------*/
+
+inline bool m68000_base_device::drc_usable()
+{
+	return !m_address_error && !t1_flag && !t0_flag && !pmmu_enabled && !hmmu_enabled && instruction_hook.isnull();
+}
+
+
+/*-------------------------------------------------
+    cfunc_execute_interpreted - C wrapper for the
+    interpreter thunk
+-------------------------------------------------*/
+
+void m68000_base_device::cfunc_execute_interpreted(void *param)
+{
+	((m68000_base_device *)param)->func_execute_interpreted();
+}
+
+
+/***************************************************************************
+    STATE TRANSFER
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_export_state - copy the state the
+    generated code works on out of the device
+-------------------------------------------------*/
+
+void m68000_base_device::drc_export_state()
+{
+	internal_m68k_state *core = m_drc_core;
+
+	for (int regnum = 0; regnum < 16; regnum++)
+		core->dar[regnum] = dar[regnum];
+	core->pc = pc;
+	core->x_flag = x_flag;
+	core->n_flag = n_flag;
+	core->not_z_flag = not_z_flag;
+	core->v_flag = v_flag;
+	core->c_flag = c_flag;
+	core->icount = remaining_cycles;
+}
+
+
+/*-------------------------------------------------
+    drc_import_state - copy the state the
+    generated code works on back into the device
+-------------------------------------------------*/
+
+void m68000_base_device::drc_import_state()
+{
+	internal_m68k_state *core = m_drc_core;
+
+	for (int regnum = 0; regnum < 16; regnum++)
+		dar[regnum] = core->dar[regnum];
+	pc = core->pc;
+	x_flag = core->x_flag;
+	n_flag = core->n_flag;
+	not_z_flag = core->not_z_flag;
+	v_flag = core->v_flag;
+	c_flag = core->c_flag;
+	remaining_cycles = core->icount;
+}
+
+
+/*-------------------------------------------------
+    drc_update_status - export the state after an
+    interpreted instruction and decide whether
+    the generated code may carry on
+-------------------------------------------------*/
+
+void m68000_base_device::drc_update_status()
+{
+	internal_m68k_state *core = m_drc_core;
+	UINT32 status = STATUS_CONTINUE;
+
+	drc_export_state();
+
+	/* anything the execute loop has to look at sends us back there */
+	if (remaining_cycles <= 0 || stopped || m_cache_dirty || !drc_usable())
+		status = STATUS_EXIT;
+
+	/* an unexpected PC means we need a different block */
+	else if (core->nextpc != 0xffffffff && core->pc != core->nextpc)
+		status = STATUS_REDISPATCH;
+
+	core->status = status;
+}
+
+
+/*-------------------------------------------------
+    func_execute_interpreted - run a single
+    instruction through the interpreter on
+    behalf of the generated code
+-------------------------------------------------*/
+
+void m68000_base_device::func_execute_interpreted()
+{
+	drc_import_state();
+
+	/* this is one pass through the main loop of cpu_execute */
+	m68ki_trace_t1(this);
+	debugger_instruction_hook(this, REG_PC(this));
+	REG_PPC(this) = REG_PC(this);
+
+	try
+	{
+		run_mode = RUN_MODE_NORMAL;
+		ir = m68ki_read_imm_16(this);
+		UINT16 index = jump_index[ir];
+		m68ki_instruction_handlers[index](this);
+		remaining_cycles -= cyc_instruction[index];
+	}
+	catch (int error)
+	{
+		if (error != 10)
+			throw;
+
+		/* the execute loop hands address errors to the interpreter */
+		m_address_error = 1;
+	}
+
+	if (!m_address_error)
+		m68ki_exception_if_trace(this);
+	drc_update_status();
+}
+
+
+/***************************************************************************
+    CORE EXECUTION
+***************************************************************************/
+
+/*-------------------------------------------------
+    init_drc - set up the recompiler for the CPU
+    types it supports
+-------------------------------------------------*/
+
+void m68000_base_device::init_drc()
+{
+	if (!m_isdrc || m_drcuml != NULL)
+		return;
+
+	/* allocate the state shared with generated code from the cache */
+	m_drc_core = (internal_m68k_state *)m_cache.alloc_near(sizeof(internal_m68k_state));
+	memset(m_drc_core, 0, sizeof(*m_drc_core));
+
+	/* initialize the UML generator */
+	m_drcuml = auto_alloc(machine(), drcuml_state(*this, m_cache, 0, 1, 32, 0));
+
+	/* add symbols for our stuff */
+	m_drcuml->symbol_add(&m_drc_core->pc, sizeof(m_drc_core->pc), "pc");
+	m_drcuml->symbol_add(&m_drc_core->icount, sizeof(m_drc_core->icount), "icount");
+	static const char *const regnames[16] = { "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7" };
+	for (int regnum = 0; regnum < 16; regnum++)
+		m_drcuml->symbol_add(&m_drc_core->dar[regnum], sizeof(m_drc_core->dar[regnum]), regnames[regnum]);
+	m_drcuml->symbol_add(&m_drc_core->status, sizeof(m_drc_core->status), "status");
+
+	/* initialize the front-end helper */
+	m_drcfe = auto_alloc(machine(), m68k_frontend(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE));
+	m_drcfe->set_superblocks(true);
+
+	/* mark the cache dirty so it is updated on next execute */
+	m_cache_dirty = TRUE;
+}
+
+
+/*-------------------------------------------------
+    m68kdrc_set_options - configure DRC options
+-------------------------------------------------*/
+
+void m68000_base_device::m68kdrc_set_options(UINT32 options)
+{
+	if (!m_isdrc)
+		return;
+	m_drcoptions = options;
+}
+
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void m68000_base_device::code_flush_cache()
+{
+	drcuml_state *drcuml = m_drcuml;
+
+	/* empty the transient cache contents */
+	drcuml->reset();
+
+	try
+	{
+		/* generate the entry point and exception handlers */
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+		static_generate_resync();
+		static_generate_entry_point();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unable to generate 68000 static code\n");
+	}
+
+	m_cache_dirty = FALSE;
+}
+
+
+/*-------------------------------------------------
+    execute_run_drc - execute cycles using the
+    recompiler
+-------------------------------------------------*/
+
+void m68000_base_device::execute_run_drc()
+{
+	drcuml_state *drcuml = m_drcuml;
+	int execute_result;
+
+	initial_cycles = remaining_cycles;
+
+	/* eat up any reset cycles */
+	if (reset_cycles) {
+		int rc = reset_cycles;
+		reset_cycles = 0;
+		remaining_cycles -= rc;
+
+		if (remaining_cycles <= 0) return;
+	}
+
+	/* See if interrupts came in */
+	m68ki_check_interrupts(this);
+
+	while (remaining_cycles > 0)
+	{
+		/* a stopped CPU just burns the rest of the slice */
+		if (stopped)
+		{
+			remaining_cycles = 0;
+			break;
+		}
+
+		/* let the interpreter finish the slice if it needs anything the generated code doesn't model */
+		if (!drc_usable())
+		{
+			cpu_execute();
+			return;
+		}
+
+		/* reset the cache if dirty */
+		if (m_cache_dirty)
+			code_flush_cache();
+
+		/* run as much as we can */
+		drc_export_state();
+		execute_result = drcuml->execute(*m_entry);
+		drc_import_state();
+
+		if (execute_result == EXECUTE_MISSING_CODE)
+			code_compile_block(pc);
+	}
+
+	/* set previous PC to current PC for the next entry into the loop */
+	REG_PPC(this) = REG_PC(this);
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block at the
+    specified pc
+-------------------------------------------------*/
+
+void m68000_base_device::code_compile_block(offs_t pc)
+{
+	drcuml_state *drcuml = m_drcuml;
+	compiler_state compiler = { 0 };
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
+	int override = FALSE;
+	drcuml_block *block;
+
+	g_profiler.start(PROFILER_DRC_COMPILE);
+
+	/* get a description of this sequence */
+	desclist = m_drcfe->describe_code(pc);
+
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			/* start the block */
+			block = drcuml->begin_block(4096);
+
+			/* loop until we get through all instruction sequences */
+			for (seqhead = desclist; seqhead != NULL; seqhead = seqlast->next())
+			{
+				const opcode_desc *curdesc;
+				UINT32 nextpc;
+
+				/* add a code log entry */
+				if (drcuml->logging())
+					block->append_comment("-------------------------");                     // comment
+
+				/* determine the last instruction in this sequence */
+				for (seqlast = seqhead; seqlast != NULL; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != NULL);
+
+				/* if we don't have a hash for this mode/pc, or if we are overriding all, add one */
+				if (override || !drcuml->hash_exists(0, seqhead->pc))
+					UML_HASH(block, 0, seqhead->pc);                                        // hash    0,pc
+
+				/* if we already have a hash, and this is the first sequence, assume that we */
+				/* are recompiling due to being out of sync and allow future overrides */
+				else if (seqhead == desclist)
+				{
+					override = TRUE;
+					UML_HASH(block, 0, seqhead->pc);                                        // hash    0,pc
+				}
+
+				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
+				else
+				{
+					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
+					UML_HASHJMP(block, 0, seqhead->pc, *m_nocode);                          // hashjmp 0,seqhead->pc,nocode
+					continue;
+				}
+
+				/* validate this code block if we're not pointing into ROM */
+				if (!(seqhead->flags & (OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_WILL_CAUSE_EXCEPTION)) && m_ospace->get_write_ptr(seqhead->physpc) != NULL)
+					generate_checksum_block(block, &compiler, seqhead, seqlast);
+
+				/* label this instruction, if it may be jumped to locally */
+				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
+					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
+
+				/* iterate over instructions in the sequence and compile them */
+				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+				{
+					/* superblock side entries need settled cycles, a hash entry and a label */
+					if (curdesc->flags & OPFLAG_SIDE_ENTRY)
+					{
+						generate_update_cycles(block, &compiler, curdesc->pc, FALSE);      // <subtract cycles>
+						if (override || !drcuml->hash_exists(0, curdesc->pc))
+						{
+							/* jumps from other blocks land here without passing the check above; */
+							/* falling through and local branches go straight to the label */
+							if (!(curdesc->flags & (OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_WILL_CAUSE_EXCEPTION)) && m_ospace->get_write_ptr(curdesc->physpc) != NULL)
+							{
+								code_label skip = compiler.labelnum++;
+								UML_JMP(block, skip);                                      // jmp     skip
+								UML_HASH(block, 0, curdesc->pc);                      // hash    0,pc
+								generate_checksum_block(block, &compiler, curdesc, seqlast);
+								UML_LABEL(block, skip);                                    // skip:
+							}
+							else
+								UML_HASH(block, 0, curdesc->pc);                      // hash    0,pc
+						}
+						UML_LABEL(block, curdesc->pc | 0x80000000);                     // label   curdesc->pc | 0x80000000
+					}
+					generate_sequence_instruction(block, &compiler, curdesc);
+				}
+
+				/* if we need to return to the start, do it */
+				if (seqlast->flags & OPFLAG_RETURN_TO_START)
+					nextpc = pc;
+
+				/* otherwise we just go to the next instruction */
+				else
+					nextpc = seqlast->pc + seqlast->length;
+
+				/* count off cycles and go there */
+				generate_update_cycles(block, &compiler, nextpc, TRUE);                    // <subtract cycles>
+				if (seqlast->next() == NULL || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, 0, nextpc, *m_nocode);                               // hashjmp 0,nextpc,nocode
+			}
+
+			/* end the sequence */
+			block->end();
+			g_profiler.stop();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+/***************************************************************************
+    C FUNCTION CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void m68000_base_device::static_generate_entry_point()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(20);
+
+	/* forward references */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+
+	alloc_handle(drcuml, &m_entry, "entry");
+	UML_HANDLE(block, *m_entry);                                                            // handle  entry
+
+	/* generate a hash jump via the current PC */
+	UML_HASHJMP(block, 0, mem(&m_drc_core->pc), *m_nocode);                                 // hashjmp 0,<pc>,nocode
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void m68000_base_device::static_generate_nocode_handler()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	/* generate a hash jump via the current mode and PC */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	UML_HANDLE(block, *m_nocode);                                                           // handle  nocode
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_drc_core->pc), I0);                                               // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                                  // exit    EXECUTE_MISSING_CODE
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_out_of_cycles - generate an
+    out of cycles exception handler
+-------------------------------------------------*/
+
+void m68000_base_device::static_generate_out_of_cycles()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);                                                    // handle  out_of_cycles
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_drc_core->pc), I0);                                               // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                                 // exit    EXECUTE_OUT_OF_CYCLES
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_resync - generate the handler
+    taken when an interpreted instruction didn't
+    go where the block expected
+-------------------------------------------------*/
+
+void m68000_base_device::static_generate_resync()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	alloc_handle(drcuml, &m_resync, "resync");
+	UML_HANDLE(block, *m_resync);                                                           // handle  resync
+	UML_CMP(block, mem(&m_drc_core->status), STATUS_EXIT);                                  // cmp     [status],STATUS_EXIT
+	UML_JMPc(block, COND_E, 1);                                                             // je      1
+	UML_HASHJMP(block, 0, mem(&m_drc_core->pc), *m_nocode);                                 // hashjmp 0,<pc>,nocode
+	UML_LABEL(block, 1);                                                                    // 1:
+	UML_EXIT(block, EXECUTE_RESYNC);                                                        // exit    EXECUTE_RESYNC
+
+	block->end();
+}
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    log_add_disasm_comment - add a comment
+    including disassembly of a 68000 instruction
+-------------------------------------------------*/
+
+void m68000_base_device::log_add_disasm_comment(drcuml_block *block, UINT32 pc, const opcode_desc *desc)
+{
+	if (m_drcuml->logging())
+	{
+		char buffer[256];
+		UINT8 oprom[ARRAY_LENGTH(desc->opptr.w) * 2];
+		for (int word = 0; word < ARRAY_LENGTH(desc->opptr.w); word++)
+		{
+			oprom[word * 2 + 0] = desc->opptr.w[word] >> 8;
+			oprom[word * 2 + 1] = desc->opptr.w[word];
+		}
+		disasm_disassemble(buffer, pc, oprom, oprom, 0);
+		block->append_comment("%08X: %s", pc, buffer);                                      // comment
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and generate
+    an exception if out
+-------------------------------------------------*/
+
+void m68000_base_device::generate_update_cycles(drcuml_block *block, compiler_state *compiler, uml::parameter param, int allow_exception)
+{
+	/* account for cycles */
+	if ((INT32)compiler->cycles > 0)
+	{
+		UML_SUB(block, mem(&m_drc_core->icount), mem(&m_drc_core->icount), compiler->cycles);   // sub     icount,icount,cycles
+		if (allow_exception)
+			UML_EXHc(block, COND_LE, *m_out_of_cycles, param);                              // exh     out_of_cycles,nextpc
+	}
+	compiler->cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void m68000_base_device::generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	const opcode_desc *curdesc;
+
+	if (m_drcuml->logging())
+		block->append_comment("[Validation for %08X]", seqhead->pc);                        // comment
+
+	/* compare the opcode words of each instruction we kept a copy of */
+	for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+	{
+		if (curdesc != seqhead && !(m_drcoptions & M68KDRC_STRICT_VERIFY))
+			break;
+		if (curdesc->flags & (OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_WILL_CAUSE_EXCEPTION))
+			continue;
+
+		for (UINT32 word = 0; word < curdesc->length / 2 && word < ARRAY_LENGTH(curdesc->opptr.w); word++)
+		{
+			void *base = m_odirect->read_ptr((curdesc->physpc + word * 2) & m_ospace->bytemask(), opcode_xor);
+			if (base == NULL)
+				continue;
+
+			UML_LOAD(block, I0, base, 0, SIZE_WORD, SCALE_x2);                              // load    i0,base,0,word
+			UML_CMP(block, I0, curdesc->opptr.w[word]);                                     // cmp     i0,opptr.w[word]
+			UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                               // exne    nocode,seqhead->pc
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void m68000_base_device::generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* add an entry for the log */
+	if (m_drcuml->logging() && !(desc->flags & (OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_WILL_CAUSE_EXCEPTION)))
+		log_add_disasm_comment(block, desc->pc, desc);
+
+	/* the interpreter calls the debugger hook itself, so native code is only used when not debugging */
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0 || (desc->flags & (OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_WILL_CAUSE_EXCEPTION)) ||
+		!generate_opcode(block, compiler, desc))
+		generate_interpreted(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_interpreted - generate a call into
+    the interpreter for a single instruction
+-------------------------------------------------*/
+
+void m68000_base_device::generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* the interpreter needs an accurate cycle count */
+	generate_update_cycles(block, compiler, desc->pc, TRUE);                                // <subtract cycles>
+
+	UML_MOV(block, mem(&m_drc_core->pc), desc->pc);                                         // mov     [pc],desc->pc
+	UML_MOV(block, mem(&m_drc_core->nextpc), (desc->flags & OPFLAG_IS_BRANCH) ? 0xffffffff : desc->pc + desc->length);
+																							// mov     [nextpc],nextpc
+	UML_CALLC(block, cfunc_execute_interpreted, this);                                      // callc   execute_interpreted
+	UML_CMP(block, mem(&m_drc_core->status), STATUS_CONTINUE);                              // cmp     [status],STATUS_CONTINUE
+	UML_EXHc(block, COND_NE, *m_resync, 0);                                                 // exh     resync,0,ne
+
+	/* branches go wherever the interpreter sent them */
+	if (desc->flags & OPFLAG_IS_BRANCH)
+	{
+		code_label skip = compiler->labelnum++;
+
+		if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
+		{
+			code_label nottaken = compiler->labelnum++;
+			UML_CMP(block, mem(&m_drc_core->pc), desc->targetpc);                           // cmp     [pc],desc->targetpc
+			UML_JMPc(block, COND_NE, nottaken);                                             // jne     nottaken
+			generate_branch(block, compiler, desc, desc->targetpc);                         // <branch>
+			UML_LABEL(block, nottaken);                                                     // nottaken:
+		}
+		if (desc->flags & OPFLAG_IS_CONDITIONAL_BRANCH)
+		{
+			UML_CMP(block, mem(&m_drc_core->pc), desc->pc + desc->length);                  // cmp     [pc],nextpc
+			UML_JMPc(block, COND_E, skip);                                                  // je      skip
+		}
+		UML_HASHJMP(block, 0, mem(&m_drc_core->pc), *m_nocode);                             // hashjmp 0,<pc>,nocode
+		UML_LABEL(block, skip);                                                             // skip:
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_branch - generate a jump to a known
+    target
+-------------------------------------------------*/
+
+void m68000_base_device::generate_branch(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, offs_t target)
+{
+	compiler_state compiler_temp = *compiler;
+
+	/* update the cycles and jump through the hash table to the target */
+	generate_update_cycles(block, &compiler_temp, target, TRUE);                            // <subtract cycles>
+	if ((desc->flags & OPFLAG_INTRABLOCK_BRANCH) && target == desc->targetpc)
+		UML_JMP(block, target | 0x80000000);                                                // jmp     target | 0x80000000
+	else
+		UML_HASHJMP(block, 0, target, *m_nocode);                                           // hashjmp 0,target,nocode
+
+	/* update the label */
+	compiler->labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_logic_flags - set the flags the way
+    a move or logical operation does; the result
+    is expected to be masked to size bytes
+-------------------------------------------------*/
+
+void m68000_base_device::generate_logic_flags(drcuml_block *block, uml::parameter result, int size)
+{
+	internal_m68k_state *core = m_drc_core;
+
+	UML_SHR(block, mem(&core->n_flag), result, size * 8 - 8);                               // shr     [n],result,size*8-8
+	UML_MOV(block, mem(&core->not_z_flag), result);                                         // mov     [not_z],result
+	UML_MOV(block, mem(&core->v_flag), 0);                                                  // mov     [v],0
+	UML_MOV(block, mem(&core->c_flag), 0);                                                  // mov     [c],0
+}
+
+
+/*-------------------------------------------------
+    generate_alu - generate a long-sized ALU
+    operation on a data register; src may be a
+    register, an immediate or I2
+-------------------------------------------------*/
+
+void m68000_base_device::generate_alu(drcuml_block *block, int aluop, int dstreg, uml::parameter src)
+{
+	internal_m68k_state *core = m_drc_core;
+
+	UML_MOV(block, I0, mem(&core->dar[dstreg]));                                            // mov     i0,dst
+	UML_MOV(block, I1, src);                                                                // mov     i1,src
+
+	switch (aluop)
+	{
+		case ALU_ADD:   UML_ADD(block, I2, I0, I1);                                         break;
+		case ALU_SUB:
+		case ALU_CMP:   UML_SUB(block, I2, I0, I1);                                         break;
+		case ALU_AND:   UML_AND(block, I2, I0, I1);                                         break;
+		case ALU_OR:    UML_OR(block, I2, I0, I1);                                          break;
+		case ALU_EOR:   UML_XOR(block, I2, I0, I1);                                         break;
+	}
+
+	if (aluop == ALU_ADD || aluop == ALU_SUB || aluop == ALU_CMP)
+	{
+		/* capture carry and overflow straight away and move them to where the interpreter keeps them */
+		UML_SETc(block, COND_C, I3);                                                        // setc    i3,c
+		UML_SETc(block, COND_V, I1);                                                        // setc    i1,v
+		UML_SHL(block, mem(&core->c_flag), I3, 8);                                          // shl     [c],i3,8
+		if (aluop != ALU_CMP)
+			UML_SHL(block, mem(&core->x_flag), I3, 8);                                      // shl     [x],i3,8
+		UML_SHL(block, mem(&core->v_flag), I1, 7);                                          // shl     [v],i1,7
+		UML_SHR(block, mem(&core->n_flag), I2, 24);                                         // shr     [n],i2,24
+		UML_MOV(block, mem(&core->not_z_flag), I2);                                         // mov     [not_z],i2
+	}
+	else
+		generate_logic_flags(block, I2, 4);
+
+	/* write back the result */
+	if (aluop != ALU_CMP)
+		UML_MOV(block, mem(&core->dar[dstreg]), I2);                                        // mov     dst,i2
+}
+
+
+/*-------------------------------------------------
+    decode_ea - decode an effective address and
+    its extension words, starting at 'word';
+    returns false for the modes that stay in the
+    interpreter
+-------------------------------------------------*/
+
+bool m68000_base_device::decode_ea(const opcode_desc *desc, int mode, int reg, int size, int &word, drc_ea &ea)
+{
+	int words;
+
+	ea.mode = (mode == 7) ? 7 + reg : mode;
+	ea.reg = (mode == 0) ? reg : 8 + reg;
+	ea.ext = 0;
+	ea.pc = desc->pc + word * 2;
+
+	switch (ea.mode)
+	{
+		case 0:     // Dn
+		case 1:     // An
+		case 2:     // (An)
+		case 3:     // (An)+
+		case 4:     // -(An)
+			return true;
+
+		case 5:     // d16(An)
+		case 6:     // d8(An,Xn)
+		case 7:     // abs.W
+			words = 1;
+			break;
+
+		case 8:     // abs.L
+			words = 2;
+			break;
+
+		case 11:    // #imm
+			words = (size == 4) ? 2 : 1;
+			break;
+
+		default:    // PC-relative operands come from the opcode space
+			return false;
+	}
+
+	if (word + words > (int)ARRAY_LENGTH(desc->opptr.w) || (word + words) * 2 > desc->length)
+		return false;
+	ea.ext = desc->opptr.w[word];
+	if (words == 2)
+		ea.ext = (ea.ext << 16) | desc->opptr.w[word + 1];
+	word += words;
+	ea.pc = desc->pc + word * 2;
+
+	switch (ea.mode)
+	{
+		case 5:
+		case 7:
+			ea.ext = (INT16)ea.ext;
+			break;
+
+		case 6:
+			/* the 68020's full extension format is left to the interpreter */
+			if (!CPU_TYPE_IS_010_LESS(cpu_type) && (ea.ext & 0x0100))
+				return false;
+			break;
+
+		case 11:
+			if (size == 1)
+				ea.ext &= 0xff;
+			break;
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_ea_address - compute the address of
+    a memory operand into dst; bias is added to
+    register biasreg, which the source operand of
+    the same instruction has already moved
+-------------------------------------------------*/
+
+void m68000_base_device::generate_ea_address(drcuml_block *block, const drc_ea &ea, int size, uml::parameter dst, int biasreg, INT32 bias)
+{
+	internal_m68k_state *core = m_drc_core;
+	INT32 offset = (ea.reg == biasreg) ? bias : 0;
+
+	switch (ea.mode)
+	{
+		case 4:
+			offset -= ea_step(ea, size);
+			break;
+
+		case 5:
+			offset += (INT32)ea.ext;
+			break;
+
+		case 6:
+		{
+			int index = ea.ext >> 12;
+
+			if (ea.ext & 0x0800)
+				UML_MOV(block, dst, mem(&core->dar[index]));                                // mov     dst,xn
+			else
+				UML_SEXT(block, dst, mem(&core->dar[index]), SIZE_WORD);                    // sext    dst,xn,word
+			if (!CPU_TYPE_IS_010_LESS(cpu_type) && ((ea.ext >> 9) & 3) != 0)
+				UML_SHL(block, dst, dst, (ea.ext >> 9) & 3);                                // shl     dst,dst,scale
+			UML_ADD(block, dst, dst, mem(&core->dar[ea.reg]));                              // add     dst,dst,an
+			offset += (INT8)ea.ext;
+			if (offset != 0)
+				UML_ADD(block, dst, dst, offset);                                           // add     dst,dst,offset
+			return;
+		}
+
+		case 7:
+		case 8:
+			UML_MOV(block, dst, ea.ext);                                                    // mov     dst,address
+			return;
+	}
+
+	if (offset != 0)
+		UML_ADD(block, dst, mem(&core->dar[ea.reg]), offset);                               // add     dst,an,offset
+	else
+		UML_MOV(block, dst, mem(&core->dar[ea.reg]));                                       // mov     dst,an
+}
+
+
+/*-------------------------------------------------
+    generate_memory_begin - settle the cycle count
+    and compute the source and destination
+    addresses into I0 and I1; returns true if a
+    misaligned address branches to 'slow', which
+    generate_memory_end fills in
+-------------------------------------------------*/
+
+bool m68000_base_device::generate_memory_begin(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, const drc_ea *src, const drc_ea *dst, int size, code_label &slow)
+{
+	bool srcmem = (src != NULL && src->is_memory());
+	bool dstmem = (dst != NULL && dst->is_memory());
+	int biasreg = -1;
+	INT32 bias = 0;
+
+	if (!srcmem && !dstmem)
+		return false;
+
+	/* handlers may look at the time, so the cycles so far have to be counted off first */
+	generate_update_cycles(block, compiler, desc->pc, TRUE);                                // <subtract cycles>
+	if (size > 1)
+		slow = compiler->labelnum++;
+
+	/* odd addresses take an address error on the 68000, and the 68020 needs */
+	/* the unaligned handlers for them and for longs off a dword boundary */
+	if (srcmem)
+	{
+		generate_ea_address(block, *src, size, I0, -1, 0);
+		if (size > 1)
+		{
+			UML_TEST(block, I0, (size == 4 && !CPU_TYPE_IS_010_LESS(cpu_type)) ? 3 : 1);   // test    i0,align
+			UML_JMPc(block, COND_NZ, slow);                                                 // jnz     slow
+		}
+		if (src->mode == 3 || src->mode == 4)
+		{
+			biasreg = src->reg;
+			bias = (src->mode == 3) ? ea_step(*src, size) : -ea_step(*src, size);
+		}
+	}
+	if (dstmem)
+	{
+		generate_ea_address(block, *dst, size, I1, biasreg, bias);
+		if (size > 1)
+		{
+			UML_TEST(block, I1, (size == 4 && dst->mode != 4 && !CPU_TYPE_IS_010_LESS(cpu_type)) ? 3 : 1);
+																							// test    i1,align
+			UML_JMPc(block, COND_NZ, slow);                                                 // jnz     slow
+		}
+	}
+
+	/* show the handlers the cycle count, PC and function code the interpreter would */
+	/* the device is too far from the cache for mem(), so these go through LOAD/STORE */
+	UML_STORE(block, &remaining_cycles, 0, mem(&m_drc_core->icount), SIZE_DWORD, SCALE_x4); // store   remaining_cycles,0,[icount],dword
+	UML_STORE(block, &ppc, 0, desc->pc, SIZE_DWORD, SCALE_x4);                              // store   ppc,0,desc->pc,dword
+	UML_LOAD(block, I3, &s_flag, 0, SIZE_DWORD, SCALE_x4);                                  // load    i3,s_flag,0,dword
+	UML_OR(block, I3, I3, FUNCTION_CODE_USER_DATA);                                         // or      i3,i3,FUNCTION_CODE_USER_DATA
+	UML_STORE(block, &mmu_tmp_fc, 0, I3, SIZE_WORD, SCALE_x2);                              // store   mmu_tmp_fc,0,i3,word
+	return (size > 1);
+}
+
+
+/*-------------------------------------------------
+    generate_memory_end - take back the cycle
+    count the handlers may have changed and add
+    the interpreter call for misaligned accesses
+-------------------------------------------------*/
+
+void m68000_base_device::generate_memory_end(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, const drc_ea *src, const drc_ea *dst, bool checked, code_label slow)
+{
+	if (!(src != NULL && src->is_memory()) && !(dst != NULL && dst->is_memory()))
+	{
+		compiler->cycles += desc->cycles;
+		return;
+	}
+
+	UML_LOAD(block, I3, &remaining_cycles, 0, SIZE_DWORD, SCALE_x4);                        // load    i3,remaining_cycles,0,dword
+	UML_SUB(block, mem(&m_drc_core->icount), I3, desc->cycles);                             // sub     [icount],i3,cycles
+	UML_EXHc(block, COND_LE, *m_out_of_cycles, desc->pc + desc->length);                    // exh     out_of_cycles,nextpc
+
+	if (checked)
+	{
+		compiler_state compiler_temp = *compiler;
+		code_label done = compiler_temp.labelnum++;
+
+		UML_JMP(block, done);                                                               // jmp     done
+		UML_LABEL(block, slow);                                                             // slow:
+		generate_interpreted(block, &compiler_temp, desc);
+		UML_LABEL(block, done);                                                             // done:
+		compiler->labelnum = compiler_temp.labelnum;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_load_operand - load a source operand
+    into I2, masked to its size; memory operands
+    are read from the address in I0
+-------------------------------------------------*/
+
+void m68000_base_device::generate_load_operand(drcuml_block *block, const drc_ea &ea, int size)
+{
+	internal_m68k_state *core = m_drc_core;
+
+	switch (ea.mode)
+	{
+		case 0:
+		case 1:
+			if (size == 4)
+				UML_MOV(block, I2, mem(&core->dar[ea.reg]));                                // mov     i2,rn
+			else
+				UML_AND(block, I2, mem(&core->dar[ea.reg]), (size == 1) ? 0xff : 0xffff);  // and     i2,rn,mask
+			return;
+
+		case 11:
+			UML_MOV(block, I2, ea.ext);                                                     // mov     i2,imm
+			return;
+	}
+
+	UML_STORE(block, &pc, 0, ea.pc, SIZE_DWORD, SCALE_x4);                                  // store   pc,0,ea.pc,dword
+	UML_STORE(block, &mmu_tmp_rw, 0, 1, SIZE_WORD, SCALE_x2);                               // store   mmu_tmp_rw,0,1,word
+	UML_READ(block, I2, I0, ea_operand_size(size), SPACE_PROGRAM);                          // read    i2,i0,program_size
+	if (ea.mode == 3)
+		UML_ADD(block, mem(&core->dar[ea.reg]), mem(&core->dar[ea.reg]), ea_step(ea, size));   // add     an,an,step
+	else if (ea.mode == 4)
+		UML_SUB(block, mem(&core->dar[ea.reg]), mem(&core->dar[ea.reg]), ea_step(ea, size));   // sub     an,an,step
+}
+
+
+/*-------------------------------------------------
+    generate_store_operand - store I2 to a
+    destination operand; memory operands are
+    written to the address in I1, which may be
+    clobbered along with I0 and I3
+-------------------------------------------------*/
+
+void m68000_base_device::generate_store_operand(drcuml_block *block, const drc_ea &ea, int size)
+{
+	internal_m68k_state *core = m_drc_core;
+
+	switch (ea.mode)
+	{
+		case 0:
+			if (size == 4)
+				UML_MOV(block, mem(&core->dar[ea.reg]), I2);                                // mov     dn,i2
+			else
+				UML_ROLINS(block, mem(&core->dar[ea.reg]), I2, 0, (size == 1) ? 0xff : 0xffff); // rolins  dn,i2,0,mask
+			return;
+
+		case 1:
+			UML_MOV(block, mem(&core->dar[ea.reg]), I2);                                    // mov     an,i2
+			return;
+	}
+
+	UML_STORE(block, &pc, 0, ea.pc, SIZE_DWORD, SCALE_x4);                                  // store   pc,0,ea.pc,dword
+	UML_STORE(block, &mmu_tmp_rw, 0, 0, SIZE_WORD, SCALE_x2);                               // store   mmu_tmp_rw,0,0,word
+	if (size == 1 && CPU_TYPE_IS_010_LESS(cpu_type))
+	{
+		/* the 68000 drives the byte onto both halves of the data bus, as m68000_write_byte does */
+		UML_SHL(block, I3, I2, 8);                                                          // shl     i3,i2,8
+		UML_OR(block, I3, I3, I2);                                                          // or      i3,i3,i2
+		UML_ROLAND(block, I0, I1, 3, 8);                                                    // roland  i0,i1,3,8
+		UML_SHR(block, I0, 0xff00, I0);                                                     // shr     i0,0xff00,i0
+		UML_AND(block, I1, I1, ~1);                                                         // and     i1,i1,~1
+		UML_WRITEM(block, I1, I3, I0, SIZE_WORD, SPACE_PROGRAM);                            // writem  i1,i3,i0,program_word
+	}
+	else if (size == 4 && ea.mode == 4)
+	{
+		/* MOVE.L to -(An) writes the low word first */
+		UML_ADD(block, I0, I1, 2);                                                          // add     i0,i1,2
+		UML_WRITE(block, I0, I2, SIZE_WORD, SPACE_PROGRAM);                                 // write   i0,i2,program_word
+		UML_SHR(block, I3, I2, 16);                                                         // shr     i3,i2,16
+		UML_WRITE(block, I1, I3, SIZE_WORD, SPACE_PROGRAM);                                 // write   i1,i3,program_word
+	}
+	else
+		UML_WRITE(block, I1, I2, ea_operand_size(size), SPACE_PROGRAM);                     // write   i1,i2,program_size
+
+	if (ea.mode == 3)
+		UML_ADD(block, mem(&core->dar[ea.reg]), mem(&core->dar[ea.reg]), ea_step(ea, size));   // add     an,an,step
+	else if (ea.mode == 4)
+		UML_SUB(block, mem(&core->dar[ea.reg]), mem(&core->dar[ea.reg]), ea_step(ea, size));   // sub     an,an,step
+}
+
+
+/*-------------------------------------------------
+    generate_move - generate MOVE and MOVEA for
+    the operands decode_ea understands
+-------------------------------------------------*/
+
+bool m68000_base_device::generate_move(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	UINT16 op = desc->opptr.w[0];
+	int size = ((op >> 12) == 1) ? 1 : ((op >> 12) == 3) ? 2 : 4;
+	int word = 1;
+	drc_ea src, dst;
+	code_label slow = 0;
+
+	if (!decode_ea(desc, (op >> 3) & 7, op & 7, size, word, src) || !decode_ea(desc, (op >> 6) & 7, (op >> 9) & 7, size, word, dst) || dst.mode > 8)
+		return false;
+
+	/* an index register the source has just moved is rare enough to interpret */
+	if (dst.mode == 6 && (src.mode == 3 || src.mode == 4) && (int)(dst.ext >> 12) == src.reg)
+		return false;
+
+	bool checked = generate_memory_begin(block, compiler, desc, &src, &dst, size, slow);
+	generate_load_operand(block, src, size);
+	if (dst.mode == 1)
+	{
+		/* MOVEA sign-extends words and leaves the flags alone */
+		if (size == 2)
+			UML_SEXT(block, I2, I2, SIZE_WORD);                                             // sext    i2,i2,word
+	}
+	else
+		generate_logic_flags(block, I2, size);
+	generate_store_operand(block, dst, size);
+	generate_memory_end(block, compiler, desc, &src, &dst, checked, slow);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_ea_source - generate TST (aluop -1)
+    or a long ALU operation into dstreg, with the
+    source operand in any mode decode_ea
+    understands
+-------------------------------------------------*/
+
+bool m68000_base_device::generate_ea_source(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int size, int aluop, int dstreg)
+{
+	UINT16 op = desc->opptr.w[0];
+	int word = 1;
+	drc_ea src;
+	code_label slow = 0;
+
+	if (!decode_ea(desc, (op >> 3) & 7, op & 7, size, word, src))
+		return false;
+
+	bool checked = generate_memory_begin(block, compiler, desc, &src, NULL, size, slow);
+	generate_load_operand(block, src, size);
+	if (aluop < 0)
+		generate_logic_flags(block, I2, size);
+	else
+		generate_alu(block, aluop, dstreg, I2);
+	generate_memory_end(block, compiler, desc, &src, NULL, checked, slow);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_condition - evaluate a condition
+    into I0; for odd conditions I0 is 1 when the
+    condition holds, for even ones when it fails
+-------------------------------------------------*/
+
+void m68000_base_device::generate_condition(drcuml_block *block, int cc)
+{
+	internal_m68k_state *core = m_drc_core;
+
+	switch (cc >> 1)
+	{
+		case 1:     // HI/LS
+			UML_ROLAND(block, I0, mem(&core->c_flag), 24, 1);                               // roland  i0,[c],24,1
+			UML_CMP(block, mem(&core->not_z_flag), 0);                                      // cmp     [not_z],0
+			UML_SETc(block, COND_E, I1);                                                    // sete    i1
+			UML_OR(block, I0, I0, I1);                                                      // or      i0,i0,i1
+			break;
+
+		case 2:     // CC/CS
+			UML_ROLAND(block, I0, mem(&core->c_flag), 24, 1);                               // roland  i0,[c],24,1
+			break;
+
+		case 3:     // NE/EQ
+			UML_CMP(block, mem(&core->not_z_flag), 0);                                      // cmp     [not_z],0
+			UML_SETc(block, COND_E, I0);                                                    // sete    i0
+			break;
+
+		case 4:     // VC/VS
+			UML_ROLAND(block, I0, mem(&core->v_flag), 25, 1);                               // roland  i0,[v],25,1
+			break;
+
+		case 5:     // PL/MI
+			UML_ROLAND(block, I0, mem(&core->n_flag), 25, 1);                               // roland  i0,[n],25,1
+			break;
+
+		case 6:     // GE/LT
+			UML_XOR(block, I0, mem(&core->n_flag), mem(&core->v_flag));                     // xor     i0,[n],[v]
+			UML_ROLAND(block, I0, I0, 25, 1);                                               // roland  i0,i0,25,1
+			break;
+
+		case 7:     // GT/LE
+			UML_XOR(block, I0, mem(&core->n_flag), mem(&core->v_flag));                     // xor     i0,[n],[v]
+			UML_ROLAND(block, I0, I0, 25, 1);                                               // roland  i0,i0,25,1
+			UML_CMP(block, mem(&core->not_z_flag), 0);                                      // cmp     [not_z],0
+			UML_SETc(block, COND_E, I1);                                                    // sete    i1
+			UML_OR(block, I0, I0, I1);                                                      // or      i0,i0,i1
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_bcc - generate BRA or Bcc; cc is 0
+    for BRA
+-------------------------------------------------*/
+
+void m68000_base_device::generate_bcc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int cc, INT32 notake_cycles)
+{
+	code_label skip = compiler->labelnum++;
+
+	if (cc != 0)
+	{
+		generate_condition(block, cc);
+		UML_TEST(block, I0, 1);                                                             // test    i0,1
+		UML_JMPc(block, (cc & 1) ? COND_Z : COND_NZ, skip);                                 // jcc     skip
+	}
+
+	compiler_state compiler_temp = *compiler;
+	compiler_temp.cycles += desc->cycles;
+	generate_branch(block, &compiler_temp, desc, desc->targetpc);
+	compiler->labelnum = compiler_temp.labelnum;
+
+	if (cc != 0)
+	{
+		UML_LABEL(block, skip);                                                             // skip:
+		compiler->cycles += desc->cycles + notake_cycles;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_dbcc - generate DBcc
+-------------------------------------------------*/
+
+void m68000_base_device::generate_dbcc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int cc, int regnum)
+{
+	internal_m68k_state *core = m_drc_core;
+	code_label done = compiler->labelnum++;
+	code_label expired = compiler->labelnum++;
+
+	/* DBF is the only form that never tests a condition */
+	if (cc != 1)
+	{
+		generate_condition(block, cc);
+		UML_TEST(block, I0, 1);                                                             // test    i0,1
+		UML_JMPc(block, (cc & 1) ? COND_NZ : COND_Z, done);                                 // jcc     done
+	}
+
+	/* decrement the low word of the counter */
+	UML_SUB(block, I1, mem(&core->dar[regnum]), 1);                                         // sub     i1,dn,1
+	UML_AND(block, I1, I1, 0xffff);                                                         // and     i1,i1,0xffff
+	UML_ROLINS(block, mem(&core->dar[regnum]), I1, 0, 0xffff);                              // rolins  dn,i1,0,0xffff
+	UML_CMP(block, I1, 0xffff);                                                             // cmp     i1,0xffff
+	UML_JMPc(block, COND_E, expired);                                                       // je      expired
+
+	compiler_state compiler_temp = *compiler;
+	compiler_temp.cycles += desc->cycles + (INT32)cyc_dbcc_f_noexp;
+	generate_branch(block, &compiler_temp, desc, desc->targetpc);
+	compiler->labelnum = compiler_temp.labelnum;
+
+	/* an expired counter costs extra; out of cycles is picked up at the end of the sequence */
+	UML_LABEL(block, expired);                                                              // expired:
+	if ((INT32)cyc_dbcc_f_exp != 0)
+		UML_SUB(block, mem(&core->icount), mem(&core->icount), (INT32)cyc_dbcc_f_exp);      // sub     icount,icount,f_exp
+	UML_LABEL(block, done);                                                                 // done:
+	compiler->cycles += desc->cycles;
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate native code for a
+    single instruction; returns false if the
+    interpreter has to handle it
+-------------------------------------------------*/
+
+bool m68000_base_device::generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	internal_m68k_state *core = m_drc_core;
+	UINT16 op = desc->opptr.w[0];
+	int rx = (op >> 9) & 7;
+	int ry = op & 7;
+	int srcmode = (op >> 3) & 7;
+
+	switch (op >> 12)
+	{
+		case 0x1:
+			/* MOVE.B */
+			return generate_move(block, compiler, desc);
+
+		case 0x2:
+			/* MOVE.L Rn,Dn and MOVEA.L Rn,An; the rest go through generate_move */
+			if ((op & 0x0180) != 0x0000 || srcmode >= 2)
+				return generate_move(block, compiler, desc);
+			UML_MOV(block, I0, mem(&core->dar[op & 15]));                                   // mov     i0,src
+			if (op & 0x0040)
+				UML_MOV(block, mem(&core->dar[8 + rx]), I0);                                // mov     ax,i0
+			else
+			{
+				UML_MOV(block, mem(&core->dar[rx]), I0);                                    // mov     dx,i0
+				generate_logic_flags(block, I0, 4);
+			}
+			compiler->cycles += desc->cycles;
+			return true;
+
+		case 0x3:
+			/* MOVE.W Rn,Dn and MOVEA.W Rn,An; the rest go through generate_move */
+			if ((op & 0x0180) != 0x0000 || srcmode >= 2)
+				return generate_move(block, compiler, desc);
+			if (op & 0x0040)
+			{
+				UML_SEXT(block, I0, mem(&core->dar[op & 15]), SIZE_WORD);                   // sext    i0,src,word
+				UML_MOV(block, mem(&core->dar[8 + rx]), I0);                                // mov     ax,i0
+			}
+			else
+			{
+				UML_AND(block, I0, mem(&core->dar[op & 15]), 0xffff);                       // and     i0,src,0xffff
+				UML_ROLINS(block, mem(&core->dar[rx]), I0, 0, 0xffff);                      // rolins  dx,i0,0,0xffff
+				generate_logic_flags(block, I0, 2);
+			}
+			compiler->cycles += desc->cycles;
+			return true;
+
+		case 0x4:
+			switch (op & 0xfff8)
+			{
+				case 0x4240:    /* CLR.W Dn */
+				case 0x4280:    /* CLR.L Dn */
+					if (op & 0x0080)
+						UML_MOV(block, mem(&core->dar[ry]), 0);                             // mov     dy,0
+					else
+						UML_AND(block, mem(&core->dar[ry]), mem(&core->dar[ry]), 0xffff0000);   // and     dy,dy,0xffff0000
+					UML_MOV(block, mem(&core->n_flag), 0);                                  // mov     [n],0
+					UML_MOV(block, mem(&core->not_z_flag), 0);                              // mov     [not_z],0
+					UML_MOV(block, mem(&core->v_flag), 0);                                  // mov     [v],0
+					UML_MOV(block, mem(&core->c_flag), 0);                                  // mov     [c],0
+					compiler->cycles += desc->cycles;
+					return true;
+
+				case 0x4840:    /* SWAP Dn */
+					UML_ROL(block, I0, mem(&core->dar[ry]), 16);                            // rol     i0,dy,16
+					UML_MOV(block, mem(&core->dar[ry]), I0);                                // mov     dy,i0
+					generate_logic_flags(block, I0, 4);
+					compiler->cycles += desc->cycles;
+					return true;
+
+				case 0x4880:    /* EXT.W Dn */
+					UML_SEXT(block, I0, mem(&core->dar[ry]), SIZE_BYTE);                    // sext    i0,dy,byte
+					UML_AND(block, I0, I0, 0xffff);                                         // and     i0,i0,0xffff
+					UML_ROLINS(block, mem(&core->dar[ry]), I0, 0, 0xffff);                  // rolins  dy,i0,0,0xffff
+					generate_logic_flags(block, I0, 2);
+					compiler->cycles += desc->cycles;
+					return true;
+
+				case 0x48c0:    /* EXT.L Dn */
+					UML_SEXT(block, I0, mem(&core->dar[ry]), SIZE_WORD);                    // sext    i0,dy,word
+					UML_MOV(block, mem(&core->dar[ry]), I0);                                // mov     dy,i0
+					generate_logic_flags(block, I0, 4);
+					compiler->cycles += desc->cycles;
+					return true;
+
+				case 0x4a40:    /* TST.W Dn */
+					UML_AND(block, I0, mem(&core->dar[ry]), 0xffff);                        // and     i0,dy,0xffff
+					generate_logic_flags(block, I0, 2);
+					compiler->cycles += desc->cycles;
+					return true;
+
+				case 0x4a80:    /* TST.L Dn */
+					UML_MOV(block, I0, mem(&core->dar[ry]));                                // mov     i0,dy
+					generate_logic_flags(block, I0, 4);
+					compiler->cycles += desc->cycles;
+					return true;
+			}
+			/* TST <ea> */
+			if ((op & 0xff00) == 0x4a00 && (op & 0x00c0) != 0x00c0)
+				return generate_ea_source(block, compiler, desc, 1 << ((op >> 6) & 3), -1, 0);
+			if (op == 0x4e71)   /* NOP */
+			{
+				compiler->cycles += desc->cycles;
+				return true;
+			}
+			return false;
+
+		case 0x5:
+		{
+			int size = (op >> 6) & 3;
+			UINT32 data = (rx == 0) ? 8 : rx;
+
+			/* DBcc */
+			if ((op & 0xf0f8) == 0x50c8)
+			{
+				if ((op & 0x0f00) == 0x0000)
+				{
+					compiler->cycles += desc->cycles;
+					return true;
+				}
+				if ((desc->targetpc & 1) != 0)
+					return false;
+				generate_dbcc(block, compiler, desc, (op >> 8) & 15, ry);
+				return true;
+			}
+			if (size == 3)
+				return false;
+
+			/* ADDQ/SUBQ to an address register always work on the whole register and leave the flags alone */
+			if (srcmode == 1 && size != 0)
+			{
+				if (op & 0x0100)
+					UML_SUB(block, mem(&core->dar[8 + ry]), mem(&core->dar[8 + ry]), data); // sub     ay,ay,data
+				else
+					UML_ADD(block, mem(&core->dar[8 + ry]), mem(&core->dar[8 + ry]), data); // add     ay,ay,data
+				compiler->cycles += desc->cycles;
+				return true;
+			}
+
+			/* ADDQ.L/SUBQ.L to a data register */
+			if (srcmode == 0 && size == 2)
+			{
+				generate_alu(block, (op & 0x0100) ? ALU_SUB : ALU_ADD, ry, data);
+				compiler->cycles += desc->cycles;
+				return true;
+			}
+			return false;
+		}
+
+		case 0x6:
+		{
+			int cc = (op >> 8) & 15;
+
+			/* BSR, 32-bit displacements, odd targets and branches to self stay in the interpreter */
+			if (cc == 1 || (op & 0xff) == 0xff || (desc->targetpc & 1) != 0 || desc->targetpc == desc->pc)
+				return false;
+			generate_bcc(block, compiler, desc, cc, (op & 0xff) ? (INT32)cyc_bcc_notake_b : (INT32)cyc_bcc_notake_w);
+			return true;
+		}
+
+		case 0x7:
+			/* MOVEQ */
+			if (op & 0x0100)
+				return false;
+			UML_MOV(block, mem(&core->dar[rx]), (UINT32)(INT8)op);                           // mov     dx,imm
+			UML_MOV(block, mem(&core->n_flag), ((UINT32)(INT8)op) >> 24);                   // mov     [n],imm >> 24
+			UML_MOV(block, mem(&core->not_z_flag), (UINT32)(INT8)op);                       // mov     [not_z],imm
+			UML_MOV(block, mem(&core->v_flag), 0);                                          // mov     [v],0
+			UML_MOV(block, mem(&core->c_flag), 0);                                          // mov     [c],0
+			compiler->cycles += desc->cycles;
+			return true;
+
+		case 0x8:
+			/* OR.L <ea>,Dn */
+			if ((op & 0x01c0) != 0x0080)
+				return false;
+			return generate_ea_source(block, compiler, desc, 4, ALU_OR, rx);
+
+		case 0x9:
+		case 0xd:
+			/* ADD.L/SUB.L <ea>,Dn */
+			if ((op & 0x01c0) == 0x0080)
+				return generate_ea_source(block, compiler, desc, 4, ((op >> 12) == 0xd) ? ALU_ADD : ALU_SUB, rx);
+
+			/* ADDA/SUBA Rn,An */
+			if ((op & 0x00f0) == 0x00c0)
+			{
+				if (op & 0x0100)
+					UML_MOV(block, I0, mem(&core->dar[op & 15]));                           // mov     i0,src
+				else
+					UML_SEXT(block, I0, mem(&core->dar[op & 15]), SIZE_WORD);               // sext    i0,src,word
+				if ((op >> 12) == 0xd)
+					UML_ADD(block, mem(&core->dar[8 + rx]), mem(&core->dar[8 + rx]), I0);   // add     ax,ax,i0
+				else
+					UML_SUB(block, mem(&core->dar[8 + rx]), mem(&core->dar[8 + rx]), I0);   // sub     ax,ax,i0
+				compiler->cycles += desc->cycles;
+				return true;
+			}
+			return false;
+
+		case 0xb:
+			/* CMP.L <ea>,Dn and CMPA.L <ea>,An */
+			if ((op & 0x01c0) == 0x0080 || (op & 0x01c0) == 0x01c0)
+				return generate_ea_source(block, compiler, desc, 4, ALU_CMP, ((op & 0x0100) ? 8 : 0) + rx);
+
+			/* EOR.L Dn,Dn */
+			if ((op & 0x01f8) == 0x0180)
+			{
+				generate_alu(block, ALU_EOR, ry, mem(&core->dar[rx]));
+				compiler->cycles += desc->cycles;
+				return true;
+			}
+			return false;
+
+		case 0xc:
+			/* AND.L <ea>,Dn */
+			if ((op & 0x01c0) == 0x0080)
+				return generate_ea_source(block, compiler, desc, 4, ALU_AND, rx);
+
+			/* EXG */
+			if ((op & 0x01f8) == 0x0140 || (op & 0x01f8) == 0x0148 || (op & 0x01f8) == 0x0188)
+			{
+				int regx = rx + (((op & 0x01f8) == 0x0148) ? 8 : 0);
+				int regy = ry + (((op & 0x01f8) != 0x0140) ? 8 : 0);
+				UML_MOV(block, I0, mem(&core->dar[regx]));                                  // mov     i0,rx
+				UML_MOV(block, mem(&core->dar[regx]), mem(&core->dar[regy]));               // mov     rx,ry
+				UML_MOV(block, mem(&core->dar[regy]), I0);                                  // mov     ry,i0
+				compiler->cycles += desc->cycles;
+				return true;
+			}
+			return false;
+	}
+
+	return false;
+}
@@ -0,0 +1,168 @@
+// license:BSD-3-Clause
+// copyright-holders:Karl Stenerud
+/***************************************************************************
+
+    m68kfe.c
+
+    Front end for 68000 recompiler
+
+    Instruction lengths come from the disassembler, so the front end only
+    decodes the opcodes that affect control flow.  Everything else is
+    either generated natively or handed to the interpreter, which has the
+    final say on where execution goes next.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "m68kcpu.h"
+#include "cpu/drcfe.h"
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* the longest 68020 instruction is eleven words */
+#define MAX_INSTRUCTION_WORDS   11
+
+
+
+/***************************************************************************
+    INSTRUCTION PARSERS
+***************************************************************************/
+
+m68k_frontend::m68k_frontend(m68000_base_device *device, UINT32 window_start, UINT32 window_end, UINT32 max_sequence)
+	: drc_frontend(*device, window_start, window_end, max_sequence)
+	, m_m68k(device)
+{
+}
+
+
+/*-------------------------------------------------
+    describe - build a description of a single
+    instruction
+-------------------------------------------------*/
+
+bool m68k_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	UINT8 oprom[MAX_INSTRUCTION_WORDS * 2];
+	char buffer[256];
+	offs_t bytemask = m_m68k->m_ospace->bytemask();
+	int words;
+
+	/* an odd PC takes an address error when the opcode is fetched; leave that to the interpreter */
+	if (desc.pc & 1)
+	{
+		desc.length = 2;
+		desc.flags |= OPFLAG_WILL_CAUSE_EXCEPTION | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+	desc.physpc = desc.pc & bytemask;
+
+	/* fetch as much as the longest instruction can use, stopping at anything not backed by memory */
+	memset(oprom, 0, sizeof(oprom));
+	for (words = 0; words < MAX_INSTRUCTION_WORDS; words++)
+	{
+		const UINT16 *ptr = (const UINT16 *)m_m68k->m_odirect->read_ptr((desc.physpc + words * 2) & bytemask, m_m68k->opcode_xor);
+		if (ptr == NULL)
+			break;
+		oprom[words * 2 + 0] = *ptr >> 8;
+		oprom[words * 2 + 1] = *ptr;
+		if (words < ARRAY_LENGTH(desc.opptr.w))
+			desc.opptr.w[words] = *ptr;
+	}
+
+	/* code outside of directly readable memory is always interpreted */
+	if (words == 0)
+	{
+		desc.length = 2;
+		desc.flags |= OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+
+	UINT16 op = desc.opptr.w[0];
+	desc.length = m_m68k->disasm_disassemble(buffer, desc.pc, oprom, oprom, 0) & DASMFLAG_LENGTHMASK;
+	if (desc.length < 2)
+		desc.length = 2;
+	if (desc.length > words * 2)
+	{
+		desc.flags |= OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+	desc.cycles = m_m68k->cyc_instruction[m_m68k->jump_index[op]];
+
+	/* illegal instructions, line A and line F all take an exception */
+	if (m_m68k->jump_index[op] == 0 || (op & 0xf000) == 0xa000 || (op & 0xf000) == 0xf000)
+	{
+		desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_WILL_CAUSE_EXCEPTION;
+		return true;
+	}
+
+	switch (op >> 12)
+	{
+		case 0x4:
+			/* JMP and JSR */
+			if ((op & 0xff80) == 0x4e80)
+			{
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+				if (op & 0x0040)
+					desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+				else
+					desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+				return true;
+			}
+
+			switch (op)
+			{
+				case 0x4afc:    /* ILLEGAL */
+				case 0x4e73:    /* RTE */
+				case 0x4e74:    /* RTD */
+				case 0x4e75:    /* RTS */
+				case 0x4e77:    /* RTR */
+					desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+					return true;
+
+				case 0x4e72:    /* STOP */
+					desc.flags |= OPFLAG_END_SEQUENCE | OPFLAG_CAN_CAUSE_EXCEPTION;
+					return true;
+			}
+
+			/* TRAP */
+			if ((op & 0xfff0) == 0x4e40)
+			{
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_WILL_CAUSE_EXCEPTION;
+				return true;
+			}
+			break;
+
+		case 0x5:
+			/* DBcc; DBT never branches */
+			if ((op & 0xf0f8) == 0x50c8 && (op & 0x0f00) != 0x0000)
+			{
+				desc.targetpc = desc.pc + 2 + (INT16)desc.opptr.w[1];
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+				return true;
+			}
+			break;
+
+		case 0x6:
+		{
+			/* BRA, BSR and Bcc with 8, 16 or (EC020 and later) 32-bit displacements */
+			INT32 disp = (INT8)op;
+			if ((op & 0xff) == 0x00)
+				disp = (INT16)desc.opptr.w[1];
+			else if ((op & 0xff) == 0xff && CPU_TYPE_IS_EC020_PLUS(m_m68k->cpu_type))
+				disp = (desc.opptr.w[1] << 16) | desc.opptr.w[2];
+			desc.targetpc = desc.pc + 2 + disp;
+
+			if ((op & 0x0f00) == 0x0000)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			else if ((op & 0x0f00) == 0x0100)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			else
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			return true;
+		}
+	}
+	return true;
+}
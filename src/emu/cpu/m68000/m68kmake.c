@@ -1395,6 +1395,8 @@ int main(int argc, char *argv[])
 			print_opcode_output_table(g_table_file);
 			fprintf(g_table_file, "%s\n\n", table_footer_insert);
 
+			/* the table entries plus the illegal instruction handler */
+			fprintf(g_prototype_file, "#define M68K_NUM_OPCODE_HANDLERS %d\n\n", g_opcode_output_table_length + 1);
 			fprintf(g_prototype_file, "%s\n\n", prototype_footer_insert);
 			fprintf(g_prototype_file, "#endif\n");
 
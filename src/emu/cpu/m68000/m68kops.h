@@ -1980,11 +1980,14 @@ static void m68k_op_unpk_16_mm(m68000_base_device* mc68kcpu);
 static void m68k_op_cinv_32(m68000_base_device* mc68kcpu);
 static void m68k_op_cpush_32(m68000_base_device* mc68kcpu);
 #else
+#define M68K_NUM_OPCODE_HANDLERS 1973
+
 /* Build the opcode handler table */
 void m68ki_build_opcode_table(void);
 
-extern void (*m68ki_instruction_jump_table[][0x10000])(m68000_base_device *m68k); /* opcode handler jump table */
-extern unsigned char m68ki_cycles[][0x10000];
+extern void (*m68ki_instruction_handlers[])(m68000_base_device *m68k); /* opcode handlers, shared by all CPU types */
+extern const UINT16 *m68ki_instruction_index[];                         /* opcode -> handler index, by CPU type */
+extern unsigned char m68ki_cycles[][M68K_NUM_OPCODE_HANDLERS];          /* handler index -> cycles, by CPU type */
 
 
 /* ======================================================================== */
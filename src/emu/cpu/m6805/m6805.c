@@ -619,10 +619,25 @@ UINT32 m6805_base_device::execute_input_lines() const
 }
 
 
+/* called after an instruction that branched to itself; if repeating */
+/* it can only burn cycles until an input changes, skip ahead */
+void m6805_base_device::idle_loop(UINT8 ireg)
+{
+	/* subroutine calls and returns move the stack */
+	switch (ireg)
+	{
+		case 0x80: case 0x81: case 0x83: case 0xad:
+		case 0xbd: case 0xcd: case 0xdd: case 0xed: case 0xfd:
+			return;
+	}
+	batch_idle(m_cycles1[ireg]);
+}
+
 /* execute instructions on this CPU until icount expires */
 void m6805_base_device::execute_run()
 {
 	UINT8 ireg;
+	UINT16 prevpc;
 
 	S = SP_ADJUST( S );     /* Taken from CPU_SET_CONTEXT when pointer'afying */
 
@@ -635,6 +650,7 @@ void m6805_base_device::execute_run()
 
 		debugger_instruction_hook(this, PC);
 
+		prevpc = PC;
 		ireg=M_RDOP(PC++);
 
 		switch( ireg )
@@ -901,6 +917,10 @@ void m6805_base_device::execute_run()
 			case 0xff: stx_ix(); break;
 		}
 		m_icount -= m_cycles1[ireg];
+
+		/* a branch to itself may be waiting on an input */
+		if (UNEXPECTED(PC == prevpc))
+			idle_loop(ireg);
 	} while( m_icount > 0 );
 }
 
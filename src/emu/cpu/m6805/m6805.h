@@ -255,6 +255,7 @@ protected:
 	void stx_ix();
 
 	void illegal();
+	void idle_loop(UINT8 ireg);
 
 	virtual void interrupt();
 	virtual void interrupt_vector();
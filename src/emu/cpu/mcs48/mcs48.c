@@ -1112,9 +1112,9 @@ void mcs48_cpu_device::burn_cycles(int count)
 	if (m_timecount_enabled & TIMER_ENABLED)
 	{
 		UINT8 oldtimer = m_timer;
-		m_prescaler += count;
-		m_timer += m_prescaler >> 5;
-		m_prescaler &= 0x1f;
+		int total = m_prescaler + count;
+		m_timer += total >> 5;
+		m_prescaler = total & 0x1f;
 		timerover = (oldtimer != 0 && m_timer == 0);
 	}
 
@@ -1142,6 +1142,34 @@ void mcs48_cpu_device::burn_cycles(int count)
 }
 
 
+/*-------------------------------------------------
+    idle_loop - called after an instruction that
+    branched to itself; if repeating it can only
+    burn cycles until an input changes, let the
+    scheduler skip ahead
+-------------------------------------------------*/
+
+void mcs48_cpu_device::idle_loop(unsigned opcode, int cycles)
+{
+	/* DJNZ counts, JTF clears the timer flag, CALL/RET move the stack */
+	if ((opcode & 0xf8) == 0xe8 || opcode == 0x16 || (opcode & 0x1f) == 0x14 || opcode == 0x83 || opcode == 0x93)
+		return;
+
+	/* the counter has to see every T1 edge as it happens, so don't skip at all */
+	if (m_timecount_enabled & COUNTER_ENABLED)
+		return;
+
+	/* stop short of the next timer overflow so it happens in the normal flow */
+	int limit = 0x7fffffff;
+	if (m_timecount_enabled & TIMER_ENABLED)
+		limit = ((0x100 - m_timer) << 5) - m_prescaler;
+
+	int skipped = batch_idle(cycles, limit);
+	if (skipped != 0 && m_timecount_enabled != 0)
+		burn_cycles(skipped);
+}
+
+
 /*-------------------------------------------------
     mcs48_execute - execute until we run out
     of cycles
@@ -1177,6 +1205,10 @@ void mcs48_cpu_device::execute_run()
 		if (m_timecount_enabled != 0)
 			burn_cycles(curcycles);
 
+		/* a branch to itself may be waiting on an input */
+		if (UNEXPECTED(m_pc == m_prevpc))
+			idle_loop(opcode, curcycles);
+
 	} while (m_icount > 0);
 }
 
@@ -223,6 +223,7 @@ protected:
 	void expander_operation(UINT8 operation, UINT8 port);
 	int check_irqs();
 	void burn_cycles(int count);
+	void idle_loop(unsigned opcode, int cycles);
 
 	int illegal();
 	int add_a_r0();
@@ -48,7 +48,8 @@
 #define POWERPC_MIN_PAGE_SHIFT      12
 #define POWERPC_MIN_PAGE_SIZE       (1 << POWERPC_MIN_PAGE_SHIFT)
 #define POWERPC_MIN_PAGE_MASK       (POWERPC_MIN_PAGE_SIZE - 1)
-#define POWERPC_TLB_ENTRIES         128
+#define POWERPC_TLB_ENTRIES         1024
+#define POWERPC_TLB_WAYS            4
 #define PPC603_FIXED_TLB_ENTRIES    128
 
 
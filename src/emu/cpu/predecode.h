@@ -0,0 +1,203 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    predecode.h
+
+    Generic pre-decoded instruction cache for table-driven interpreters.
+
+****************************************************************************
+
+    The cache maps the byte addresses of a CPU's opcode space to
+    core-defined entries (typically the index of the handler that will
+    execute the instruction plus whatever prefix/operand information the
+    core wants to keep), so that the interpreter only has to walk its
+    prefix and decode tables the first time an instruction is seen.
+
+    Entries are grouped in pages of 1 << _PageBits bytes. A page is only
+    cached when its whole range is directly readable through the
+    direct_read_data of the opcode space; each page remembers the host
+    pointer it was decoded from, and is revalidated against the current
+    mapping whenever the direct_read_data reports that banks or handlers
+    may have changed. Pages that fall on I/O or other handler-backed
+    memory are not cached at all, and the core should interpret those
+    instructions as usual.
+
+    Writes can reach code through paths the memory system never sees
+    (another CPU's view of shared RAM, drivers poking RAM pointers,
+    save states), so entries are not invalidated by write callbacks.
+    Instead each entry records the opcode bytes it was decoded from and
+    the core checks them with verify() before trusting it, much like the
+    DRC front-ends compare code before running a block. Operand bytes the
+    handlers fetch themselves at run time need no such check.
+
+    The entry type must be a POD structure for which all-zero bits mean
+    "not decoded yet".
+
+    The direct access type defaults to direct_read_data; anything with
+    the same space(), generation() and read_ptr() will do, which is how
+    the unit test drives the cache through memory map changes.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __PREDECODE_H__
+#define __PREDECODE_H__
+
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+// computed goto is available as a GNU extension
+#if defined(__GNUC__)
+#define PREDECODE_COMPUTED_GOTO     1
+#else
+#define PREDECODE_COMPUTED_GOTO     0
+#endif
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// statistics for a pre-decoded cache
+struct predecode_stats
+{
+	UINT64              hits;               // instructions executed from a valid entry
+	UINT64              decodes;            // entries decoded for the first time
+	UINT64              redecodes;          // entries decoded again because their bytes changed
+	UINT64              uncached;           // instructions executed outside of cacheable pages
+	UINT64              remaps;             // pages discarded because their mapping changed
+};
+
+
+// predecode_cache
+template<class _EntryType, int _PageBits = 8, class _Direct = direct_read_data>
+class predecode_cache
+{
+public:
+	static const int PAGE_SIZE = 1 << _PageBits;
+	static const offs_t PAGE_MASK = PAGE_SIZE - 1;
+
+	// a page of entries
+	struct page
+	{
+		const UINT8 *   host;               // host pointer to the first byte of the page, or NULL if not cacheable
+		UINT32          generation;         // direct_read_data generation the page was validated against
+		_EntryType      entry[PAGE_SIZE];   // one entry per byte address
+	};
+
+	// construction/destruction
+	predecode_cache(_Direct &direct)
+		: m_direct(direct),
+			m_pages(NULL),
+			m_count((direct.space().bytemask() >> _PageBits) + 1)
+	{
+		// a flat page table is only reasonable for the small address spaces this is meant for
+		assert(direct.space().addr_width() <= 24);
+		m_pages = global_alloc_array_clear(page *, m_count);
+		memset(&m_stats, 0, sizeof(m_stats));
+	}
+
+	~predecode_cache()
+	{
+		for (offs_t index = 0; index < m_count; index++)
+			global_free(m_pages[index]);
+		global_free_array(m_pages);
+	}
+
+	// getters
+	_Direct &direct() const { return m_direct; }
+	predecode_stats &stats() { return m_stats; }
+
+	// return the page holding the given byte address, or NULL if it cannot be cached
+	page *find(offs_t address)
+	{
+		page *result = m_pages[(address & m_direct.space().bytemask()) >> _PageBits];
+		if (EXPECTED(result != NULL && result->generation == m_direct.generation()))
+			return (result->host != NULL) ? result : NULL;
+		return validate(address);
+	}
+
+	// return true if the given bytes are where the page expects them to be
+	bool is_linear(const page &p, offs_t address, int length)
+	{
+		for (int index = 0; index < length; index++)
+		{
+			offs_t byteaddress = (address + index) & m_direct.space().bytemask();
+			if ((byteaddress & ~PAGE_MASK) != (address & ~PAGE_MASK))
+				return false;
+			if (m_direct.read_ptr(byteaddress) != p.host + (byteaddress & PAGE_MASK))
+				return false;
+		}
+		return true;
+	}
+
+	// fetch up to four bytes from a page, least significant first
+	UINT32 fetch(const page &p, offs_t address, int length) const
+	{
+		const UINT8 *src = &p.host[address & PAGE_MASK];
+		UINT32 result = src[0];
+		for (int index = 1; index < length; index++)
+			result |= src[index] << (8 * index);
+		return result;
+	}
+
+	// return true if an entry's recorded bytes are still in memory
+	bool verify(const page &p, offs_t address, UINT32 raw, int length) const
+	{
+		return (fetch(p, address, length) == raw);
+	}
+
+	// discard entries
+	void invalidate(offs_t start, offs_t end)
+	{
+		for (offs_t index = start >> _PageBits; index <= (end >> _PageBits) && index < m_count; index++)
+			if (m_pages[index] != NULL)
+				memset(m_pages[index]->entry, 0, sizeof(m_pages[index]->entry));
+	}
+
+	void invalidate_all()
+	{
+		invalidate(0, m_direct.space().bytemask());
+	}
+
+private:
+	// (re)establish the page holding the given address against the current mapping
+	page *validate(offs_t address)
+	{
+		offs_t base = address & m_direct.space().bytemask() & ~PAGE_MASK;
+		page *&slot = m_pages[base >> _PageBits];
+		if (slot == NULL)
+			slot = global_alloc_clear(page);
+
+		// the whole page must map linearly onto a single host range
+		const UINT8 *host = reinterpret_cast<const UINT8 *>(m_direct.read_ptr(base));
+		if (host != NULL && m_direct.read_ptr(base + PAGE_MASK) != host + PAGE_MASK)
+			host = NULL;
+
+		// lookups may have invoked direct update callbacks, so sample the generation last
+		if (host != slot->host)
+		{
+			if (slot->host != NULL)
+				m_stats.remaps++;
+			memset(slot->entry, 0, sizeof(slot->entry));
+			slot->host = host;
+		}
+		slot->generation = m_direct.generation();
+		return (host != NULL) ? slot : NULL;
+	}
+
+	// internal state
+	_Direct &           m_direct;           // direct access to the opcode space
+	page **             m_pages;            // flat table of pages
+	offs_t              m_count;            // number of pages in the table
+	predecode_stats     m_stats;            // statistics
+};
+
+
+#endif /* __PREDECODE_H__ */
@@ -13,9 +13,6 @@
 #include "rsp.h"
 #include "rspcp2.h"
 
-#if USE_SIMD
-#include <emmintrin.h>
-
 const rsp_cop2::vec_helpers_t rsp_cop2::m_vec_helpers = {
 	{ 0 },
 	{ // logic_mask
@@ -211,28 +208,7 @@ const rsp_cop2::vec_helpers_t rsp_cop2::m_vec_helpers = {
 	}
 };
 
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-// TODO: Highly optimized. More of a stopgap measure.
-static inline rsp_vec_t sse2_pshufb(rsp_vec_t v, const UINT16 *keys)
-{
-	UINT8 dest[16];
-	UINT8 temp[16];
-
-	_mm_storeu_si128((rsp_vec_t *) temp, v);
-
-	for (UINT32 j = 0; j < 8; j++)
-	{
-		UINT16 key = keys[j];
-		UINT8 key_hi = key >> 8;
-		UINT8 key_lo = key >> 0;
-
-		dest[(j << 1) + 1] = key_hi == 0x80 ? 0x00 : temp[key_hi];
-		dest[(j << 1) + 0] = key_lo == 0x80 ? 0x00 : temp[key_lo];
-	}
-
-	return _mm_loadu_si128((rsp_vec_t *) dest);
-}
-
+#if !RSP_VEC_HAS_SHUFFLE8
 rsp_vec_t rsp_cop2::vec_load_and_shuffle_operand(const UINT16* src, UINT32 element)
 {
 	if (element >= 8) // element => 0w ... 7w
@@ -242,7 +218,7 @@ rsp_vec_t rsp_cop2::vec_load_and_shuffle_operand(const UINT16* src, UINT32 eleme
 		memcpy(&word_lo, src + (element - 8), sizeof(word_lo));
 		UINT64 dword = word_lo | ((UINT32) word_lo << 16);
 
-		return _mm_shuffle_epi32(_mm_loadl_epi64((rsp_vec_t*) &dword), _MM_SHUFFLE(0,0,0,0));
+		return vec_shuffle32(vec_loadl64((rsp_vec_t*) &dword), VEC_SHUFFLE(0,0,0,0));
 	}
 	else if (element >= 4) // element => 0h ... 3h
 	{
@@ -253,22 +229,22 @@ rsp_vec_t rsp_cop2::vec_load_and_shuffle_operand(const UINT16* src, UINT32 eleme
 		memcpy(&word_lo, src + element - 4, sizeof(word_lo));
 		UINT64 dword = word_lo | ((UINT32) word_hi << 16);
 
-		rsp_vec_t v = _mm_loadl_epi64((rsp_vec_t*) &dword);
-		v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(1,1,0,0));
-		return _mm_shuffle_epi32(v, _MM_SHUFFLE(1,1,0,0));
+		rsp_vec_t v = vec_loadl64((rsp_vec_t*) &dword);
+		v = vec_shufflelo16(v, VEC_SHUFFLE(1,1,0,0));
+		return vec_shuffle32(v, VEC_SHUFFLE(1,1,0,0));
 	}
 	else if (element >= 2) // element => 0q ... 1q
 	{
 		rsp_vec_t v = vec_load_unshuffled_operand(src);
 
 		if (element == 2) {
-			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3,3,1,1));
-			v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(3,3,1,1));
+			v = vec_shufflelo16(v, VEC_SHUFFLE(3,3,1,1));
+			v = vec_shufflehi16(v, VEC_SHUFFLE(3,3,1,1));
 		}
 		else
 		{
-			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2,2,0,0));
-			v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2,2,0,0));
+			v = vec_shufflelo16(v, VEC_SHUFFLE(2,2,0,0));
+			v = vec_shufflehi16(v, VEC_SHUFFLE(2,2,0,0));
 		}
 
 		return v;
@@ -279,14 +255,14 @@ rsp_vec_t rsp_cop2::vec_load_and_shuffle_operand(const UINT16* src, UINT32 eleme
 #else
 rsp_vec_t rsp_cop2::vec_load_and_shuffle_operand(const UINT16* src, UINT32 element)
 {
-	rsp_vec_t operand = _mm_load_si128((rsp_vec_t*) src);
-	rsp_vec_t key = _mm_load_si128((rsp_vec_t*) m_vec_helpers.shuffle_keys[element]);
+	rsp_vec_t operand = vec_load((rsp_vec_t*) src);
+	rsp_vec_t key = vec_load((rsp_vec_t*) m_vec_helpers.shuffle_keys[element]);
 
-	return _mm_shuffle_epi8(operand, key);
+	return vec_shuffle8(operand, key);
 }
 #endif
 //
-// SSSE3+ accelerated loads for group I. Byteswap big-endian to 2-byte
+// Vector loads for group I. Byteswap big-endian to 2-byte
 // little-endian vector. Start at vector element offset, discarding any
 // wraparound as necessary.
 //
@@ -305,45 +281,31 @@ void rsp_cop2::vec_load_group1(UINT32 addr, UINT32 element, UINT16 *regp, rsp_ve
 		UINT32 aligned_addr_lo = addr & ~0x7;
 		UINT32 aligned_addr_hi = (aligned_addr_lo + 8) & 0xFFF;
 
-		data = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_lo));
-		rsp_vec_t temp = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_hi));
-		data = _mm_unpacklo_epi64(data, temp);
+		data = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_lo));
+		rsp_vec_t temp = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_hi));
+		data = vec_unpacklo64(data, temp);
 	}
 	else
 	{
-		data = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + addr));
+		data = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + addr));
 	}
 
 	// Shift the DQM up to the point where we mux in the data.
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	dqm = sse2_pshufb(dqm, m_vec_helpers.sll_b2l_keys[element]);
-#else
-	rsp_vec_t ekey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.sll_b2l_keys[element]));
-	dqm = _mm_shuffle_epi8(dqm, ekey);
-#endif
+	rsp_vec_t ekey = vec_load((rsp_vec_t *) (m_vec_helpers.sll_b2l_keys[element]));
+	dqm = vec_shuffle8(dqm, ekey);
 
 	// Align the data to the DQM so we can mask it in.
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	data = sse2_pshufb(data, m_vec_helpers.ror_b2l_keys[ror & 0xF]);
-#else
-	ekey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.ror_b2l_keys[ror & 0xF]));
-	data = _mm_shuffle_epi8(data, ekey);
-#endif
+	ekey = vec_load((rsp_vec_t *) (m_vec_helpers.ror_b2l_keys[ror & 0xF]));
+	data = vec_shuffle8(data, ekey);
 
 	// Mask and mux in the data.
-#if (defined(__SSE4_1__) || defined(_MSC_VER))
-	reg = _mm_blendv_epi8(reg, data, dqm);
-#else
-	data = _mm_and_si128(dqm, data);
-	reg = _mm_andnot_si128(dqm, reg);
-	reg = _mm_or_si128(data, reg);
-#endif
+	reg = vec_blend(reg, data, dqm);
 
-	_mm_store_si128((rsp_vec_t *) regp, reg);
+	vec_store((rsp_vec_t *) regp, reg);
 }
 
 //
-// SSSE3+ accelerated loads for group II.
+// Vector loads for group II.
 //
 // TODO: Reverse-engineer what happens when loads to vector elements must
 //       wraparound. Do we just discard the data, as below, or does the
@@ -369,30 +331,30 @@ void rsp_cop2::vec_load_group2(UINT32 addr, UINT32 element, UINT16 *regp, rsp_ve
 		datalow <<= (offset << 3);
 		datalow = datahigh | datalow;
 
-		data = _mm_loadl_epi64((rsp_vec_t *) &datalow);
+		data = vec_loadl64((rsp_vec_t *) &datalow);
 	}
 	else
 	{
-		data = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + addr));
+		data = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + addr));
 	}
 
 	// "Unpack" the data.
-	rsp_vec_t zero = _mm_setzero_si128();
-	data = _mm_unpacklo_epi8(zero, data);
+	rsp_vec_t zero = vec_setzero();
+	data = vec_unpacklo8(zero, data);
 
 	if (request_type != RSP_MEM_REQUEST_PACK)
 	{
-		data = _mm_srli_epi16(data, 1);
+		data = vec_srli16(data, 1);
 	}
 
-	data = _mm_shufflehi_epi16(data, _MM_SHUFFLE(0, 1, 2, 3));
-	data = _mm_shufflelo_epi16(data, _MM_SHUFFLE(0, 1, 2, 3));
+	data = vec_shufflehi16(data, VEC_SHUFFLE(0, 1, 2, 3));
+	data = vec_shufflelo16(data, VEC_SHUFFLE(0, 1, 2, 3));
 
-	_mm_store_si128((rsp_vec_t *) regp, data);
+	vec_store((rsp_vec_t *) regp, data);
 }
 
 //
-// SSSE3+ accelerated loads for group IV. Byteswap big-endian to 2-byte
+// Vector loads for group IV. Byteswap big-endian to 2-byte
 // little-endian vector. Stop loading at quadword boundaries.
 //
 // TODO: Reverse-engineer what happens when loads from vector elements
@@ -405,7 +367,7 @@ void rsp_cop2::vec_load_group4(UINT32 addr, UINT32 element, UINT16 *regp, rsp_ve
 	UINT32 offset = addr & 0xF;
 	static UINT32 call_count = 0;
 
-	rsp_vec_t data = _mm_load_si128((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr));
+	rsp_vec_t data = vec_load((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr));
 
 	UINT32 ror;
 	if (request_type == RSP_MEM_REQUEST_QUAD)
@@ -415,35 +377,24 @@ void rsp_cop2::vec_load_group4(UINT32 addr, UINT32 element, UINT16 *regp, rsp_ve
 	else
 	{
 		// TODO: How is this adjusted for LRV when e != 0?
-		dqm = _mm_cmpeq_epi8(_mm_setzero_si128(), dqm);
+		dqm = vec_cmpeq8(vec_setzero(), dqm);
 		ror = 16 - offset;
 	}
 
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	data = sse2_pshufb(data, m_vec_helpers.ror_b2l_keys[ror & 0xF]);
-	dqm = sse2_pshufb(dqm, m_vec_helpers.ror_b2l_keys[ror & 0xF]);
-#else
-	rsp_vec_t dkey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.ror_b2l_keys[ror & 0xF]));
-	data = _mm_shuffle_epi8(data, dkey);
-	dqm = _mm_shuffle_epi8(dqm, dkey);
-#endif
+	rsp_vec_t dkey = vec_load((rsp_vec_t *) (m_vec_helpers.ror_b2l_keys[ror & 0xF]));
+	data = vec_shuffle8(data, dkey);
+	dqm = vec_shuffle8(dqm, dkey);
 
 	// Mask and mux in the data.
-#if (defined(__SSE4_1__) || defined(_MSC_VER))
-	data = _mm_blendv_epi8(reg, data, dqm);
-#else
-	data = _mm_and_si128(dqm, data);
-	reg = _mm_andnot_si128(dqm, reg);
-	data = _mm_or_si128(data, reg);
-#endif
+	data = vec_blend(reg, data, dqm);
 
-	_mm_store_si128((rsp_vec_t *) regp, data);
+	vec_store((rsp_vec_t *) regp, data);
 
 	call_count++;
 }
 
 //
-// SSE3+ accelerated stores for group I. Byteswap 2-byte little-endian
+// Vector stores for group I. Byteswap 2-byte little-endian
 // vector back to big-endian. Start at vector element offset, wrapping
 // around the edge of the vector as necessary.
 //
@@ -457,20 +408,12 @@ void rsp_cop2::vec_store_group1(UINT32 addr, UINT32 element, UINT16 *regp, rsp_v
 	UINT32 ror = element - offset;
 
 	// Shift the DQM up to the point where we mux in the data.
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	dqm = sse2_pshufb(dqm, m_vec_helpers.sll_l2b_keys[offset]);
-#else
-	rsp_vec_t ekey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.sll_l2b_keys[offset]));
-	dqm = _mm_shuffle_epi8(dqm, ekey);
-#endif
+	rsp_vec_t ekey = vec_load((rsp_vec_t *) (m_vec_helpers.sll_l2b_keys[offset]));
+	dqm = vec_shuffle8(dqm, ekey);
 
 	// Rotate the reg to align with the DQM.
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	reg = sse2_pshufb(reg, m_vec_helpers.ror_l2b_keys[ror & 0xF]);
-#else
-	ekey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.ror_l2b_keys[ror & 0xF]));
-	reg = _mm_shuffle_epi8(reg, ekey);
-#endif
+	ekey = vec_load((rsp_vec_t *) (m_vec_helpers.ror_l2b_keys[ror & 0xF]));
+	reg = vec_shuffle8(reg, ekey);
 
 	// Always load in 8-byte chunks to emulate wraparound.
 	rsp_vec_t data;
@@ -479,43 +422,31 @@ void rsp_cop2::vec_store_group1(UINT32 addr, UINT32 element, UINT16 *regp, rsp_v
 		UINT32 aligned_addr_lo = addr & ~0x7;
 		UINT32 aligned_addr_hi = (aligned_addr_lo + 8) & 0xFFF;
 
-		data = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_lo));
-		rsp_vec_t temp = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_hi));
-		data = _mm_unpacklo_epi64(data, temp);
+		data = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_lo));
+		rsp_vec_t temp = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_hi));
+		data = vec_unpacklo64(data, temp);
 
 		// Mask and mux in the data.
-#if (defined(__SSE4_1__) || defined(_MSC_VER))
-		data = _mm_blendv_epi8(data, reg, dqm);
-#else
-		data = _mm_andnot_si128(dqm, data);
-		reg = _mm_and_si128(dqm, reg);
-		data = _mm_or_si128(data, reg);
-#endif
+		data = vec_blend(data, reg, dqm);
 
-		_mm_storel_epi64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_lo), data);
+		vec_storel64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_lo), data);
 
-		data = _mm_srli_si128(data, 8);
-		_mm_storel_epi64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_hi), data);
+		data = vec_srli128(data, 8);
+		vec_storel64((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr_hi), data);
 	}
 	else
 	{
-		data = _mm_loadl_epi64((rsp_vec_t *) (m_rsp.get_dmem() + addr));
+		data = vec_loadl64((rsp_vec_t *) (m_rsp.get_dmem() + addr));
 
 		// Mask and mux in the data.
-#if (defined(__SSE4_1__) || defined(_MSC_VER))
-		data = _mm_blendv_epi8(data, reg, dqm);
-#else
-		data = _mm_andnot_si128(dqm, data);
-		reg = _mm_and_si128(dqm, reg);
-		data = _mm_or_si128(data, reg);
-#endif
+		data = vec_blend(data, reg, dqm);
 
-		_mm_storel_epi64((rsp_vec_t *) (m_rsp.get_dmem() + addr), data);
+		vec_storel64((rsp_vec_t *) (m_rsp.get_dmem() + addr), data);
 	}
 }
 
 //
-// SSE3+ accelerated stores for group II. Byteswap 2-byte little-endian
+// Vector stores for group II. Byteswap 2-byte little-endian
 // vector back to big-endian. Start at vector element offset, wrapping
 // around the edge of the vector as necessary.
 //
@@ -529,25 +460,21 @@ void rsp_cop2::vec_store_group2(UINT32 addr, UINT32 element, UINT16 *regp, rsp_v
 	// "Pack" the data.
 	if (request_type != RSP_MEM_REQUEST_PACK)
 	{
-		reg = _mm_slli_epi16(reg, 1);
+		reg = vec_slli16(reg, 1);
 	}
 
-	reg = _mm_srai_epi16(reg, 8);
-	reg = _mm_packs_epi16(reg, reg);
+	reg = vec_srai16(reg, 8);
+	reg = vec_packs16(reg, reg);
 
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	reg = sse2_pshufb(reg, m_vec_helpers.word_reverse);
-#else
-	rsp_vec_t dkey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.word_reverse));
-	reg = _mm_shuffle_epi8(reg, dkey);
-#endif
+	rsp_vec_t dkey = vec_load((rsp_vec_t *) (m_vec_helpers.word_reverse));
+	reg = vec_shuffle8(reg, dkey);
 
 	// TODO: Always store in 8-byte chunks to emulate wraparound.
-	_mm_storel_epi64((rsp_vec_t *) (m_rsp.get_dmem() + addr), reg);
+	vec_storel64((rsp_vec_t *) (m_rsp.get_dmem() + addr), reg);
 }
 
 //
-// SSE3+ accelerated stores for group IV. Byteswap 2-byte little-endian
+// Vector stores for group IV. Byteswap 2-byte little-endian
 // vector back to big-endian. Stop storing at quadword boundaries.
 //
 void rsp_cop2::vec_store_group4(UINT32 addr, UINT32 element, UINT16 *regp, rsp_vec_t reg, rsp_vec_t dqm, rsp_mem_request_type request_type) {
@@ -555,7 +482,7 @@ void rsp_cop2::vec_store_group4(UINT32 addr, UINT32 element, UINT16 *regp, rsp_v
 	UINT32 offset = addr & 0xF;
 	UINT32 rol = offset;
 
-	rsp_vec_t data = _mm_load_si128((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr));
+	rsp_vec_t data = vec_load((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr));
 
 	if (request_type == RSP_MEM_REQUEST_QUAD)
 	{
@@ -564,28 +491,17 @@ void rsp_cop2::vec_store_group4(UINT32 addr, UINT32 element, UINT16 *regp, rsp_v
 	else
 	{
 		// TODO: How is this adjusted for SRV when e != 0?
-		dqm = _mm_cmpeq_epi8(_mm_setzero_si128(), dqm);
+		dqm = vec_cmpeq8(vec_setzero(), dqm);
 	}
 
-#if !(defined(__SSSE3__) || defined(_MSC_VER))
-	reg = sse2_pshufb(reg, m_vec_helpers.rol_l2b_keys[rol & 0xF]);
-#else
-	rsp_vec_t ekey = _mm_load_si128((rsp_vec_t *) (m_vec_helpers.rol_l2b_keys[rol & 0xF]));
-	reg = _mm_shuffle_epi8(reg, ekey);
-#endif
+	rsp_vec_t ekey = vec_load((rsp_vec_t *) (m_vec_helpers.rol_l2b_keys[rol & 0xF]));
+	reg = vec_shuffle8(reg, ekey);
 
 	// Mask and mux out the data, write.
-#if (defined(__SSE4_1__) || defined(_MSC_VER))
-	data = _mm_blendv_epi8(data, reg, dqm);
-#else
-	reg = _mm_and_si128(dqm, reg);
-	data = _mm_andnot_si128(dqm, data);
-	data = _mm_or_si128(data, reg);
-#endif
+	data = vec_blend(data, reg, dqm);
 
-	_mm_store_si128((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr), data);
+	vec_store((rsp_vec_t *) (m_rsp.get_dmem() + aligned_addr), data);
 }
-#endif
 
 extern offs_t rsp_dasm_one(char *buffer, offs_t pc, UINT32 op);
 
@@ -668,7 +584,6 @@ extern offs_t rsp_dasm_one(char *buffer, offs_t pc, UINT32 op);
 		VREG_S(VDREG, 7) = m_vres[7];   \
 }
 
-#if !USE_SIMD
 static const int vector_elements_2[16][8] =
 {
 	{ 0, 1, 2, 3, 4, 5, 6, 7 },     // none
@@ -688,7 +603,6 @@ static const int vector_elements_2[16][8] =
 	{ 6, 6, 6, 6, 6, 6, 6, 6 },     // 6
 	{ 7, 7, 7, 7, 7, 7, 7, 7 },     // 7
 };
-#endif
 
 rsp_cop2::rsp_cop2(rsp_device &rsp, running_machine &machine)
 	: m_rsp(rsp)
@@ -696,17 +610,16 @@ rsp_cop2::rsp_cop2(rsp_device &rsp, running_machine &machine)
 	, m_reciprocal_res(0)
 	, m_reciprocal_high(0)
 	, m_dp_allowed(0)
+	, m_simd(RSP_SIMD_DEFAULT)
 {
 	memset(m_vres, 0, sizeof(m_vres));
 	memset(m_v, 0, sizeof(m_v));
 	memset(m_vflag, 0, sizeof(m_vflag));
 	memset(m_accum, 0, sizeof(m_accum));
-#if USE_SIMD
 	memset(&m_acc, 0, sizeof(m_acc));
 	memset(&m_flags, 0, sizeof(aligned_rsp_2vect_t) * 3);
 	m_div_out = 0;
 	m_div_in = 0;
-#endif
 	m_rspcop2_state = (internal_rspcop2_state *)rsp.m_cache.alloc_near(sizeof(internal_rspcop2_state));
 }
 
@@ -856,7 +769,6 @@ void rsp_cop2::state_string_export(const int index, std::string &str)
 void rsp_cop2::handle_lwc2(UINT32 op)
 {
 	int base = (op >> 21) & 0x1f;
-#if !USE_SIMD
 	int i, end;
 	UINT32 ea;
 	int dest = (op >> 16) & 0x1f;
@@ -864,7 +776,6 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 	int offset = (op & 0x7f);
 	if (offset & 0x40)
 		offset |= 0xffffffc0;
-#endif
 
 	switch ((op >> 11) & 0x1f)
 	{
@@ -878,12 +789,15 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Load 1 byte to vector byte index
 
 			//printf("LBV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + offset : offset;
-			VREG_B(dest, index) = m_rsp.READ8(ea);
-#endif
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + offset : offset;
+				VREG_B(dest, index) = m_rsp.READ8(ea);
+			}
 			//
 			break;
 		}
@@ -897,19 +811,22 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads 2 bytes starting from vector byte index
 
 			//printf("LSV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 2) : (offset * 2);
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 2) : (offset * 2);
 
-			end = index + 2;
+				end = index + 2;
 
-			for (i=index; i < end; i++)
-			{
-				VREG_B(dest, i) = m_rsp.READ8(ea);
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					VREG_B(dest, i) = m_rsp.READ8(ea);
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -923,19 +840,22 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads 4 bytes starting from vector byte index
 
 			//printf("LLV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 4) : (offset * 4);
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 4) : (offset * 4);
 
-			end = index + 4;
+				end = index + 4;
 
-			for (i=index; i < end; i++)
-			{
-				VREG_B(dest, i) = m_rsp.READ8(ea);
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					VREG_B(dest, i) = m_rsp.READ8(ea);
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -949,19 +869,22 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads 8 bytes starting from vector byte index
 
 			//printf("LDV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
 
-			end = index + 8;
+				end = index + 8;
 
-			for (i=index; i < end; i++)
-			{
-				VREG_B(dest, i) = m_rsp.READ8(ea);
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					VREG_B(dest, i) = m_rsp.READ8(ea);
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -975,20 +898,23 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads up to 16 bytes starting from vector byte index
 
 			//printf("LQV ");
-#if USE_SIMD
-			vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
+			if (m_simd)
+			{
+				vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
-			end = index + (16 - (ea & 0xf));
-			if (end > 16) end = 16;
+				end = index + (16 - (ea & 0xf));
+				if (end > 16) end = 16;
 
-			for (i=index; i < end; i++)
-			{
-				VREG_B(dest, i) = m_rsp.READ8(ea);
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					VREG_B(dest, i) = m_rsp.READ8(ea);
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1002,21 +928,24 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Stores up to 16 bytes starting from right side until 16-byte boundary
 
 			//printf("LRV ");
-#if USE_SIMD
-			vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
+			if (m_simd)
+			{
+				vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
-			index = 16 - ((ea & 0xf) - index);
-			end = 16;
-			ea &= ~0xf;
+				index = 16 - ((ea & 0xf) - index);
+				end = 16;
+				ea &= ~0xf;
 
-			for (i=index; i < end; i++)
-			{
-				VREG_B(dest, i) = m_rsp.READ8(ea);
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					VREG_B(dest, i) = m_rsp.READ8(ea);
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1030,16 +959,19 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads a byte as the upper 8 bits of each element
 
 			//printf("LPV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
-
-			for (i=0; i < 8; i++)
+			if (m_simd)
 			{
-				VREG_S(dest, i) = m_rsp.READ8(ea + (((16-index) + i) & 0xf)) << 8;
+				vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
+
+				for (i=0; i < 8; i++)
+				{
+					VREG_S(dest, i) = m_rsp.READ8(ea + (((16-index) + i) & 0xf)) << 8;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1053,16 +985,19 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads a byte as the bits 14-7 of each element
 
 			//printf("LUV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
-
-			for (i=0; i < 8; i++)
+			if (m_simd)
 			{
-				VREG_S(dest, i) = m_rsp.READ8(ea + (((16-index) + i) & 0xf)) << 7;
+				vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
+
+				for (i=0; i < 8; i++)
+				{
+					VREG_S(dest, i) = m_rsp.READ8(ea + (((16-index) + i) & 0xf)) << 7;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1076,16 +1011,12 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads a byte as the bits 14-7 of each element, with 2-byte stride
 
 			//printf("LHV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
 			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
 			for (i=0; i < 8; i++)
 			{
 				VREG_S(dest, i) = m_rsp.READ8(ea + (((16-index) + (i<<1)) & 0xf)) << 7;
 			}
-#endif
 			//
 			break;
 		}
@@ -1099,9 +1030,6 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// Loads a byte as the bits 14-7 of upper or lower quad, with 4-byte stride
 
 			//printf("LFV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
 			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
 			// not sure what happens if 16-byte boundary is crossed...
@@ -1113,7 +1041,6 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 				VREG_S(dest, i) = m_rsp.READ8(ea) << 7;
 				ea += 4;
 			}
-#endif
 			//
 			break;
 		}
@@ -1128,8 +1055,6 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 			// after byte index 15
 
 			//printf("LWV ");
-#if USE_SIMD
-#else
 			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
 			end = (16 - index) + 16;
@@ -1139,7 +1064,6 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 				VREG_B(dest, i & 0xf) = m_rsp.READ8(ea);
 				ea += 4;
 			}
-#endif
 			//
 			break;
 		}
@@ -1203,7 +1127,6 @@ void rsp_cop2::handle_lwc2(UINT32 op)
 void rsp_cop2::handle_swc2(UINT32 op)
 {
 	int base = (op >> 21) & 0x1f;
-#if !USE_SIMD
 	int i, end;
 	int eaoffset;
 	UINT32 ea;
@@ -1212,7 +1135,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 	int offset = (op & 0x7f);
 	if (offset & 0x40)
 		offset |= 0xffffffc0;
-#endif
 
 	switch ((op >> 11) & 0x1f)
 	{
@@ -1226,12 +1148,15 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores 1 byte from vector byte index
 
 			//printf("SBV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + offset : offset;
-			m_rsp.WRITE8(ea, VREG_B(dest, index));
-#endif
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + offset : offset;
+				m_rsp.WRITE8(ea, VREG_B(dest, index));
+			}
 			//
 			break;
 		}
@@ -1245,19 +1170,22 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores 2 bytes starting from vector byte index
 
 			//printf("SSV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 2) : (offset * 2);
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 2) : (offset * 2);
 
-			end = index + 2;
+				end = index + 2;
 
-			for (i=index; i < end; i++)
-			{
-				m_rsp.WRITE8(ea, VREG_B(dest, i));
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					m_rsp.WRITE8(ea, VREG_B(dest, i));
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1271,19 +1199,22 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores 4 bytes starting from vector byte index
 
 			//printf("SLV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 4) : (offset * 4);
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 4) : (offset * 4);
 
-			end = index + 4;
+				end = index + 4;
 
-			for (i=index; i < end; i++)
-			{
-				m_rsp.WRITE8(ea, VREG_B(dest, i));
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					m_rsp.WRITE8(ea, VREG_B(dest, i));
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1297,19 +1228,22 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores 8 bytes starting from vector byte index
 
 			//printf("SDV ");
-#if USE_SIMD
-			vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
+			if (m_simd)
+			{
+				vec_lbdlsv_sbdlsv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
 
-			end = index + 8;
+				end = index + 8;
 
-			for (i=index; i < end; i++)
-			{
-				m_rsp.WRITE8(ea, VREG_B(dest, i));
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					m_rsp.WRITE8(ea, VREG_B(dest, i));
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1323,19 +1257,22 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores up to 16 bytes starting from vector byte index until 16-byte boundary
 
 			//printf("SQV ");
-#if USE_SIMD
-			vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
+			if (m_simd)
+			{
+				vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
-			end = index + (16 - (ea & 0xf));
+				end = index + (16 - (ea & 0xf));
 
-			for (i=index; i < end; i++)
-			{
-				m_rsp.WRITE8(ea, VREG_B(dest, i & 0xf));
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					m_rsp.WRITE8(ea, VREG_B(dest, i & 0xf));
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1349,22 +1286,25 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores up to 16 bytes starting from right side until 16-byte boundary
 
 			//printf("SRV ");
-#if USE_SIMD
-			vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			int o;
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
+			if (m_simd)
+			{
+				vec_lqrv_sqrv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				int o;
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
-			end = index + (ea & 0xf);
-			o = (16 - (ea & 0xf)) & 0xf;
-			ea &= ~0xf;
+				end = index + (ea & 0xf);
+				o = (16 - (ea & 0xf)) & 0xf;
+				ea &= ~0xf;
 
-			for (i=index; i < end; i++)
-			{
-				m_rsp.WRITE8(ea, VREG_B(dest, ((i + o) & 0xf)));
-				ea++;
+				for (i=index; i < end; i++)
+				{
+					m_rsp.WRITE8(ea, VREG_B(dest, ((i + o) & 0xf)));
+					ea++;
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -1378,25 +1318,28 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores upper 8 bits of each element
 
 			//printf("SPV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
-			end = index + 8;
-
-			for (i=index; i < end; i++)
+			if (m_simd)
 			{
-				if ((i & 0xf) < 8)
-				{
-					m_rsp.WRITE8(ea, VREG_B(dest, ((i & 0xf) << 1)));
-				}
-				else
+				vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
+				end = index + 8;
+
+				for (i=index; i < end; i++)
 				{
-					m_rsp.WRITE8(ea, VREG_S(dest, (i & 0x7)) >> 7);
+					if ((i & 0xf) < 8)
+					{
+						m_rsp.WRITE8(ea, VREG_B(dest, ((i & 0xf) << 1)));
+					}
+					else
+					{
+						m_rsp.WRITE8(ea, VREG_S(dest, (i & 0x7)) >> 7);
+					}
+					ea++;
 				}
-				ea++;
 			}
-#endif
 			//
 			break;
 		}
@@ -1410,25 +1353,28 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores bits 14-7 of each element
 
 			//printf("SUV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
-			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
-			end = index + 8;
-
-			for (i=index; i < end; i++)
+			if (m_simd)
 			{
-				if ((i & 0xf) < 8)
-				{
-					m_rsp.WRITE8(ea, VREG_S(dest, (i & 0x7)) >> 7);
-				}
-				else
+				vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
+			}
+			else
+			{
+				ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 8) : (offset * 8);
+				end = index + 8;
+
+				for (i=index; i < end; i++)
 				{
-					m_rsp.WRITE8(ea, VREG_B(dest, ((i & 0x7) << 1)));
+					if ((i & 0xf) < 8)
+					{
+						m_rsp.WRITE8(ea, VREG_S(dest, (i & 0x7)) >> 7);
+					}
+					else
+					{
+						m_rsp.WRITE8(ea, VREG_B(dest, ((i & 0x7) << 1)));
+					}
+					ea++;
 				}
-				ea++;
 			}
-#endif
 			//
 			break;
 		}
@@ -1442,9 +1388,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// Stores bits 14-7 of each element, with 2-byte stride
 
 			//printf("SHV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
 			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
 			for (i=0; i < 8; i++)
@@ -1455,7 +1398,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 				m_rsp.WRITE8(ea, d);
 				ea += 2;
 			}
-#endif
 			//
 			break;
 		}
@@ -1471,9 +1413,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// FIXME: only works for index 0 and index 8
 
 			//printf("SFV ");
-#if USE_SIMD
-			vec_lfhpuv_sfhpuv(op, m_rsp.m_rsp_state->r[base]);
-#else
 			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
 			eaoffset = ea & 0xf;
@@ -1486,7 +1425,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 				m_rsp.WRITE8(ea + (eaoffset & 0xf), VREG_S(dest, i) >> 7);
 				eaoffset += 4;
 			}
-#endif
 			//
 			break;
 		}
@@ -1501,8 +1439,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 			// after byte index 15
 
 			//printf("SWV ");
-#if USE_SIMD
-#else
 			ea = (base) ? m_rsp.m_rsp_state->r[base] + (offset * 16) : (offset * 16);
 
 			eaoffset = ea & 0xf;
@@ -1515,7 +1451,6 @@ void rsp_cop2::handle_swc2(UINT32 op)
 				m_rsp.WRITE8(ea + (eaoffset & 0xf), VREG_B(dest, i & 0xf));
 				eaoffset++;
 			}
-#endif
 			//
 			break;
 		}
@@ -1633,9 +1568,7 @@ UINT16 rsp_cop2::SATURATE_ACCUM(int accum, int slice, UINT16 negative, UINT16 po
 
 void rsp_cop2::handle_vector_ops(UINT32 op)
 {
-#if !USE_SIMD
 	int i;
-#endif
 
 	// Opcode legend:
 	//    E = VS2 element type
@@ -1655,44 +1588,47 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Multiplies signed integer by signed integer * 2
 
 			//printf("MULF ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmulf_vmulu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmulf_vmulu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-
-				if (s1 == -32768 && s2 == -32768)
-				{
-					// overflow
-					SET_ACCUM_H(0, i);
-					SET_ACCUM_M(-32768, i);
-					SET_ACCUM_L(-32768, i);
-					m_vres[i] = 0x7fff;
-				}
-				else
+				for (i=0; i < 8; i++)
 				{
-					INT64 r =  s1 * s2 * 2;
-					r += 0x8000;    // rounding ?
-					SET_ACCUM_H((r < 0) ? 0xffff : 0, i);      // sign-extend to 48-bit
-					SET_ACCUM_M((INT16)(r >> 16), i);
-					SET_ACCUM_L((UINT16)(r), i);
-					m_vres[i] = ACCUM_M(i);
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+
+					if (s1 == -32768 && s2 == -32768)
+					{
+						// overflow
+						SET_ACCUM_H(0, i);
+						SET_ACCUM_M(-32768, i);
+						SET_ACCUM_L(-32768, i);
+						m_vres[i] = 0x7fff;
+					}
+					else
+					{
+						INT64 r =  s1 * s2 * 2;
+						r += 0x8000;    // rounding ?
+						SET_ACCUM_H((r < 0) ? 0xffff : 0, i);      // sign-extend to 48-bit
+						SET_ACCUM_M((INT16)(r >> 16), i);
+						SET_ACCUM_L((UINT16)(r), i);
+						m_vres[i] = ACCUM_M(i);
+					}
 				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 
@@ -1707,46 +1643,49 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			//
 
 			//printf("MULU ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmulf_vmulu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmulf_vmulu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
 
-				INT64 r = s1 * s2 * 2;
-				r += 0x8000;    // rounding ?
+					INT64 r = s1 * s2 * 2;
+					r += 0x8000;    // rounding ?
 
-				SET_ACCUM_H((UINT16)(r >> 32), i);
-				SET_ACCUM_M((UINT16)(r >> 16), i);
-				SET_ACCUM_L((UINT16)(r), i);
+					SET_ACCUM_H((UINT16)(r >> 32), i);
+					SET_ACCUM_M((UINT16)(r >> 16), i);
+					SET_ACCUM_L((UINT16)(r), i);
 
-				if (r < 0)
-				{
-					m_vres[i] = 0;
-				}
-				else if (((INT16)(ACCUM_H(i)) ^ (INT16)(ACCUM_M(i))) < 0)
-				{
-					m_vres[i] = -1;
-				}
-				else
-				{
-					m_vres[i] = ACCUM_M(i);
+					if (r < 0)
+					{
+						m_vres[i] = 0;
+					}
+					else if (((INT16)(ACCUM_H(i)) ^ (INT16)(ACCUM_M(i))) < 0)
+					{
+						m_vres[i] = -1;
+					}
+					else
+					{
+						m_vres[i] = ACCUM_M(i);
+					}
 				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -1763,37 +1702,40 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The low slice of accumulator is stored into destination element
 
 			//printf("MUDL ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadl_vmudl(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadl_vmudl(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				UINT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
-				UINT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				UINT32 r = s1 * s2;
+				for (i=0; i < 8; i++)
+				{
+					UINT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
+					UINT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					UINT32 r = s1 * s2;
 
-				SET_ACCUM_H(0, i);
-				SET_ACCUM_M(0, i);
-				SET_ACCUM_L((UINT16)(r >> 16), i);
+					SET_ACCUM_H(0, i);
+					SET_ACCUM_M(0, i);
+					SET_ACCUM_L((UINT16)(r >> 16), i);
 
-				m_vres[i] = ACCUM_L(i);
+					m_vres[i] = ACCUM_L(i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -1810,37 +1752,40 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The middle slice of accumulator is stored into destination element
 
 			//printf("MUDM ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadm_vmudm(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadm_vmudm(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));   // not sign-extended
-				INT32 r =  s1 * s2;
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));   // not sign-extended
+					INT32 r =  s1 * s2;
 
-				SET_ACCUM_H((r < 0) ? 0xffff : 0, i);      // sign-extend to 48-bit
-				SET_ACCUM_M((INT16)(r >> 16), i);
-				SET_ACCUM_L((UINT16)(r), i);
+					SET_ACCUM_H((r < 0) ? 0xffff : 0, i);      // sign-extend to 48-bit
+					SET_ACCUM_M((INT16)(r >> 16), i);
+					SET_ACCUM_L((UINT16)(r), i);
 
-				m_vres[i] = ACCUM_M(i);
+					m_vres[i] = ACCUM_M(i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 
@@ -1858,35 +1803,38 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The low slice of accumulator is stored into destination element
 
 			//printf("MUDN ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo = read_acc_lo(acc);
-			rsp_vec_t acc_mid = read_acc_mid(acc);
-			rsp_vec_t acc_hi = read_acc_hi(acc);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo = read_acc_lo(acc);
+				rsp_vec_t acc_mid = read_acc_mid(acc);
+				rsp_vec_t acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadn_vmudn(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadn_vmudn(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (UINT16)VREG_S(VS1REG, i);     // not sign-extended
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 * s2;
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (UINT16)VREG_S(VS1REG, i);     // not sign-extended
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 * s2;
 
-				SET_ACCUM_H((r < 0) ? 0xffff : 0, i);      // sign-extend to 48-bit
-				SET_ACCUM_M((INT16)(r >> 16), i);
-				SET_ACCUM_L((UINT16)(r), i);
+					SET_ACCUM_H((r < 0) ? 0xffff : 0, i);      // sign-extend to 48-bit
+					SET_ACCUM_M((INT16)(r >> 16), i);
+					SET_ACCUM_L((UINT16)(r), i);
 
-				m_vres[i] = ACCUM_L(i);
+					m_vres[i] = ACCUM_L(i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -1903,39 +1851,42 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The highest 32 bits of accumulator is saturated into destination element
 
 			//printf("MUDH ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadh_vmudh(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadh_vmudh(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 * s2;
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 * s2;
 
-				SET_ACCUM_H((INT16)(r >> 16), i);
-				SET_ACCUM_M((UINT16)(r), i);
-				SET_ACCUM_L(0, i);
+					SET_ACCUM_H((INT16)(r >> 16), i);
+					SET_ACCUM_M((UINT16)(r), i);
+					SET_ACCUM_L(0, i);
 
-				if (r < -32768) r = -32768;
-				if (r >  32767) r = 32767;
-				m_vres[i] = (INT16)(r);
+					if (r < -32768) r = -32768;
+					if (r >  32767) r = 32767;
+					m_vres[i] = (INT16)(r);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -1951,45 +1902,48 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The result is added to accumulator
 
 			//printf("MACF ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmacf_vmacu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmacf_vmacu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 * s2;
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 * s2;
 
-				UINT64 q = (UINT64)(UINT16)ACCUM_LL(i);
-				q |= (((UINT64)(UINT16)ACCUM_L(i)) << 16);
-				q |= (((UINT64)(UINT16)ACCUM_M(i)) << 32);
-				q |= (((UINT64)(UINT16)ACCUM_H(i)) << 48);
+					UINT64 q = (UINT64)(UINT16)ACCUM_LL(i);
+					q |= (((UINT64)(UINT16)ACCUM_L(i)) << 16);
+					q |= (((UINT64)(UINT16)ACCUM_M(i)) << 32);
+					q |= (((UINT64)(UINT16)ACCUM_H(i)) << 48);
 
-				q += (INT64)(r) << 17;
+					q += (INT64)(r) << 17;
 
-				SET_ACCUM_LL((UINT16)q, i);
-				SET_ACCUM_L((UINT16)(q >> 16), i);
-				SET_ACCUM_M((UINT16)(q >> 32), i);
-				SET_ACCUM_H((UINT16)(q >> 48), i);
+					SET_ACCUM_LL((UINT16)q, i);
+					SET_ACCUM_L((UINT16)(q >> 16), i);
+					SET_ACCUM_M((UINT16)(q >> 32), i);
+					SET_ACCUM_H((UINT16)(q >> 48), i);
 
-				m_vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
+					m_vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2002,60 +1956,63 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			//
 
 			//printf("MACU ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmacf_vmacu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmacf_vmacu(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i = 0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r1 = s1 * s2;
-				UINT32 r2 = (UINT16)ACCUM_L(i) + ((UINT16)(r1) * 2);
-				UINT32 r3 = (UINT16)ACCUM_M(i) + (UINT16)((r1 >> 16) * 2) + (UINT16)(r2 >> 16);
+				for (i = 0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r1 = s1 * s2;
+					UINT32 r2 = (UINT16)ACCUM_L(i) + ((UINT16)(r1) * 2);
+					UINT32 r3 = (UINT16)ACCUM_M(i) + (UINT16)((r1 >> 16) * 2) + (UINT16)(r2 >> 16);
 
-				SET_ACCUM_L((UINT16)(r2), i);
-				SET_ACCUM_M((UINT16)(r3), i);
-				SET_ACCUM_H(ACCUM_H(i) + (UINT16)(r3 >> 16) + (UINT16)(r1 >> 31), i);
+					SET_ACCUM_L((UINT16)(r2), i);
+					SET_ACCUM_M((UINT16)(r3), i);
+					SET_ACCUM_H(ACCUM_H(i) + (UINT16)(r3 >> 16) + (UINT16)(r1 >> 31), i);
 
-				if ((INT16)ACCUM_H(i) < 0)
-				{
-					m_vres[i] = 0;
-				}
-				else
-				{
-					if (ACCUM_H(i) != 0)
+					if ((INT16)ACCUM_H(i) < 0)
 					{
-						m_vres[i] = 0xffff;
+						m_vres[i] = 0;
 					}
 					else
 					{
-						if ((INT16)ACCUM_M(i) < 0)
+						if (ACCUM_H(i) != 0)
 						{
 							m_vres[i] = 0xffff;
 						}
 						else
 						{
-							m_vres[i] = ACCUM_M(i);
+							if ((INT16)ACCUM_M(i) < 0)
+							{
+								m_vres[i] = 0xffff;
+							}
+							else
+							{
+								m_vres[i] = ACCUM_M(i);
+							}
 						}
 					}
 				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2072,39 +2029,42 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The low slice of accumulator is stored into destination element
 
 			//printf("MADL ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadl_vmudl(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadl_vmudl(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i = 0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				UINT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
-				UINT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				UINT32 r1 = s1 * s2;
-				UINT32 r2 = (UINT16)ACCUM_L(i) + (r1 >> 16);
-				UINT32 r3 = (UINT16)ACCUM_M(i) + (r2 >> 16);
+				for (i = 0; i < 8; i++)
+				{
+					UINT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
+					UINT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					UINT32 r1 = s1 * s2;
+					UINT32 r2 = (UINT16)ACCUM_L(i) + (r1 >> 16);
+					UINT32 r3 = (UINT16)ACCUM_M(i) + (r2 >> 16);
 
-				SET_ACCUM_L((UINT16)(r2), i);
-				SET_ACCUM_M((UINT16)(r3), i);
-				SET_ACCUM_H(ACCUM_H(i) + (INT16)(r3 >> 16), i);
+					SET_ACCUM_L((UINT16)(r2), i);
+					SET_ACCUM_M((UINT16)(r3), i);
+					SET_ACCUM_H(ACCUM_H(i) + (INT16)(r3 >> 16), i);
 
-				m_vres[i] = SATURATE_ACCUM(i, 0, 0x0000, 0xffff);
+					m_vres[i] = SATURATE_ACCUM(i, 0, 0x0000, 0xffff);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2121,41 +2081,44 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The middle slice of accumulator is stored into destination element
 
 			//printf("MADM ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadm_vmudm(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadm_vmudm(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				UINT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				UINT32 s2 = (UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));   // not sign-extended
-				UINT32 r1 = s1 * s2;
-				UINT32 r2 = (UINT16)ACCUM_L(i) + (UINT16)(r1);
-				UINT32 r3 = (UINT16)ACCUM_M(i) + (r1 >> 16) + (r2 >> 16);
-
-				SET_ACCUM_L((UINT16)(r2), i);
-				SET_ACCUM_M((UINT16)(r3), i);
-				SET_ACCUM_H(ACCUM_H(i) + (UINT16)(r3 >> 16), i);
-				if ((INT32)(r1) < 0)
-					SET_ACCUM_H(ACCUM_H(i) - 1, i);
-
-				m_vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
+				for (i=0; i < 8; i++)
+				{
+					UINT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					UINT32 s2 = (UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));   // not sign-extended
+					UINT32 r1 = s1 * s2;
+					UINT32 r2 = (UINT16)ACCUM_L(i) + (UINT16)(r1);
+					UINT32 r3 = (UINT16)ACCUM_M(i) + (r1 >> 16) + (r2 >> 16);
+
+					SET_ACCUM_L((UINT16)(r2), i);
+					SET_ACCUM_M((UINT16)(r3), i);
+					SET_ACCUM_H(ACCUM_H(i) + (UINT16)(r3 >> 16), i);
+					if ((INT32)(r1) < 0)
+						SET_ACCUM_H(ACCUM_H(i) - 1, i);
+
+					m_vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2172,44 +2135,47 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The low slice of accumulator is stored into destination element
 
 			//printf("MADN ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadn_vmudn(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadn_vmudn(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (UINT16)VREG_S(VS1REG, i);     // not sign-extended
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (UINT16)VREG_S(VS1REG, i);     // not sign-extended
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
 
-				UINT64 q = (UINT64)ACCUM_LL(i);
-				q |= (((UINT64)ACCUM_L(i)) << 16);
-				q |= (((UINT64)ACCUM_M(i)) << 32);
-				q |= (((UINT64)ACCUM_H(i)) << 48);
-				q += (INT64)(s1*s2) << 16;
+					UINT64 q = (UINT64)ACCUM_LL(i);
+					q |= (((UINT64)ACCUM_L(i)) << 16);
+					q |= (((UINT64)ACCUM_M(i)) << 32);
+					q |= (((UINT64)ACCUM_H(i)) << 48);
+					q += (INT64)(s1*s2) << 16;
 
-				SET_ACCUM_LL((UINT16)q, i);
-				SET_ACCUM_L((UINT16)(q >> 16), i);
-				SET_ACCUM_M((UINT16)(q >> 32), i);
-				SET_ACCUM_H((UINT16)(q >> 48), i);
+					SET_ACCUM_LL((UINT16)q, i);
+					SET_ACCUM_L((UINT16)(q >> 16), i);
+					SET_ACCUM_M((UINT16)(q >> 32), i);
+					SET_ACCUM_H((UINT16)(q >> 48), i);
 
-				m_vres[i] = SATURATE_ACCUM(i, 0, 0x0000, 0xffff);
-			}
-			WRITEBACK_RESULT();
+					m_vres[i] = SATURATE_ACCUM(i, 0, 0x0000, 0xffff);
+				}
+				WRITEBACK_RESULT();
 
-#endif
+			}
 			//
 			break;
 		}
@@ -2226,40 +2192,43 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// The highest 32 bits of accumulator is saturated into destination element
 
 			//printf("MADH ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t acc_lo, acc_mid, acc_hi;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t acc_lo, acc_mid, acc_hi;
 
-			acc_lo = read_acc_lo(acc);
-			acc_mid = read_acc_mid(acc);
-			acc_hi = read_acc_hi(acc);
+				acc_lo = read_acc_lo(acc);
+				acc_mid = read_acc_mid(acc);
+				acc_hi = read_acc_hi(acc);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmadh_vmudh(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
+				m_v[VDREG].v = vec_vmadh_vmudh(op, vs, vt_shuffle, vec_zero(), &acc_lo, &acc_mid, &acc_hi);
 
-			write_acc_lo(acc, acc_lo);
-			write_acc_mid(acc, acc_mid);
-			write_acc_hi(acc, acc_hi);
-#else
-			for (i = 0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+				write_acc_mid(acc, acc_mid);
+				write_acc_hi(acc, acc_hi);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+				for (i = 0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
 
-				INT32 accum = (UINT32)(UINT16)ACCUM_M(i);
-				accum |= ((UINT32)((UINT16)ACCUM_H(i))) << 16;
-				accum += s1 * s2;
+					INT32 accum = (UINT32)(UINT16)ACCUM_M(i);
+					accum |= ((UINT32)((UINT16)ACCUM_H(i))) << 16;
+					accum += s1 * s2;
 
-				SET_ACCUM_H((UINT16)(accum >> 16), i);
-				SET_ACCUM_M((UINT16)accum, i);
+					SET_ACCUM_H((UINT16)(accum >> 16), i);
+					SET_ACCUM_M((UINT16)accum, i);
 
-				m_vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
-			}
-			WRITEBACK_RESULT();
+					m_vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
+				}
+				WRITEBACK_RESULT();
 
-#endif
+			}
 			//
 			break;
 		}
@@ -2276,36 +2245,39 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// TODO: check VS2REG == VDREG
 
 			//printf("ADD ");
-#if USE_SIMD
-			rsp_vec_t acc_lo;
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t carry = read_vco_lo(m_flags[RSP_VCO].s);
+			if (m_simd)
+			{
+				rsp_vec_t acc_lo;
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t carry = read_vco_lo(m_flags[RSP_VCO].s);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vadd(vs, vt_shuffle, carry, &acc_lo);
+				m_v[VDREG].v = vec_vadd(vs, vt_shuffle, carry, &acc_lo);
 
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, acc_lo);
-#else
-			for (i=0; i < 8; i++)
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, acc_lo);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 + s2 + (CARRY_FLAG(i) != 0 ? 1 : 0);
+				for (i=0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 + s2 + (CARRY_FLAG(i) != 0 ? 1 : 0);
 
-				SET_ACCUM_L((INT16)(r), i);
+					SET_ACCUM_L((INT16)(r), i);
 
-				if (r > 32767) r = 32767;
-				if (r < -32768) r = -32768;
-				m_vres[i] = (INT16)(r);
+					if (r > 32767) r = 32767;
+					if (r < -32768) r = -32768;
+					m_vres[i] = (INT16)(r);
+				}
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CARRY_FLAGS();
+				WRITEBACK_RESULT();
 			}
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CARRY_FLAGS();
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2322,37 +2294,40 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// TODO: check VS2REG == VDREG
 
 			//printf("SUB ");
-#if USE_SIMD
-			rsp_vec_t acc_lo;
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t carry = read_vco_lo(m_flags[RSP_VCO].s);
+			if (m_simd)
+			{
+				rsp_vec_t acc_lo;
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t carry = read_vco_lo(m_flags[RSP_VCO].s);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vsub(vs, vt_shuffle, carry, &acc_lo);
+				m_v[VDREG].v = vec_vsub(vs, vt_shuffle, carry, &acc_lo);
 
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, acc_lo);
-#else
-			for (i = 0; i < 8; i++)
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, acc_lo);
+			}
+			else
 			{
-				INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
-				INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 - s2 - (CARRY_FLAG(i) != 0 ? 1 : 0);
+				for (i = 0; i < 8; i++)
+				{
+					INT32 s1 = (INT32)(INT16)VREG_S(VS1REG, i);
+					INT32 s2 = (INT32)(INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 - s2 - (CARRY_FLAG(i) != 0 ? 1 : 0);
 
-				SET_ACCUM_L((INT16)(r), i);
+					SET_ACCUM_L((INT16)(r), i);
 
-				if (r > 32767) r = 32767;
-				if (r < -32768) r = -32768;
+					if (r > 32767) r = 32767;
+					if (r < -32768) r = -32768;
 
-				m_vres[i] = (INT16)(r);
+					m_vres[i] = (INT16)(r);
+				}
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CARRY_FLAGS();
+				WRITEBACK_RESULT();
 			}
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CARRY_FLAGS();
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2368,46 +2343,49 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// the result to destination register
 
 			//printf("ABS ");
-#if USE_SIMD
-			rsp_vec_t acc_lo;
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				rsp_vec_t acc_lo;
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vabs(vs, vt_shuffle, vec_zero(), &acc_lo);
+				m_v[VDREG].v = vec_vabs(vs, vt_shuffle, vec_zero(), &acc_lo);
 
-			write_acc_lo(acc, acc_lo);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, acc_lo);
+			}
+			else
 			{
-				INT16 s1 = (INT16)VREG_S(VS1REG, i);
-				INT16 s2 = (INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-
-				if (s1 < 0)
+				for (i=0; i < 8; i++)
 				{
-					if (s2 == -32768)
+					INT16 s1 = (INT16)VREG_S(VS1REG, i);
+					INT16 s2 = (INT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+
+					if (s1 < 0)
 					{
-						m_vres[i] = 32767;
+						if (s2 == -32768)
+						{
+							m_vres[i] = 32767;
+						}
+						else
+						{
+							m_vres[i] = -s2;
+						}
+					}
+					else if (s1 > 0)
+					{
+						m_vres[i] = s2;
 					}
 					else
 					{
-						m_vres[i] = -s2;
+						m_vres[i] = 0;
 					}
-				}
-				else if (s1 > 0)
-				{
-					m_vres[i] = s2;
-				}
-				else
-				{
-					m_vres[i] = 0;
-				}
 
-				SET_ACCUM_L(m_vres[i], i);
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2424,38 +2402,41 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// TODO: check VS2REG = VDREG
 
 			//printf("ADDC ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t sn;
-
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t sn;
 
-			m_v[VDREG].v = vec_vaddc(vs, vt_shuffle, vec_zero(), &sn);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, sn);
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CARRY_FLAGS();
+				m_v[VDREG].v = vec_vaddc(vs, vt_shuffle, vec_zero(), &sn);
 
-			for (i=0; i < 8; i++)
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, sn);
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
-				INT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 + s2;
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CARRY_FLAGS();
 
-				m_vres[i] = (INT16)(r);
-				SET_ACCUM_L((INT16)(r), i);
-
-				if (r & 0xffff0000)
+				for (i=0; i < 8; i++)
 				{
-					SET_CARRY_FLAG(i);
+					INT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
+					INT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 + s2;
+
+					m_vres[i] = (INT16)(r);
+					SET_ACCUM_L((INT16)(r), i);
+
+					if (r & 0xffff0000)
+					{
+						SET_CARRY_FLAG(i);
+					}
 				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2472,42 +2453,45 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// TODO: check VS2REG = VDREG
 
 			//printf("SUBC ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t eq, sn;
-
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t eq, sn;
 
-			m_v[VDREG].v = vec_vsubc(vs, vt_shuffle, vec_zero(), &eq, &sn);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			write_vco_hi(m_flags[RSP_VCO].s, eq);
-			write_vco_lo(m_flags[RSP_VCO].s, sn);
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CARRY_FLAGS();
+				m_v[VDREG].v = vec_vsubc(vs, vt_shuffle, vec_zero(), &eq, &sn);
 
-			for (i=0; i < 8; i++)
+				write_vco_hi(m_flags[RSP_VCO].s, eq);
+				write_vco_lo(m_flags[RSP_VCO].s, sn);
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
-				INT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
-				INT32 r = s1 - s2;
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CARRY_FLAGS();
 
-				m_vres[i] = (INT16)(r);
-				SET_ACCUM_L((UINT16)(r), i);
-
-				if ((UINT16)(r) != 0)
-				{
-					SET_ZERO_FLAG(i);
-				}
-				if (r & 0xffff0000)
+				for (i=0; i < 8; i++)
 				{
-					SET_CARRY_FLAG(i);
+					INT32 s1 = (UINT32)(UINT16)VREG_S(VS1REG, i);
+					INT32 s2 = (UINT32)(UINT16)VREG_S(VS2REG, VEC_EL_2(EL, i));
+					INT32 r = s1 - s2;
+
+					m_vres[i] = (INT16)(r);
+					SET_ACCUM_L((UINT16)(r), i);
+
+					if ((UINT16)(r) != 0)
+					{
+						SET_ZERO_FLAG(i);
+					}
+					if (r & 0xffff0000)
+					{
+						SET_CARRY_FLAG(i);
+					}
 				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2522,56 +2506,59 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Stores high, middle or low slice of accumulator to destination vector
 
 			//printf("SAW ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			switch (EL)
+			if (m_simd)
 			{
-				case 8:
-					m_v[VDREG].v = read_acc_hi(acc);
-					break;
-				case 9:
-					m_v[VDREG].v = read_acc_mid(acc);
-					break;
-				case 10:
-					m_v[VDREG].v = read_acc_lo(acc);
-					break;
-
-				default:
-					m_v[VDREG].v = _mm_setzero_si128();
-					break;
+				UINT16 *acc = m_acc.s;
+				switch (EL)
+				{
+					case 8:
+						m_v[VDREG].v = read_acc_hi(acc);
+						break;
+					case 9:
+						m_v[VDREG].v = read_acc_mid(acc);
+						break;
+					case 10:
+						m_v[VDREG].v = read_acc_lo(acc);
+						break;
+
+					default:
+						m_v[VDREG].v = vec_setzero();
+						break;
+				}
 			}
-#else
-			switch (EL)
+			else
 			{
-				case 0x08:      // VSAWH
+				switch (EL)
 				{
-					for (i=0; i < 8; i++)
+					case 0x08:      // VSAWH
 					{
-						VREG_S(VDREG, i) = ACCUM_H(i);
+						for (i=0; i < 8; i++)
+						{
+							VREG_S(VDREG, i) = ACCUM_H(i);
+						}
+						break;
 					}
-					break;
-				}
-				case 0x09:      // VSAWM
-				{
-					for (i=0; i < 8; i++)
+					case 0x09:      // VSAWM
 					{
-						VREG_S(VDREG, i) = ACCUM_M(i);
+						for (i=0; i < 8; i++)
+						{
+							VREG_S(VDREG, i) = ACCUM_M(i);
+						}
+						break;
 					}
-					break;
-				}
-				case 0x0a:      // VSAWL
-				{
-					for (i=0; i < 8; i++)
+					case 0x0a:      // VSAWL
 					{
-						VREG_S(VDREG, i) = ACCUM_L(i);
+						for (i=0; i < 8; i++)
+						{
+							VREG_S(VDREG, i) = ACCUM_L(i);
+						}
+						break;
 					}
-					break;
+					default:    //fatalerror("RSP: VSAW: el = %d\n", EL);//???????
+						printf("RSP: VSAW: el = %d\n", EL);//??? ???
+						exit(0);
 				}
-				default:    //fatalerror("RSP: VSAW: el = %d\n", EL);//???????
-					printf("RSP: VSAW: el = %d\n", EL);//??? ???
-					exit(0);
 			}
-#endif
 			//
 			break;
 		}
@@ -2587,60 +2574,63 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Moves the element in VS2 to destination vector
 
 			//printf("LT ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t le;
-
-			rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
-			rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t le;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
+				rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
 
-			m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_COMPARE_FLAGS();
-			CLEAR_CLIP2_FLAGS();
+				m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
 
-			for (i=0; i < 8; i++)
+				write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT16 s1, s2;
-				s1 = VREG_S(VS1REG, i);
-				s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
-				if (s1 < s2)
-				{
-					SET_COMPARE_FLAG(i);
-				}
-				else if (s1 == s2)
+				CLEAR_COMPARE_FLAGS();
+				CLEAR_CLIP2_FLAGS();
+
+				for (i=0; i < 8; i++)
 				{
-					if (ZERO_FLAG(i) != 0 && CARRY_FLAG(i) != 0)
+					INT16 s1, s2;
+					s1 = VREG_S(VS1REG, i);
+					s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+					if (s1 < s2)
 					{
 						SET_COMPARE_FLAG(i);
 					}
-				}
+					else if (s1 == s2)
+					{
+						if (ZERO_FLAG(i) != 0 && CARRY_FLAG(i) != 0)
+						{
+							SET_COMPARE_FLAG(i);
+						}
+					}
 
-				if (COMPARE_FLAG(i) != 0)
-				{
-					m_vres[i] = s1;
-				}
-				else
-				{
-					m_vres[i] = s2;
+					if (COMPARE_FLAG(i) != 0)
+					{
+						m_vres[i] = s1;
+					}
+					else
+					{
+						m_vres[i] = s2;
+					}
+
+					SET_ACCUM_L(m_vres[i], i);
 				}
 
-				SET_ACCUM_L(m_vres[i], i);
+				CLEAR_CARRY_FLAGS();
+				CLEAR_ZERO_FLAGS();
+				WRITEBACK_RESULT();
 			}
-
-			CLEAR_CARRY_FLAGS();
-			CLEAR_ZERO_FLAGS();
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2656,49 +2646,52 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Moves the element in VS2 to destination vector
 
 			//printf("EQ ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t le;
-
-			rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
-			rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t le;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
+				rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
 
-			m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_COMPARE_FLAGS();
-			CLEAR_CLIP2_FLAGS();
+				m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
 
-			for (i = 0; i < 8; i++)
+				write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT16 s1 = VREG_S(VS1REG, i);
-				INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+				CLEAR_COMPARE_FLAGS();
+				CLEAR_CLIP2_FLAGS();
 
-				if ((s1 == s2) && ZERO_FLAG(i) == 0)
-				{
-					SET_COMPARE_FLAG(i);
-					m_vres[i] = s1;
-				}
-				else
+				for (i = 0; i < 8; i++)
 				{
-					m_vres[i] = s2;
-				}
-				SET_ACCUM_L(m_vres[i], i);
-			}
+					INT16 s1 = VREG_S(VS1REG, i);
+					INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
 
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CARRY_FLAGS();
-			WRITEBACK_RESULT();
-#endif
-			//
+					if ((s1 == s2) && ZERO_FLAG(i) == 0)
+					{
+						SET_COMPARE_FLAG(i);
+						m_vres[i] = s1;
+					}
+					else
+					{
+						m_vres[i] = s2;
+					}
+					SET_ACCUM_L(m_vres[i], i);
+				}
+
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CARRY_FLAGS();
+				WRITEBACK_RESULT();
+			}
+			//
 			break;
 		}
 
@@ -2713,49 +2706,52 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Moves the element in VS2 to destination vector
 
 			//printf("NE ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t le;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t le;
 
-			rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
-			rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
+				rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
+				rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
+				m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
 
-			write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_COMPARE_FLAGS();
-			CLEAR_CLIP2_FLAGS();
-
-			for (i = 0; i < 8; i++)
+				write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT16 s1 = VREG_S(VS1REG, i);
-				INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+				CLEAR_COMPARE_FLAGS();
+				CLEAR_CLIP2_FLAGS();
 
-				if (s1 != s2 || ZERO_FLAG(i) != 0)
+				for (i = 0; i < 8; i++)
 				{
-					SET_COMPARE_FLAG(i);
-					m_vres[i] = s1;
-				}
-				else
-				{
-					m_vres[i] = s2;
+					INT16 s1 = VREG_S(VS1REG, i);
+					INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+
+					if (s1 != s2 || ZERO_FLAG(i) != 0)
+					{
+						SET_COMPARE_FLAG(i);
+						m_vres[i] = s1;
+					}
+					else
+					{
+						m_vres[i] = s2;
+					}
+
+					SET_ACCUM_L(m_vres[i], i);
 				}
 
-				SET_ACCUM_L(m_vres[i], i);
+				CLEAR_CARRY_FLAGS();
+				CLEAR_ZERO_FLAGS();
+				WRITEBACK_RESULT();
 			}
-
-			CLEAR_CARRY_FLAGS();
-			CLEAR_ZERO_FLAGS();
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2771,49 +2767,52 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Moves the element in VS2 to destination vector
 
 			//printf("GE ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t le;
-
-			rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
-			rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t le;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
+				rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
 
-			m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_COMPARE_FLAGS();
-			CLEAR_CLIP2_FLAGS();
+				m_v[VDREG].v = vec_veq_vge_vlt_vne(op, vs, vt_shuffle, vec_zero(), &le, eq, sign);
 
-			for (i=0; i < 8; i++)
+				write_vcc_hi(m_flags[RSP_VCC].s, vec_zero());
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT16 s1 = VREG_S(VS1REG, i);
-				INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+				CLEAR_COMPARE_FLAGS();
+				CLEAR_CLIP2_FLAGS();
 
-				if ((s1 == s2 && (ZERO_FLAG(i) == 0 || CARRY_FLAG(i) == 0)) || s1 > s2)
-				{
-					SET_COMPARE_FLAG(i);
-					m_vres[i] = s1;
-				}
-				else
+				for (i=0; i < 8; i++)
 				{
-					m_vres[i] = s2;
+					INT16 s1 = VREG_S(VS1REG, i);
+					INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+
+					if ((s1 == s2 && (ZERO_FLAG(i) == 0 || CARRY_FLAG(i) == 0)) || s1 > s2)
+					{
+						SET_COMPARE_FLAG(i);
+						m_vres[i] = s1;
+					}
+					else
+					{
+						m_vres[i] = s2;
+					}
+
+					SET_ACCUM_L(m_vres[i], i);
 				}
 
-				SET_ACCUM_L(m_vres[i], i);
+				CLEAR_CARRY_FLAGS();
+				CLEAR_ZERO_FLAGS();
+				WRITEBACK_RESULT();
 			}
-
-			CLEAR_CARRY_FLAGS();
-			CLEAR_ZERO_FLAGS();
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2828,109 +2827,112 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Vector clip low
 
 			//printf("CL ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-
-			rsp_vec_t ge = read_vcc_hi(m_flags[RSP_VCC].s);
-			rsp_vec_t le = read_vcc_lo(m_flags[RSP_VCC].s);
-			rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
-			rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
-			rsp_vec_t vce = read_vce(m_flags[RSP_VCE].s);
-
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
-			m_v[VDREG].v = vec_vcl(vs, vt_shuffle, vec_zero(), &ge, &le, eq, sign, vce);
-
-			write_vcc_hi(m_flags[RSP_VCC].s, ge);
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_vce(m_flags[RSP_VCE].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i = 0; i < 8; i++)
+			if (m_simd)
 			{
-				INT16 s1 = VREG_S(VS1REG, i);
-				INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
-
-				if (CARRY_FLAG(i) != 0) // vco_lo
+				UINT16 *acc = m_acc.s;
+
+				rsp_vec_t ge = read_vcc_hi(m_flags[RSP_VCC].s);
+				rsp_vec_t le = read_vcc_lo(m_flags[RSP_VCC].s);
+				rsp_vec_t eq = read_vco_hi(m_flags[RSP_VCO].s);
+				rsp_vec_t sign = read_vco_lo(m_flags[RSP_VCO].s);
+				rsp_vec_t vce = read_vce(m_flags[RSP_VCE].s);
+
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				m_v[VDREG].v = vec_vcl(vs, vt_shuffle, vec_zero(), &ge, &le, eq, sign, vce);
+
+				write_vcc_hi(m_flags[RSP_VCC].s, ge);
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_vce(m_flags[RSP_VCE].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
+			{
+				for (i = 0; i < 8; i++)
 				{
-					if (ZERO_FLAG(i) != 0) // vco_hi
-					{
-						if (COMPARE_FLAG(i) != 0) // vcc_lo
-						{
-							SET_ACCUM_L(-(UINT16)s2, i);
-						}
-						else
-						{
-							SET_ACCUM_L(s1, i);
-						}
-					}
-					else
+					INT16 s1 = VREG_S(VS1REG, i);
+					INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+
+					if (CARRY_FLAG(i) != 0) // vco_lo
 					{
-						if (CLIP1_FLAG(i) != 0) // vce
+						if (ZERO_FLAG(i) != 0) // vco_hi
 						{
-							if (((UINT32)(UINT16)(s1) + (UINT32)(UINT16)(s2)) > 0x10000)
+							if (COMPARE_FLAG(i) != 0) // vcc_lo
 							{
-								SET_ACCUM_L(s1, i);
-								CLEAR_COMPARE_FLAG(i);
+								SET_ACCUM_L(-(UINT16)s2, i);
 							}
 							else
 							{
-								SET_ACCUM_L(-((UINT16)s2), i);
-								SET_COMPARE_FLAG(i);
+								SET_ACCUM_L(s1, i);
 							}
 						}
 						else
 						{
-							if (((UINT32)(UINT16)(s1) + (UINT32)(UINT16)(s2)) != 0)
+							if (CLIP1_FLAG(i) != 0) // vce
 							{
-								SET_ACCUM_L(s1, i);
-								CLEAR_COMPARE_FLAG(i);
+								if (((UINT32)(UINT16)(s1) + (UINT32)(UINT16)(s2)) > 0x10000)
+								{
+									SET_ACCUM_L(s1, i);
+									CLEAR_COMPARE_FLAG(i);
+								}
+								else
+								{
+									SET_ACCUM_L(-((UINT16)s2), i);
+									SET_COMPARE_FLAG(i);
+								}
 							}
 							else
 							{
-								SET_ACCUM_L(-((UINT16)s2), i);
-								SET_COMPARE_FLAG(i);
+								if (((UINT32)(UINT16)(s1) + (UINT32)(UINT16)(s2)) != 0)
+								{
+									SET_ACCUM_L(s1, i);
+									CLEAR_COMPARE_FLAG(i);
+								}
+								else
+								{
+									SET_ACCUM_L(-((UINT16)s2), i);
+									SET_COMPARE_FLAG(i);
+								}
 							}
 						}
 					}
-				}
-				else
-				{
-					if (ZERO_FLAG(i) != 0) // vco_hi
-					{
-						if (CLIP2_FLAG(i) != 0) // vcc_hi
-						{
-							SET_ACCUM_L(s2, i);
-						}
-						else
-						{
-							SET_ACCUM_L(s1, i);
-						}
-					}
 					else
 					{
-						if (((INT32)(UINT16)s1 - (INT32)(UINT16)s2) >= 0)
+						if (ZERO_FLAG(i) != 0) // vco_hi
 						{
-							SET_ACCUM_L(s2, i);
-							SET_CLIP2_FLAG(i);
+							if (CLIP2_FLAG(i) != 0) // vcc_hi
+							{
+								SET_ACCUM_L(s2, i);
+							}
+							else
+							{
+								SET_ACCUM_L(s1, i);
+							}
 						}
 						else
 						{
-							SET_ACCUM_L(s1, i);
-							CLEAR_CLIP2_FLAG(i);
+							if (((INT32)(UINT16)s1 - (INT32)(UINT16)s2) >= 0)
+							{
+								SET_ACCUM_L(s2, i);
+								SET_CLIP2_FLAG(i);
+							}
+							else
+							{
+								SET_ACCUM_L(s1, i);
+								CLEAR_CLIP2_FLAG(i);
+							}
 						}
 					}
-				}
 
-				m_vres[i] = ACCUM_L(i);
+					m_vres[i] = ACCUM_L(i);
+				}
+				CLEAR_CARRY_FLAGS(); // vco_lo
+				CLEAR_ZERO_FLAGS(); // vco_hi
+				CLEAR_CLIP1_FLAGS(); // vce
+				WRITEBACK_RESULT();
 			}
-			CLEAR_CARRY_FLAGS(); // vco_lo
-			CLEAR_ZERO_FLAGS(); // vco_hi
-			CLEAR_CLIP1_FLAGS(); // vce
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -2945,95 +2947,98 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Vector clip high
 
 			//printf("CH ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t ge, le, sign, eq, vce;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t ge, le, sign, eq, vce;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vch(vs, vt_shuffle, vec_zero(), &ge, &le, &eq, &sign, &vce);
+				m_v[VDREG].v = vec_vch(vs, vt_shuffle, vec_zero(), &ge, &le, &eq, &sign, &vce);
 
-			write_vcc_hi(m_flags[RSP_VCC].s, ge);
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, eq);
-			write_vco_lo(m_flags[RSP_VCO].s, sign);
-			write_vce(m_flags[RSP_VCE].s, vce);
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_CARRY_FLAGS();
-			CLEAR_COMPARE_FLAGS();
-			CLEAR_CLIP1_FLAGS();
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CLIP2_FLAGS();
-			UINT32 vce = 0;
-
-			for (i=0; i < 8; i++)
+				write_vcc_hi(m_flags[RSP_VCC].s, ge);
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, eq);
+				write_vco_lo(m_flags[RSP_VCO].s, sign);
+				write_vce(m_flags[RSP_VCE].s, vce);
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT16 s1 = VREG_S(VS1REG, i);
-				INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
-
-				if ((s1 ^ s2) < 0)
+				CLEAR_CARRY_FLAGS();
+				CLEAR_COMPARE_FLAGS();
+				CLEAR_CLIP1_FLAGS();
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CLIP2_FLAGS();
+				UINT32 vce = 0;
+
+				for (i=0; i < 8; i++)
 				{
-					vce = (s1 + s2 == -1);
-					SET_CARRY_FLAG(i);
-					if (s2 < 0)
-					{
-						SET_CLIP2_FLAG(i);
-					}
+					INT16 s1 = VREG_S(VS1REG, i);
+					INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
 
-					if (s1 + s2 <= 0)
+					if ((s1 ^ s2) < 0)
 					{
-						SET_COMPARE_FLAG(i);
-						m_vres[i] = -((UINT16)s2);
-					}
-					else
-					{
-						m_vres[i] = s1;
-					}
+						vce = (s1 + s2 == -1);
+						SET_CARRY_FLAG(i);
+						if (s2 < 0)
+						{
+							SET_CLIP2_FLAG(i);
+						}
 
-					if (s1 + s2 != 0)
-					{
-						if (s1 != ~s2)
+						if (s1 + s2 <= 0)
 						{
-							SET_ZERO_FLAG(i);
+							SET_COMPARE_FLAG(i);
+							m_vres[i] = -((UINT16)s2);
+						}
+						else
+						{
+							m_vres[i] = s1;
+						}
+
+						if (s1 + s2 != 0)
+						{
+							if (s1 != ~s2)
+							{
+								SET_ZERO_FLAG(i);
+							}
 						}
-					}
-				}
-				else
-				{
-					vce = 0;
-					if (s2 < 0)
-					{
-						SET_COMPARE_FLAG(i);
-					}
-					if (s1 - s2 >= 0)
-					{
-						SET_CLIP2_FLAG(i);
-						m_vres[i] = s2;
 					}
 					else
 					{
-						m_vres[i] = s1;
-					}
+						vce = 0;
+						if (s2 < 0)
+						{
+							SET_COMPARE_FLAG(i);
+						}
+						if (s1 - s2 >= 0)
+						{
+							SET_CLIP2_FLAG(i);
+							m_vres[i] = s2;
+						}
+						else
+						{
+							m_vres[i] = s1;
+						}
 
-					if ((s1 - s2) != 0)
-					{
-						if (s1 != ~s2)
+						if ((s1 - s2) != 0)
 						{
-							SET_ZERO_FLAG(i);
+							if (s1 != ~s2)
+							{
+								SET_ZERO_FLAG(i);
+							}
 						}
 					}
-				}
-				if (vce != 0)
-				{
-					SET_CLIP1_FLAG(i);
-				}
+					if (vce != 0)
+					{
+						SET_CLIP1_FLAG(i);
+					}
 
-				SET_ACCUM_L(m_vres[i], i);
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3048,70 +3053,73 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Vector clip reverse
 
 			//printf("CR ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t ge, le;
-
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t ge, le;
 
-			m_v[VDREG].v = vec_vcr(vs, vt_shuffle, vec_zero(), &ge, &le);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			write_vcc_hi(m_flags[RSP_VCC].s, ge);
-			write_vcc_lo(m_flags[RSP_VCC].s, le);
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_vce(m_flags[RSP_VCE].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			CLEAR_CARRY_FLAGS();
-			CLEAR_COMPARE_FLAGS();
-			CLEAR_CLIP1_FLAGS();
-			CLEAR_ZERO_FLAGS();
-			CLEAR_CLIP2_FLAGS();
+				m_v[VDREG].v = vec_vcr(vs, vt_shuffle, vec_zero(), &ge, &le);
 
-			for (i=0; i < 8; i++)
+				write_vcc_hi(m_flags[RSP_VCC].s, ge);
+				write_vcc_lo(m_flags[RSP_VCC].s, le);
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_vce(m_flags[RSP_VCE].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				INT16 s1 = VREG_S(VS1REG, i);
-				INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+				CLEAR_CARRY_FLAGS();
+				CLEAR_COMPARE_FLAGS();
+				CLEAR_CLIP1_FLAGS();
+				CLEAR_ZERO_FLAGS();
+				CLEAR_CLIP2_FLAGS();
 
-				if ((INT16)(s1 ^ s2) < 0)
+				for (i=0; i < 8; i++)
 				{
-					if (s2 < 0)
-					{
-						SET_CLIP2_FLAG(i);
-					}
-					if ((s1 + s2) <= 0)
-					{
-						SET_ACCUM_L(~((UINT16)s2), i);
-						SET_COMPARE_FLAG(i);
-					}
-					else
-					{
-						SET_ACCUM_L(s1, i);
-					}
-				}
-				else
-				{
-					if (s2 < 0)
-					{
-						SET_COMPARE_FLAG(i);
-					}
-					if ((s1 - s2) >= 0)
+					INT16 s1 = VREG_S(VS1REG, i);
+					INT16 s2 = VREG_S(VS2REG, VEC_EL_2(EL, i));
+
+					if ((INT16)(s1 ^ s2) < 0)
 					{
-						SET_ACCUM_L(s2, i);
-						SET_CLIP2_FLAG(i);
+						if (s2 < 0)
+						{
+							SET_CLIP2_FLAG(i);
+						}
+						if ((s1 + s2 + 1) <= 0)
+						{
+							SET_ACCUM_L(~((UINT16)s2), i);
+							SET_COMPARE_FLAG(i);
+						}
+						else
+						{
+							SET_ACCUM_L(s1, i);
+						}
 					}
 					else
 					{
-						SET_ACCUM_L(s1, i);
+						if (s2 < 0)
+						{
+							SET_COMPARE_FLAG(i);
+						}
+						if ((s1 - s2) >= 0)
+						{
+							SET_ACCUM_L(s2, i);
+							SET_CLIP2_FLAG(i);
+						}
+						else
+						{
+							SET_ACCUM_L(s1, i);
+						}
 					}
-				}
 
-				m_vres[i] = ACCUM_L(i);
+					m_vres[i] = ACCUM_L(i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3126,34 +3134,37 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Merges two vectors according to compare flags
 
 			//printf("MRG ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
-			rsp_vec_t le = read_vcc_lo(m_flags[RSP_VCC].s);
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
+				rsp_vec_t le = read_vcc_lo(m_flags[RSP_VCC].s);
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vmrg(vs, vt_shuffle, le);
+				m_v[VDREG].v = vec_vmrg(vs, vt_shuffle, le);
 
-			write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
-			write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i = 0; i < 8; i++)
+				write_vco_hi(m_flags[RSP_VCO].s, vec_zero());
+				write_vco_lo(m_flags[RSP_VCO].s, vec_zero());
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				if (COMPARE_FLAG(i) != 0)
-				{
-					m_vres[i] = VREG_S(VS1REG, i);
-				}
-				else
+				for (i = 0; i < 8; i++)
 				{
-					m_vres[i] = VREG_S(VS2REG, VEC_EL_2(EL, i));
-				}
+					if (COMPARE_FLAG(i) != 0)
+					{
+						m_vres[i] = VREG_S(VS1REG, i);
+					}
+					else
+					{
+						m_vres[i] = VREG_S(VS2REG, VEC_EL_2(EL, i));
+					}
 
-				SET_ACCUM_L(m_vres[i], i);
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3167,23 +3178,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Bitwise AND of two vector registers
 
 			//printf("AND ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vand_vnand(op, vs, vt_shuffle);
+				m_v[VDREG].v = vec_vand_vnand(op, vs, vt_shuffle);
 
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i = 0; i < 8; i++)
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				m_vres[i] = VREG_S(VS1REG, i) & VREG_S(VS2REG, VEC_EL_2(EL, i));
-				SET_ACCUM_L(m_vres[i], i);
+				for (i = 0; i < 8; i++)
+				{
+					m_vres[i] = VREG_S(VS1REG, i) & VREG_S(VS2REG, VEC_EL_2(EL, i));
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3197,23 +3211,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Bitwise NOT AND of two vector registers
 
 			//printf("NAND ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vand_vnand(op, vs, vt_shuffle);
+				m_v[VDREG].v = vec_vand_vnand(op, vs, vt_shuffle);
 
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i = 0; i < 8; i++)
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				m_vres[i] = ~((VREG_S(VS1REG, i) & VREG_S(VS2REG, VEC_EL_2(EL, i))));
-				SET_ACCUM_L(m_vres[i], i);
+				for (i = 0; i < 8; i++)
+				{
+					m_vres[i] = ~((VREG_S(VS1REG, i) & VREG_S(VS2REG, VEC_EL_2(EL, i))));
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3227,23 +3244,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Bitwise OR of two vector registers
 
 			//printf("OR ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vor_vnor(op, vs, vt_shuffle);
+				m_v[VDREG].v = vec_vor_vnor(op, vs, vt_shuffle);
 
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i = 0; i < 8; i++)
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				m_vres[i] = VREG_S(VS1REG, i) | VREG_S(VS2REG, VEC_EL_2(EL, i));
-				SET_ACCUM_L(m_vres[i], i);
+				for (i = 0; i < 8; i++)
+				{
+					m_vres[i] = VREG_S(VS1REG, i) | VREG_S(VS2REG, VEC_EL_2(EL, i));
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3257,23 +3277,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Bitwise NOT OR of two vector registers
 
 			//printf("NOR ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vor_vnor(op, vs, vt_shuffle);
+				m_v[VDREG].v = vec_vor_vnor(op, vs, vt_shuffle);
 
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				m_vres[i] = ~((VREG_S(VS1REG, i) | VREG_S(VS2REG, VEC_EL_2(EL, i))));
-				SET_ACCUM_L(m_vres[i], i);
+				for (i=0; i < 8; i++)
+				{
+					m_vres[i] = ~((VREG_S(VS1REG, i) | VREG_S(VS2REG, VEC_EL_2(EL, i))));
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3287,23 +3310,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Bitwise XOR of two vector registers
 
 			//printf("XOR ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vxor_vnxor(op, vs, vt_shuffle);
+				m_v[VDREG].v = vec_vxor_vnxor(op, vs, vt_shuffle);
 
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				m_vres[i] = VREG_S(VS1REG, i) ^ VREG_S(VS2REG, VEC_EL_2(EL, i));
-				SET_ACCUM_L(m_vres[i], i);
+				for (i=0; i < 8; i++)
+				{
+					m_vres[i] = VREG_S(VS1REG, i) ^ VREG_S(VS2REG, VEC_EL_2(EL, i));
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3317,23 +3343,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Bitwise NOT XOR of two vector registers
 
 			//printf("NXOR ");
-#if USE_SIMD
-			UINT16 *acc = m_acc.s;
+			if (m_simd)
+			{
+				UINT16 *acc = m_acc.s;
 
-			rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
-			rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
+				rsp_vec_t vs = vec_load_unshuffled_operand(m_v[VS1REG].s);
+				rsp_vec_t vt_shuffle = vec_load_and_shuffle_operand(m_v[VS2REG].s, EL);
 
-			m_v[VDREG].v = vec_vxor_vnxor(op, vs, vt_shuffle);
+				m_v[VDREG].v = vec_vxor_vnxor(op, vs, vt_shuffle);
 
-			write_acc_lo(acc, m_v[VDREG].v);
-#else
-			for (i=0; i < 8; i++)
+				write_acc_lo(acc, m_v[VDREG].v);
+			}
+			else
 			{
-				m_vres[i] = ~((VREG_S(VS1REG, i) ^ VREG_S(VS2REG, VEC_EL_2(EL, i))));
-				SET_ACCUM_L(m_vres[i], i);
+				for (i=0; i < 8; i++)
+				{
+					m_vres[i] = ~((VREG_S(VS1REG, i) ^ VREG_S(VS2REG, VEC_EL_2(EL, i))));
+					SET_ACCUM_L(m_vres[i], i);
+				}
+				WRITEBACK_RESULT();
 			}
-			WRITEBACK_RESULT();
-#endif
 			//
 			break;
 		}
@@ -3348,63 +3377,66 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Calculates reciprocal
 
 			//printf("RCP ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
+			if (m_simd)
+			{
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
 
-			INT32 dp = op & m_dp_flag;
-			m_dp_flag = 0;
+				INT32 dp = op & m_dp_flag;
+				m_dp_flag = 0;
 
-			m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
-#else
-			INT32 shifter = 0;
-
-			INT32 rec = (INT16)(VREG_S(VS2REG, EL & 7));
-			INT32 datainput = (rec < 0) ? (-rec) : rec;
-			if (datainput)
+				m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
+			}
+			else
 			{
-				for (i = 0; i < 32; i++)
+				INT32 shifter = 0;
+
+				INT32 rec = (INT16)(VREG_S(VS2REG, EL & 7));
+				INT32 datainput = (rec < 0) ? (-rec) : rec;
+				if (datainput)
 				{
-					if (datainput & (1 << ((~i) & 0x1f)))
+					for (i = 0; i < 32; i++)
 					{
-						shifter = i;
-						break;
+						if (datainput & (1 << ((~i) & 0x1f)))
+						{
+							shifter = i;
+							break;
+						}
 					}
 				}
-			}
-			else
-			{
-				shifter = 0x10;
-			}
+				else
+				{
+					shifter = 0x10;
+				}
 
-			INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
-			INT32 fetchval = rsp_divtable[address];
-			INT32 temp = (0x40000000 | (fetchval << 14)) >> ((~shifter) & 0x1f);
-			if (rec < 0)
-			{
-				temp = ~temp;
-			}
-			if (!rec)
-			{
-				temp = 0x7fffffff;
-			}
-			else if (rec == 0xffff8000)
-			{
-				temp = 0xffff0000;
-			}
-			rec = temp;
+				INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
+				INT32 fetchval = rsp_divtable[address];
+				INT32 temp = (0x40000000 | (fetchval << 14)) >> ((~shifter) & 0x1f);
+				if (rec < 0)
+				{
+					temp = ~temp;
+				}
+				if (!rec)
+				{
+					temp = 0x7fffffff;
+				}
+				else if (rec == 0xffff8000)
+				{
+					temp = 0xffff0000;
+				}
+				rec = temp;
 
-			m_reciprocal_res = rec;
-			m_dp_allowed = 0;
+				m_reciprocal_res = rec;
+				m_dp_allowed = 0;
 
-			VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
+				VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
 
-			for (i = 0; i < 8; i++)
-			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
-			}
+				for (i = 0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
 
 
-#endif
+			}
 			//
 			break;
 		}
@@ -3419,79 +3451,82 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Calculates reciprocal low part
 
 			//printf("RCPL ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
-
-			INT32 dp = op & m_dp_flag;
-			m_dp_flag = 0;
-
-			m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
-#else
-			INT32 shifter = 0;
+			if (m_simd)
+			{
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
 
-			INT32 rec = (INT16)VREG_S(VS2REG, EL & 7);
-			INT32 datainput = rec;
+				INT32 dp = op & m_dp_flag;
+				m_dp_flag = 0;
 
-			if (m_dp_allowed)
+				m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
+			}
+			else
 			{
-				rec = (rec & 0x0000ffff) | m_reciprocal_high;
-				datainput = rec;
+				INT32 shifter = 0;
 
-				if (rec < 0)
+				INT32 rec = (INT16)VREG_S(VS2REG, EL & 7);
+				INT32 datainput = rec;
+
+				if (m_dp_allowed)
 				{
-					if (rec < -32768)
-					{
-						datainput = ~datainput;
-					}
-					else
+					rec = (rec & 0x0000ffff) | m_reciprocal_high;
+					datainput = rec;
+
+					if (rec < 0)
 					{
-						datainput = -datainput;
+						if (rec < -32768)
+						{
+							datainput = ~datainput;
+						}
+						else
+						{
+							datainput = -datainput;
+						}
 					}
 				}
-			}
-			else if (datainput < 0)
-			{
-				datainput = -datainput;
+				else if (datainput < 0)
+				{
+					datainput = -datainput;
 
-				shifter = 0x10;
-			}
+					shifter = 0x10;
+				}
 
 
-			for (i = 0; i < 32; i++)
-			{
-				if (datainput & (1 << ((~i) & 0x1f)))
+				for (i = 0; i < 32; i++)
 				{
-					shifter = i;
-					break;
+					if (datainput & (1 << ((~i) & 0x1f)))
+					{
+						shifter = i;
+						break;
+					}
 				}
-			}
 
-			INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
-			INT32 fetchval = rsp_divtable[address];
-			INT32 temp = (0x40000000 | (fetchval << 14)) >> ((~shifter) & 0x1f);
-			temp ^= rec >> 31;
+				INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
+				INT32 fetchval = rsp_divtable[address];
+				INT32 temp = (0x40000000 | (fetchval << 14)) >> ((~shifter) & 0x1f);
+				temp ^= rec >> 31;
 
-			if (!rec)
-			{
-				temp = 0x7fffffff;
-			}
-			else if (rec == 0xffff8000)
-			{
-				temp = 0xffff0000;
-			}
-			rec = temp;
+				if (!rec)
+				{
+					temp = 0x7fffffff;
+				}
+				else if (rec == 0xffff8000)
+				{
+					temp = 0xffff0000;
+				}
+				rec = temp;
 
-			m_reciprocal_res = rec;
-			m_dp_allowed = 0;
+				m_reciprocal_res = rec;
+				m_dp_allowed = 0;
 
-			VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
+				VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
 
-			for (i = 0; i < 8; i++)
-			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
-			}
+				for (i = 0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
 
-#endif
+			}
 			//
 			break;
 		}
@@ -3506,24 +3541,27 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Calculates reciprocal high part
 
 			//printf("RCPH ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
-
-			m_dp_flag = 1;
+			if (m_simd)
+			{
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
 
-			m_v[VDREG].v = vec_vdivh(VS2REG, EL, VDREG, VS1REG);
-#else
-			m_reciprocal_high = (VREG_S(VS2REG, EL & 7)) << 16;
-			m_dp_allowed = 1;
+				m_dp_flag = 1;
 
-			for (i = 0; i < 8; i++)
-			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				m_v[VDREG].v = vec_vdivh(VS2REG, EL, VDREG, VS1REG);
 			}
+			else
+			{
+				m_reciprocal_high = (VREG_S(VS2REG, EL & 7)) << 16;
+				m_dp_allowed = 1;
 
-			VREG_S(VDREG, VS1REG & 7) = (INT16)(m_reciprocal_res >> 16);
+				for (i = 0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
 
-#endif
+				VREG_S(VDREG, VS1REG & 7) = (INT16)(m_reciprocal_res >> 16);
+
+			}
 			//
 			break;
 		}
@@ -3538,16 +3576,19 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Moves element from vector to destination vector
 
 			//printf("MOV ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
-			m_v[VDREG].v = vec_vmov(VS2REG, EL, VDREG, VS1REG);
-#else
-			VREG_S(VDREG, VS1REG & 7) = VREG_S(VS2REG, EL & 7);
-			for (i = 0; i < 8; i++)
+			if (m_simd)
 			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
+				m_v[VDREG].v = vec_vmov(VS2REG, EL, VDREG, VS1REG);
+			}
+			else
+			{
+				VREG_S(VDREG, VS1REG & 7) = VREG_S(VS2REG, EL & 7);
+				for (i = 0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
 			}
-#endif
 			//
 			break;
 		}
@@ -3562,64 +3603,67 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Calculates reciprocal square-root
 
 			//printf("RSQ ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
-
-			INT32 dp = op & m_dp_flag;
-			m_dp_flag = 0;
+			if (m_simd)
+			{
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
 
-			m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
-#else
-			INT32 shifter = 0;
+				INT32 dp = op & m_dp_flag;
+				m_dp_flag = 0;
 
-			INT32 rec = (INT16)(VREG_S(VS2REG, EL & 7));
-			INT32 datainput = (rec < 0) ? (-rec) : rec;
-			if (datainput)
+				m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
+			}
+			else
 			{
-				for (i = 0; i < 32; i++)
+				INT32 shifter = 0;
+
+				INT32 rec = (INT16)(VREG_S(VS2REG, EL & 7));
+				INT32 datainput = (rec < 0) ? (-rec) : rec;
+				if (datainput)
 				{
-					if (datainput & (1 << ((~i) & 0x1f)))//?.?.??? 31 - i
+					for (i = 0; i < 32; i++)
 					{
-						shifter = i;
-						break;
+						if (datainput & (1 << ((~i) & 0x1f)))//?.?.??? 31 - i
+						{
+							shifter = i;
+							break;
+						}
 					}
 				}
-			}
-			else
-			{
-				shifter = 0x10;
-			}
+				else
+				{
+					shifter = 0x10;
+				}
 
-			INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
-			address = ((address | 0x200) & 0x3fe) | (shifter & 1);
+				INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
+				address = ((address | 0x200) & 0x3fe) | (shifter & 1);
 
-			INT32 fetchval = rsp_divtable[address];
-			INT32 temp = (0x40000000 | (fetchval << 14)) >> (((~shifter) & 0x1f) >> 1);
-			if (rec < 0)
-			{
-				temp = ~temp;
-			}
-			if (!rec)
-			{
-				temp = 0x7fffffff;
-			}
-			else if (rec == 0xffff8000)
-			{
-				temp = 0xffff0000;
-			}
-			rec = temp;
+				INT32 fetchval = rsp_divtable[address];
+				INT32 temp = (0x40000000 | (fetchval << 14)) >> (((~shifter) & 0x1f) >> 1);
+				if (rec < 0)
+				{
+					temp = ~temp;
+				}
+				if (!rec)
+				{
+					temp = 0x7fffffff;
+				}
+				else if (rec == 0xffff8000)
+				{
+					temp = 0xffff0000;
+				}
+				rec = temp;
 
-			m_reciprocal_res = rec;
-			m_dp_allowed = 0;
+				m_reciprocal_res = rec;
+				m_dp_allowed = 0;
 
-			VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
+				VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
 
-			for (i = 0; i < 8; i++)
-			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
-			}
+				for (i = 0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
 
-#endif
+			}
 			//
 			break;
 		}
@@ -3634,82 +3678,85 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Calculates reciprocal square-root low part
 
 			//printf("RSQL ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
-
-			INT32 dp = op & m_dp_flag;
-			m_dp_flag = 0;
+			if (m_simd)
+			{
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
 
-			m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
-#else
-			INT32 shifter = 0;
-			INT32 rec = (INT16)VREG_S(VS2REG, EL & 7);
-			INT32 datainput = rec;
+				INT32 dp = op & m_dp_flag;
+				m_dp_flag = 0;
 
-			if (m_dp_allowed)
+				m_v[VDREG].v = vec_vrcp_vrsq(op, dp, VS2REG, EL, VDREG, VS1REG);
+			}
+			else
 			{
-				rec = (rec & 0x0000ffff) | m_reciprocal_high;
-				datainput = rec;
+				INT32 shifter = 0;
+				INT32 rec = (INT16)VREG_S(VS2REG, EL & 7);
+				INT32 datainput = rec;
 
-				if (rec < 0)
+				if (m_dp_allowed)
 				{
-					if (rec < -32768)
-					{
-						datainput = ~datainput;
-					}
-					else
+					rec = (rec & 0x0000ffff) | m_reciprocal_high;
+					datainput = rec;
+
+					if (rec < 0)
 					{
-						datainput = -datainput;
+						if (rec < -32768)
+						{
+							datainput = ~datainput;
+						}
+						else
+						{
+							datainput = -datainput;
+						}
 					}
 				}
-			}
-			else if (datainput < 0)
-			{
-				datainput = -datainput;
+				else if (datainput < 0)
+				{
+					datainput = -datainput;
 
-				shifter = 0x10;
-			}
+					shifter = 0x10;
+				}
 
-			if (datainput)
-			{
-				for (i = 0; i < 32; i++)
+				if (datainput)
 				{
-					if (datainput & (1 << ((~i) & 0x1f)))
+					for (i = 0; i < 32; i++)
 					{
-						shifter = i;
-						break;
+						if (datainput & (1 << ((~i) & 0x1f)))
+						{
+							shifter = i;
+							break;
+						}
 					}
 				}
-			}
 
-			INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
-			address = ((address | 0x200) & 0x3fe) | (shifter & 1);
+				INT32 address = ((datainput << shifter) & 0x7fc00000) >> 22;
+				address = ((address | 0x200) & 0x3fe) | (shifter & 1);
 
-			INT32 fetchval = rsp_divtable[address];
-			INT32 temp = (0x40000000 | (fetchval << 14)) >> (((~shifter) & 0x1f) >> 1);
-			temp ^= rec >> 31;
+				INT32 fetchval = rsp_divtable[address];
+				INT32 temp = (0x40000000 | (fetchval << 14)) >> (((~shifter) & 0x1f) >> 1);
+				temp ^= rec >> 31;
 
-			if (!rec)
-			{
-				temp = 0x7fffffff;
-			}
-			else if (rec == 0xffff8000)
-			{
-				temp = 0xffff0000;
-			}
-			rec = temp;
+				if (!rec)
+				{
+					temp = 0x7fffffff;
+				}
+				else if (rec == 0xffff8000)
+				{
+					temp = 0xffff0000;
+				}
+				rec = temp;
 
-			m_reciprocal_res = rec;
-			m_dp_allowed = 0;
+				m_reciprocal_res = rec;
+				m_dp_allowed = 0;
 
-			VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
+				VREG_S(VDREG, VS1REG & 7) = (UINT16)(rec & 0xffff);
 
-			for (i = 0; i < 8; i++)
-			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
-			}
+				for (i = 0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
 
-#endif
+			}
 			//
 			break;
 		}
@@ -3724,23 +3771,26 @@ void rsp_cop2::handle_vector_ops(UINT32 op)
 			// Calculates reciprocal square-root high part
 
 			//printf("RSQH ");
-#if USE_SIMD
-			write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
-
-			m_dp_flag = 1;
+			if (m_simd)
+			{
+				write_acc_lo(m_acc.s, vec_load_and_shuffle_operand(m_v[VS2REG].s, EL));
 
-			m_v[VDREG].v = vec_vdivh(VS2REG, EL, VDREG, VS1REG);
-#else
-			m_reciprocal_high = (VREG_S(VS2REG, EL & 7)) << 16;
-			m_dp_allowed = 1;
+				m_dp_flag = 1;
 
-			for (i=0; i < 8; i++)
-			{
-				SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				m_v[VDREG].v = vec_vdivh(VS2REG, EL, VDREG, VS1REG);
 			}
+			else
+			{
+				m_reciprocal_high = (VREG_S(VS2REG, EL & 7)) << 16;
+				m_dp_allowed = 1;
 
-			VREG_S(VDREG, VS1REG & 7) = (INT16)(m_reciprocal_res >> 16);    // store high part
-#endif
+				for (i=0; i < 8; i++)
+				{
+					SET_ACCUM_L(VREG_S(VS2REG, VEC_EL_2(EL, i)), i);
+				}
+
+				VREG_S(VDREG, VS1REG & 7) = (INT16)(m_reciprocal_res >> 16);    // store high part
+			}
 			//
 			break;
 		}
@@ -3795,65 +3845,68 @@ void rsp_cop2::handle_cop2(UINT32 op)
 			//printf("CFC2 ");
 			if (RTREG)
 			{
-#if USE_SIMD
-				INT32 src = RDREG & 3;
-				if (src == 3) {
-					src = 2;
+				if (m_simd)
+				{
+					INT32 src = RDREG & 3;
+					if (src == 3) {
+						src = 2;
+					}
+					RTVAL = get_flags(m_flags[src].s);
 				}
-				RTVAL = get_flags(m_flags[src].s);
-#else
-				switch(RDREG)
+				else
 				{
-					case 0:
-						RTVAL = ((CARRY_FLAG(0) & 1) << 0) |
-						((CARRY_FLAG(1) & 1) << 1) |
-						((CARRY_FLAG(2) & 1) << 2) |
-						((CARRY_FLAG(3) & 1) << 3) |
-						((CARRY_FLAG(4) & 1) << 4) |
-						((CARRY_FLAG(5) & 1) << 5) |
-						((CARRY_FLAG(6) & 1) << 6) |
-						((CARRY_FLAG(7) & 1) << 7) |
-						((ZERO_FLAG(0) & 1) << 8) |
-						((ZERO_FLAG(1) & 1) << 9) |
-						((ZERO_FLAG(2) & 1) << 10) |
-						((ZERO_FLAG(3) & 1) << 11) |
-						((ZERO_FLAG(4) & 1) << 12) |
-						((ZERO_FLAG(5) & 1) << 13) |
-						((ZERO_FLAG(6) & 1) << 14) |
-						((ZERO_FLAG(7) & 1) << 15);
-						if (RTVAL & 0x8000) RTVAL |= 0xffff0000;
-						break;
-					case 1:
-						RTVAL = ((COMPARE_FLAG(0) & 1) << 0) |
-						((COMPARE_FLAG(1) & 1) << 1) |
-						((COMPARE_FLAG(2) & 1) << 2) |
-						((COMPARE_FLAG(3) & 1) << 3) |
-						((COMPARE_FLAG(4) & 1) << 4) |
-						((COMPARE_FLAG(5) & 1) << 5) |
-						((COMPARE_FLAG(6) & 1) << 6) |
-						((COMPARE_FLAG(7) & 1) << 7) |
-						((CLIP2_FLAG(0) & 1) << 8) |
-						((CLIP2_FLAG(1) & 1) << 9) |
-						((CLIP2_FLAG(2) & 1) << 10) |
-						((CLIP2_FLAG(3) & 1) << 11) |
-						((CLIP2_FLAG(4) & 1) << 12) |
-						((CLIP2_FLAG(5) & 1) << 13) |
-						((CLIP2_FLAG(6) & 1) << 14) |
-						((CLIP2_FLAG(7) & 1) << 15);
-						if (RTVAL & 0x8000) RTVAL |= 0xffff0000;
-						break;
-					case 2:
-						// Anciliary clipping flags
-						RTVAL = ((CLIP1_FLAG(0) & 1) << 0) |
-						((CLIP1_FLAG(1) & 1) << 1) |
-						((CLIP1_FLAG(2) & 1) << 2) |
-						((CLIP1_FLAG(3) & 1) << 3) |
-						((CLIP1_FLAG(4) & 1) << 4) |
-						((CLIP1_FLAG(5) & 1) << 5) |
-						((CLIP1_FLAG(6) & 1) << 6) |
-						((CLIP1_FLAG(7) & 1) << 7);
+					switch(RDREG)
+					{
+						case 0:
+							RTVAL = ((CARRY_FLAG(0) & 1) << 0) |
+							((CARRY_FLAG(1) & 1) << 1) |
+							((CARRY_FLAG(2) & 1) << 2) |
+							((CARRY_FLAG(3) & 1) << 3) |
+							((CARRY_FLAG(4) & 1) << 4) |
+							((CARRY_FLAG(5) & 1) << 5) |
+							((CARRY_FLAG(6) & 1) << 6) |
+							((CARRY_FLAG(7) & 1) << 7) |
+							((ZERO_FLAG(0) & 1) << 8) |
+							((ZERO_FLAG(1) & 1) << 9) |
+							((ZERO_FLAG(2) & 1) << 10) |
+							((ZERO_FLAG(3) & 1) << 11) |
+							((ZERO_FLAG(4) & 1) << 12) |
+							((ZERO_FLAG(5) & 1) << 13) |
+							((ZERO_FLAG(6) & 1) << 14) |
+							((ZERO_FLAG(7) & 1) << 15);
+							if (RTVAL & 0x8000) RTVAL |= 0xffff0000;
+							break;
+						case 1:
+							RTVAL = ((COMPARE_FLAG(0) & 1) << 0) |
+							((COMPARE_FLAG(1) & 1) << 1) |
+							((COMPARE_FLAG(2) & 1) << 2) |
+							((COMPARE_FLAG(3) & 1) << 3) |
+							((COMPARE_FLAG(4) & 1) << 4) |
+							((COMPARE_FLAG(5) & 1) << 5) |
+							((COMPARE_FLAG(6) & 1) << 6) |
+							((COMPARE_FLAG(7) & 1) << 7) |
+							((CLIP2_FLAG(0) & 1) << 8) |
+							((CLIP2_FLAG(1) & 1) << 9) |
+							((CLIP2_FLAG(2) & 1) << 10) |
+							((CLIP2_FLAG(3) & 1) << 11) |
+							((CLIP2_FLAG(4) & 1) << 12) |
+							((CLIP2_FLAG(5) & 1) << 13) |
+							((CLIP2_FLAG(6) & 1) << 14) |
+							((CLIP2_FLAG(7) & 1) << 15);
+							if (RTVAL & 0x8000) RTVAL |= 0xffff0000;
+							break;
+						case 2:
+							// Anciliary clipping flags
+							RTVAL = ((CLIP1_FLAG(0) & 1) << 0) |
+							((CLIP1_FLAG(1) & 1) << 1) |
+							((CLIP1_FLAG(2) & 1) << 2) |
+							((CLIP1_FLAG(3) & 1) << 3) |
+							((CLIP1_FLAG(4) & 1) << 4) |
+							((CLIP1_FLAG(5) & 1) << 5) |
+							((CLIP1_FLAG(6) & 1) << 6) |
+							((CLIP1_FLAG(7) & 1) << 7);
+					}
 				}
-#endif
 			}
 			break;
 		}
@@ -3879,86 +3932,92 @@ void rsp_cop2::handle_cop2(UINT32 op)
 			// | 010010 | 00110 | TTTTT | DDDDD | 00000000000 |
 			// ------------------------------------------------
 			//
-			switch(RDREG)
+			if (m_simd)
 			{
-#if USE_SIMD
-				case 0:
-				case 1:
-				case 2:
-					UINT16 r0 = (RTVAL & (1 << 0)) ? 0xffff : 0;
-					UINT16 r1 = (RTVAL & (1 << 1)) ? 0xffff : 0;
-					UINT16 r2 = (RTVAL & (1 << 2)) ? 0xffff : 0;
-					UINT16 r3 = (RTVAL & (1 << 3)) ? 0xffff : 0;
-					UINT16 r4 = (RTVAL & (1 << 4)) ? 0xffff : 0;
-					UINT16 r5 = (RTVAL & (1 << 5)) ? 0xffff : 0;
-					UINT16 r6 = (RTVAL & (1 << 6)) ? 0xffff : 0;
-					UINT16 r7 = (RTVAL & (1 << 7)) ? 0xffff : 0;
-					m_flags[RDREG].__align[0] = _mm_set_epi16(r7, r6, r5, r4, r3, r2, r1, r0);
-					r0 = (RTVAL & (1 << 8)) ? 0xffff : 0;
-					r1 = (RTVAL & (1 << 9)) ? 0xffff : 0;
-					r2 = (RTVAL & (1 << 10)) ? 0xffff : 0;
-					r3 = (RTVAL & (1 << 11)) ? 0xffff : 0;
-					r4 = (RTVAL & (1 << 12)) ? 0xffff : 0;
-					r5 = (RTVAL & (1 << 13)) ? 0xffff : 0;
-					r6 = (RTVAL & (1 << 14)) ? 0xffff : 0;
-					r7 = (RTVAL & (1 << 15)) ? 0xffff : 0;
-					m_flags[RDREG].__align[1] = _mm_set_epi16(r7, r6, r5, r4, r3, r2, r1, r0);
-					break;
-#else
-				case 0:
-					CLEAR_CARRY_FLAGS();
-					CLEAR_ZERO_FLAGS();
-					if (RTVAL & (1 << 0)) { SET_CARRY_FLAG(0); }
-					if (RTVAL & (1 << 1)) { SET_CARRY_FLAG(1); }
-					if (RTVAL & (1 << 2)) { SET_CARRY_FLAG(2); }
-					if (RTVAL & (1 << 3)) { SET_CARRY_FLAG(3); }
-					if (RTVAL & (1 << 4)) { SET_CARRY_FLAG(4); }
-					if (RTVAL & (1 << 5)) { SET_CARRY_FLAG(5); }
-					if (RTVAL & (1 << 6)) { SET_CARRY_FLAG(6); }
-					if (RTVAL & (1 << 7)) { SET_CARRY_FLAG(7); }
-					if (RTVAL & (1 << 8)) { SET_ZERO_FLAG(0); }
-					if (RTVAL & (1 << 9)) { SET_ZERO_FLAG(1); }
-					if (RTVAL & (1 << 10)) { SET_ZERO_FLAG(2); }
-					if (RTVAL & (1 << 11)) { SET_ZERO_FLAG(3); }
-					if (RTVAL & (1 << 12)) { SET_ZERO_FLAG(4); }
-					if (RTVAL & (1 << 13)) { SET_ZERO_FLAG(5); }
-					if (RTVAL & (1 << 14)) { SET_ZERO_FLAG(6); }
-					if (RTVAL & (1 << 15)) { SET_ZERO_FLAG(7); }
-					break;
-
-				case 1:
-					CLEAR_COMPARE_FLAGS();
-					CLEAR_CLIP2_FLAGS();
-					if (RTVAL & (1 << 0)) { SET_COMPARE_FLAG(0); }
-					if (RTVAL & (1 << 1)) { SET_COMPARE_FLAG(1); }
-					if (RTVAL & (1 << 2)) { SET_COMPARE_FLAG(2); }
-					if (RTVAL & (1 << 3)) { SET_COMPARE_FLAG(3); }
-					if (RTVAL & (1 << 4)) { SET_COMPARE_FLAG(4); }
-					if (RTVAL & (1 << 5)) { SET_COMPARE_FLAG(5); }
-					if (RTVAL & (1 << 6)) { SET_COMPARE_FLAG(6); }
-					if (RTVAL & (1 << 7)) { SET_COMPARE_FLAG(7); }
-					if (RTVAL & (1 << 8)) { SET_CLIP2_FLAG(0); }
-					if (RTVAL & (1 << 9)) { SET_CLIP2_FLAG(1); }
-					if (RTVAL & (1 << 10)) { SET_CLIP2_FLAG(2); }
-					if (RTVAL & (1 << 11)) { SET_CLIP2_FLAG(3); }
-					if (RTVAL & (1 << 12)) { SET_CLIP2_FLAG(4); }
-					if (RTVAL & (1 << 13)) { SET_CLIP2_FLAG(5); }
-					if (RTVAL & (1 << 14)) { SET_CLIP2_FLAG(6); }
-					if (RTVAL & (1 << 15)) { SET_CLIP2_FLAG(7); }
-					break;
-
-				case 2:
-					CLEAR_CLIP1_FLAGS();
-					if (RTVAL & (1 << 0)) { SET_CLIP1_FLAG(0); }
-					if (RTVAL & (1 << 1)) { SET_CLIP1_FLAG(1); }
-					if (RTVAL & (1 << 2)) { SET_CLIP1_FLAG(2); }
-					if (RTVAL & (1 << 3)) { SET_CLIP1_FLAG(3); }
-					if (RTVAL & (1 << 4)) { SET_CLIP1_FLAG(4); }
-					if (RTVAL & (1 << 5)) { SET_CLIP1_FLAG(5); }
-					if (RTVAL & (1 << 6)) { SET_CLIP1_FLAG(6); }
-					if (RTVAL & (1 << 7)) { SET_CLIP1_FLAG(7); }
-					break;
-#endif
+				switch(RDREG)
+				{
+					case 0:
+					case 1:
+					case 2:
+						UINT16 r0 = (RTVAL & (1 << 0)) ? 0xffff : 0;
+						UINT16 r1 = (RTVAL & (1 << 1)) ? 0xffff : 0;
+						UINT16 r2 = (RTVAL & (1 << 2)) ? 0xffff : 0;
+						UINT16 r3 = (RTVAL & (1 << 3)) ? 0xffff : 0;
+						UINT16 r4 = (RTVAL & (1 << 4)) ? 0xffff : 0;
+						UINT16 r5 = (RTVAL & (1 << 5)) ? 0xffff : 0;
+						UINT16 r6 = (RTVAL & (1 << 6)) ? 0xffff : 0;
+						UINT16 r7 = (RTVAL & (1 << 7)) ? 0xffff : 0;
+						m_flags[RDREG].__align[0] = vec_set16(r7, r6, r5, r4, r3, r2, r1, r0);
+						r0 = (RTVAL & (1 << 8)) ? 0xffff : 0;
+						r1 = (RTVAL & (1 << 9)) ? 0xffff : 0;
+						r2 = (RTVAL & (1 << 10)) ? 0xffff : 0;
+						r3 = (RTVAL & (1 << 11)) ? 0xffff : 0;
+						r4 = (RTVAL & (1 << 12)) ? 0xffff : 0;
+						r5 = (RTVAL & (1 << 13)) ? 0xffff : 0;
+						r6 = (RTVAL & (1 << 14)) ? 0xffff : 0;
+						r7 = (RTVAL & (1 << 15)) ? 0xffff : 0;
+						m_flags[RDREG].__align[1] = vec_set16(r7, r6, r5, r4, r3, r2, r1, r0);
+						break;
+				}
+			}
+			else
+			{
+				switch(RDREG)
+				{
+					case 0:
+						CLEAR_CARRY_FLAGS();
+						CLEAR_ZERO_FLAGS();
+						if (RTVAL & (1 << 0)) { SET_CARRY_FLAG(0); }
+						if (RTVAL & (1 << 1)) { SET_CARRY_FLAG(1); }
+						if (RTVAL & (1 << 2)) { SET_CARRY_FLAG(2); }
+						if (RTVAL & (1 << 3)) { SET_CARRY_FLAG(3); }
+						if (RTVAL & (1 << 4)) { SET_CARRY_FLAG(4); }
+						if (RTVAL & (1 << 5)) { SET_CARRY_FLAG(5); }
+						if (RTVAL & (1 << 6)) { SET_CARRY_FLAG(6); }
+						if (RTVAL & (1 << 7)) { SET_CARRY_FLAG(7); }
+						if (RTVAL & (1 << 8)) { SET_ZERO_FLAG(0); }
+						if (RTVAL & (1 << 9)) { SET_ZERO_FLAG(1); }
+						if (RTVAL & (1 << 10)) { SET_ZERO_FLAG(2); }
+						if (RTVAL & (1 << 11)) { SET_ZERO_FLAG(3); }
+						if (RTVAL & (1 << 12)) { SET_ZERO_FLAG(4); }
+						if (RTVAL & (1 << 13)) { SET_ZERO_FLAG(5); }
+						if (RTVAL & (1 << 14)) { SET_ZERO_FLAG(6); }
+						if (RTVAL & (1 << 15)) { SET_ZERO_FLAG(7); }
+						break;
+
+					case 1:
+						CLEAR_COMPARE_FLAGS();
+						CLEAR_CLIP2_FLAGS();
+						if (RTVAL & (1 << 0)) { SET_COMPARE_FLAG(0); }
+						if (RTVAL & (1 << 1)) { SET_COMPARE_FLAG(1); }
+						if (RTVAL & (1 << 2)) { SET_COMPARE_FLAG(2); }
+						if (RTVAL & (1 << 3)) { SET_COMPARE_FLAG(3); }
+						if (RTVAL & (1 << 4)) { SET_COMPARE_FLAG(4); }
+						if (RTVAL & (1 << 5)) { SET_COMPARE_FLAG(5); }
+						if (RTVAL & (1 << 6)) { SET_COMPARE_FLAG(6); }
+						if (RTVAL & (1 << 7)) { SET_COMPARE_FLAG(7); }
+						if (RTVAL & (1 << 8)) { SET_CLIP2_FLAG(0); }
+						if (RTVAL & (1 << 9)) { SET_CLIP2_FLAG(1); }
+						if (RTVAL & (1 << 10)) { SET_CLIP2_FLAG(2); }
+						if (RTVAL & (1 << 11)) { SET_CLIP2_FLAG(3); }
+						if (RTVAL & (1 << 12)) { SET_CLIP2_FLAG(4); }
+						if (RTVAL & (1 << 13)) { SET_CLIP2_FLAG(5); }
+						if (RTVAL & (1 << 14)) { SET_CLIP2_FLAG(6); }
+						if (RTVAL & (1 << 15)) { SET_CLIP2_FLAG(7); }
+						break;
+
+					case 2:
+						CLEAR_CLIP1_FLAGS();
+						if (RTVAL & (1 << 0)) { SET_CLIP1_FLAG(0); }
+						if (RTVAL & (1 << 1)) { SET_CLIP1_FLAG(1); }
+						if (RTVAL & (1 << 2)) { SET_CLIP1_FLAG(2); }
+						if (RTVAL & (1 << 3)) { SET_CLIP1_FLAG(3); }
+						if (RTVAL & (1 << 4)) { SET_CLIP1_FLAG(4); }
+						if (RTVAL & (1 << 5)) { SET_CLIP1_FLAG(5); }
+						if (RTVAL & (1 << 6)) { SET_CLIP1_FLAG(6); }
+						if (RTVAL & (1 << 7)) { SET_CLIP1_FLAG(7); }
+						break;
+				}
 			}
 			break;
 		}
@@ -4184,25 +4243,28 @@ void rsp_cop2::dump(UINT32 op)
 		printf("%02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n", VREG_B(i, 0), VREG_B(i, 1), VREG_B(i, 2), VREG_B(i, 3), VREG_B(i, 4), VREG_B(i, 5), VREG_B(i, 6), VREG_B(i, 7), VREG_B(i, 8), VREG_B(i, 9), VREG_B(i, 10), VREG_B(i, 11), VREG_B(i, 12), VREG_B(i, 13), VREG_B(i, 14), VREG_B(i, 15));
 	}
 
-#if USE_SIMD
-	printf("acc_h: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_acc.s[0], m_acc.s[1], m_acc.s[2], m_acc.s[3], m_acc.s[4], m_acc.s[5], m_acc.s[6], m_acc.s[7]);
-	printf("acc_m: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_acc.s[8], m_acc.s[9], m_acc.s[10], m_acc.s[11], m_acc.s[12], m_acc.s[13], m_acc.s[14], m_acc.s[15]);
-	printf("acc_l: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_acc.s[16], m_acc.s[17], m_acc.s[18], m_acc.s[19], m_acc.s[20], m_acc.s[21], m_acc.s[22], m_acc.s[23]);
-	printf("vcc_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCC].s[0], m_flags[RSP_VCC].s[1], m_flags[RSP_VCC].s[2], m_flags[RSP_VCC].s[3], m_flags[RSP_VCC].s[4], m_flags[RSP_VCC].s[5], m_flags[RSP_VCC].s[6], m_flags[RSP_VCC].s[7]);
-	printf("vcc_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCC].s[8], m_flags[RSP_VCC].s[9], m_flags[RSP_VCC].s[10], m_flags[RSP_VCC].s[11], m_flags[RSP_VCC].s[12], m_flags[RSP_VCC].s[13], m_flags[RSP_VCC].s[14], m_flags[RSP_VCC].s[15]);
-	printf("vco_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCO].s[0], m_flags[RSP_VCO].s[1], m_flags[RSP_VCO].s[2], m_flags[RSP_VCO].s[3], m_flags[RSP_VCO].s[4], m_flags[RSP_VCO].s[5], m_flags[RSP_VCO].s[6], m_flags[RSP_VCO].s[7]);
-	printf("vco_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCO].s[8], m_flags[RSP_VCO].s[9], m_flags[RSP_VCO].s[10], m_flags[RSP_VCO].s[11], m_flags[RSP_VCO].s[12], m_flags[RSP_VCO].s[13], m_flags[RSP_VCO].s[14], m_flags[RSP_VCO].s[15]);
-	printf("vce:    %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCE].s[0], m_flags[RSP_VCE].s[1], m_flags[RSP_VCE].s[2], m_flags[RSP_VCE].s[3], m_flags[RSP_VCE].s[4], m_flags[RSP_VCE].s[5], m_flags[RSP_VCE].s[6], m_flags[RSP_VCE].s[7]);
-#else
-	printf("acc_h: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", ACCUM_H(0), ACCUM_H(1), ACCUM_H(2), ACCUM_H(3), ACCUM_H(4), ACCUM_H(5), ACCUM_H(6), ACCUM_H(7));
-	printf("acc_m: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", ACCUM_M(0), ACCUM_M(1), ACCUM_M(2), ACCUM_M(3), ACCUM_M(4), ACCUM_M(5), ACCUM_M(6), ACCUM_M(7));
-	printf("acc_l: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", ACCUM_L(0), ACCUM_L(1), ACCUM_L(2), ACCUM_L(3), ACCUM_L(4), ACCUM_L(5), ACCUM_L(6), ACCUM_L(7));
-	printf("vcc_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[4][0], m_vflag[4][1], m_vflag[4][2], m_vflag[4][3], m_vflag[4][4], m_vflag[4][5], m_vflag[4][6], m_vflag[4][7]);
-	printf("vcc_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[1][0], m_vflag[1][1], m_vflag[1][2], m_vflag[1][3], m_vflag[1][4], m_vflag[1][5], m_vflag[1][6], m_vflag[1][7]);
-	printf("vco_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[3][0], m_vflag[3][1], m_vflag[3][2], m_vflag[3][3], m_vflag[3][4], m_vflag[3][5], m_vflag[3][6], m_vflag[3][7]);
-	printf("vco_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[0][0], m_vflag[0][1], m_vflag[0][2], m_vflag[0][3], m_vflag[0][4], m_vflag[0][5], m_vflag[0][6], m_vflag[0][7]);
-	printf("vce:    %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[2][0], m_vflag[2][1], m_vflag[2][2], m_vflag[2][3], m_vflag[2][4], m_vflag[2][5], m_vflag[2][6], m_vflag[2][7]);
-#endif
+	if (m_simd)
+	{
+		printf("acc_h: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_acc.s[0], m_acc.s[1], m_acc.s[2], m_acc.s[3], m_acc.s[4], m_acc.s[5], m_acc.s[6], m_acc.s[7]);
+		printf("acc_m: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_acc.s[8], m_acc.s[9], m_acc.s[10], m_acc.s[11], m_acc.s[12], m_acc.s[13], m_acc.s[14], m_acc.s[15]);
+		printf("acc_l: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_acc.s[16], m_acc.s[17], m_acc.s[18], m_acc.s[19], m_acc.s[20], m_acc.s[21], m_acc.s[22], m_acc.s[23]);
+		printf("vcc_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCC].s[0], m_flags[RSP_VCC].s[1], m_flags[RSP_VCC].s[2], m_flags[RSP_VCC].s[3], m_flags[RSP_VCC].s[4], m_flags[RSP_VCC].s[5], m_flags[RSP_VCC].s[6], m_flags[RSP_VCC].s[7]);
+		printf("vcc_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCC].s[8], m_flags[RSP_VCC].s[9], m_flags[RSP_VCC].s[10], m_flags[RSP_VCC].s[11], m_flags[RSP_VCC].s[12], m_flags[RSP_VCC].s[13], m_flags[RSP_VCC].s[14], m_flags[RSP_VCC].s[15]);
+		printf("vco_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCO].s[0], m_flags[RSP_VCO].s[1], m_flags[RSP_VCO].s[2], m_flags[RSP_VCO].s[3], m_flags[RSP_VCO].s[4], m_flags[RSP_VCO].s[5], m_flags[RSP_VCO].s[6], m_flags[RSP_VCO].s[7]);
+		printf("vco_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCO].s[8], m_flags[RSP_VCO].s[9], m_flags[RSP_VCO].s[10], m_flags[RSP_VCO].s[11], m_flags[RSP_VCO].s[12], m_flags[RSP_VCO].s[13], m_flags[RSP_VCO].s[14], m_flags[RSP_VCO].s[15]);
+		printf("vce:    %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_flags[RSP_VCE].s[0], m_flags[RSP_VCE].s[1], m_flags[RSP_VCE].s[2], m_flags[RSP_VCE].s[3], m_flags[RSP_VCE].s[4], m_flags[RSP_VCE].s[5], m_flags[RSP_VCE].s[6], m_flags[RSP_VCE].s[7]);
+	}
+	else
+	{
+		printf("acc_h: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", ACCUM_H(0), ACCUM_H(1), ACCUM_H(2), ACCUM_H(3), ACCUM_H(4), ACCUM_H(5), ACCUM_H(6), ACCUM_H(7));
+		printf("acc_m: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", ACCUM_M(0), ACCUM_M(1), ACCUM_M(2), ACCUM_M(3), ACCUM_M(4), ACCUM_M(5), ACCUM_M(6), ACCUM_M(7));
+		printf("acc_l: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", ACCUM_L(0), ACCUM_L(1), ACCUM_L(2), ACCUM_L(3), ACCUM_L(4), ACCUM_L(5), ACCUM_L(6), ACCUM_L(7));
+		printf("vcc_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[4][0], m_vflag[4][1], m_vflag[4][2], m_vflag[4][3], m_vflag[4][4], m_vflag[4][5], m_vflag[4][6], m_vflag[4][7]);
+		printf("vcc_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[1][0], m_vflag[1][1], m_vflag[1][2], m_vflag[1][3], m_vflag[1][4], m_vflag[1][5], m_vflag[1][6], m_vflag[1][7]);
+		printf("vco_hi: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[3][0], m_vflag[3][1], m_vflag[3][2], m_vflag[3][3], m_vflag[3][4], m_vflag[3][5], m_vflag[3][6], m_vflag[3][7]);
+		printf("vco_lo: %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[0][0], m_vflag[0][1], m_vflag[0][2], m_vflag[0][3], m_vflag[0][4], m_vflag[0][5], m_vflag[0][6], m_vflag[0][7]);
+		printf("vce:    %04x|%04x|%04x|%04x|%04x|%04x|%04x|%04x\n", m_vflag[2][0], m_vflag[2][1], m_vflag[2][2], m_vflag[2][3], m_vflag[2][4], m_vflag[2][5], m_vflag[2][6], m_vflag[2][7]);
+	}
 }
 
 void rsp_cop2::dump_dmem()
@@ -16,42 +16,15 @@
 #include "cpu/drcuml.h"
 #include "rsp.h"
 #include "rspdiv.h"
+#include "rspvops.h"
 
-#define SIMD_OFF        (1)
-
-#if (defined(__SSE2__) || defined(__SSE3__) || defined(__SSSE3__) || defined(__SSE4_1__) || defined(__SSE4_2__))
-#define SSE_AVAILABLE   (1)
-#else
-#define SSE_AVAILABLE   (0)
-#endif
-
-#if (SSE_AVAILABLE || defined(_MSC_VER)) && defined(PTR64) && !SIMD_OFF
-#define USE_SIMD    (1)
-#else
-#define USE_SIMD    (0)
-#endif
-
-#if USE_SIMD
-
-#ifdef _MSC_VER
-#define __align16 __declspec(align(16))
-#else
-#define __align16 __attribute__((aligned(16)))
-#endif
-
-#if (defined(__SSE4_2__) || defined(_MSC_VER))
-#include <nmmintrin.h>
-#elif (defined(__SSE4_1__) || defined(_MSC_VER))
-#include <smmintrin.h>
-#elif (defined(__SSSE3__) || defined(_MSC_VER))
-#include <tmmintrin.h>
-#elif (defined(__SSE3__ ) || defined(_MSC_VER))
-#include <pmmintrin.h>
+/* the SIMD vector unit is used by default wherever the host has a native vector backend */
+#ifndef RSP_SIMD_DEFAULT
+#if RSP_VEC_NATIVE && defined(LSB_FIRST)
+#define RSP_SIMD_DEFAULT    (1)
 #else
-#include <emmintrin.h>
+#define RSP_SIMD_DEFAULT    (0)
 #endif
-
-typedef __m128i rsp_vec_t;
 #endif
 
 union VECTOR_REG
@@ -60,9 +33,7 @@ union VECTOR_REG
 	UINT32 l[4];
 	UINT16 s[8];
 	UINT8 b[16];
-#if USE_SIMD
 	rsp_vec_t v;
-#endif
 };
 
 union ACCUMULATOR_REG
@@ -170,6 +141,8 @@ public:
 	void            dump(UINT32 op);
 	void            dump_dmem();
 
+	bool            simd() const { return m_simd; }
+
 protected:
 	virtual int     generate_vector_opcode(drcuml_block *block, rsp_device::compiler_state *compiler, const opcode_desc *desc) { return TRUE; }
 
@@ -187,11 +160,7 @@ protected:
 	running_machine& m_machine;
 	UINT32          m_vres[8];          /* used for temporary vector results */
 
-#if USE_SIMD
 	__align16 VECTOR_REG      m_v[32];
-#else
-	VECTOR_REG      m_v[32];
-#endif
 	ACCUMULATOR_REG m_accum[8];
 	UINT16          m_vflag[6][8];
 
@@ -199,7 +168,8 @@ protected:
 	UINT32          m_reciprocal_high;
 	INT32           m_dp_allowed;
 
-#if USE_SIMD
+	bool            m_simd;             /* use the SIMD implementation of the vector unit */
+
 	enum rsp_flags_t {
 		RSP_VCO = 0,
 		RSP_VCC = 1,
@@ -269,11 +239,11 @@ protected:
 	}
 	static inline rsp_vec_t vec_load_unshuffled_operand(const void* src)
 	{
-		return _mm_load_si128((rsp_vec_t*) src);
+		return vec_load((rsp_vec_t*) src);
 	}
 	static inline void vec_write_operand(UINT16* dest, rsp_vec_t src)
 	{
-		_mm_store_si128((rsp_vec_t*) dest, src);
+		vec_store((rsp_vec_t*) dest, src);
 	}
 	static inline rsp_vec_t read_acc_lo(const UINT16* acc)
 	{
@@ -342,12 +312,12 @@ protected:
 
 	static inline INT16 get_flags(const UINT16 *flags)
 	{
-		return _mm_movemask_epi8(_mm_packs_epi16(_mm_load_si128((rsp_vec_t*) (flags + (sizeof(rsp_vec_t) >> 1))), _mm_load_si128((rsp_vec_t*) flags)));
+		return vec_movemask8(vec_packs16(vec_load((rsp_vec_t*) (flags + (sizeof(rsp_vec_t) >> 1))), vec_load((rsp_vec_t*) flags)));
 	}
 
 	static inline rsp_vec_t vec_zero()
 	{
-		return _mm_setzero_si128();
+		return vec_setzero();
 	}
 
 	void vec_load_group1(UINT32 addr, UINT32 element, UINT16* regp, rsp_vec_t reg, rsp_vec_t dqm);
@@ -357,38 +327,17 @@ protected:
 	void vec_store_group2(UINT32 addr, UINT32 element, UINT16* regp, rsp_vec_t reg, rsp_vec_t dqm, rsp_mem_request_type request_type);
 	void vec_store_group4(UINT32 addr, UINT32 element, UINT16* regp, rsp_vec_t reg, rsp_vec_t dqm, rsp_mem_request_type request_type);
 
-#include "clamp.h"
-#include "vabs.h"
-#include "vadd.h"
-#include "vaddc.h"
-#include "vand.h"
-#include "vch.h"
-#include "vcmp.h"
-#include "vcl.h"
-#include "vcr.h"
 #include "vdivh.h"
-#include "vmac.h"
 #include "vmov.h"
-#include "vmrg.h"
-#include "vmul.h"
-#include "vmulh.h"
-#include "vmull.h"
-#include "vmulm.h"
-#include "vmuln.h"
-#include "vor.h"
 #include "vrcpsq.h"
 #include "vrsq.h"
-#include "vsub.h"
-#include "vsubc.h"
-#include "vxor.h"
 #include "vldst.h"
-#endif
 
-private:
 	void            handle_lwc2(UINT32 op);
 	void            handle_swc2(UINT32 op);
 	void            handle_vector_ops(UINT32 op);
 
+private:
 	UINT32          m_div_in;
 	UINT32          m_div_out;
 };
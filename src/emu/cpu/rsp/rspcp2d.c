@@ -2537,7 +2537,7 @@ void rsp_cop2_drc::vcr()
 			{
 				SET_CLIP2_FLAG(i);
 			}
-			if ((s1 + s2) <= 0)
+			if ((s1 + s2 + 1) <= 0)
 			{
 				SET_ACCUM_L(~((UINT16)s2), i);
 				SET_COMPARE_FLAG(i);
@@ -3691,6 +3691,16 @@ static void cfunc_ctc2(void *param)
 	((rsp_cop2 *)param)->ctc2();
 }
 
+void rsp_cop2_drc::simd_cop2()
+{
+	handle_cop2(m_rspcop2_state->op);
+}
+
+static void cfunc_simd_cop2(void *param)
+{
+	((rsp_cop2_drc *)param)->simd_cop2();
+}
+
 /***************************************************************************
     COP2 Opcode Compilation
 ***************************************************************************/
@@ -3700,6 +3710,17 @@ int rsp_cop2_drc::generate_cop2(drcuml_block *block, rsp_device::compiler_state
 	UINT32 op = desc->opptr.l[0];
 	UINT8 opswitch = RSREG;
 
+	/* the SIMD vector unit keeps its own accumulator and flags, so hand
+	   everything that touches them to the shared implementation */
+	if (m_simd && (opswitch == 0x02 || opswitch == 0x06 || opswitch >= 0x10))
+	{
+		if (opswitch == 0x02 && RTREG == 0)
+			return TRUE;
+		UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);   // mov     [arg0],desc->opptr.l
+		UML_CALLC(block, cfunc_simd_cop2, this);        // callc   simd_cop2
+		return TRUE;
+	}
+
 	switch (opswitch)
 	{
 		case 0x00:  /* MFCz */
@@ -102,6 +102,8 @@ public:
 	virtual void mtc2();
 	virtual void ctc2();
 
+	void simd_cop2();
+
 private:
 	virtual int     generate_vector_opcode(drcuml_block *block, rsp_device::compiler_state *compiler, const opcode_desc *desc);
 };
@@ -0,0 +1,458 @@
+// license:BSD-3-Clause
+// copyright-holders:Ryan Holtz,Tyler J. Stachecki
+/***************************************************************************
+
+    rspvec.h
+
+    Portable 128-bit vector primitives for the RSP vector unit.
+
+    The operations mirror the SSE2 integer instructions the vector unit
+    code was written against: eight 16-bit lanes, with lane 0 in the
+    lowest addressed element. Three implementations are provided:
+
+      - SSE, using SSE2 with SSSE3/SSE4.1 instructions where the
+        compiler targets them
+      - NEON, for AArch64
+      - a plain C version for everything else, which is slow but exact
+
+    RSP_VEC_NATIVE is 1 when one of the SIMD implementations is in use.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __RSPVEC_H__
+#define __RSPVEC_H__
+
+#include "osdcomm.h"
+#include <string.h>
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RSP_VEC_SSE         (1)
+#elif (defined(__aarch64__) && defined(__ARM_NEON))
+#define RSP_VEC_NEON        (1)
+#else
+#define RSP_VEC_GENERIC     (1)
+#endif
+
+#ifdef _MSC_VER
+#define __align16 __declspec(align(16))
+#else
+#define __align16 __attribute__((aligned(16)))
+#endif
+
+/* builds a lane selector for vec_shufflelo16/vec_shufflehi16/vec_shuffle32, like _MM_SHUFFLE */
+#define VEC_SHUFFLE(z, y, x, w)     (((z) << 6) | ((y) << 4) | ((x) << 2) | (w))
+
+
+
+/***************************************************************************
+    SSE
+***************************************************************************/
+
+#if defined(RSP_VEC_SSE)
+
+#define RSP_VEC_NATIVE      (1)
+
+#if (defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__)))
+#include <smmintrin.h>
+#define RSP_VEC_HAS_BLEND   (1)
+#define RSP_VEC_HAS_SHUFFLE8 (1)
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define RSP_VEC_HAS_BLEND   (0)
+#define RSP_VEC_HAS_SHUFFLE8 (1)
+#else
+#include <emmintrin.h>
+#define RSP_VEC_HAS_BLEND   (0)
+#define RSP_VEC_HAS_SHUFFLE8 (0)
+#endif
+
+typedef __m128i rsp_vec_t;
+
+/* loads and stores; vec_load/vec_store need 16-byte alignment */
+static inline rsp_vec_t vec_load(const void *src) { return _mm_load_si128((const rsp_vec_t *)src); }
+static inline rsp_vec_t vec_loadu(const void *src) { return _mm_loadu_si128((const rsp_vec_t *)src); }
+static inline rsp_vec_t vec_loadl64(const void *src) { return _mm_loadl_epi64((const rsp_vec_t *)src); }
+static inline void vec_store(void *dest, rsp_vec_t v) { _mm_store_si128((rsp_vec_t *)dest, v); }
+static inline void vec_storeu(void *dest, rsp_vec_t v) { _mm_storeu_si128((rsp_vec_t *)dest, v); }
+static inline void vec_storel64(void *dest, rsp_vec_t v) { _mm_storel_epi64((rsp_vec_t *)dest, v); }
+
+/* constants */
+static inline rsp_vec_t vec_setzero() { return _mm_setzero_si128(); }
+static inline rsp_vec_t vec_set1_16(INT16 x) { return _mm_set1_epi16(x); }
+static inline rsp_vec_t vec_set16(INT16 e7, INT16 e6, INT16 e5, INT16 e4, INT16 e3, INT16 e2, INT16 e1, INT16 e0) { return _mm_set_epi16(e7, e6, e5, e4, e3, e2, e1, e0); }
+
+/* bitwise; vec_andnot(a, b) is ~a & b */
+static inline rsp_vec_t vec_and(rsp_vec_t a, rsp_vec_t b) { return _mm_and_si128(a, b); }
+static inline rsp_vec_t vec_or(rsp_vec_t a, rsp_vec_t b) { return _mm_or_si128(a, b); }
+static inline rsp_vec_t vec_xor(rsp_vec_t a, rsp_vec_t b) { return _mm_xor_si128(a, b); }
+static inline rsp_vec_t vec_andnot(rsp_vec_t a, rsp_vec_t b) { return _mm_andnot_si128(a, b); }
+
+/* 16-bit arithmetic */
+static inline rsp_vec_t vec_add16(rsp_vec_t a, rsp_vec_t b) { return _mm_add_epi16(a, b); }
+static inline rsp_vec_t vec_sub16(rsp_vec_t a, rsp_vec_t b) { return _mm_sub_epi16(a, b); }
+static inline rsp_vec_t vec_adds16(rsp_vec_t a, rsp_vec_t b) { return _mm_adds_epi16(a, b); }
+static inline rsp_vec_t vec_subs16(rsp_vec_t a, rsp_vec_t b) { return _mm_subs_epi16(a, b); }
+static inline rsp_vec_t vec_addus16(rsp_vec_t a, rsp_vec_t b) { return _mm_adds_epu16(a, b); }
+static inline rsp_vec_t vec_subus16(rsp_vec_t a, rsp_vec_t b) { return _mm_subs_epu16(a, b); }
+static inline rsp_vec_t vec_mullo16(rsp_vec_t a, rsp_vec_t b) { return _mm_mullo_epi16(a, b); }
+static inline rsp_vec_t vec_mulhi16(rsp_vec_t a, rsp_vec_t b) { return _mm_mulhi_epi16(a, b); }
+static inline rsp_vec_t vec_mulhiu16(rsp_vec_t a, rsp_vec_t b) { return _mm_mulhi_epu16(a, b); }
+static inline rsp_vec_t vec_min16(rsp_vec_t a, rsp_vec_t b) { return _mm_min_epi16(a, b); }
+static inline rsp_vec_t vec_max16(rsp_vec_t a, rsp_vec_t b) { return _mm_max_epi16(a, b); }
+
+/* comparisons, producing all-ones lanes where true */
+static inline rsp_vec_t vec_cmpeq16(rsp_vec_t a, rsp_vec_t b) { return _mm_cmpeq_epi16(a, b); }
+static inline rsp_vec_t vec_cmpgt16(rsp_vec_t a, rsp_vec_t b) { return _mm_cmpgt_epi16(a, b); }
+static inline rsp_vec_t vec_cmplt16(rsp_vec_t a, rsp_vec_t b) { return _mm_cmplt_epi16(a, b); }
+static inline rsp_vec_t vec_cmpeq8(rsp_vec_t a, rsp_vec_t b) { return _mm_cmpeq_epi8(a, b); }
+
+/* shifts by a constant */
+#define vec_slli16(a, n)            _mm_slli_epi16(a, n)
+#define vec_srli16(a, n)            _mm_srli_epi16(a, n)
+#define vec_srai16(a, n)            _mm_srai_epi16(a, n)
+#define vec_srli128(a, n)           _mm_srli_si128(a, n)
+
+/* lane rearrangement by a constant selector */
+#define vec_shufflelo16(a, sel)     _mm_shufflelo_epi16(a, sel)
+#define vec_shufflehi16(a, sel)     _mm_shufflehi_epi16(a, sel)
+#define vec_shuffle32(a, sel)       _mm_shuffle_epi32(a, sel)
+
+/* packing and interleaving */
+static inline rsp_vec_t vec_packs16(rsp_vec_t a, rsp_vec_t b) { return _mm_packs_epi16(a, b); }
+static inline rsp_vec_t vec_packs32(rsp_vec_t a, rsp_vec_t b) { return _mm_packs_epi32(a, b); }
+static inline rsp_vec_t vec_unpacklo8(rsp_vec_t a, rsp_vec_t b) { return _mm_unpacklo_epi8(a, b); }
+static inline rsp_vec_t vec_unpacklo16(rsp_vec_t a, rsp_vec_t b) { return _mm_unpacklo_epi16(a, b); }
+static inline rsp_vec_t vec_unpackhi16(rsp_vec_t a, rsp_vec_t b) { return _mm_unpackhi_epi16(a, b); }
+static inline rsp_vec_t vec_unpacklo64(rsp_vec_t a, rsp_vec_t b) { return _mm_unpacklo_epi64(a, b); }
+static inline int vec_movemask8(rsp_vec_t a) { return _mm_movemask_epi8(a); }
+
+/* per-byte select of b where the top bit of mask is set, otherwise a */
+static inline rsp_vec_t vec_blend(rsp_vec_t a, rsp_vec_t b, rsp_vec_t mask)
+{
+#if RSP_VEC_HAS_BLEND
+	return _mm_blendv_epi8(a, b, mask);
+#else
+	mask = _mm_cmpgt_epi8(_mm_setzero_si128(), mask);
+	return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+#endif
+}
+
+/* per-byte table lookup into a; key bytes with the top bit set give zero */
+static inline rsp_vec_t vec_shuffle8(rsp_vec_t a, rsp_vec_t key)
+{
+#if RSP_VEC_HAS_SHUFFLE8
+	return _mm_shuffle_epi8(a, key);
+#else
+	UINT8 src[16], keys[16], dest[16];
+	_mm_storeu_si128((rsp_vec_t *)src, a);
+	_mm_storeu_si128((rsp_vec_t *)keys, key);
+	for (int i = 0; i < 16; i++)
+		dest[i] = (keys[i] & 0x80) ? 0 : src[keys[i] & 0x0f];
+	return _mm_loadu_si128((const rsp_vec_t *)dest);
+#endif
+}
+
+
+
+/***************************************************************************
+    NEON
+***************************************************************************/
+
+#elif defined(RSP_VEC_NEON)
+
+#include <arm_neon.h>
+
+#define RSP_VEC_NATIVE      (1)
+#define RSP_VEC_HAS_BLEND   (1)
+#define RSP_VEC_HAS_SHUFFLE8 (1)
+
+typedef int16x8_t rsp_vec_t;
+
+static inline int8x16_t vec_as8(rsp_vec_t a) { return vreinterpretq_s8_s16(a); }
+static inline uint16x8_t vec_asu16(rsp_vec_t a) { return vreinterpretq_u16_s16(a); }
+static inline rsp_vec_t vec_from8(int8x16_t a) { return vreinterpretq_s16_s8(a); }
+static inline rsp_vec_t vec_fromu8(uint8x16_t a) { return vreinterpretq_s16_u8(a); }
+static inline rsp_vec_t vec_fromu16(uint16x8_t a) { return vreinterpretq_s16_u16(a); }
+
+static inline rsp_vec_t vec_load(const void *src) { return vld1q_s16((const int16_t *)src); }
+static inline rsp_vec_t vec_loadu(const void *src) { return vld1q_s16((const int16_t *)src); }
+static inline rsp_vec_t vec_loadl64(const void *src) { return vcombine_s16(vld1_s16((const int16_t *)src), vdup_n_s16(0)); }
+static inline void vec_store(void *dest, rsp_vec_t v) { vst1q_s16((int16_t *)dest, v); }
+static inline void vec_storeu(void *dest, rsp_vec_t v) { vst1q_s16((int16_t *)dest, v); }
+static inline void vec_storel64(void *dest, rsp_vec_t v) { vst1_s16((int16_t *)dest, vget_low_s16(v)); }
+
+static inline rsp_vec_t vec_setzero() { return vdupq_n_s16(0); }
+static inline rsp_vec_t vec_set1_16(INT16 x) { return vdupq_n_s16(x); }
+static inline rsp_vec_t vec_set16(INT16 e7, INT16 e6, INT16 e5, INT16 e4, INT16 e3, INT16 e2, INT16 e1, INT16 e0)
+{
+	const INT16 lanes[8] = { e0, e1, e2, e3, e4, e5, e6, e7 };
+	return vld1q_s16(lanes);
+}
+
+static inline rsp_vec_t vec_and(rsp_vec_t a, rsp_vec_t b) { return vandq_s16(a, b); }
+static inline rsp_vec_t vec_or(rsp_vec_t a, rsp_vec_t b) { return vorrq_s16(a, b); }
+static inline rsp_vec_t vec_xor(rsp_vec_t a, rsp_vec_t b) { return veorq_s16(a, b); }
+static inline rsp_vec_t vec_andnot(rsp_vec_t a, rsp_vec_t b) { return vbicq_s16(b, a); }
+
+static inline rsp_vec_t vec_add16(rsp_vec_t a, rsp_vec_t b) { return vaddq_s16(a, b); }
+static inline rsp_vec_t vec_sub16(rsp_vec_t a, rsp_vec_t b) { return vsubq_s16(a, b); }
+static inline rsp_vec_t vec_adds16(rsp_vec_t a, rsp_vec_t b) { return vqaddq_s16(a, b); }
+static inline rsp_vec_t vec_subs16(rsp_vec_t a, rsp_vec_t b) { return vqsubq_s16(a, b); }
+static inline rsp_vec_t vec_addus16(rsp_vec_t a, rsp_vec_t b) { return vec_fromu16(vqaddq_u16(vec_asu16(a), vec_asu16(b))); }
+static inline rsp_vec_t vec_subus16(rsp_vec_t a, rsp_vec_t b) { return vec_fromu16(vqsubq_u16(vec_asu16(a), vec_asu16(b))); }
+static inline rsp_vec_t vec_mullo16(rsp_vec_t a, rsp_vec_t b) { return vmulq_s16(a, b); }
+static inline rsp_vec_t vec_mulhi16(rsp_vec_t a, rsp_vec_t b)
+{
+	int32x4_t lo = vmull_s16(vget_low_s16(a), vget_low_s16(b));
+	int32x4_t hi = vmull_high_s16(a, b);
+	return vuzp2q_s16(vreinterpretq_s16_s32(lo), vreinterpretq_s16_s32(hi));
+}
+static inline rsp_vec_t vec_mulhiu16(rsp_vec_t a, rsp_vec_t b)
+{
+	uint32x4_t lo = vmull_u16(vget_low_u16(vec_asu16(a)), vget_low_u16(vec_asu16(b)));
+	uint32x4_t hi = vmull_high_u16(vec_asu16(a), vec_asu16(b));
+	return vec_fromu16(vuzp2q_u16(vreinterpretq_u16_u32(lo), vreinterpretq_u16_u32(hi)));
+}
+static inline rsp_vec_t vec_min16(rsp_vec_t a, rsp_vec_t b) { return vminq_s16(a, b); }
+static inline rsp_vec_t vec_max16(rsp_vec_t a, rsp_vec_t b) { return vmaxq_s16(a, b); }
+
+static inline rsp_vec_t vec_cmpeq16(rsp_vec_t a, rsp_vec_t b) { return vec_fromu16(vceqq_s16(a, b)); }
+static inline rsp_vec_t vec_cmpgt16(rsp_vec_t a, rsp_vec_t b) { return vec_fromu16(vcgtq_s16(a, b)); }
+static inline rsp_vec_t vec_cmplt16(rsp_vec_t a, rsp_vec_t b) { return vec_fromu16(vcltq_s16(a, b)); }
+static inline rsp_vec_t vec_cmpeq8(rsp_vec_t a, rsp_vec_t b) { return vec_fromu8(vceqq_s8(vec_as8(a), vec_as8(b))); }
+
+#define vec_slli16(a, n)            vshlq_n_s16(a, n)
+#define vec_srli16(a, n)            vec_fromu16(vshrq_n_u16(vec_asu16(a), n))
+#define vec_srai16(a, n)            vshrq_n_s16(a, n)
+#define vec_srli128(a, n)           vec_from8(vextq_s8(vec_as8(a), vdupq_n_s8(0), n))
+
+static inline rsp_vec_t vec_shuffle_lanes(rsp_vec_t a, int sel0, int sel1, int sel2, int sel3, int sel4, int sel5, int sel6, int sel7)
+{
+	INT16 src[8], dest[8];
+	vst1q_s16(src, a);
+	dest[0] = src[sel0]; dest[1] = src[sel1]; dest[2] = src[sel2]; dest[3] = src[sel3];
+	dest[4] = src[sel4]; dest[5] = src[sel5]; dest[6] = src[sel6]; dest[7] = src[sel7];
+	return vld1q_s16(dest);
+}
+#define vec_shufflelo16(a, sel)     vec_shuffle_lanes(a, (sel) & 3, ((sel) >> 2) & 3, ((sel) >> 4) & 3, ((sel) >> 6) & 3, 4, 5, 6, 7)
+#define vec_shufflehi16(a, sel)     vec_shuffle_lanes(a, 0, 1, 2, 3, 4 + ((sel) & 3), 4 + (((sel) >> 2) & 3), 4 + (((sel) >> 4) & 3), 4 + (((sel) >> 6) & 3))
+#define vec_shuffle32(a, sel)       vec_shuffle_lanes(a, \
+		2 * ((sel) & 3), 2 * ((sel) & 3) + 1, 2 * (((sel) >> 2) & 3), 2 * (((sel) >> 2) & 3) + 1, \
+		2 * (((sel) >> 4) & 3), 2 * (((sel) >> 4) & 3) + 1, 2 * (((sel) >> 6) & 3), 2 * (((sel) >> 6) & 3) + 1)
+
+static inline rsp_vec_t vec_packs16(rsp_vec_t a, rsp_vec_t b) { return vec_from8(vcombine_s8(vqmovn_s16(a), vqmovn_s16(b))); }
+static inline rsp_vec_t vec_packs32(rsp_vec_t a, rsp_vec_t b) { return vcombine_s16(vqmovn_s32(vreinterpretq_s32_s16(a)), vqmovn_s32(vreinterpretq_s32_s16(b))); }
+static inline rsp_vec_t vec_unpacklo8(rsp_vec_t a, rsp_vec_t b) { return vec_from8(vzip1q_s8(vec_as8(a), vec_as8(b))); }
+static inline rsp_vec_t vec_unpacklo16(rsp_vec_t a, rsp_vec_t b) { return vzip1q_s16(a, b); }
+static inline rsp_vec_t vec_unpackhi16(rsp_vec_t a, rsp_vec_t b) { return vzip2q_s16(a, b); }
+static inline rsp_vec_t vec_unpacklo64(rsp_vec_t a, rsp_vec_t b) { return vcombine_s16(vget_low_s16(a), vget_low_s16(b)); }
+static inline int vec_movemask8(rsp_vec_t a)
+{
+	static const int8_t shifts[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+	uint8x16_t bits = vshlq_u8(vshrq_n_u8(vreinterpretq_u8_s16(a), 7), vld1q_s8(shifts));
+	return vaddv_u8(vget_low_u8(bits)) | (vaddv_u8(vget_high_u8(bits)) << 8);
+}
+
+static inline rsp_vec_t vec_blend(rsp_vec_t a, rsp_vec_t b, rsp_vec_t mask)
+{
+	uint8x16_t select = vreinterpretq_u8_s8(vshrq_n_s8(vec_as8(mask), 7));
+	return vec_from8(vbslq_s8(select, vec_as8(b), vec_as8(a)));
+}
+
+static inline rsp_vec_t vec_shuffle8(rsp_vec_t a, rsp_vec_t key)
+{
+	uint8x16_t index = vandq_u8(vreinterpretq_u8_s16(key), vdupq_n_u8(0x8f));
+	return vec_fromu8(vqtbl1q_u8(vreinterpretq_u8_s16(a), index));
+}
+
+
+
+/***************************************************************************
+    GENERIC
+***************************************************************************/
+
+#else
+
+#define RSP_VEC_NATIVE      (0)
+#define RSP_VEC_HAS_BLEND   (1)
+#define RSP_VEC_HAS_SHUFFLE8 (1)
+
+/* lanes are kept in host order; byte accessors assume little-endian lanes, like SSE */
+union rsp_vec_t
+{
+	UINT8 b[16];
+	UINT16 h[8];
+	INT16 s[8];
+	UINT32 w[4];
+	UINT64 d[2];
+};
+
+static inline rsp_vec_t vec_load(const void *src) { rsp_vec_t r; memcpy(&r, src, 16); return r; }
+static inline rsp_vec_t vec_loadu(const void *src) { rsp_vec_t r; memcpy(&r, src, 16); return r; }
+static inline rsp_vec_t vec_loadl64(const void *src) { rsp_vec_t r; memcpy(&r, src, 8); r.d[1] = 0; return r; }
+static inline void vec_store(void *dest, rsp_vec_t v) { memcpy(dest, &v, 16); }
+static inline void vec_storeu(void *dest, rsp_vec_t v) { memcpy(dest, &v, 16); }
+static inline void vec_storel64(void *dest, rsp_vec_t v) { memcpy(dest, &v, 8); }
+
+static inline rsp_vec_t vec_setzero() { rsp_vec_t r; r.d[0] = r.d[1] = 0; return r; }
+static inline rsp_vec_t vec_set1_16(INT16 x) { rsp_vec_t r; for (int i = 0; i < 8; i++) r.s[i] = x; return r; }
+static inline rsp_vec_t vec_set16(INT16 e7, INT16 e6, INT16 e5, INT16 e4, INT16 e3, INT16 e2, INT16 e1, INT16 e0)
+{
+	rsp_vec_t r;
+	r.s[0] = e0; r.s[1] = e1; r.s[2] = e2; r.s[3] = e3; r.s[4] = e4; r.s[5] = e5; r.s[6] = e6; r.s[7] = e7;
+	return r;
+}
+
+#define RSP_VEC_LANES16(expr) \
+	rsp_vec_t r; \
+	for (int i = 0; i < 8; i++) \
+		r.s[i] = (INT16)(expr); \
+	return r;
+
+static inline INT16 vec_sat16(INT32 x) { return (x < -32768) ? -32768 : (x > 32767) ? 32767 : x; }
+static inline UINT16 vec_satu16(INT32 x) { return (x < 0) ? 0 : (x > 65535) ? 65535 : x; }
+static inline INT8 vec_sat8(INT32 x) { return (x < -128) ? -128 : (x > 127) ? 127 : x; }
+
+static inline rsp_vec_t vec_and(rsp_vec_t a, rsp_vec_t b) { a.d[0] &= b.d[0]; a.d[1] &= b.d[1]; return a; }
+static inline rsp_vec_t vec_or(rsp_vec_t a, rsp_vec_t b) { a.d[0] |= b.d[0]; a.d[1] |= b.d[1]; return a; }
+static inline rsp_vec_t vec_xor(rsp_vec_t a, rsp_vec_t b) { a.d[0] ^= b.d[0]; a.d[1] ^= b.d[1]; return a; }
+static inline rsp_vec_t vec_andnot(rsp_vec_t a, rsp_vec_t b) { b.d[0] &= ~a.d[0]; b.d[1] &= ~a.d[1]; return b; }
+
+static inline rsp_vec_t vec_add16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(a.h[i] + b.h[i]) }
+static inline rsp_vec_t vec_sub16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(a.h[i] - b.h[i]) }
+static inline rsp_vec_t vec_adds16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(vec_sat16(a.s[i] + b.s[i])) }
+static inline rsp_vec_t vec_subs16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(vec_sat16(a.s[i] - b.s[i])) }
+static inline rsp_vec_t vec_addus16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(vec_satu16(a.h[i] + b.h[i])) }
+static inline rsp_vec_t vec_subus16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(vec_satu16(a.h[i] - b.h[i])) }
+static inline rsp_vec_t vec_mullo16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16((UINT32)a.h[i] * b.h[i]) }
+static inline rsp_vec_t vec_mulhi16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(((INT32)a.s[i] * b.s[i]) >> 16) }
+static inline rsp_vec_t vec_mulhiu16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16(((UINT32)a.h[i] * b.h[i]) >> 16) }
+static inline rsp_vec_t vec_min16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16((a.s[i] < b.s[i]) ? a.s[i] : b.s[i]) }
+static inline rsp_vec_t vec_max16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16((a.s[i] > b.s[i]) ? a.s[i] : b.s[i]) }
+
+static inline rsp_vec_t vec_cmpeq16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16((a.h[i] == b.h[i]) ? -1 : 0) }
+static inline rsp_vec_t vec_cmpgt16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16((a.s[i] > b.s[i]) ? -1 : 0) }
+static inline rsp_vec_t vec_cmplt16(rsp_vec_t a, rsp_vec_t b) { RSP_VEC_LANES16((a.s[i] < b.s[i]) ? -1 : 0) }
+static inline rsp_vec_t vec_cmpeq8(rsp_vec_t a, rsp_vec_t b)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 16; i++)
+		r.b[i] = (a.b[i] == b.b[i]) ? 0xff : 0;
+	return r;
+}
+
+static inline rsp_vec_t vec_slli16(rsp_vec_t a, int n) { RSP_VEC_LANES16(a.h[i] << n) }
+static inline rsp_vec_t vec_srli16(rsp_vec_t a, int n) { RSP_VEC_LANES16(a.h[i] >> n) }
+static inline rsp_vec_t vec_srai16(rsp_vec_t a, int n) { RSP_VEC_LANES16(a.s[i] >> n) }
+static inline rsp_vec_t vec_srli128(rsp_vec_t a, int n)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 16; i++)
+		r.b[i] = (i + n < 16) ? a.b[i + n] : 0;
+	return r;
+}
+
+static inline rsp_vec_t vec_shufflelo16(rsp_vec_t a, int sel)
+{
+	rsp_vec_t r = a;
+	for (int i = 0; i < 4; i++)
+		r.h[i] = a.h[(sel >> (i * 2)) & 3];
+	return r;
+}
+static inline rsp_vec_t vec_shufflehi16(rsp_vec_t a, int sel)
+{
+	rsp_vec_t r = a;
+	for (int i = 0; i < 4; i++)
+		r.h[4 + i] = a.h[4 + ((sel >> (i * 2)) & 3)];
+	return r;
+}
+static inline rsp_vec_t vec_shuffle32(rsp_vec_t a, int sel)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 4; i++)
+		r.w[i] = a.w[(sel >> (i * 2)) & 3];
+	return r;
+}
+
+static inline rsp_vec_t vec_packs16(rsp_vec_t a, rsp_vec_t b)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 8; i++)
+	{
+		r.b[i] = vec_sat8(a.s[i]);
+		r.b[8 + i] = vec_sat8(b.s[i]);
+	}
+	return r;
+}
+static inline rsp_vec_t vec_packs32(rsp_vec_t a, rsp_vec_t b)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 4; i++)
+	{
+		r.s[i] = vec_sat16((INT32)a.w[i]);
+		r.s[4 + i] = vec_sat16((INT32)b.w[i]);
+	}
+	return r;
+}
+static inline rsp_vec_t vec_unpacklo8(rsp_vec_t a, rsp_vec_t b)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 8; i++)
+	{
+		r.b[2 * i] = a.b[i];
+		r.b[2 * i + 1] = b.b[i];
+	}
+	return r;
+}
+static inline rsp_vec_t vec_unpacklo16(rsp_vec_t a, rsp_vec_t b)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 4; i++)
+	{
+		r.h[2 * i] = a.h[i];
+		r.h[2 * i + 1] = b.h[i];
+	}
+	return r;
+}
+static inline rsp_vec_t vec_unpackhi16(rsp_vec_t a, rsp_vec_t b)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 4; i++)
+	{
+		r.h[2 * i] = a.h[4 + i];
+		r.h[2 * i + 1] = b.h[4 + i];
+	}
+	return r;
+}
+static inline rsp_vec_t vec_unpacklo64(rsp_vec_t a, rsp_vec_t b) { a.d[1] = b.d[0]; return a; }
+static inline int vec_movemask8(rsp_vec_t a)
+{
+	int result = 0;
+	for (int i = 0; i < 16; i++)
+		result |= (a.b[i] >> 7) << i;
+	return result;
+}
+
+static inline rsp_vec_t vec_blend(rsp_vec_t a, rsp_vec_t b, rsp_vec_t mask)
+{
+	for (int i = 0; i < 16; i++)
+		if (mask.b[i] & 0x80)
+			a.b[i] = b.b[i];
+	return a;
+}
+
+static inline rsp_vec_t vec_shuffle8(rsp_vec_t a, rsp_vec_t key)
+{
+	rsp_vec_t r;
+	for (int i = 0; i < 16; i++)
+		r.b[i] = (key.b[i] & 0x80) ? 0 : a.b[key.b[i] & 0x0f];
+	return r;
+}
+
+#undef RSP_VEC_LANES16
+
+#endif
+
+#endif /* __RSPVEC_H__ */
@@ -0,0 +1,43 @@
+// license:BSD-3-Clause
+// copyright-holders:Ryan Holtz,Tyler J. Stachecki
+/***************************************************************************
+
+    rspvops.h
+
+    SIMD implementations of the RSP vector unit operations.
+
+    These work purely on vector values, with the accumulator and flag
+    registers passed in and out by the caller, so they can be shared by
+    the interpreter and checked against the scalar implementation.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __RSPVOPS_H__
+#define __RSPVOPS_H__
+
+#include "rspvec.h"
+
+#include "clamp.h"
+#include "vabs.h"
+#include "vadd.h"
+#include "vaddc.h"
+#include "vand.h"
+#include "vch.h"
+#include "vcmp.h"
+#include "vcl.h"
+#include "vcr.h"
+#include "vmac.h"
+#include "vmrg.h"
+#include "vmul.h"
+#include "vmulh.h"
+#include "vmull.h"
+#include "vmulm.h"
+#include "vmuln.h"
+#include "vor.h"
+#include "vsub.h"
+#include "vsubc.h"
+#include "vxor.h"
+
+#endif /* __RSPVOPS_H__ */
@@ -3,11 +3,11 @@
 
 inline rsp_vec_t vec_vaddc(rsp_vec_t vs, rsp_vec_t vt, rsp_vec_t zero, rsp_vec_t *sn)
 {
-	rsp_vec_t sat_sum = _mm_adds_epu16(vs, vt);
-	rsp_vec_t unsat_sum = _mm_add_epi16(vs, vt);
+	rsp_vec_t sat_sum = vec_addus16(vs, vt);
+	rsp_vec_t unsat_sum = vec_add16(vs, vt);
 
-	*sn = _mm_cmpeq_epi16(sat_sum, unsat_sum);
-	*sn = _mm_cmpeq_epi16(*sn, zero);
+	*sn = vec_cmpeq16(sat_sum, unsat_sum);
+	*sn = vec_cmpeq16(*sn, zero);
 
 	return unsat_sum;
 }
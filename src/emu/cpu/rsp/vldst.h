@@ -5,7 +5,7 @@
 inline void vec_lbdlsv_sbdlsv(UINT32 iw, UINT32 rs)
 {
 	const UINT32 shift_and_idx = (iw >> 11) & 0x3;
-	rsp_vec_t dqm = _mm_loadl_epi64((rsp_vec_t *) (m_vec_helpers.bdls_lut[shift_and_idx]));
+	rsp_vec_t dqm = vec_loadl64((rsp_vec_t *) (m_vec_helpers.bdls_lut[shift_and_idx]));
 
 	const UINT32 addr = (rs + (sign_extend_6(iw) << shift_and_idx)) & 0xfff;
 	const UINT32 element = (iw >> 7) & 0xf;
@@ -38,11 +38,11 @@ inline void vec_lfhpuv_sfhpuv(UINT32 iw, UINT32 rs)
 	rsp_mem_request_type request_type = fhpu_type_lut[((iw >> 11) & 0x1f) - 6];
 	if ((iw >> 29) & 0x1)
 	{
-		vec_store_group2(addr, element, regp, vec_load_unshuffled_operand(regp), _mm_setzero_si128(), request_type);
+		vec_store_group2(addr, element, regp, vec_load_unshuffled_operand(regp), vec_setzero(), request_type);
 	}
 	else
 	{
-		vec_load_group2(addr, element, regp, vec_load_unshuffled_operand(regp), _mm_setzero_si128(), request_type);
+		vec_load_group2(addr, element, regp, vec_load_unshuffled_operand(regp), vec_setzero(), request_type);
 	}
 }
 
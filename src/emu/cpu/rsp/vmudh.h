@@ -3,8 +3,8 @@
 
 inline rsp_vec_t rsp_vmudh(rsp_vec_t vs, rsp_vec_t vt, rsp_vec_t *acc_md, rsp_vec_t *acc_hi)
 {
-	*acc_md = _mm_mullo_epi16(vs, vt);
-	*acc_hi = _mm_mulhi_epi16(vs, vt);
+	*acc_md = vec_mullo16(vs, vt);
+	*acc_hi = vec_mulhi16(vs, vt);
 
 	return sclamp_acc_to_mid(*acc_md, *acc_hi);
 }
@@ -3,21 +3,21 @@
 
 inline rsp_vec_t vec_vmadh_vmudh(UINT32 iw, rsp_vec_t vs, rsp_vec_t vt, rsp_vec_t zero, rsp_vec_t *acc_lo, rsp_vec_t *acc_md, rsp_vec_t *acc_hi)
 {
-	rsp_vec_t lo = _mm_mullo_epi16(vs, vt);
-	rsp_vec_t hi = _mm_mulhi_epi16(vs, vt);
+	rsp_vec_t lo = vec_mullo16(vs, vt);
+	rsp_vec_t hi = vec_mulhi16(vs, vt);
 
 	if (iw & 0x8) // VMADH
 	{
 		// Tricky part: start accumulating everything.
 		// Get/keep the carry as we'll add it in later.
-		rsp_vec_t overflow_mask = _mm_adds_epu16(*acc_md, lo);
-		*acc_md = _mm_add_epi16(*acc_md, lo);
+		rsp_vec_t overflow_mask = vec_addus16(*acc_md, lo);
+		*acc_md = vec_add16(*acc_md, lo);
 
-		overflow_mask = _mm_cmpeq_epi16(*acc_md, overflow_mask);
-		overflow_mask = _mm_cmpeq_epi16(overflow_mask, zero);
+		overflow_mask = vec_cmpeq16(*acc_md, overflow_mask);
+		overflow_mask = vec_cmpeq16(overflow_mask, zero);
 
-		hi = _mm_sub_epi16(hi, overflow_mask);
-		*acc_hi = _mm_add_epi16(*acc_hi, hi);
+		hi = vec_sub16(hi, overflow_mask);
+		*acc_hi = vec_add16(*acc_hi, hi);
 	}
 	else // VMUDH
 	{
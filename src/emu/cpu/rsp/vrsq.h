@@ -56,11 +56,11 @@ rsp_vec_t vec_vrsqh(UINT32 src, UINT32 e, UINT32 dest, UINT32 de)
 	m_div_in = elements[e];
 
 	// Write out the upper part of the result.
-	rsp_vec_t vd_mask = _mm_load_si128((rsp_vec_t *) m_vec_helpers.vrsq_mask_table[de]);
-	rsp_vec_t vd = _mm_load_si128((rsp_vec_t *) &m_v[dest]);
-	vd = _mm_andnot_si128(vd_mask, vd);
+	rsp_vec_t vd_mask = vec_load((rsp_vec_t *) m_vec_helpers.vrsq_mask_table[de]);
+	rsp_vec_t vd = vec_load((rsp_vec_t *) &m_v[dest]);
+	vd = vec_andnot(vd_mask, vd);
 
-	rsp_vec_t b_result = _mm_set1_epi16(m_div_out);
-	b_result = _mm_and_si128(vd_mask, b_result);
-	return _mm_or_si128(b_result, vd);
+	rsp_vec_t b_result = vec_set1_16(m_div_out);
+	b_result = vec_and(vd_mask, b_result);
+	return vec_or(b_result, vd);
 }
@@ -3,8 +3,8 @@
 
 inline rsp_vec_t vec_vxor_vnxor(UINT32 iw, rsp_vec_t vs, rsp_vec_t vt)
 {
-	rsp_vec_t vmask = _mm_load_si128((rsp_vec_t *) m_vec_helpers.logic_mask[iw & 0x1]);
+	rsp_vec_t vmask = vec_set1_16((iw & 0x1) ? -1 : 0);
 
-	rsp_vec_t vd = _mm_xor_si128(vs, vt);
-	return _mm_xor_si128(vd, vmask);
+	rsp_vec_t vd = vec_xor(vs, vt);
+	return vec_xor(vd, vmask);
 }
@@ -32,6 +32,20 @@
 #include "sh3comn.h"
 #include "sh4tmu.h"
 
+/***************************************************************************
+    CONFIGURATION
+***************************************************************************/
+
+#define SINGLE_INSTRUCTION_MODE         (0)
+
+/* size of the execution code cache */
+#define CACHE_SIZE                      (32 * 1024 * 1024)
+
+/* compilation boundaries -- how far back/forward does the analysis extend? */
+#define COMPILE_BACKWARDS_BYTES         128
+#define COMPILE_FORWARDS_BYTES          512
+#define COMPILE_MAX_SEQUENCE            64
+
 #if SH4_USE_FASTRAM_OPTIMIZATION
 void sh34_base_device::add_fastram(offs_t start, offs_t end, UINT8 readonly, void *base)
 {
@@ -106,6 +120,27 @@ sh34_base_device::sh34_base_device(const machine_config &mconfig, device_type ty
 	, m_dword_xor(m_bigendian ? DWORD_XOR_BE(0) : DWORD_XOR_LE(0))
 	, m_fastram_select(0)
 #endif
+	, m_isdrc(false)
+	, m_cache(CACHE_SIZE + sizeof(internal_sh4_state))
+	, m_drcuml(NULL)
+	, m_drcfe(NULL)
+	, m_drcoptions(SH4DRC_COMPATIBLE_OPTIONS)
+	, m_sh4_state(NULL)
+	, m_cache_dirty(TRUE)
+	, m_drc_running(false)
+	, m_drc_code_xor(0)
+	, m_pcfsel(0)
+	, m_entry(NULL)
+	, m_nocode(NULL)
+	, m_out_of_cycles(NULL)
+	, m_resync(NULL)
+	, m_interrupt(NULL)
+	, m_read8(NULL)
+	, m_write8(NULL)
+	, m_read16(NULL)
+	, m_write16(NULL)
+	, m_read32(NULL)
+	, m_write32(NULL)
 {
 #if SH4_USE_FASTRAM_OPTIMIZATION
 	memset(m_fastram, 0, sizeof(m_fastram));
@@ -124,6 +159,9 @@ sh4_base_device::sh4_base_device(const machine_config &mconfig, device_type type
 	: sh34_base_device(mconfig, type, name, tag, owner, clock, shortname, endianness, ADDRESS_MAP_NAME(sh4_internal_map))
 {
 	m_cpu_type = CPU_TYPE_SH4;
+
+	/* only the SH-4 has a recompiler; the SH-3 always interprets */
+	m_isdrc = (mconfig.options().drc() && mconfig.options().drc_sh4() && !mconfig.m_force_no_drc) ? true : false;
 }
 
 
@@ -3166,6 +3204,8 @@ void sh34_base_device::device_reset()
 	m_sleep_mode = 0;
 
 	m_sh4_mmu_enabled = 0;
+
+	m_cache_dirty = TRUE;
 }
 
 /*-------------------------------------------------
@@ -3938,6 +3978,12 @@ inline void sh34_base_device::execute_one(const UINT16 opcode)
 /* Execute cycles - returns number of cycles actually run */
 void sh34_base_device::execute_run()
 {
+	if (m_isdrc)
+	{
+		execute_run_drc();
+		return;
+	}
+
 	if (m_cpu_off)
 	{
 		m_sh4_icount = 0;
@@ -4035,6 +4081,12 @@ void sh3be_device::execute_run()
 
 void sh4be_device::execute_run()
 {
+	if (m_isdrc)
+	{
+		execute_run_drc();
+		return;
+	}
+
 	if (m_cpu_off)
 	{
 		m_sh4_icount = 0;
@@ -4284,6 +4336,57 @@ void sh34_base_device::device_start()
 	state_add(STATE_GENFLAGS, "GENFLAGS", m_sr).formatstr("%20s").noshow();
 
 	m_icountptr = &m_sh4_icount;
+
+	if (m_isdrc)
+	{
+		/* allocate the state shared with generated code from the cache */
+		m_sh4_state = (internal_sh4_state *)m_cache.alloc_near(sizeof(internal_sh4_state));
+		memset(m_sh4_state, 0, sizeof(*m_sh4_state));
+
+		/* initialize the UML generator */
+		m_drcuml = auto_alloc(machine(), drcuml_state(*this, m_cache, 0, DRCMODE_COUNT, 32, 1));
+
+		/* add symbols for our stuff */
+		m_drcuml->symbol_add(&m_sh4_state->pc, sizeof(m_sh4_state->pc), "pc");
+		m_drcuml->symbol_add(&m_sh4_state->icount, sizeof(m_sh4_state->icount), "icount");
+		for (int regnum = 0; regnum < 16; regnum++)
+		{
+			char buf[10];
+			sprintf(buf, "r%d", regnum);
+			m_drcuml->symbol_add(&m_sh4_state->r[regnum], sizeof(m_sh4_state->r[regnum]), buf);
+			sprintf(buf, "fr%d", regnum);
+			m_drcuml->symbol_add(&m_sh4_state->fr[regnum], sizeof(m_sh4_state->fr[regnum]), buf);
+		}
+		m_drcuml->symbol_add(&m_sh4_state->pr, sizeof(m_sh4_state->pr), "pr");
+		m_drcuml->symbol_add(&m_sh4_state->sr, sizeof(m_sh4_state->sr), "sr");
+		m_drcuml->symbol_add(&m_sh4_state->gbr, sizeof(m_sh4_state->gbr), "gbr");
+		m_drcuml->symbol_add(&m_sh4_state->mach, sizeof(m_sh4_state->mach), "mach");
+		m_drcuml->symbol_add(&m_sh4_state->macl, sizeof(m_sh4_state->macl), "macl");
+		m_drcuml->symbol_add(&m_sh4_state->fpul, sizeof(m_sh4_state->fpul), "fpul");
+		m_drcuml->symbol_add(&m_sh4_state->mode, sizeof(m_sh4_state->mode), "mode");
+		m_drcuml->symbol_add(&m_sh4_state->status, sizeof(m_sh4_state->status), "status");
+
+		/* opcodes are fetched the same way the interpreter does */
+		m_drc_code_xor = (m_program->endianness() == ENDIANNESS_BIG) ? WORD_XOR_LE(6) : WORD2_XOR_LE(0);
+
+		/* initialize the front-end helper */
+		m_drcfe = auto_alloc(machine(), sh4_frontend(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE));
+
+		/* the generated code counts down the copy next to the cache */
+		m_icountptr = &m_sh4_state->icount;
+
+		/* mark the cache dirty so it is updated on next execute */
+		m_cache_dirty = TRUE;
+	}
+}
+
+void sh34_base_device::device_stop()
+{
+	/* clean up the DRC */
+	if (m_drcfe != NULL)
+		auto_free(machine(), m_drcfe);
+	if (m_drcuml != NULL)
+		auto_free(machine(), m_drcuml);
 }
 
 void sh34_base_device::state_import(const device_state_entry &entry)
@@ -4442,7 +4545,10 @@ void sh34_base_device::state_export(const device_state_entry &entry)
 	switch (entry.index())
 	{
 		case STATE_GENPC:
-			m_debugger_temp = (m_delay) ? (m_delay & AM) : (m_pc & AM);
+			if (m_drc_running)
+				m_debugger_temp = m_sh4_state->pc & AM;
+			else
+				m_debugger_temp = (m_delay) ? (m_delay & AM) : (m_pc & AM);
 			break;
 	}
 }
@@ -4606,3 +4712,5 @@ void sh34_base_device::sh4_set_ftcsr_callback(sh4_ftcsr_callback callback)
 {
 	m_ftcsr_read_callback = callback;
 }
+
+#include "sh4drc.c"
@@ -13,6 +13,8 @@
 #ifndef __SH4_H__
 #define __SH4_H__
 
+#include "cpu/sh2/sh2.h"
+
 // doesn't actually seem to improve performance at all
 #define SH4_USE_FASTRAM_OPTIMIZATION 0
 #define SH4_MAX_FASTRAM       3
@@ -170,12 +172,32 @@ typedef void (*sh4_ftcsr_callback)(UINT32);
 	sh34_base_device::set_sh4_clock(*device, _clock);
 
 
+/***************************************************************************
+    COMPILER-SPECIFIC OPTIONS
+***************************************************************************/
+
+#define SH4DRC_STRICT_VERIFY    0x0001          /* verify all instructions */
+#define SH4DRC_FLUSH_PC         0x0002          /* flush the PC value before each memory access */
+#define SH4DRC_STRICT_PCREL     0x0004          /* do actual loads on MOVLI/MOVWI instead of collapsing to immediates */
+
+#define SH4DRC_COMPATIBLE_OPTIONS   (SH4DRC_STRICT_VERIFY | SH4DRC_FLUSH_PC | SH4DRC_STRICT_PCREL)
+#define SH4DRC_FASTEST_OPTIONS  (0)
+
+
+class sh4_frontend;
+
 class sh34_base_device : public cpu_device
 {
+	friend class sh4_frontend;
+
 public:
 	// construction/destruction
 	sh34_base_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, UINT32 clock, const char *shortname, endianness_t endianness, address_map_constructor internal);
 
+	// DRC configuration helpers
+	void sh4drc_set_options(UINT32 options);
+	void sh4drc_add_pcflush(offs_t address);
+
 //#if SH4_USE_FASTRAM_OPTIMIZATION
 	void add_fastram(offs_t start, offs_t end, UINT8 readonly, void *base);
 //#endif
@@ -206,6 +228,7 @@ protected:
 	// device-level overrides
 	virtual void device_start();
 	virtual void device_reset();
+	virtual void device_stop();
 
 	// device_execute_interface overrides
 	virtual UINT32 execute_min_cycles() const { return 1; }
@@ -707,6 +730,111 @@ protected:
 		void *              base;                       /* base in memory where the RAM lives */
 	}       m_fastram[SH4_MAX_FASTRAM];
 #endif
+
+	// DRC code modes; the mode selects the hash table a block is compiled into
+	enum
+	{
+		DRCMODE_PR          = 0x01,     // FPSCR.PR set, FPU works on doubles
+		DRCMODE_SZ          = 0x02,     // FPSCR.SZ set, FMOV transfers register pairs
+		DRCMODE_COUNT       = 0x04
+	};
+
+	// Data that needs to be stored close to the generated DRC code
+	struct internal_sh4_state
+	{
+		UINT32  r[16];              // current register bank
+		UINT32  fr[16];             // current FPU bank; PR=1 pairs are native doubles
+		UINT32  xf[16];             // other FPU bank
+		UINT32  pc;
+		UINT32  pr;
+		UINT32  sr;
+		UINT32  gbr;
+		UINT32  mach;
+		UINT32  macl;
+		UINT32  fpul;
+		INT32   icount;             // authoritative cycle count while the DRC is in use
+		UINT32  mode;               // current DRCMODE_* bits
+		UINT32  opcode;             // opcode handed to the interpreter
+		UINT32  insnpc;             // address of that opcode
+		UINT32  status;             // result of the last interpreter call
+		UINT32  nextpc;             // PC an interpreted instruction is expected to continue at
+		UINT32  target;             // branch target while a delay slot executes
+	};
+
+	/* internal compiler state */
+	struct compiler_state
+	{
+		UINT32          cycles;                     /* accumulated cycles */
+		UINT32          mode;                       /* mode being compiled */
+		uml::code_label  labelnum;                   /* index for local labels */
+	};
+
+	bool                m_isdrc;
+	drc_cache           m_cache;                    /* pointer to the DRC code cache */
+	drcuml_state *      m_drcuml;                   /* DRC UML generator state */
+	sh4_frontend *      m_drcfe;                    /* pointer to the DRC front-end state */
+	UINT32              m_drcoptions;               /* configurable DRC options */
+	internal_sh4_state *m_sh4_state;                /* state shared with the generated code */
+	UINT8               m_cache_dirty;              /* true if we need to flush the cache */
+	bool                m_drc_running;              /* true while generated code owns the state */
+	UINT32              m_drc_code_xor;             /* xor applied to opcode fetches */
+	int                 m_pcfsel;                   /* last pcflush entry set */
+	UINT32              m_pcflushes[16];            /* pcflush entries */
+
+	uml::code_handle *  m_entry;                    /* entry point */
+	uml::code_handle *  m_nocode;                   /* nocode exception handler */
+	uml::code_handle *  m_out_of_cycles;            /* out of cycles exception handler */
+	uml::code_handle *  m_resync;                   /* interpreter resync handler */
+	uml::code_handle *  m_interrupt;                /* exit taken when a store raised an interrupt */
+	uml::code_handle *  m_read8;                    /* read byte */
+	uml::code_handle *  m_write8;                   /* write byte */
+	uml::code_handle *  m_read16;                   /* read word */
+	uml::code_handle *  m_write16;                  /* write word */
+	uml::code_handle *  m_read32;                   /* read long */
+	uml::code_handle *  m_write32;                  /* write long */
+
+	// internal helpers
+	inline void alloc_handle(drcuml_state *drcuml, uml::code_handle **handleptr, const char *name);
+	inline UINT32 drc_compute_mode();
+	void drc_export_state();
+	void drc_import_state();
+	void drc_update_status(UINT32 oldmode);
+	void drc_interpret(UINT16 opcode);
+	void drc_interpret_delay_slot();
+
+	void execute_run_drc();
+	void code_flush_cache();
+	void code_compile_block(UINT8 mode, offs_t pc);
+	static void cfunc_execute_interpreted(void *param);
+	void func_execute_interpreted();
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+	void static_generate_resync();
+	void static_generate_interrupt_exit();
+	void static_generate_memory_accessor(int size, int iswrite, const char *name, uml::code_handle **handleptr);
+	void log_add_disasm_comment(drcuml_block *block, UINT32 pc, UINT32 op);
+	void generate_update_cycles(drcuml_block *block, compiler_state *compiler, uml::parameter param, int allow_exception);
+	void generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_delay_slot_and_branch(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int extra_cycles);
+	void generate_flush_pc(drcuml_block *block, const opcode_desc *desc);
+	void generate_read(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int size);
+	void generate_write(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int size);
+	void generate_check_interrupt(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_set_t(drcuml_block *block, uml::condition_t cond);
+	bool generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	bool generate_group_0(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_2(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_3(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_4(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_6(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_8(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_12(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_group_15(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_fpu_misc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
+	bool generate_fmov_memory(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode);
 };
 
 
@@ -780,24 +908,26 @@ protected:
 };
 
 
+class sh4_frontend : public sh2_frontend
+{
+public:
+	sh4_frontend(sh34_base_device *device, UINT32 window_start, UINT32 window_end, UINT32 max_sequence);
+
+protected:
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev);
+	virtual UINT16 read_opcode(const opcode_desc &desc);
+	virtual bool describe_group_0(opcode_desc &desc, const opcode_desc *prev, UINT16 opcode);
+	virtual bool describe_group_4(opcode_desc &desc, const opcode_desc *prev, UINT16 opcode);
+	virtual bool describe_group_15(opcode_desc &desc, const opcode_desc *prev, UINT16 opcode);
+
+private:
+	sh34_base_device *m_sh4;
+};
+
+
 extern const device_type SH3LE;
 extern const device_type SH3BE;
 extern const device_type SH4LE;
 extern const device_type SH4BE;
 
-
-/***************************************************************************
-    COMPILER-SPECIFIC OPTIONS
-***************************************************************************/
-
-#define SH4DRC_STRICT_VERIFY    0x0001          /* verify all instructions */
-#define SH4DRC_FLUSH_PC         0x0002          /* flush the PC value before each memory access */
-#define SH4DRC_STRICT_PCREL     0x0004          /* do actual loads on MOVLI/MOVWI instead of collapsing to immediates */
-
-#define SH4DRC_COMPATIBLE_OPTIONS   (SH4DRC_STRICT_VERIFY | SH4DRC_FLUSH_PC | SH4DRC_STRICT_PCREL)
-#define SH4DRC_FASTEST_OPTIONS  (0)
-
-void sh4drc_set_options(device_t *device, UINT32 options);
-void sh4drc_add_pcflush(device_t *device, offs_t address);
-
 #endif /* __SH4_H__ */
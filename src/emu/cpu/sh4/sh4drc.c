@@ -0,0 +1,2108 @@
+// license:BSD-3-Clause
+// copyright-holders:R. Belmont
+/***************************************************************************
+
+    sh4drc.c
+    Universal machine language-based SH-4 emulator.
+
+    Integer, branch and memory operations, along with the common
+    single-precision FPU operations (including the register pair moves,
+    FIPR and FTRV), are translated directly to UML.  Everything else is
+    handed back to the interpreter one instruction at a time; the
+    generated code then checks whether it can keep running the block or
+    has to redispatch.
+
+    Instruction decoding is shared with the SH-2 front end.  FPSCR.PR and
+    FPSCR.SZ change what the FPU opcodes do, so they select the DRC mode
+    a block is compiled for.
+
+***************************************************************************/
+
+#include "cpu/drcumlsh.h"
+
+using namespace uml;
+
+extern unsigned DasmSH4(char *buffer, unsigned pc, UINT16 opcode);
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* exit codes */
+#define EXECUTE_OUT_OF_CYCLES       0
+#define EXECUTE_MISSING_CODE        1
+#define EXECUTE_INTERRUPT           2
+#define EXECUTE_RESYNC              3
+
+/* interpreter call status */
+#define STATUS_CONTINUE             0           /* carry on with the block */
+#define STATUS_REDISPATCH           1           /* control went somewhere the block doesn't know about */
+#define STATUS_EXIT                 2           /* return to the execute loop */
+
+
+/***************************************************************************
+    MACROS
+***************************************************************************/
+
+#define R32(reg)        mem(&m_sh4_state->r[reg])
+#define FR32(reg)       mem(&m_sh4_state->fr[reg])
+#define XF32(reg)       mem(&m_sh4_state->xf[reg])
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+inline void sh34_base_device::alloc_handle(drcuml_state *drcuml, code_handle **handleptr, const char *name)
+{
+	if (*handleptr == NULL)
+		*handleptr = drcuml->handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    drc_compute_mode - work out the DRC mode for
+    the current CPU state
+-------------------------------------------------*/
+
+inline UINT32 sh34_base_device::drc_compute_mode()
+{
+	UINT32 mode = 0;
+
+	if (m_fpscr & PR)
+		mode |= DRCMODE_PR;
+	if (m_fpscr & SZ)
+		mode |= DRCMODE_SZ;
+	return mode;
+}
+
+
+/*-------------------------------------------------
+    cfunc_execute_interpreted - C wrapper for the
+    interpreter thunk
+-------------------------------------------------*/
+
+void sh34_base_device::cfunc_execute_interpreted(void *param)
+{
+	((sh34_base_device *)param)->func_execute_interpreted();
+}
+
+
+/***************************************************************************
+    STATE TRANSFER
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_export_state - copy the state the
+    generated code works on out of the device
+-------------------------------------------------*/
+
+void sh34_base_device::drc_export_state()
+{
+	internal_sh4_state *core = m_sh4_state;
+
+	for (int regnum = 0; regnum < 16; regnum++)
+	{
+		core->r[regnum] = m_r[regnum];
+		core->fr[regnum] = m_fr[regnum];
+		core->xf[regnum] = m_xf[regnum];
+	}
+	core->pc = m_pc;
+	core->pr = m_pr;
+	core->sr = m_sr;
+	core->gbr = m_gbr;
+	core->mach = m_mach;
+	core->macl = m_macl;
+	core->fpul = m_fpul;
+	core->mode = drc_compute_mode();
+}
+
+
+/*-------------------------------------------------
+    drc_import_state - copy the state the
+    generated code works on back into the device
+-------------------------------------------------*/
+
+void sh34_base_device::drc_import_state()
+{
+	internal_sh4_state *core = m_sh4_state;
+
+	for (int regnum = 0; regnum < 16; regnum++)
+	{
+		m_r[regnum] = core->r[regnum];
+		m_fr[regnum] = core->fr[regnum];
+		m_xf[regnum] = core->xf[regnum];
+	}
+	m_pc = core->pc;
+	m_pr = core->pr;
+	m_sr = core->sr;
+	m_gbr = core->gbr;
+	m_mach = core->mach;
+	m_macl = core->macl;
+	m_fpul = core->fpul;
+}
+
+
+/*-------------------------------------------------
+    drc_update_status - export the state after an
+    interpreted instruction and decide whether
+    the generated code may carry on
+-------------------------------------------------*/
+
+void sh34_base_device::drc_update_status(UINT32 oldmode)
+{
+	internal_sh4_state *core = m_sh4_state;
+	UINT32 status = STATUS_CONTINUE;
+
+	drc_export_state();
+
+	/* anything the execute loop has to look at sends us back there */
+	if (core->icount <= 0 || m_delay || m_cache_dirty || m_test_irq || m_sleep_mode == 1)
+		status = STATUS_EXIT;
+
+	/* a mode change or an unexpected PC means we need a different block */
+	else if (core->mode != oldmode || (core->nextpc != 0xffffffff && core->pc != core->nextpc))
+		status = STATUS_REDISPATCH;
+
+	core->status = status;
+}
+
+
+/*-------------------------------------------------
+    drc_interpret - run a single opcode through
+    the interpreter, charging its cycles to the
+    DRC cycle count
+-------------------------------------------------*/
+
+void sh34_base_device::drc_interpret(UINT16 opcode)
+{
+	internal_sh4_state *core = m_sh4_state;
+	INT32 before = core->icount;
+
+	/* the handlers count on m_sh4_icount, and the busy loop hacks look at its absolute value */
+	m_sh4_icount = before;
+	m_ppc = m_pc;
+	execute_one(opcode);
+	m_sh4_icount--;
+	core->icount += m_sh4_icount - before;
+}
+
+
+/*-------------------------------------------------
+    drc_interpret_delay_slot - run the delay slot
+    of a branch the interpreter took
+-------------------------------------------------*/
+
+void sh34_base_device::drc_interpret_delay_slot()
+{
+	const UINT16 opcode = m_direct->read_word(m_delay & AM, m_drc_code_xor);
+
+	debugger_instruction_hook(this, m_delay & AM);
+
+	m_delay = 0;
+	drc_interpret(opcode);
+}
+
+
+/*-------------------------------------------------
+    func_execute_interpreted - run a single
+    instruction through the interpreter on
+    behalf of the generated code
+-------------------------------------------------*/
+
+void sh34_base_device::func_execute_interpreted()
+{
+	internal_sh4_state *core = m_sh4_state;
+	UINT32 oldmode = core->mode;
+
+	drc_import_state();
+	m_drc_running = false;
+
+	/* the debugger wants to see the address of the instruction, not the one after it */
+	UINT32 pc = m_pc;
+	m_pc = core->insnpc;
+	debugger_instruction_hook(this, m_pc & AM);
+	m_pc = pc;
+
+	drc_interpret(core->opcode);
+	drc_update_status(oldmode);
+	m_drc_running = true;
+}
+
+
+/***************************************************************************
+    CORE EXECUTION
+***************************************************************************/
+
+/*-------------------------------------------------
+    sh4drc_set_options - configure DRC options
+-------------------------------------------------*/
+
+void sh34_base_device::sh4drc_set_options(UINT32 options)
+{
+	if (!m_isdrc)
+		return;
+	m_drcoptions = options;
+	m_cache_dirty = TRUE;
+}
+
+
+/*-------------------------------------------------
+    sh4drc_add_pcflush - add a new address where
+    the PC must be flushed for speedups to work
+-------------------------------------------------*/
+
+void sh34_base_device::sh4drc_add_pcflush(offs_t address)
+{
+	if (!m_isdrc)
+		return;
+
+	if (m_pcfsel < ARRAY_LENGTH(m_pcflushes))
+		m_pcflushes[m_pcfsel++] = address;
+	m_cache_dirty = TRUE;
+}
+
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void sh34_base_device::code_flush_cache()
+{
+	drcuml_state *drcuml = m_drcuml;
+
+	/* empty the transient cache contents */
+	drcuml->reset();
+
+	try
+	{
+		/* generate the entry point and exception handlers */
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+		static_generate_interrupt_exit();
+		static_generate_resync();
+		static_generate_entry_point();
+
+		/* add subroutines for memory accesses */
+		static_generate_memory_accessor(1, FALSE, "read8",   &m_read8);
+		static_generate_memory_accessor(1, TRUE,  "write8",  &m_write8);
+		static_generate_memory_accessor(2, FALSE, "read16",  &m_read16);
+		static_generate_memory_accessor(2, TRUE,  "write16", &m_write16);
+		static_generate_memory_accessor(4, FALSE, "read32",  &m_read32);
+		static_generate_memory_accessor(4, TRUE,  "write32", &m_write32);
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unable to generate SH4 static code\n");
+	}
+
+	m_cache_dirty = FALSE;
+}
+
+
+/*-------------------------------------------------
+    execute_run_drc - execute cycles using the
+    recompiler
+-------------------------------------------------*/
+
+void sh34_base_device::execute_run_drc()
+{
+	internal_sh4_state *core = m_sh4_state;
+	drcuml_state *drcuml = m_drcuml;
+	int execute_result;
+
+	if (m_cpu_off)
+	{
+		core->icount = 0;
+		return;
+	}
+
+	while (core->icount > 0)
+	{
+		/* take any exception that became pending while we were away */
+		if (m_test_irq && !m_delay)
+			sh4_check_pending_irq("sh4drc_execute");
+
+		/* the interpreter took a branch; finish off its delay slot the same way */
+		if (m_delay)
+		{
+			drc_interpret_delay_slot();
+			continue;
+		}
+
+		/* a sleeping CPU has nothing to do until an interrupt arrives */
+		if (m_sleep_mode == 1)
+		{
+			core->icount = 0;
+			break;
+		}
+
+		/* reset the cache if dirty */
+		if (m_cache_dirty)
+			code_flush_cache();
+
+		/* run as much as we can */
+		drc_export_state();
+		m_drc_running = true;
+		execute_result = drcuml->execute(*m_entry);
+		m_drc_running = false;
+		drc_import_state();
+
+		if (execute_result == EXECUTE_MISSING_CODE)
+			code_compile_block(drc_compute_mode(), m_pc);
+	}
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block of the
+    given mode at the specified pc
+-------------------------------------------------*/
+
+void sh34_base_device::code_compile_block(UINT8 mode, offs_t pc)
+{
+	drcuml_state *drcuml = m_drcuml;
+	compiler_state compiler = { 0 };
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
+	int override = FALSE;
+	drcuml_block *block;
+
+	g_profiler.start(PROFILER_DRC_COMPILE);
+
+	compiler.mode = mode;
+
+	/* get a description of this sequence */
+	desclist = m_drcfe->describe_code(pc);
+
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			/* start the block */
+			block = drcuml->begin_block(4096);
+
+			/* loop until we get through all instruction sequences */
+			for (seqhead = desclist; seqhead != NULL; seqhead = seqlast->next())
+			{
+				const opcode_desc *curdesc;
+				UINT32 nextpc;
+
+				/* add a code log entry */
+				if (drcuml->logging())
+					block->append_comment("-------------------------");                     // comment
+
+				/* determine the last instruction in this sequence */
+				for (seqlast = seqhead; seqlast != NULL; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != NULL);
+
+				/* if we don't have a hash for this mode/pc, or if we are overriding all, add one */
+				if (override || !drcuml->hash_exists(mode, seqhead->pc))
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+
+				/* if we already have a hash, and this is the first sequence, assume that we */
+				/* are recompiling due to being out of sync and allow future overrides */
+				else if (seqhead == desclist)
+				{
+					override = TRUE;
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+				}
+
+				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
+				else
+				{
+					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
+					UML_HASHJMP(block, mode, seqhead->pc, *m_nocode);                       // hashjmp <mode>,seqhead->pc,nocode
+					continue;
+				}
+
+				/* validate this code block if we're not pointing into ROM */
+				if (m_program->get_write_ptr(seqhead->physpc) != NULL)
+					generate_checksum_block(block, &compiler, seqhead, seqlast);
+
+				/* label this instruction, if it may be jumped to locally */
+				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
+					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
+
+				/* iterate over instructions in the sequence and compile them */
+				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, &compiler, curdesc);
+
+				/* if we need to return to the start, do it */
+				if (seqlast->flags & OPFLAG_RETURN_TO_START)
+					nextpc = pc;
+
+				/* otherwise we just go to the next instruction */
+				else
+					nextpc = seqlast->pc + seqlast->length;
+
+				/* count off cycles and go there */
+				generate_update_cycles(block, &compiler, nextpc, TRUE);                    // <subtract cycles>
+				if (seqlast->next() == NULL || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, mode, nextpc, *m_nocode);                            // hashjmp <mode>,nextpc,nocode
+			}
+
+			/* end the sequence */
+			block->end();
+			g_profiler.stop();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+/***************************************************************************
+    STATIC CODEGEN
+***************************************************************************/
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void sh34_base_device::static_generate_entry_point()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(20);
+
+	/* forward references */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+
+	alloc_handle(drcuml, &m_entry, "entry");
+	UML_HANDLE(block, *m_entry);                                                            // handle  entry
+
+	/* generate a hash jump via the current mode and PC */
+	UML_HASHJMP(block, mem(&m_sh4_state->mode), mem(&m_sh4_state->pc), *m_nocode);          // hashjmp <mode>,<pc>,nocode
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void sh34_base_device::static_generate_nocode_handler()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	/* generate a hash jump via the current mode and PC */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	UML_HANDLE(block, *m_nocode);                                                           // handle  nocode
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_sh4_state->pc), I0);                                              // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                                  // exit    EXECUTE_MISSING_CODE
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_out_of_cycles - generate an
+    out of cycles exception handler
+-------------------------------------------------*/
+
+void sh34_base_device::static_generate_out_of_cycles()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);                                                    // handle  out_of_cycles
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_sh4_state->pc), I0);                                              // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                                 // exit    EXECUTE_OUT_OF_CYCLES
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_interrupt_exit - generate the
+    exit taken when a store has made an interrupt
+    pending
+-------------------------------------------------*/
+
+void sh34_base_device::static_generate_interrupt_exit()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_interrupt, "interrupt");
+	UML_HANDLE(block, *m_interrupt);                                                        // handle  interrupt
+	UML_GETEXP(block, I0);                                                                  // getexp  i0
+	UML_MOV(block, mem(&m_sh4_state->pc), I0);                                              // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_INTERRUPT);                                                     // exit    EXECUTE_INTERRUPT
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_resync - generate the handler
+    taken when an interpreted instruction didn't
+    go where the block expected
+-------------------------------------------------*/
+
+void sh34_base_device::static_generate_resync()
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	alloc_handle(drcuml, &m_resync, "resync");
+	UML_HANDLE(block, *m_resync);                                                           // handle  resync
+	UML_CMP(block, mem(&m_sh4_state->status), STATUS_EXIT);                                 // cmp     [status],STATUS_EXIT
+	UML_JMPc(block, COND_E, 1);                                                             // je      1
+	UML_HASHJMP(block, mem(&m_sh4_state->mode), mem(&m_sh4_state->pc), *m_nocode);          // hashjmp <mode>,<pc>,nocode
+	UML_LABEL(block, 1);                                                                    // 1:
+	UML_EXIT(block, EXECUTE_RESYNC);                                                        // exit    EXECUTE_RESYNC
+
+	block->end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_memory_accessor - generate a
+    subroutine for a memory access; the address
+    is in I0, the data (for writes) in I1, and
+    the result (for reads) is returned in I0
+-------------------------------------------------*/
+
+void sh34_base_device::static_generate_memory_accessor(int size, int iswrite, const char *name, code_handle **handleptr)
+{
+	drcuml_state *drcuml = m_drcuml;
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(20);
+
+	/* add a global entry for this */
+	alloc_handle(drcuml, handleptr, name);
+	UML_HANDLE(block, **handleptr);                                                         // handle  *handleptr
+
+	/* the on-chip registers live at the top of the map; everything else is mirrored in 29 bits */
+	UML_CMP(block, I0, 0xe0000000);                                                         // cmp     i0,0xe0000000
+	UML_JMPc(block, COND_AE, 1);                                                            // jae     1
+	UML_AND(block, I0, I0, AM);                                                             // and     i0,i0,AM
+	UML_LABEL(block, 1);                                                                    // 1:
+
+	if (iswrite)
+	{
+		switch (size)
+		{
+			case 1: UML_WRITE(block, I0, I1, SIZE_BYTE, SPACE_PROGRAM);     break;          // write   i0,i1,program_byte
+			case 2: UML_WRITE(block, I0, I1, SIZE_WORD, SPACE_PROGRAM);     break;          // write   i0,i1,program_word
+			case 4: UML_WRITE(block, I0, I1, SIZE_DWORD, SPACE_PROGRAM);    break;          // write   i0,i1,program_dword
+		}
+	}
+	else
+	{
+		switch (size)
+		{
+			case 1: UML_READ(block, I0, I0, SIZE_BYTE, SPACE_PROGRAM);      break;          // read    i0,i0,program_byte
+			case 2: UML_READ(block, I0, I0, SIZE_WORD, SPACE_PROGRAM);      break;          // read    i0,i0,program_word
+			case 4: UML_READ(block, I0, I0, SIZE_DWORD, SPACE_PROGRAM);     break;          // read    i0,i0,program_dword
+		}
+	}
+	UML_RET(block);                                                                         // ret
+
+	block->end();
+}
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    log_add_disasm_comment - add a comment
+    including disassembly of an SH-4 instruction
+-------------------------------------------------*/
+
+void sh34_base_device::log_add_disasm_comment(drcuml_block *block, UINT32 pc, UINT32 op)
+{
+	if (m_drcuml->logging())
+	{
+		char buffer[100];
+		DasmSH4(buffer, pc, op);
+		block->append_comment("%08X: %s", pc, buffer);                                      // comment
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and generate
+    an exception if out
+-------------------------------------------------*/
+
+void sh34_base_device::generate_update_cycles(drcuml_block *block, compiler_state *compiler, uml::parameter param, int allow_exception)
+{
+	/* account for cycles */
+	if (compiler->cycles > 0)
+	{
+		UML_SUB(block, mem(&m_sh4_state->icount), mem(&m_sh4_state->icount), compiler->cycles); // sub     icount,icount,cycles
+		if (allow_exception)
+			UML_EXHc(block, COND_LE, *m_out_of_cycles, param);                              // exh     out_of_cycles,nextpc
+	}
+	compiler->cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void sh34_base_device::generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	const opcode_desc *curdesc;
+	if (m_drcuml->logging())
+		block->append_comment("[Validation for %08X]", seqhead->pc);                        // comment
+
+	/* loose verify or single instruction: just compare and fail */
+	if (!(m_drcoptions & SH4DRC_STRICT_VERIFY) || seqhead->next() == NULL)
+	{
+		void *base = m_direct->read_ptr(seqhead->physpc, m_drc_code_xor);
+		if (base != NULL)
+		{
+			UML_LOAD(block, I0, base, 0, SIZE_WORD, SCALE_x2);                              // load    i0,base,word
+			UML_CMP(block, I0, seqhead->opptr.w[0]);                                        // cmp     i0,*opptr
+			UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                               // exne    nocode,seqhead->pc
+		}
+	}
+
+	/* full verification; sum up everything, delay slots included */
+	else
+	{
+		UINT32 sum = 0;
+		UML_MOV(block, I0, 0);                                                              // mov     i0,0
+		for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+		{
+			const opcode_desc *slot = curdesc->delay.first();
+			for (int pass = 0; pass < 2; pass++)
+			{
+				const opcode_desc *desc = (pass == 0) ? curdesc : slot;
+				if (desc == NULL)
+					continue;
+
+				void *base = m_direct->read_ptr(desc->physpc, m_drc_code_xor);
+				if (base != NULL)
+				{
+					UML_LOAD(block, I1, base, 0, SIZE_WORD, SCALE_x2);                      // load    i1,base,word
+					UML_ADD(block, I0, I0, I1);                                             // add     i0,i0,i1
+					sum += desc->opptr.w[0];
+				}
+			}
+		}
+		UML_CMP(block, I0, sum);                                                            // cmp     i0,sum
+		UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                                   // exne    nocode,seqhead->pc
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void sh34_base_device::generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* add an entry for the log */
+	if (m_drcuml->logging())
+		log_add_disasm_comment(block, desc->pc, desc->opptr.w[0]);
+
+	/* the interpreter calls the debugger hook itself, so native code is only used when not debugging */
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0 && !(desc->flags & OPFLAG_INVALID_OPCODE))
+	{
+		compiler->cycles += desc->cycles;
+		if (generate_opcode(block, compiler, desc))
+			return;
+		compiler->cycles -= desc->cycles;
+	}
+
+	generate_interpreted(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_interpreted - generate a call into
+    the interpreter for a single instruction
+-------------------------------------------------*/
+
+void sh34_base_device::generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* the interpreter needs an accurate cycle count; a delay slot can't be restarted */
+	generate_update_cycles(block, compiler, desc->pc, !(desc->flags & OPFLAG_IN_DELAY_SLOT));   // <subtract cycles>
+
+	/* the interpreter runs an instruction with the PC pointing past it, or at the target in a delay slot */
+	if (desc->flags & OPFLAG_IN_DELAY_SLOT)
+	{
+		UML_MOV(block, mem(&m_sh4_state->pc), mem(&m_sh4_state->target));                  // mov     [pc],[target]
+		UML_MOV(block, mem(&m_sh4_state->nextpc), mem(&m_sh4_state->target));              // mov     [nextpc],[target]
+	}
+	else
+	{
+		UML_MOV(block, mem(&m_sh4_state->pc), desc->pc + 2);                               // mov     [pc],desc->pc + 2
+		UML_MOV(block, mem(&m_sh4_state->nextpc), desc->pc + 2);                           // mov     [nextpc],desc->pc + 2
+	}
+	UML_MOV(block, mem(&m_sh4_state->insnpc), desc->pc);                                   // mov     [insnpc],desc->pc
+	UML_MOV(block, mem(&m_sh4_state->opcode), desc->opptr.w[0]);                           // mov     [opcode],opcode
+	UML_CALLC(block, cfunc_execute_interpreted, this);                                      // callc   execute_interpreted
+	UML_CMP(block, mem(&m_sh4_state->status), STATUS_CONTINUE);                             // cmp     [status],STATUS_CONTINUE
+	UML_EXHc(block, COND_NE, *m_resync, 0);                                                 // exh     resync,0,ne
+}
+
+
+/*-------------------------------------------------
+    generate_delay_slot_and_branch - compile the
+    delay slot of a branch, if it has one, and
+    jump to the target
+-------------------------------------------------*/
+
+void sh34_base_device::generate_delay_slot_and_branch(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int extra_cycles)
+{
+	compiler_state compiler_temp = *compiler;
+
+	/* the branch itself costs extra cycles on top of the base one */
+	compiler_temp.cycles += extra_cycles;
+
+	/* compile the delay slot using temporary compiler state */
+	if (desc->delay.first() != NULL)
+		generate_sequence_instruction(block, &compiler_temp, desc->delay.first());          // <next instruction>
+
+	/* update the cycles and jump through the hash table to the target */
+	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
+	{
+		generate_update_cycles(block, &compiler_temp, desc->targetpc, TRUE);               // <subtract cycles>
+		if (desc->flags & OPFLAG_INTRABLOCK_BRANCH)
+			UML_JMP(block, desc->targetpc | 0x80000000);                                    // jmp     desc->targetpc | 0x80000000
+		else
+			UML_HASHJMP(block, compiler->mode, desc->targetpc, *m_nocode);                  // hashjmp <mode>,desc->targetpc,nocode
+	}
+	else
+	{
+		generate_update_cycles(block, &compiler_temp, mem(&m_sh4_state->target), TRUE);    // <subtract cycles>
+		UML_HASHJMP(block, compiler->mode, mem(&m_sh4_state->target), *m_nocode);           // hashjmp <mode>,<target>,nocode
+	}
+
+	/* update the label */
+	compiler->labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_flush_pc - store the PC before a
+    memory access if the options or a driver's
+    speedup ask for it
+-------------------------------------------------*/
+
+void sh34_base_device::generate_flush_pc(drcuml_block *block, const opcode_desc *desc)
+{
+	bool flush = (m_drcoptions & SH4DRC_FLUSH_PC) != 0;
+
+	for (int pcflush = 0; pcflush < m_pcfsel && !flush; pcflush++)
+		if (desc->pc == m_pcflushes[pcflush])
+			flush = true;
+
+	if (!flush)
+		return;
+
+	/* match what the interpreter has in m_pc while the instruction runs */
+	if (desc->flags & OPFLAG_IN_DELAY_SLOT)
+		UML_MOV(block, mem(&m_sh4_state->pc), mem(&m_sh4_state->target));                  // mov     [pc],[target]
+	else
+		UML_MOV(block, mem(&m_sh4_state->pc), desc->pc + 2);                               // mov     [pc],desc->pc + 2
+}
+
+
+/*-------------------------------------------------
+    generate_read - read from the address in I0
+    into I0
+-------------------------------------------------*/
+
+void sh34_base_device::generate_read(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int size)
+{
+	generate_flush_pc(block, desc);
+	switch (size)
+	{
+		case 1: UML_CALLH(block, *m_read8);     break;                                      // callh   read8
+		case 2: UML_CALLH(block, *m_read16);    break;                                      // callh   read16
+		case 4: UML_CALLH(block, *m_read32);    break;                                      // callh   read32
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_write - write I1 to the address in
+    I0; callers finish the instruction with
+    generate_check_interrupt
+-------------------------------------------------*/
+
+void sh34_base_device::generate_write(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, int size)
+{
+	generate_flush_pc(block, desc);
+	switch (size)
+	{
+		case 1: UML_CALLH(block, *m_write8);    break;                                      // callh   write8
+		case 2: UML_CALLH(block, *m_write16);   break;                                      // callh   write16
+		case 4: UML_CALLH(block, *m_write32);   break;                                      // callh   write32
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_check_interrupt - leave the block
+    after a store that made an interrupt pending,
+    just as the interpreter would take it before
+    the next instruction
+-------------------------------------------------*/
+
+void sh34_base_device::generate_check_interrupt(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	compiler_state compiler_temp = *compiler;
+	code_label skip = compiler->labelnum++;
+
+	UML_LOAD(block, I0, (void *)&m_test_irq, 0, SIZE_DWORD, SCALE_x4);                     // load    i0,test_irq,0,dword
+	UML_TEST(block, I0, ~0);                                                                // test    i0,~0
+	UML_JMPc(block, COND_Z, skip);                                                          // jz      skip
+
+	/* a store in a delay slot finishes the branch first */
+	if (desc->flags & OPFLAG_IN_DELAY_SLOT)
+	{
+		generate_update_cycles(block, &compiler_temp, mem(&m_sh4_state->target), FALSE);   // <subtract cycles>
+		UML_EXH(block, *m_interrupt, mem(&m_sh4_state->target));                            // exh     interrupt,[target]
+	}
+	else
+	{
+		generate_update_cycles(block, &compiler_temp, desc->pc + 2, FALSE);                // <subtract cycles>
+		UML_EXH(block, *m_interrupt, desc->pc + 2);                                         // exh     interrupt,desc->pc + 2
+	}
+
+	UML_LABEL(block, skip);                                                                 // skip:
+}
+
+
+/*-------------------------------------------------
+    generate_set_t - copy a condition into SR.T
+-------------------------------------------------*/
+
+void sh34_base_device::generate_set_t(drcuml_block *block, uml::condition_t cond)
+{
+	UML_SETc(block, cond, I0);                                                              // set     i0,cond
+	UML_ROLINS(block, mem(&m_sh4_state->sr), I0, 0, T);                                     // rolins  [sr],i0,0,T
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a specific
+    opcode; returns false, without emitting
+    anything, if the interpreter has to run it
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	UINT16 opcode = desc->opptr.w[0];
+	bool in_delay_slot = (desc->flags & OPFLAG_IN_DELAY_SLOT) != 0;
+	UINT32 scratch;
+
+	switch (opcode >> 12)
+	{
+		case 0:
+			return generate_group_0(block, compiler, desc, opcode);
+
+		case 1:     // MOVLS4(Rm, Rn)
+			UML_ADD(block, I0, R32(Rn), (opcode & 0x0f) * 4);                               // add     i0,Rn,disp*4
+			UML_MOV(block, I1, R32(Rm));                                                    // mov     i1,Rm
+			generate_write(block, compiler, desc, 4);
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+
+		case 2:
+			return generate_group_2(block, compiler, desc, opcode);
+
+		case 3:
+			return generate_group_3(block, compiler, desc, opcode);
+
+		case 4:
+			return generate_group_4(block, compiler, desc, opcode);
+
+		case 5:     // MOVLL4(Rm, Rn)
+			UML_ADD(block, I0, R32(Rm), (opcode & 0x0f) * 4);                               // add     i0,Rm,disp*4
+			generate_read(block, compiler, desc, 4);
+			UML_MOV(block, R32(Rn), I0);                                                    // mov     Rn,i0
+			return true;
+
+		case 6:
+			return generate_group_6(block, compiler, desc, opcode);
+
+		case 7:     // ADDI(Rn, imm)
+			UML_ADD(block, R32(Rn), R32(Rn), (INT32)(INT8)(opcode & 0xff));                 // add     Rn,Rn,simm8
+			return true;
+
+		case 8:
+			return generate_group_8(block, compiler, desc, opcode);
+
+		case 9:     // MOVWI(Rn, disp)
+			/* the interpreter works these out from the branch target in a delay slot */
+			if (in_delay_slot)
+				return false;
+			scratch = desc->pc + 4 + (opcode & 0xff) * 2;
+			if (m_drcoptions & SH4DRC_STRICT_PCREL)
+			{
+				UML_MOV(block, I0, scratch);                                                // mov     i0,scratch
+				generate_read(block, compiler, desc, 2);
+				UML_SEXT(block, R32(Rn), I0, SIZE_WORD);                                    // sext    Rn,i0,word
+			}
+			else
+				UML_MOV(block, R32(Rn), (UINT32)(INT32)(INT16)RW(scratch));                 // mov     Rn,[scratch]
+			return true;
+
+		case 10:    // BRA(disp)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+#if BUSY_LOOP_HACKS
+			/* let the interpreter burn through BRA $ / NOP idle loops */
+			if ((((INT32)opcode << 20) >> 20) == -2 && desc->delay.first()->opptr.w[0] == 0x0009)
+				return false;
+#endif
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			return true;
+
+		case 11:    // BSR(disp)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			UML_MOV(block, mem(&m_sh4_state->pr), desc->pc + 4);                            // mov     [pr],desc->pc + 4
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			return true;
+
+		case 12:
+			return generate_group_12(block, compiler, desc, opcode);
+
+		case 13:    // MOVLI(Rn, disp)
+			if (in_delay_slot)
+				return false;
+			scratch = ((desc->pc + 4) & ~3) + (opcode & 0xff) * 4;
+			if (m_drcoptions & SH4DRC_STRICT_PCREL)
+			{
+				UML_MOV(block, I0, scratch);                                                // mov     i0,scratch
+				generate_read(block, compiler, desc, 4);
+				UML_MOV(block, R32(Rn), I0);                                                // mov     Rn,i0
+			}
+			else
+				UML_MOV(block, R32(Rn), RL(scratch));                                       // mov     Rn,[scratch]
+			return true;
+
+		case 14:    // MOVI(Rn, imm)
+			UML_MOV(block, R32(Rn), (UINT32)(INT32)(INT8)(opcode & 0xff));                  // mov     Rn,simm8
+			return true;
+
+		case 15:
+			return generate_group_15(block, compiler, desc, opcode);
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_0 - 0000 nnnn mmmm xxxx
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_0(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	bool in_delay_slot = (desc->flags & OPFLAG_IN_DELAY_SLOT) != 0;
+
+	/* the interpreter decodes the whole low byte; anything not listed here is left to it */
+	switch (opcode & 0xff)
+	{
+		case 0x02:  // STCSR(Rn)
+			UML_MOV(block, R32(Rn), mem(&m_sh4_state->sr));                                 // mov     Rn,[sr]
+			return true;
+
+		case 0x12:  // STCGBR(Rn)
+			UML_MOV(block, R32(Rn), mem(&m_sh4_state->gbr));                                // mov     Rn,[gbr]
+			return true;
+
+		case 0x03:  // BSRF(Rn)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			UML_ADD(block, mem(&m_sh4_state->target), R32(Rn), desc->pc + 4);              // add     [target],Rn,desc->pc + 4
+			UML_MOV(block, mem(&m_sh4_state->pr), desc->pc + 4);                            // mov     [pr],desc->pc + 4
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			return true;
+
+		case 0x23:  // BRAF(Rn)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			UML_ADD(block, mem(&m_sh4_state->target), R32(Rn), desc->pc + 4);              // add     [target],Rn,desc->pc + 4
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			return true;
+
+		case 0x09:  // NOP()
+			return true;
+
+		case 0x08: case 0x88:   // CLRT()
+			UML_AND(block, mem(&m_sh4_state->sr), mem(&m_sh4_state->sr), ~T);               // and     [sr],[sr],~T
+			return true;
+
+		case 0x18: case 0x98:   // SETT()
+			UML_OR(block, mem(&m_sh4_state->sr), mem(&m_sh4_state->sr), T);                 // or      [sr],[sr],T
+			return true;
+
+		case 0x28: case 0xa8:   // CLRMAC()
+			UML_MOV(block, mem(&m_sh4_state->mach), 0);                                     // mov     [mach],0
+			UML_MOV(block, mem(&m_sh4_state->macl), 0);                                     // mov     [macl],0
+			return true;
+
+		case 0x48: case 0xc8:   // CLRS()
+			UML_AND(block, mem(&m_sh4_state->sr), mem(&m_sh4_state->sr), ~S);               // and     [sr],[sr],~S
+			return true;
+
+		case 0x58: case 0xd8:   // SETS()
+			UML_OR(block, mem(&m_sh4_state->sr), mem(&m_sh4_state->sr), S);                 // or      [sr],[sr],S
+			return true;
+
+		case 0x19: case 0x59: case 0x99: case 0xd9:     // DIV0U()
+			UML_AND(block, mem(&m_sh4_state->sr), mem(&m_sh4_state->sr), ~(M | Q | T));     // and     [sr],[sr],~(M|Q|T)
+			return true;
+
+		case 0x29: case 0x69: case 0xa9: case 0xe9:     // MOVT(Rn)
+			UML_AND(block, R32(Rn), mem(&m_sh4_state->sr), T);                              // and     Rn,[sr],T
+			return true;
+
+		case 0x0a: case 0x8a:   // STSMACH(Rn)
+			UML_MOV(block, R32(Rn), mem(&m_sh4_state->mach));                               // mov     Rn,[mach]
+			return true;
+
+		case 0x1a: case 0x9a:   // STSMACL(Rn)
+			UML_MOV(block, R32(Rn), mem(&m_sh4_state->macl));                               // mov     Rn,[macl]
+			return true;
+
+		case 0x2a: case 0xaa:   // STSPR(Rn)
+			UML_MOV(block, R32(Rn), mem(&m_sh4_state->pr));                                 // mov     Rn,[pr]
+			return true;
+
+		case 0x5a: case 0xda:   // STSFPUL(Rn)
+			UML_MOV(block, R32(Rn), mem(&m_sh4_state->fpul));                               // mov     Rn,[fpul]
+			return true;
+
+		case 0x0b: case 0x4b: case 0x8b: case 0xcb:     // RTS()
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			UML_MOV(block, mem(&m_sh4_state->target), mem(&m_sh4_state->pr));               // mov     [target],[pr]
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			return true;
+	}
+
+	switch (opcode & 0x0f)
+	{
+		case 0x04:  // MOVBS0(Rm, Rn)
+		case 0x05:  // MOVWS0(Rm, Rn)
+		case 0x06:  // MOVLS0(Rm, Rn)
+		{
+			int size = 1 << ((opcode & 0x0f) - 0x04);
+			UML_ADD(block, I0, R32(Rn), R32(0));                                            // add     i0,Rn,R0
+			UML_MOV(block, I1, R32(Rm));                                                    // mov     i1,Rm
+			generate_write(block, compiler, desc, size);
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+		}
+
+		case 0x07:  // MULL(Rm, Rn)
+			UML_MULU(block, mem(&m_sh4_state->macl), mem(&m_sh4_state->macl), R32(Rn), R32(Rm));   // mulu    [macl],[macl],Rn,Rm
+			compiler->cycles += 1;
+			return true;
+
+		case 0x0c:  // MOVBL0(Rm, Rn)
+			UML_ADD(block, I0, R32(Rm), R32(0));                                            // add     i0,Rm,R0
+			generate_read(block, compiler, desc, 1);
+			UML_SEXT(block, R32(Rn), I0, SIZE_BYTE);                                        // sext    Rn,i0,byte
+			return true;
+
+		case 0x0d:  // MOVWL0(Rm, Rn)
+			UML_ADD(block, I0, R32(Rm), R32(0));                                            // add     i0,Rm,R0
+			generate_read(block, compiler, desc, 2);
+			UML_SEXT(block, R32(Rn), I0, SIZE_WORD);                                        // sext    Rn,i0,word
+			return true;
+
+		case 0x0e:  // MOVLL0(Rm, Rn)
+			UML_ADD(block, I0, R32(Rm), R32(0));                                            // add     i0,Rm,R0
+			generate_read(block, compiler, desc, 4);
+			UML_MOV(block, R32(Rn), I0);                                                    // mov     Rn,i0
+			return true;
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_2 - 0010 nnnn mmmm xxxx
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_2(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	switch (opcode & 0x0f)
+	{
+		case 0x00:  // MOVBS(Rm, Rn)
+		case 0x01:  // MOVWS(Rm, Rn)
+		case 0x02:  // MOVLS(Rm, Rn)
+			UML_MOV(block, I0, R32(Rn));                                                    // mov     i0,Rn
+			UML_MOV(block, I1, R32(Rm));                                                    // mov     i1,Rm
+			generate_write(block, compiler, desc, 1 << (opcode & 0x03));
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+
+		case 0x03:  // NOP()
+			return true;
+
+		case 0x04:  // MOVBM(Rm, Rn)
+		case 0x05:  // MOVWM(Rm, Rn)
+		case 0x06:  // MOVLM(Rm, Rn)
+		{
+			int size = 1 << ((opcode & 0x0f) - 0x04);
+			UML_MOV(block, I1, R32(Rm));                                                    // mov     i1,Rm
+			UML_SUB(block, R32(Rn), R32(Rn), size);                                         // sub     Rn,Rn,size
+			UML_MOV(block, I0, R32(Rn));                                                    // mov     i0,Rn
+			generate_write(block, compiler, desc, size);
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+		}
+
+		case 0x07:  // DIV0S(Rm, Rn)
+			UML_SHR(block, I0, R32(Rn), 31);                                                // shr     i0,Rn,31
+			UML_SHR(block, I1, R32(Rm), 31);                                                // shr     i1,Rm,31
+			UML_XOR(block, I2, I0, I1);                                                     // xor     i2,i0,i1
+			UML_ROLINS(block, mem(&m_sh4_state->sr), I0, 8, Q);                             // rolins  [sr],i0,8,Q
+			UML_ROLINS(block, mem(&m_sh4_state->sr), I1, 9, M);                             // rolins  [sr],i1,9,M
+			UML_ROLINS(block, mem(&m_sh4_state->sr), I2, 0, T);                             // rolins  [sr],i2,0,T
+			return true;
+
+		case 0x08:  // TST(Rm, Rn)
+			UML_TEST(block, R32(Rn), R32(Rm));                                              // test    Rn,Rm
+			generate_set_t(block, COND_Z);
+			return true;
+
+		case 0x09:  // AND(Rm, Rn)
+			UML_AND(block, R32(Rn), R32(Rn), R32(Rm));                                      // and     Rn,Rn,Rm
+			return true;
+
+		case 0x0a:  // XOR(Rm, Rn)
+			UML_XOR(block, R32(Rn), R32(Rn), R32(Rm));                                      // xor     Rn,Rn,Rm
+			return true;
+
+		case 0x0b:  // OR(Rm, Rn)
+			UML_OR(block, R32(Rn), R32(Rn), R32(Rm));                                       // or      Rn,Rn,Rm
+			return true;
+
+		case 0x0c:  // CMPSTR(Rm, Rn)
+			UML_XOR(block, I0, R32(Rn), R32(Rm));                                           // xor     i0,Rn,Rm
+			UML_TEST(block, I0, 0x000000ff);                                                // test    i0,0x000000ff
+			UML_SETc(block, COND_Z, I1);                                                    // setz    i1
+			UML_TEST(block, I0, 0x0000ff00);                                                // test    i0,0x0000ff00
+			UML_SETc(block, COND_Z, I2);                                                    // setz    i2
+			UML_OR(block, I1, I1, I2);                                                      // or      i1,i1,i2
+			UML_TEST(block, I0, 0x00ff0000);                                                // test    i0,0x00ff0000
+			UML_SETc(block, COND_Z, I2);                                                    // setz    i2
+			UML_OR(block, I1, I1, I2);                                                      // or      i1,i1,i2
+			UML_TEST(block, I0, 0xff000000);                                                // test    i0,0xff000000
+			UML_SETc(block, COND_Z, I2);                                                    // setz    i2
+			UML_OR(block, I1, I1, I2);                                                      // or      i1,i1,i2
+			UML_ROLINS(block, mem(&m_sh4_state->sr), I1, 0, T);                             // rolins  [sr],i1,0,T
+			return true;
+
+		case 0x0d:  // XTRCT(Rm, Rn)
+			UML_SHL(block, I0, R32(Rm), 16);                                                // shl     i0,Rm,16
+			UML_SHR(block, I1, R32(Rn), 16);                                                // shr     i1,Rn,16
+			UML_OR(block, R32(Rn), I0, I1);                                                 // or      Rn,i0,i1
+			return true;
+
+		case 0x0e:  // MULU(Rm, Rn)
+			UML_AND(block, I0, R32(Rn), 0xffff);                                            // and     i0,Rn,0xffff
+			UML_AND(block, I1, R32(Rm), 0xffff);                                            // and     i1,Rm,0xffff
+			UML_MULU(block, mem(&m_sh4_state->macl), mem(&m_sh4_state->macl), I0, I1);      // mulu    [macl],[macl],i0,i1
+			return true;
+
+		case 0x0f:  // MULS(Rm, Rn)
+			UML_SEXT(block, I0, R32(Rn), SIZE_WORD);                                        // sext    i0,Rn,word
+			UML_SEXT(block, I1, R32(Rm), SIZE_WORD);                                        // sext    i1,Rm,word
+			UML_MULS(block, mem(&m_sh4_state->macl), mem(&m_sh4_state->macl), I0, I1);      // muls    [macl],[macl],i0,i1
+			return true;
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_3 - 0011 nnnn mmmm xxxx
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_3(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	switch (opcode & 0x0f)
+	{
+		case 0x00:  // CMPEQ(Rm, Rn)
+			UML_CMP(block, R32(Rn), R32(Rm));                                               // cmp     Rn,Rm
+			generate_set_t(block, COND_E);
+			return true;
+
+		case 0x01:  // NOP()
+		case 0x09:  // NOP()
+			return true;
+
+		case 0x02:  // CMPHS(Rm, Rn)
+			UML_CMP(block, R32(Rn), R32(Rm));                                               // cmp     Rn,Rm
+			generate_set_t(block, COND_AE);
+			return true;
+
+		case 0x03:  // CMPGE(Rm, Rn)
+			UML_CMP(block, R32(Rn), R32(Rm));                                               // cmp     Rn,Rm
+			generate_set_t(block, COND_GE);
+			return true;
+
+		case 0x05:  // DMULU(Rm, Rn)
+			UML_MULU(block, mem(&m_sh4_state->macl), mem(&m_sh4_state->mach), R32(Rn), R32(Rm));   // mulu    [macl],[mach],Rn,Rm
+			compiler->cycles += 1;
+			return true;
+
+		case 0x06:  // CMPHI(Rm, Rn)
+			UML_CMP(block, R32(Rn), R32(Rm));                                               // cmp     Rn,Rm
+			generate_set_t(block, COND_A);
+			return true;
+
+		case 0x07:  // CMPGT(Rm, Rn)
+			UML_CMP(block, R32(Rn), R32(Rm));                                               // cmp     Rn,Rm
+			generate_set_t(block, COND_G);
+			return true;
+
+		case 0x08:  // SUB(Rm, Rn)
+			UML_SUB(block, R32(Rn), R32(Rn), R32(Rm));                                      // sub     Rn,Rn,Rm
+			return true;
+
+		case 0x0a:  // SUBC(Rm, Rn)
+			UML_CARRY(block, mem(&m_sh4_state->sr), 0);                                     // carry   [sr],0
+			UML_SUBB(block, R32(Rn), R32(Rn), R32(Rm));                                     // subb    Rn,Rn,Rm
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x0c:  // ADD(Rm, Rn)
+			UML_ADD(block, R32(Rn), R32(Rn), R32(Rm));                                      // add     Rn,Rn,Rm
+			return true;
+
+		case 0x0d:  // DMULS(Rm, Rn)
+			UML_MULS(block, mem(&m_sh4_state->macl), mem(&m_sh4_state->mach), R32(Rn), R32(Rm));   // muls    [macl],[mach],Rn,Rm
+			compiler->cycles += 1;
+			return true;
+
+		case 0x0e:  // ADDC(Rm, Rn)
+			UML_CARRY(block, mem(&m_sh4_state->sr), 0);                                     // carry   [sr],0
+			UML_ADDC(block, R32(Rn), R32(Rn), R32(Rm));                                     // addc    Rn,Rn,Rm
+			generate_set_t(block, COND_C);
+			return true;
+	}
+
+	/* DIV1, SUBV and ADDV */
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_4 - 0100 nnnn xxxx xxxx
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_4(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	bool in_delay_slot = (desc->flags & OPFLAG_IN_DELAY_SLOT) != 0;
+
+	/* the interpreter decodes the whole low byte; anything not listed here is left to it */
+	switch (opcode & 0xff)
+	{
+		case 0x00: case 0x40: case 0x80: case 0xc0:     // SHLL(Rn)
+		case 0x20: case 0x60: case 0xa0: case 0xe0:     // SHAL(Rn)
+			UML_SHL(block, R32(Rn), R32(Rn), 1);                                            // shl     Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x10: case 0x50: case 0x90: case 0xd0:     // DT(Rn)
+#if BUSY_LOOP_HACKS
+			/* let the interpreter collapse DT / BF $-2 delay loops */
+			if (m_direct->read_word((desc->pc + 2) & AM, m_drc_code_xor) == 0x8bfd)
+				return false;
+#endif
+			UML_SUB(block, R32(Rn), R32(Rn), 1);                                            // sub     Rn,Rn,1
+			generate_set_t(block, COND_Z);
+			return true;
+
+		case 0x01: case 0x41: case 0x81: case 0xc1:     // SHLR(Rn)
+			UML_SHR(block, R32(Rn), R32(Rn), 1);                                            // shr     Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x11: case 0x51: case 0x91: case 0xd1:     // CMPPZ(Rn)
+			UML_CMP(block, R32(Rn), 0);                                                     // cmp     Rn,0
+			generate_set_t(block, COND_GE);
+			return true;
+
+		case 0x21: case 0x61: case 0xa1: case 0xe1:     // SHAR(Rn)
+			UML_SAR(block, R32(Rn), R32(Rn), 1);                                            // sar     Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x02:  // STSMMACH(Rn)
+		case 0x12:  // STSMMACL(Rn)
+		case 0x22:  // STSMPR(Rn)
+		case 0x52:  // STSMFPUL(Rn)
+		case 0x03:  // STCMSR(Rn)
+		case 0x13:  // STCMGBR(Rn)
+		{
+			UINT32 *source;
+			switch (opcode & 0xff)
+			{
+				case 0x02:  source = &m_sh4_state->mach;    break;
+				case 0x12:  source = &m_sh4_state->macl;    break;
+				case 0x22:  source = &m_sh4_state->pr;      break;
+				case 0x52:  source = &m_sh4_state->fpul;    break;
+				case 0x03:  source = &m_sh4_state->sr;      break;
+				default:    source = &m_sh4_state->gbr;     break;
+			}
+			UML_SUB(block, R32(Rn), R32(Rn), 4);                                            // sub     Rn,Rn,4
+			UML_MOV(block, I0, R32(Rn));                                                    // mov     i0,Rn
+			UML_MOV(block, I1, mem(source));                                                // mov     i1,[source]
+			generate_write(block, compiler, desc, 4);
+			if ((opcode & 0x0f) == 0x03)
+				compiler->cycles += 1;
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+		}
+
+		case 0x04: case 0x44: case 0x84: case 0xc4:     // ROTL(Rn)
+			UML_ROL(block, R32(Rn), R32(Rn), 1);                                            // rol     Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x24: case 0x64: case 0xa4: case 0xe4:     // ROTCL(Rn)
+			UML_CARRY(block, mem(&m_sh4_state->sr), 0);                                     // carry   [sr],0
+			UML_ROLC(block, R32(Rn), R32(Rn), 1);                                           // rolc    Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x05: case 0x45: case 0x85: case 0xc5:     // ROTR(Rn)
+			UML_ROR(block, R32(Rn), R32(Rn), 1);                                            // ror     Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x15: case 0x55: case 0x95: case 0xd5:     // CMPPL(Rn)
+			UML_CMP(block, R32(Rn), 0);                                                     // cmp     Rn,0
+			generate_set_t(block, COND_G);
+			return true;
+
+		case 0x25: case 0x65: case 0xa5: case 0xe5:     // ROTCR(Rn)
+			UML_CARRY(block, mem(&m_sh4_state->sr), 0);                                     // carry   [sr],0
+			UML_RORC(block, R32(Rn), R32(Rn), 1);                                           // rorc    Rn,Rn,1
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x06:  // LDSMMACH(Rn)
+		case 0x16:  // LDSMMACL(Rn)
+		case 0x26:  // LDSMPR(Rn)
+		case 0x56:  // LDSMFPUL(Rn)
+		case 0x17:  // LDCMGBR(Rn)
+		{
+			UINT32 *dest;
+			switch (opcode & 0xff)
+			{
+				case 0x06:  dest = &m_sh4_state->mach;  break;
+				case 0x16:  dest = &m_sh4_state->macl;  break;
+				case 0x26:  dest = &m_sh4_state->pr;    break;
+				case 0x56:  dest = &m_sh4_state->fpul;  break;
+				default:    dest = &m_sh4_state->gbr;   break;
+			}
+			UML_MOV(block, I0, R32(Rn));                                                    // mov     i0,Rn
+			generate_read(block, compiler, desc, 4);
+			UML_MOV(block, mem(dest), I0);                                                  // mov     [dest],i0
+			UML_ADD(block, R32(Rn), R32(Rn), 4);                                            // add     Rn,Rn,4
+			if ((opcode & 0xff) == 0x17)
+				compiler->cycles += 2;
+			return true;
+		}
+
+		case 0x08: case 0x48: case 0x88: case 0xc8:     // SHLL2(Rn)
+			UML_SHL(block, R32(Rn), R32(Rn), 2);                                            // shl     Rn,Rn,2
+			return true;
+
+		case 0x18: case 0x58: case 0x98: case 0xd8:     // SHLL8(Rn)
+			UML_SHL(block, R32(Rn), R32(Rn), 8);                                            // shl     Rn,Rn,8
+			return true;
+
+		case 0x28: case 0x68: case 0xa8: case 0xe8:     // SHLL16(Rn)
+			UML_SHL(block, R32(Rn), R32(Rn), 16);                                           // shl     Rn,Rn,16
+			return true;
+
+		case 0x09: case 0x49: case 0x89: case 0xc9:     // SHLR2(Rn)
+			UML_SHR(block, R32(Rn), R32(Rn), 2);                                            // shr     Rn,Rn,2
+			return true;
+
+		case 0x19: case 0x59: case 0x99: case 0xd9:     // SHLR8(Rn)
+			UML_SHR(block, R32(Rn), R32(Rn), 8);                                            // shr     Rn,Rn,8
+			return true;
+
+		case 0x29: case 0x69: case 0xa9: case 0xe9:     // SHLR16(Rn)
+			UML_SHR(block, R32(Rn), R32(Rn), 16);                                           // shr     Rn,Rn,16
+			return true;
+
+		case 0x0a:  // LDSMACH(Rn)
+			UML_MOV(block, mem(&m_sh4_state->mach), R32(Rn));                               // mov     [mach],Rn
+			return true;
+
+		case 0x1a:  // LDSMACL(Rn)
+			UML_MOV(block, mem(&m_sh4_state->macl), R32(Rn));                               // mov     [macl],Rn
+			return true;
+
+		case 0x2a:  // LDSPR(Rn)
+			UML_MOV(block, mem(&m_sh4_state->pr), R32(Rn));                                 // mov     [pr],Rn
+			return true;
+
+		case 0x5a:  // LDSFPUL(Rn)
+			UML_MOV(block, mem(&m_sh4_state->fpul), R32(Rn));                               // mov     [fpul],Rn
+			return true;
+
+		case 0x1e:  // LDCGBR(Rn)
+			UML_MOV(block, mem(&m_sh4_state->gbr), R32(Rn));                                // mov     [gbr],Rn
+			return true;
+
+		case 0x0b: case 0x4b: case 0x8b: case 0xcb:     // JSR(Rn)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			UML_MOV(block, mem(&m_sh4_state->target), R32(Rn));                             // mov     [target],Rn
+			UML_MOV(block, mem(&m_sh4_state->pr), desc->pc + 4);                            // mov     [pr],desc->pc + 4
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			return true;
+
+		case 0x2b: case 0x6b: case 0xab: case 0xeb:     // JMP(Rn)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			UML_MOV(block, mem(&m_sh4_state->target), R32(Rn));                             // mov     [target],Rn
+			generate_delay_slot_and_branch(block, compiler, desc, 0);
+			return true;
+	}
+
+	switch (opcode & 0x0f)
+	{
+		case 0x0c:  // SHAD(Rm, Rn)
+		case 0x0d:  // SHLD(Rm, Rn)
+		{
+			code_label right = compiler->labelnum++;
+			code_label done = compiler->labelnum++;
+
+			/* positive counts shift left by the low five bits */
+			UML_MOV(block, I0, R32(Rm));                                                    // mov     i0,Rm
+			UML_TEST(block, I0, 0x80000000);                                                // test    i0,0x80000000
+			UML_JMPc(block, COND_NZ, right);                                                // jnz     right
+			UML_AND(block, I1, I0, 0x1f);                                                   // and     i1,i0,0x1f
+			UML_SHL(block, R32(Rn), R32(Rn), I1);                                           // shl     Rn,Rn,i1
+			UML_JMP(block, done);                                                           // jmp     done
+
+			/* negative ones shift right by 1-32, done in two steps so 32 works */
+			UML_LABEL(block, right);                                                        // right:
+			UML_XOR(block, I1, I0, ~0);                                                     // xor     i1,i0,~0
+			UML_AND(block, I1, I1, 0x1f);                                                   // and     i1,i1,0x1f
+			if ((opcode & 0x0f) == 0x0c)
+			{
+				UML_SAR(block, R32(Rn), R32(Rn), I1);                                       // sar     Rn,Rn,i1
+				UML_SAR(block, R32(Rn), R32(Rn), 1);                                        // sar     Rn,Rn,1
+			}
+			else
+			{
+				UML_SHR(block, R32(Rn), R32(Rn), I1);                                       // shr     Rn,Rn,i1
+				UML_SHR(block, R32(Rn), R32(Rn), 1);                                        // shr     Rn,Rn,1
+			}
+			UML_LABEL(block, done);                                                         // done:
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_6 - 0110 nnnn mmmm xxxx
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_6(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	switch (opcode & 0x0f)
+	{
+		case 0x00:  // MOVBL(Rm, Rn)
+			UML_MOV(block, I0, R32(Rm));                                                    // mov     i0,Rm
+			generate_read(block, compiler, desc, 1);
+			UML_SEXT(block, R32(Rn), I0, SIZE_BYTE);                                        // sext    Rn,i0,byte
+			return true;
+
+		case 0x01:  // MOVWL(Rm, Rn)
+			UML_MOV(block, I0, R32(Rm));                                                    // mov     i0,Rm
+			generate_read(block, compiler, desc, 2);
+			UML_SEXT(block, R32(Rn), I0, SIZE_WORD);                                        // sext    Rn,i0,word
+			return true;
+
+		case 0x02:  // MOVLL(Rm, Rn)
+			UML_MOV(block, I0, R32(Rm));                                                    // mov     i0,Rm
+			generate_read(block, compiler, desc, 4);
+			UML_MOV(block, R32(Rn), I0);                                                    // mov     Rn,i0
+			return true;
+
+		case 0x03:  // MOV(Rm, Rn)
+			UML_MOV(block, R32(Rn), R32(Rm));                                               // mov     Rn,Rm
+			return true;
+
+		case 0x04:  // MOVBP(Rm, Rn)
+		case 0x05:  // MOVWP(Rm, Rn)
+		case 0x06:  // MOVLP(Rm, Rn)
+		{
+			int size = 1 << ((opcode & 0x0f) - 0x04);
+			UML_MOV(block, I0, R32(Rm));                                                    // mov     i0,Rm
+			generate_read(block, compiler, desc, size);
+			if (size == 4)
+				UML_MOV(block, R32(Rn), I0);                                                // mov     Rn,i0
+			else
+				UML_SEXT(block, R32(Rn), I0, (size == 1) ? SIZE_BYTE : SIZE_WORD);          // sext    Rn,i0,size
+			if (Rn != Rm)
+				UML_ADD(block, R32(Rm), R32(Rm), size);                                     // add     Rm,Rm,size
+			return true;
+		}
+
+		case 0x07:  // NOT(Rm, Rn)
+			UML_XOR(block, R32(Rn), R32(Rm), ~0);                                           // xor     Rn,Rm,~0
+			return true;
+
+		case 0x08:  // SWAPB(Rm, Rn)
+			UML_ROLAND(block, I0, R32(Rm), 8, 0x0000ff00);                                  // roland  i0,Rm,8,0xff00
+			UML_ROLAND(block, I1, R32(Rm), 24, 0x000000ff);                                 // roland  i1,Rm,24,0x00ff
+			UML_AND(block, I2, R32(Rm), 0xffff0000);                                        // and     i2,Rm,0xffff0000
+			UML_OR(block, I0, I0, I1);                                                      // or      i0,i0,i1
+			UML_OR(block, R32(Rn), I0, I2);                                                 // or      Rn,i0,i2
+			return true;
+
+		case 0x09:  // SWAPW(Rm, Rn)
+			UML_ROL(block, R32(Rn), R32(Rm), 16);                                           // rol     Rn,Rm,16
+			return true;
+
+		case 0x0a:  // NEGC(Rm, Rn)
+			UML_CARRY(block, mem(&m_sh4_state->sr), 0);                                     // carry   [sr],0
+			UML_SUBB(block, R32(Rn), 0, R32(Rm));                                           // subb    Rn,0,Rm
+			generate_set_t(block, COND_C);
+			return true;
+
+		case 0x0b:  // NEG(Rm, Rn)
+			UML_SUB(block, R32(Rn), 0, R32(Rm));                                            // sub     Rn,0,Rm
+			return true;
+
+		case 0x0c:  // EXTUB(Rm, Rn)
+			UML_AND(block, R32(Rn), R32(Rm), 0x000000ff);                                   // and     Rn,Rm,0xff
+			return true;
+
+		case 0x0d:  // EXTUW(Rm, Rn)
+			UML_AND(block, R32(Rn), R32(Rm), 0x0000ffff);                                   // and     Rn,Rm,0xffff
+			return true;
+
+		case 0x0e:  // EXTSB(Rm, Rn)
+			UML_SEXT(block, R32(Rn), R32(Rm), SIZE_BYTE);                                   // sext    Rn,Rm,byte
+			return true;
+
+		case 0x0f:  // EXTSW(Rm, Rn)
+			UML_SEXT(block, R32(Rn), R32(Rm), SIZE_WORD);                                   // sext    Rn,Rm,word
+			return true;
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_8 - 1000 xxxx dddd dddd
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_8(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	bool in_delay_slot = (desc->flags & OPFLAG_IN_DELAY_SLOT) != 0;
+	code_label skip;
+
+	switch ((opcode >> 8) & 0x0f)
+	{
+		case 0x00:  // MOVBS4(Rm, disp)
+		case 0x01:  // MOVWS4(Rm, disp)
+		{
+			int size = ((opcode >> 8) & 0x0f) + 1;
+			UML_ADD(block, I0, R32(Rm), (opcode & 0x0f) * size);                            // add     i0,Rm,disp*size
+			UML_MOV(block, I1, R32(0));                                                     // mov     i1,R0
+			generate_write(block, compiler, desc, size);
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+		}
+
+		case 0x04:  // MOVBL4(Rm, disp)
+			UML_ADD(block, I0, R32(Rm), opcode & 0x0f);                                     // add     i0,Rm,disp
+			generate_read(block, compiler, desc, 1);
+			UML_SEXT(block, R32(0), I0, SIZE_BYTE);                                         // sext    R0,i0,byte
+			return true;
+
+		case 0x05:  // MOVWL4(Rm, disp)
+			UML_ADD(block, I0, R32(Rm), (opcode & 0x0f) * 2);                               // add     i0,Rm,disp*2
+			generate_read(block, compiler, desc, 2);
+			UML_SEXT(block, R32(0), I0, SIZE_WORD);                                         // sext    R0,i0,word
+			return true;
+
+		case 0x08:  // CMPIM(imm)
+			UML_CMP(block, R32(0), (UINT32)(INT32)(INT8)(opcode & 0xff));                   // cmp     R0,simm8
+			generate_set_t(block, COND_E);
+			return true;
+
+		case 0x09:  // BT(disp)
+		case 0x0b:  // BF(disp)
+			if (in_delay_slot)
+				return false;
+			skip = compiler->labelnum++;
+			UML_TEST(block, mem(&m_sh4_state->sr), T);                                      // test    [sr],T
+			UML_JMPc(block, (opcode & 0x0200) ? COND_NZ : COND_Z, skip);                    // j(n)z   skip
+			generate_delay_slot_and_branch(block, compiler, desc, 2);
+			UML_LABEL(block, skip);                                                         // skip:
+			return true;
+
+		case 0x0d:  // BTS(disp)
+		case 0x0f:  // BFS(disp)
+			if (in_delay_slot || desc->delay.first() == NULL)
+				return false;
+			skip = compiler->labelnum++;
+			UML_TEST(block, mem(&m_sh4_state->sr), T);                                      // test    [sr],T
+			UML_JMPc(block, (opcode & 0x0200) ? COND_NZ : COND_Z, skip);                    // j(n)z   skip
+
+			/* the delay slot only runs here when the branch is taken; otherwise it is the next instruction */
+			UML_MOV(block, mem(&m_sh4_state->target), desc->targetpc);                      // mov     [target],desc->targetpc
+			generate_delay_slot_and_branch(block, compiler, desc, 1);
+			UML_LABEL(block, skip);                                                         // skip:
+			return true;
+
+		case 0x02: case 0x03: case 0x06: case 0x07:
+		case 0x0a: case 0x0c: case 0x0e:    // NOP()
+			return true;
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_12 - 1100 xxxx dddd dddd
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_12(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	bool in_delay_slot = (desc->flags & OPFLAG_IN_DELAY_SLOT) != 0;
+
+	switch ((opcode >> 8) & 0x0f)
+	{
+		case 0x00:  // MOVBSG(disp)
+		case 0x01:  // MOVWSG(disp)
+		case 0x02:  // MOVLSG(disp)
+		{
+			int size = 1 << ((opcode >> 8) & 0x03);
+			UML_ADD(block, I0, mem(&m_sh4_state->gbr), (opcode & 0xff) * size);             // add     i0,[gbr],disp*size
+			UML_MOV(block, I1, R32(0));                                                     // mov     i1,R0
+			generate_write(block, compiler, desc, size);
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+		}
+
+		case 0x04:  // MOVBLG(disp)
+		case 0x05:  // MOVWLG(disp)
+		case 0x06:  // MOVLLG(disp)
+		{
+			int size = 1 << ((opcode >> 8) & 0x03);
+			UML_ADD(block, I0, mem(&m_sh4_state->gbr), (opcode & 0xff) * size);             // add     i0,[gbr],disp*size
+			generate_read(block, compiler, desc, size);
+			if (size == 4)
+				UML_MOV(block, R32(0), I0);                                                 // mov     R0,i0
+			else
+				UML_SEXT(block, R32(0), I0, (size == 1) ? SIZE_BYTE : SIZE_WORD);           // sext    R0,i0,size
+			return true;
+		}
+
+		case 0x07:  // MOVA(disp)
+			if (in_delay_slot)
+				return false;
+			UML_MOV(block, R32(0), ((desc->pc + 4) & ~3) + (opcode & 0xff) * 4);            // mov     R0,address
+			return true;
+
+		case 0x08:  // TSTI(imm)
+			UML_TEST(block, R32(0), opcode & 0xff);                                         // test    R0,imm
+			generate_set_t(block, COND_Z);
+			return true;
+
+		case 0x09:  // ANDI(imm)
+			UML_AND(block, R32(0), R32(0), opcode & 0xff);                                  // and     R0,R0,imm
+			return true;
+
+		case 0x0a:  // XORI(imm)
+			UML_XOR(block, R32(0), R32(0), opcode & 0xff);                                  // xor     R0,R0,imm
+			return true;
+
+		case 0x0b:  // ORI(imm)
+			UML_OR(block, R32(0), R32(0), opcode & 0xff);                                   // or      R0,R0,imm
+			compiler->cycles += 2;
+			return true;
+	}
+
+	/* TRAPA and the read-modify-write GBR forms */
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_group_15 - 1111 nnnn mmmm xxxx
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_group_15(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	UINT32 n = Rn;
+	UINT32 m = Rm;
+	code_label skip;
+
+	/* PR=1 works on register pairs holding native doubles */
+	if (compiler->mode & DRCMODE_PR)
+	{
+		switch (opcode & 0x0f)
+		{
+			case 0x00:  // FADD(Rm, Rn)
+			case 0x01:  // FSUB(Rm, Rn)
+			case 0x02:  // FMUL(Rm, Rn)
+			case 0x03:  // FDIV(Rm, Rn)
+				n &= 14;
+				m &= 14;
+				switch (opcode & 0x0f)
+				{
+					case 0x00:
+						UML_FDADD(block, FR32(n), FR32(n), FR32(m));                        // fdadd   DRn,DRn,DRm
+						break;
+					case 0x01:
+						UML_FDSUB(block, FR32(n), FR32(n), FR32(m));                        // fdsub   DRn,DRn,DRm
+						break;
+					case 0x02:
+						UML_FDMUL(block, FR32(n), FR32(n), FR32(m));                        // fdmul   DRn,DRn,DRm
+						break;
+					case 0x03:
+						/* division by zero leaves the destination alone */
+						skip = compiler->labelnum++;
+						UML_DTEST(block, FR32(m), U64(0x7fffffffffffffff));                 // dtest   DRm,0x7fffffffffffffff
+						UML_JMPc(block, COND_Z, skip);                                      // jz      skip
+						UML_FDDIV(block, FR32(n), FR32(n), FR32(m));                        // fddiv   DRn,DRn,DRm
+						UML_LABEL(block, skip);                                             // skip:
+						break;
+				}
+				return true;
+
+			case 0x04:  // FCMP_EQ(Rm, Rn)
+				UML_FDCMP(block, FR32(n & 14), FR32(m & 14));                               // fdcmp   DRn,DRm
+				UML_SETc(block, COND_Z, I0);                                                // setz    i0
+				UML_SETc(block, COND_NU, I1);                                               // setnu   i1
+				UML_AND(block, I0, I0, I1);                                                 // and     i0,i0,i1
+				UML_ROLINS(block, mem(&m_sh4_state->sr), I0, 0, T);                         // rolins  [sr],i0,0,T
+				return true;
+
+			case 0x05:  // FCMP_GT(Rm, Rn)
+				UML_FDCMP(block, FR32(n & 14), FR32(m & 14));                               // fdcmp   DRn,DRm
+				generate_set_t(block, COND_A);
+				return true;
+
+			case 0x0c:  // FMOVFR(Rm, Rn)
+				UML_DMOV(block, (n & 1) ? XF32(n & 14) : FR32(n), (m & 1) ? XF32(m & 14) : FR32(m));  // dmov    dst,src
+				return true;
+
+			case 0x0d:
+				return generate_fpu_misc(block, compiler, desc, opcode);
+
+			case 0x0e:  // FMAC(Rm, Rn) does nothing in double precision
+				return true;
+		}
+
+		/* the PR=1 memory forms swap words on the way through; leave them to the interpreter */
+		return false;
+	}
+
+	switch (opcode & 0x0f)
+	{
+		case 0x00:  // FADD(Rm, Rn)
+			UML_FSADD(block, FR32(n), FR32(n), FR32(m));                                    // fsadd   FRn,FRn,FRm
+			return true;
+
+		case 0x01:  // FSUB(Rm, Rn)
+			UML_FSSUB(block, FR32(n), FR32(n), FR32(m));                                    // fssub   FRn,FRn,FRm
+			return true;
+
+		case 0x02:  // FMUL(Rm, Rn)
+			UML_FSMUL(block, FR32(n), FR32(n), FR32(m));                                    // fsmul   FRn,FRn,FRm
+			return true;
+
+		case 0x03:  // FDIV(Rm, Rn)
+			/* division by zero leaves the destination alone */
+			skip = compiler->labelnum++;
+			UML_TEST(block, FR32(m), 0x7fffffff);                                           // test    FRm,0x7fffffff
+			UML_JMPc(block, COND_Z, skip);                                                  // jz      skip
+			UML_FSDIV(block, FR32(n), FR32(n), FR32(m));                                    // fsdiv   FRn,FRn,FRm
+			UML_LABEL(block, skip);                                                         // skip:
+			return true;
+
+		case 0x04:  // FCMP_EQ(Rm, Rn)
+			UML_FSCMP(block, FR32(n), FR32(m));                                             // fscmp   FRn,FRm
+			UML_SETc(block, COND_Z, I0);                                                    // setz    i0
+			UML_SETc(block, COND_NU, I1);                                                   // setnu   i1
+			UML_AND(block, I0, I0, I1);                                                     // and     i0,i0,i1
+			UML_ROLINS(block, mem(&m_sh4_state->sr), I0, 0, T);                             // rolins  [sr],i0,0,T
+			return true;
+
+		case 0x05:  // FCMP_GT(Rm, Rn)
+			UML_FSCMP(block, FR32(n), FR32(m));                                             // fscmp   FRn,FRm
+			generate_set_t(block, COND_A);
+			return true;
+
+		case 0x06:  // FMOVS0FR(Rm, Rn)
+		case 0x07:  // FMOVFRS0(Rm, Rn)
+		case 0x08:  // FMOVMRFR(Rm, Rn)
+		case 0x09:  // FMOVMRIFR(Rm, Rn)
+		case 0x0a:  // FMOVFRMR(Rm, Rn)
+		case 0x0b:  // FMOVFRMDR(Rm, Rn)
+			return generate_fmov_memory(block, compiler, desc, opcode);
+
+		case 0x0c:  // FMOVFR(Rm, Rn)
+			if (compiler->mode & DRCMODE_SZ)
+				UML_DMOV(block, (n & 1) ? XF32(n & 14) : FR32(n), (m & 1) ? XF32(m & 14) : FR32(m));  // dmov    dst,src
+			else
+				UML_MOV(block, FR32(n), FR32(m));                                           // mov     FRn,FRm
+			return true;
+
+		case 0x0d:
+			return generate_fpu_misc(block, compiler, desc, opcode);
+
+		case 0x0e:  // FMAC(Rm, Rn)
+			UML_FSMUL(block, F0, FR32(0), FR32(m));                                         // fsmul   f0,FR0,FRm
+			UML_FSADD(block, FR32(n), F0, FR32(n));                                         // fsadd   FRn,f0,FRn
+			return true;
+	}
+
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_fpu_misc - 1111 nnnn xxxx 1101
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_fpu_misc(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	bool pr = (compiler->mode & DRCMODE_PR) != 0;
+	UINT32 n = Rn;
+	code_label skip, sqrt;
+
+	switch ((opcode >> 4) & 0x0f)
+	{
+		case 0x00:  // FSTS(Rn)
+			UML_MOV(block, FR32(n), mem(&m_sh4_state->fpul));                               // mov     FRn,[fpul]
+			return true;
+
+		case 0x01:  // FLDS(Rn)
+			UML_MOV(block, mem(&m_sh4_state->fpul), FR32(n));                               // mov     [fpul],FRn
+			return true;
+
+		case 0x02:  // FLOAT(Rn)
+			if (!pr)
+				UML_FSFRINT(block, FR32(n), mem(&m_sh4_state->fpul), SIZE_DWORD);           // fsfrint FRn,[fpul],dword
+			else if (!(n & 1))
+				UML_FDFRINT(block, FR32(n), mem(&m_sh4_state->fpul), SIZE_DWORD);           // fdfrint DRn,[fpul],dword
+			else
+				return false;
+			return true;
+
+		case 0x03:  // FTRC(Rn)
+			if (!pr)
+				UML_FSTOINT(block, mem(&m_sh4_state->fpul), FR32(n), SIZE_DWORD, ROUND_TRUNC);  // fstoint [fpul],FRn,dword,trunc
+			else if (!(n & 1))
+				UML_FDTOINT(block, mem(&m_sh4_state->fpul), FR32(n), SIZE_DWORD, ROUND_TRUNC);  // fdtoint [fpul],DRn,dword,trunc
+			else
+				return false;
+			return true;
+
+		case 0x04:  // FNEG(Rn)
+			if (!pr)
+				UML_XOR(block, FR32(n), FR32(n), 0x80000000);                               // xor     FRn,FRn,0x80000000
+			else if (!(n & 1))
+			{
+				/* flip the sign in the word holding the top half of the native double */
+				n |= NATIVE_ENDIAN_VALUE_LE_BE(1,0);
+				UML_XOR(block, FR32(n), FR32(n), 0x80000000);                               // xor     DRn.hi,DRn.hi,0x80000000
+			}
+			else
+				return false;
+			return true;
+
+		case 0x05:  // FABS(Rn)
+			if (pr)
+				n = (n & 14) | NATIVE_ENDIAN_VALUE_LE_BE(1,0);
+			UML_AND(block, FR32(n), FR32(n), 0x7fffffff);                                   // and     FRn,FRn,0x7fffffff
+			return true;
+
+		case 0x06:  // FSQRT(Rn)
+			if (pr)
+				return false;
+
+			/* negative numbers are left alone; NaNs still go through */
+			skip = compiler->labelnum++;
+			sqrt = compiler->labelnum++;
+			UML_FSFRINT(block, F0, 0, SIZE_DWORD);                                          // fsfrint f0,0,dword
+			UML_FSCMP(block, FR32(n), F0);                                                  // fscmp   FRn,f0
+			UML_JMPc(block, COND_U, sqrt);                                                  // ju      sqrt
+			UML_JMPc(block, COND_C, skip);                                                  // jc      skip
+			UML_LABEL(block, sqrt);                                                         // sqrt:
+			UML_FSSQRT(block, FR32(n), FR32(n));                                            // fssqrt  FRn,FRn
+			UML_LABEL(block, skip);                                                         // skip:
+			return true;
+
+		case 0x08:  // FLDI0(Rn)
+			UML_MOV(block, FR32(n), 0);                                                     // mov     FRn,0
+			return true;
+
+		case 0x09:  // FLDI1(Rn)
+			UML_MOV(block, FR32(n), 0x3f800000);                                            // mov     FRn,1.0f
+			return true;
+
+		case 0x0e:  // FIPR(Rm, Rn)
+		{
+			UINT32 m = (n & 3) << 2;
+			n &= 12;
+			UML_FSMUL(block, F0, FR32(n + 0), FR32(m + 0));                                 // fsmul   f0,FRn+0,FRm+0
+			UML_FSMUL(block, F1, FR32(n + 1), FR32(m + 1));                                 // fsmul   f1,FRn+1,FRm+1
+			UML_FSMUL(block, F2, FR32(n + 2), FR32(m + 2));                                 // fsmul   f2,FRn+2,FRm+2
+			UML_FSMUL(block, F3, FR32(n + 3), FR32(m + 3));                                 // fsmul   f3,FRn+3,FRm+3
+			UML_FSADD(block, F0, F0, F1);                                                   // fsadd   f0,f0,f1
+			UML_FSADD(block, F0, F0, F2);                                                   // fsadd   f0,f0,f2
+			UML_FSADD(block, F0, F0, F3);                                                   // fsadd   f0,f0,f3
+			UML_FSMOV(block, FR32(n + 3), F0);                                              // fsmov   FRn+3,f0
+			return true;
+		}
+
+		case 0x0f:
+			/* FSSCA, FSCHG and FRCHG are left to the interpreter */
+			if ((opcode & 0x0300) != 0x0100)
+				return false;
+
+			// FTRV(Rn)
+			n &= 12;
+			UML_FSFRINT(block, F4, 0, SIZE_DWORD);                                          // fsfrint f4,0,dword
+			for (int i = 0; i < 4; i++)
+			{
+				UML_FSMOV(block, freg(i), F4);                                              // fsmov   fi,f4
+				for (int j = 0; j < 4; j++)
+				{
+					UML_FSMUL(block, F5, XF32((j << 2) + i), FR32(n + j));                  // fsmul   f5,XFj*4+i,FRn+j
+					UML_FSADD(block, freg(i), freg(i), F5);                                 // fsadd   fi,fi,f5
+				}
+			}
+			for (int i = 0; i < 4; i++)
+				UML_FSMOV(block, FR32(n + i), freg(i));                                     // fsmov   FRn+i,fi
+			return true;
+	}
+
+	/* FSRRA, FCNVSD, FCNVDS and the breakpoint encodings */
+	return false;
+}
+
+
+/*-------------------------------------------------
+    generate_fmov_memory - FMOV loads and stores
+    with FPSCR.PR clear; FPSCR.SZ moves a pair of
+    registers from the bank picked by the odd bit
+-------------------------------------------------*/
+
+bool sh34_base_device::generate_fmov_memory(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode)
+{
+	bool sz = (compiler->mode & DRCMODE_SZ) != 0;
+	UINT32 n = Rn;
+	UINT32 m = Rm;
+	UINT32 *fpreg;
+	int count = sz ? 2 : 1;
+
+	switch (opcode & 0x0f)
+	{
+		case 0x06:  // FMOVS0FR(Rm, Rn)
+		case 0x08:  // FMOVMRFR(Rm, Rn)
+		case 0x09:  // FMOVMRIFR(Rm, Rn)
+			fpreg = (sz && (n & 1)) ? &m_sh4_state->xf[n & 14] : &m_sh4_state->fr[sz ? (n & 14) : n];
+			for (int word = 0; word < count; word++)
+			{
+				if ((opcode & 0x0f) == 0x06)
+					UML_ADD(block, I0, R32(0), R32(m));                                     // add     i0,R0,Rm
+				else
+					UML_MOV(block, I0, R32(m));                                             // mov     i0,Rm
+				if (word != 0)
+					UML_ADD(block, I0, I0, word * 4);                                       // add     i0,i0,word*4
+				generate_read(block, compiler, desc, 4);
+				UML_MOV(block, mem(&fpreg[word]), I0);                                      // mov     FRn+word,i0
+			}
+			if ((opcode & 0x0f) == 0x09)
+				UML_ADD(block, R32(m), R32(m), count * 4);                                  // add     Rm,Rm,count*4
+			return true;
+
+		case 0x07:  // FMOVFRS0(Rm, Rn)
+		case 0x0a:  // FMOVFRMR(Rm, Rn)
+		case 0x0b:  // FMOVFRMDR(Rm, Rn)
+			fpreg = (sz && (m & 1)) ? &m_sh4_state->xf[m & 14] : &m_sh4_state->fr[sz ? (m & 14) : m];
+			if ((opcode & 0x0f) == 0x0b)
+				UML_SUB(block, R32(n), R32(n), count * 4);                                  // sub     Rn,Rn,count*4
+			for (int word = 0; word < count; word++)
+			{
+				if ((opcode & 0x0f) == 0x07)
+					UML_ADD(block, I0, R32(0), R32(n));                                     // add     i0,R0,Rn
+				else
+					UML_MOV(block, I0, R32(n));                                             // mov     i0,Rn
+				if (word != 0)
+					UML_ADD(block, I0, I0, word * 4);                                       // add     i0,i0,word*4
+				UML_MOV(block, I1, mem(&fpreg[word]));                                      // mov     i1,FRm+word
+				generate_write(block, compiler, desc, 4);
+			}
+			generate_check_interrupt(block, compiler, desc);
+			return true;
+	}
+
+	return false;
+}
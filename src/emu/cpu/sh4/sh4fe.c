@@ -0,0 +1,230 @@
+// license:BSD-3-Clause
+// copyright-holders:R. Belmont
+/***************************************************************************
+
+    sh4fe.c
+
+    Front end for SH-4 recompiler.  The SH-4 integer instruction set is
+    a superset of the SH-2 one, so this derives from the SH-2 front end
+    and only describes the encodings that differ.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "sh4.h"
+#include "sh4comn.h"
+#include "cpu/drcfe.h"
+
+
+/***************************************************************************
+    INSTRUCTION PARSERS
+***************************************************************************/
+
+sh4_frontend::sh4_frontend(sh34_base_device *device, UINT32 window_start, UINT32 window_end, UINT32 max_sequence)
+	: sh2_frontend(*device, window_start, window_end, max_sequence)
+	, m_sh4(device)
+{
+}
+
+/*-------------------------------------------------
+    describe - build a description of a single
+    instruction
+-------------------------------------------------*/
+
+bool sh4_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	/* opcodes are always fetched through the 29-bit mirror, as the interpreter does */
+	desc.physpc = desc.pc & AM;
+
+	if (!sh2_frontend::describe(desc, prev))
+		return false;
+
+	/* the SH-4 core counts one cycle per instruction plus per-opcode extras */
+	desc.cycles = 1;
+	return true;
+}
+
+/*-------------------------------------------------
+    read_opcode - fetch the opcode for a
+    description
+-------------------------------------------------*/
+
+UINT16 sh4_frontend::read_opcode(const opcode_desc &desc)
+{
+	return m_sh4->m_direct->read_word(desc.physpc, m_sh4->m_drc_code_xor);
+}
+
+bool sh4_frontend::describe_group_0(opcode_desc &desc, const opcode_desc *prev, UINT16 opcode)
+{
+	switch (opcode & 0xff)
+	{
+	case 0x13: // NOP();
+	case 0x33: // NOP();
+	case 0x43: // NOP();
+	case 0x53: // NOP();
+	case 0x63: // NOP();
+	case 0x73: // NOP();
+	case 0x93: // OCBI(Rn);
+	case 0xa3: // OCBP(Rn);
+	case 0xb3: // OCBWB(Rn);
+	case 0xd3: // NOP();
+	case 0xe3: // NOP();
+	case 0xf3: // NOP();
+		return true;
+
+	case 0x83: // PREFM(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY;
+		return true;
+
+	case 0xc3: // MOVCAL(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn) | REGFLAG_R(0);
+		desc.flags |= OPFLAG_WRITES_MEMORY;
+		return true;
+
+	case 0x32: // STCSSR(Rn);
+	case 0x42: // STCSPC(Rn);
+	case 0x82: case 0x92: case 0xa2: case 0xb2:
+	case 0xc2: case 0xd2: case 0xe2: case 0xf2: // STCRBANK(Rn);
+	case 0x3a: // STCSGR(Rn);
+	case 0x7a: // STCDBR(Rn);
+	case 0xfa: // STCDBR(Rn);
+		desc.regout[0] |= REGFLAG_R(Rn);
+		return true;
+
+	case 0x5a: // STSFPUL(Rn);
+	case 0xda: // STSFPUL(Rn);
+		desc.regin[1] |= REGFLAG_FPUL;
+		desc.regout[0] |= REGFLAG_R(Rn);
+		return true;
+
+	case 0x6a: // STSFPSCR(Rn);
+	case 0xea: // STSFPSCR(Rn);
+		desc.regin[1] |= REGFLAG_FPSCR;
+		desc.regout[0] |= REGFLAG_R(Rn);
+		return true;
+
+	case 0x38: // LDTLB();
+	case 0xb8: // LDTLB();
+		desc.flags |= OPFLAG_MODIFIES_TRANSLATION | OPFLAG_END_SEQUENCE;
+		return true;
+
+	case 0x48: // CLRS();
+	case 0x58: // SETS();
+	case 0xc8: // CLRS();
+	case 0xd8: // SETS();
+		desc.regout[1] |= REGFLAG_SR;
+		return true;
+	}
+
+	return sh2_frontend::describe_group_0(desc, prev, opcode);
+}
+
+bool sh4_frontend::describe_group_4(opcode_desc &desc, const opcode_desc *prev, UINT16 opcode)
+{
+	switch (opcode & 0xff)
+	{
+	case 0x6a: // LDSFPSCR(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.regout[1] |= REGFLAG_FPSCR;
+		desc.flags |= OPFLAG_CAN_CHANGE_MODES | OPFLAG_END_SEQUENCE;
+		return true;
+
+	case 0x66: // LDSMFPSCR(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.regout[0] |= REGFLAG_R(Rn);
+		desc.regout[1] |= REGFLAG_FPSCR;
+		desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CHANGE_MODES | OPFLAG_END_SEQUENCE;
+		return true;
+
+	case 0x5a: // LDSFPUL(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.regout[1] |= REGFLAG_FPUL;
+		return true;
+
+	case 0x56: // LDSMFPUL(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.regout[0] |= REGFLAG_R(Rn);
+		desc.regout[1] |= REGFLAG_FPUL;
+		desc.flags |= OPFLAG_READS_MEMORY;
+		return true;
+
+	case 0x52: // STSMFPUL(Rn);
+	case 0x62: // STSMFPSCR(Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.regin[1] |= REGFLAG_FPUL | REGFLAG_FPSCR;
+		desc.regout[0] |= REGFLAG_R(Rn);
+		desc.flags |= OPFLAG_WRITES_MEMORY;
+		return true;
+	}
+
+	switch (opcode & 0x0f)
+	{
+	case 0x0c: // SHAD(Rm, Rn);
+	case 0x0d: // SHLD(Rm, Rn);
+		desc.regin[0] |= REGFLAG_R(Rm) | REGFLAG_R(Rn);
+		desc.regout[0] |= REGFLAG_R(Rn);
+		return true;
+	}
+
+	return sh2_frontend::describe_group_4(desc, prev, opcode);
+}
+
+bool sh4_frontend::describe_group_15(opcode_desc &desc, const opcode_desc *prev, UINT16 opcode)
+{
+	switch (opcode & 0x0f)
+	{
+	case 0x06: // FMOVS0FR(Rm, Rn);
+	case 0x08: // FMOVMRFR(Rm, Rn);
+		desc.regin[0] |= REGFLAG_R(Rm) | REGFLAG_R(0);
+		desc.flags |= OPFLAG_READS_MEMORY;
+		return true;
+
+	case 0x09: // FMOVMRIFR(Rm, Rn);
+		desc.regin[0] |= REGFLAG_R(Rm);
+		desc.regout[0] |= REGFLAG_R(Rm);
+		desc.flags |= OPFLAG_READS_MEMORY;
+		return true;
+
+	case 0x07: // FMOVFRS0(Rm, Rn);
+	case 0x0a: // FMOVFRMR(Rm, Rn);
+		desc.regin[0] |= REGFLAG_R(Rn) | REGFLAG_R(0);
+		desc.flags |= OPFLAG_WRITES_MEMORY;
+		return true;
+
+	case 0x0b: // FMOVFRMDR(Rm, Rn);
+		desc.regin[0] |= REGFLAG_R(Rn);
+		desc.regout[0] |= REGFLAG_R(Rn);
+		desc.flags |= OPFLAG_WRITES_MEMORY;
+		return true;
+
+	case 0x0d:
+		switch ((opcode >> 4) & 0x0f)
+		{
+		case 0x00: // FSTS(Rn);
+		case 0x02: // FLOAT(Rn);
+		case 0x0a: // FCNVSD(Rn);
+			desc.regin[1] |= REGFLAG_FPUL;
+			return true;
+
+		case 0x01: // FLDS(Rn);
+		case 0x03: // FTRC(Rn);
+		case 0x0b: // FCNVDS(Rn);
+			desc.regout[1] |= REGFLAG_FPUL;
+			return true;
+
+		case 0x0f:
+			/* FSCHG and FRCHG change how the following FPU opcodes behave */
+			if ((opcode & 0x0300) == 0x0300)
+			{
+				desc.regin[1] |= REGFLAG_FPSCR;
+				desc.regout[1] |= REGFLAG_FPSCR;
+				desc.flags |= OPFLAG_CAN_CHANGE_MODES | OPFLAG_END_SEQUENCE;
+			}
+			return true;
+		}
+		return true;
+	}
+
+	return true;
+}
@@ -60,7 +60,9 @@ adsp21062_device::adsp21062_device(const machine_config &mconfig, const char *ta
 	, m_program_config("program", ENDIANNESS_LITTLE, 64, 24, -3, ADDRESS_MAP_NAME(internal_pgm))
 	, m_data_config("data", ENDIANNESS_LITTLE, 32, 32, -2)
 	, m_boot_mode(BOOT_MODE_HOST)
+	, m_predecode(NULL)
 {
+	memset(&m_predecode_stats, 0, sizeof(m_predecode_stats));
 }
 
 
@@ -324,6 +326,9 @@ void adsp21062_device::device_start()
 	m_internal_ram_block0 = &m_internal_ram[0];
 	m_internal_ram_block1 = &m_internal_ram[0x20000/2];
 
+	if (machine().options().predecode())
+		m_predecode = auto_alloc_clear(machine(), predecode_cache);
+
 	m_delayed_iop_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(adsp21062_device::sharc_iop_delayed_write_callback), this));
 
 	for (int i=0; i < 12; i++)
@@ -637,9 +642,27 @@ void adsp21062_device::device_start()
 	m_icountptr = &m_icount;
 }
 
+void adsp21062_device::device_stop()
+{
+	if (m_predecode != NULL)
+	{
+		const predecode_stats &stats = m_predecode_stats;
+		UINT64 total = stats.hits + stats.decodes + stats.redecodes + stats.uncached;
+		osd_printf_verbose("%s: pre-decoded %d instructions (%d redecoded), %d%% of %d executed from the cache\n", tag(),
+				(int)stats.decodes, (int)stats.redecodes, total ? (int)(stats.hits * 100 / total) : 0, (int)total);
+	}
+}
+
+void adsp21062_device::device_post_load()
+{
+	// internal RAM was restored behind our back
+	predecode_flush();
+}
+
 void adsp21062_device::device_reset()
 {
 	memset(m_internal_ram, 0, 2 * 0x10000 * sizeof(UINT16));
+	predecode_flush();
 
 	switch(m_boot_mode)
 	{
@@ -766,6 +789,42 @@ void adsp21062_device::check_interrupts()
 	}
 }
 
+/*****************************************************************************/
+/* Pre-decoded instructions */
+
+/* Instructions in internal program memory are cached together with their  */
+/* handler, so the hot loops of a DSP program skip assembling the 48-bit    */
+/* word and looking up the handler. Every write path into internal RAM goes */
+/* through predecode_invalidate(), so entries never need to be verified.    */
+
+void adsp21062_device::predecode_flush()
+{
+	if (m_predecode != NULL)
+		m_predecode->flush();
+}
+
+inline void adsp21062_device::predecode_invalidate(UINT32 first, UINT32 count)
+{
+	/* first is in 16-bit words from the start of internal RAM */
+	if (m_predecode != NULL)
+		m_predecode->invalidate(first, count);
+}
+
+inline adsp21062_device::opcode_func adsp21062_device::fetch_predecoded()
+{
+	UINT32 index = m_pc - 0x20000;
+	if (index >= predecode_cache::ENTRIES)
+	{
+		m_predecode_stats.uncached++;
+		m_opcode = ROPCODE(m_pc);
+		return m_sharc_op[(m_opcode >> 39) & 0x1ff];
+	}
+
+	const predecode_cache::entry &entry = m_predecode->fetch(m_internal_ram, index, m_sharc_op, m_predecode_stats);
+	m_opcode = entry.opcode;
+	return entry.handler;
+}
+
 void adsp21062_device::execute_run()
 {
 	if (m_idle && m_irq_active == 0)
@@ -790,7 +849,14 @@ void adsp21062_device::execute_run()
 		m_astat_old_old = m_astat_old;
 		m_astat_old = m_astat;
 
-		m_opcode = ROPCODE(m_pc);
+		opcode_func handler;
+		if (m_predecode != NULL)
+			handler = fetch_predecoded();
+		else
+		{
+			m_opcode = ROPCODE(m_pc);
+			handler = m_sharc_op[(m_opcode >> 39) & 0x1ff];
+		}
 
 		debugger_instruction_hook(this, m_pc);
 
@@ -851,7 +917,7 @@ void adsp21062_device::execute_run()
 			}
 		}
 
-		(this->*m_sharc_op[(m_opcode >> 39) & 0x1ff])();
+		(this->*handler)();
 
 
 
@@ -5,6 +5,9 @@
 #ifndef __SHARC_H__
 #define __SHARC_H__
 
+#include "cpu/predecode.h"
+#include "sharcpre.h"
+
 
 #define SHARC_INPUT_FLAG0       3
 #define SHARC_INPUT_FLAG1       4
@@ -95,6 +98,8 @@ protected:
 	// device-level overrides
 	virtual void device_start();
 	virtual void device_reset();
+	virtual void device_stop();
+	virtual void device_post_load();
 
 	// device_execute_interface overrides
 	virtual UINT32 execute_min_cycles() const { return 8; }
@@ -126,6 +131,8 @@ private:
 	};
 	static const SHARC_OP s_sharc_opcode_table[];
 
+	typedef sharc_predecode_cache<opcode_func> predecode_cache;
+
 	UINT32 m_pc;
 	SHARC_REG m_r[16];
 	SHARC_REG m_reg_alt[16];
@@ -217,6 +224,9 @@ private:
 
 	UINT16 m_internal_ram[2 * 0x10000]; // 2x 128KB
 
+	predecode_cache *m_predecode;           // pre-decoded instructions, if enabled
+	predecode_stats m_predecode_stats;
+
 	inline void CHANGE_PC(UINT32 newpc);
 	inline void CHANGE_PC_DELAYED(UINT32 newpc);
 	void sharc_iop_delayed_w(UINT32 reg, UINT32 data, int cycles);
@@ -228,6 +238,9 @@ private:
 	void pm_write48(UINT32 address, UINT64 data);
 	UINT32 dm_read32(UINT32 address);
 	void dm_write32(UINT32 address, UINT32 data);
+	inline opcode_func fetch_predecoded();
+	inline void predecode_invalidate(UINT32 first, UINT32 count);
+	void predecode_flush();
 	void schedule_chained_dma_op(int channel, UINT32 dma_chain_ptr, int chained_direction);
 	void schedule_dma_op(int channel, UINT32 src, UINT32 dst, int src_modifier, int dst_modifier, int src_count, int dst_count, int pmode);
 	void dma_op(int channel);
@@ -0,0 +1,105 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    sharcpre.h
+
+    Pre-decoded instructions for the ADSP-2106x internal program memory.
+
+****************************************************************************
+
+    Internal RAM is an array of 16-bit words, and an instruction at
+    PM address 0x20000 + n is made of words 3n..3n+2. The cache keeps
+    one entry per instruction address with the assembled 48-bit word
+    and the handler that was looked up for it.
+
+    Every write into internal RAM must report the words it touched
+    with invalidate(), so entries are never checked against memory.
+    Since block 1 starts at word 0x10000, which is not a multiple of
+    three, a single write can cover the tail of one entry and the head
+    of the next; invalidate() takes a range for that reason.
+
+    The handler type only needs to compare against NULL; the device
+    uses its member function pointer type.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __SHARCPRE_H__
+#define __SHARCPRE_H__
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// sharc_predecode_cache
+template<class _Handler>
+class sharc_predecode_cache
+{
+public:
+	// pre-decoded instructions cover PM 0x20000-0x27fff
+	static const UINT32 ENTRIES = 0x8000;
+
+	// a pre-decoded instruction
+	struct entry
+	{
+		UINT64          opcode;             // instruction word, or ~0 once its memory has been written
+		_Handler        handler;            // handler, or NULL if not decoded
+	};
+
+	// assemble the instruction at the given index straight from internal RAM
+	static UINT64 read_opcode(const UINT16 *ram, UINT32 index)
+	{
+		return ((UINT64)(ram[index * 3 + 0]) << 32) |
+				((UINT64)(ram[index * 3 + 1]) << 16) |
+				((UINT64)(ram[index * 3 + 2]) << 0);
+	}
+
+	// discard everything
+	void flush()
+	{
+		memset(m_entry, 0, sizeof(m_entry));
+	}
+
+	// discard the entries holding 'count' words of internal RAM from 'first' on
+	void invalidate(UINT32 first, UINT32 count = 1)
+	{
+		UINT32 last = (first + count - 1) / 3;
+		if (last >= ENTRIES)
+			last = ENTRIES - 1;
+		for (UINT32 index = first / 3; index <= last; index++)
+			if (m_entry[index].handler != NULL)
+			{
+				m_entry[index].handler = NULL;
+				m_entry[index].opcode = ~U64(0);
+			}
+	}
+
+	// return the entry for the given index, decoding it through the 512-entry handler table if needed
+	template<class _Stats>
+	const entry &fetch(const UINT16 *ram, UINT32 index, const _Handler *table, _Stats &stats)
+	{
+		entry &result = m_entry[index];
+		if (EXPECTED(result.handler != NULL))
+			stats.hits++;
+		else
+		{
+			if (result.opcode == ~U64(0))
+				stats.redecodes++;
+			else
+				stats.decodes++;
+			result.opcode = read_opcode(ram, index);
+			result.handler = table[(result.opcode >> 39) & 0x1ff];
+		}
+		return result;
+	}
+
+private:
+	entry               m_entry[ENTRIES];   // one entry per instruction address
+};
+
+
+#endif /* __SHARCPRE_H__ */
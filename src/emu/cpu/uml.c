@@ -849,6 +849,65 @@ UINT8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  param_is_input - return true if the given
+//  parameter is read by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return ((s_opcode_info_table[m_opcode].param[paramnum].output & PIO_IN) != 0);
+}
+
+
+//-------------------------------------------------
+//  param_is_output - return true if the given
+//  parameter is written by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return ((s_opcode_info_table[m_opcode].param[paramnum].output & PIO_OUT) != 0);
+}
+
+
+//-------------------------------------------------
+//  param_allows_immediate - return true if the
+//  given parameter may be replaced with an
+//  immediate value
+//-------------------------------------------------
+
+bool uml::instruction::param_allows_immediate(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return ((s_opcode_info_table[m_opcode].param[paramnum].typemask & PTYPES_IMM) != 0);
+}
+
+
+//-------------------------------------------------
+//  param_size - return the size in bytes of the
+//  given parameter
+//-------------------------------------------------
+
+int uml::instruction::param_size(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	switch (s_opcode_info_table[m_opcode].param[paramnum].size)
+	{
+		case PSIZE_4:   return 4;
+		case PSIZE_8:   return 8;
+		case PSIZE_P1:  return 1 << m_param[0].size();
+		case PSIZE_P2:  return 1 << m_param[1].size();
+		case PSIZE_P3:  return 1 << m_param[2].size();
+		case PSIZE_P4:  return 1 << m_param[3].size();
+		default:
+		case PSIZE_OP:  return m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
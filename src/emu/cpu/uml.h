@@ -407,6 +407,13 @@ namespace uml
 		// setters
 		void set_flags(UINT8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, UINT32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_param(int paramnum, const parameter &param) { assert(paramnum < m_numparams); m_param[paramnum] = param; }
+
+		// parameter queries
+		bool param_is_input(int paramnum) const;
+		bool param_is_output(int paramnum) const;
+		bool param_allows_immediate(int paramnum) const;
+		int param_size(int paramnum) const;
 
 		// misc
 		const char *disasm(std::string &str, drcuml_state *drcuml = NULL) const;
@@ -33,11 +33,18 @@ struct vtlb_state
 	int                 dynamic;            /* number of dynamic entries */
 	int                 fixed;              /* number of fixed entries */
 	int                 dynindex;           /* index of next dynamic entry */
+	int                 ways;               /* dynamic entries per set */
+	int                 sets;               /* number of dynamic sets */
 	int                 pageshift;          /* bits to shift to get page index */
 	int                 addrwidth;          /* logical address bus width */
+	int                 usedcount;          /* number of entries in the used list */
 	std::vector<offs_t> live;             /* array of live entries by table index */
 	std::vector<int> fixedpages;          /* number of pages each fixed entry covers */
+	std::vector<vtlb_entry> fixedvalue;   /* value each fixed entry was loaded with */
+	std::vector<int> used;                /* dynamic entries claimed since the last flush */
+	std::vector<int> setindex;            /* next entry to replace in each set */
 	std::vector<vtlb_entry> table;        /* table of entries by address */
+	vtlb_stats          stats;              /* miss and flush statistics */
 };
 
 
@@ -51,7 +58,7 @@ struct vtlb_state
     given CPU
 -------------------------------------------------*/
 
-vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries, int dynamic_entries)
+vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries, int dynamic_entries, int ways)
 {
 	vtlb_state *vtlb;
 
@@ -63,6 +70,8 @@ vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries,
 	vtlb->space = space;
 	vtlb->dynamic = dynamic_entries;
 	vtlb->fixed = fixed_entries;
+	vtlb->ways = (ways > 0 && ways < dynamic_entries) ? ways : dynamic_entries;
+	vtlb->sets = (vtlb->ways > 0) ? dynamic_entries / vtlb->ways : 0;
 	const address_space_config *spaceconfig = device_get_space_config(*cpu, space);
 	assert(spaceconfig != NULL);
 	vtlb->pageshift = spaceconfig->m_page_shift;
@@ -71,12 +80,24 @@ vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries,
 	/* validate CPU information */
 	assert((1 << vtlb->pageshift) > VTLB_FLAGS_MASK);
 	assert(vtlb->addrwidth > vtlb->pageshift);
+	assert(vtlb->sets * vtlb->ways == dynamic_entries);
 
 	/* allocate the entry array */
 	vtlb->live.resize(fixed_entries + dynamic_entries);
 	memset(&vtlb->live[0], 0, vtlb->live.size()*sizeof(vtlb->live[0]));
 	cpu->save_item(NAME(vtlb->live));
 
+	/* allocate the list of claimed dynamic entries and the per-set replacement state */
+	if (dynamic_entries > 0)
+	{
+		vtlb->used.resize(dynamic_entries);
+		memset(&vtlb->used[0], 0, vtlb->used.size()*sizeof(vtlb->used[0]));
+		cpu->save_item(NAME(vtlb->used));
+		cpu->save_item(NAME(vtlb->usedcount));
+		vtlb->setindex.resize(vtlb->sets);
+		memset(&vtlb->setindex[0], 0, vtlb->setindex.size()*sizeof(vtlb->setindex[0]));
+	}
+
 	/* allocate the lookup table */
 	vtlb->table.resize((size_t) 1 << (vtlb->addrwidth - vtlb->pageshift));
 	memset(&vtlb->table[0], 0, vtlb->table.size()*sizeof(vtlb->table[0]));
@@ -88,6 +109,9 @@ vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries,
 		vtlb->fixedpages.resize(fixed_entries);
 		memset(&vtlb->fixedpages[0], 0, fixed_entries*sizeof(vtlb->fixedpages[0]));
 		cpu->save_item(NAME(vtlb->fixedpages));
+		vtlb->fixedvalue.resize(fixed_entries);
+		memset(&vtlb->fixedvalue[0], 0, fixed_entries*sizeof(vtlb->fixedvalue[0]));
+		cpu->save_item(NAME(vtlb->fixedvalue));
 	}
 	return vtlb;
 }
@@ -99,6 +123,17 @@ vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries,
 
 void vtlb_free(vtlb_state *vtlb)
 {
+	const vtlb_stats &stats = vtlb->stats;
+
+	/* report how the TLB fared */
+	if (stats.fills != 0 || stats.fixed_loads != 0)
+	{
+		osd_printf_verbose("%s: VTLB %d fixed + %d dynamic entries (%d-way), %d misses (%d faults), %d evictions\n", vtlb->cpudevice->tag(),
+				vtlb->fixed, vtlb->dynamic, vtlb->ways, (UINT32)stats.fills, (UINT32)stats.faults, (UINT32)stats.evictions);
+		osd_printf_verbose("%s: VTLB %d flushes (%d entries), %d page flushes, %d of %d fixed loads unchanged\n", vtlb->cpudevice->tag(),
+				(UINT32)stats.flushes, (UINT32)stats.flushed_entries, (UINT32)stats.page_flushes, (UINT32)stats.fixed_unchanged, (UINT32)stats.fixed_loads);
+	}
+
 	auto_free(vtlb->cpudevice->machine(), vtlb);
 }
 
@@ -108,6 +143,59 @@ void vtlb_free(vtlb_state *vtlb)
     FILLING
 ***************************************************************************/
 
+/*-------------------------------------------------
+    vtlb_claim_dynamic - pick a dynamic entry for
+    the given table index, evicting the previous
+    occupant if needed
+-------------------------------------------------*/
+
+static int vtlb_claim_dynamic(vtlb_state *vtlb, offs_t tableindex)
+{
+	int liveindex;
+
+	/* fully associative: plain round-robin over all entries */
+	if (vtlb->sets == 1)
+		liveindex = vtlb->dynindex++ % vtlb->dynamic;
+
+	/* set associative: take a free way in the page's set, or replace round-robin */
+	else
+	{
+		int set = tableindex % vtlb->sets;
+		int base = set * vtlb->ways;
+		int way;
+
+		for (way = 0; way < vtlb->ways; way++)
+			if (vtlb->live[base + way] == 0)
+				break;
+		if (way == vtlb->ways)
+		{
+			way = vtlb->setindex[set];
+			vtlb->setindex[set] = (way + 1) % vtlb->ways;
+		}
+		liveindex = base + way;
+	}
+
+	/* if an entry already exists at this index, free it */
+	if (vtlb->live[liveindex] != 0)
+	{
+		vtlb->table[vtlb->live[liveindex] - 1] = 0;
+		vtlb->stats.evictions++;
+	}
+
+	/* otherwise remember it so a flush only visits claimed entries */
+	else if (vtlb->usedcount <= vtlb->dynamic)
+	{
+		if (vtlb->usedcount < vtlb->dynamic)
+			vtlb->used[vtlb->usedcount] = liveindex;
+		vtlb->usedcount++;
+	}
+
+	/* claim this new entry */
+	vtlb->live[liveindex] = tableindex + 1;
+	return liveindex;
+}
+
+
 /*-------------------------------------------------
     vtlb_fill - rcalled by the CPU core in
     response to an unmapped access
@@ -126,10 +214,12 @@ int vtlb_fill(vtlb_state *vtlb, offs_t address, int intention)
 //  assert((entry & (1 << intention)) == 0);
 
 	/* if we have no dynamic entries, we always fail */
+	vtlb->stats.fills++;
 	if (vtlb->dynamic == 0)
 	{
 		if (PRINTF_TLB)
 			printf("failed: no dynamic entries\n");
+		vtlb->stats.faults++;
 		return FALSE;
 	}
 
@@ -139,20 +229,14 @@ int vtlb_fill(vtlb_state *vtlb, offs_t address, int intention)
 	{
 		if (PRINTF_TLB)
 			printf("failed: no translation\n");
+		vtlb->stats.faults++;
 		return FALSE;
 	}
 
 	/* if this is the first successful translation for this address, allocate a new entry */
 	if ((entry & VTLB_FLAGS_MASK) == 0)
 	{
-		int liveindex = vtlb->dynindex++ % vtlb->dynamic;
-
-		/* if an entry already exists at this index, free it */
-		if (vtlb->live[liveindex] != 0)
-			vtlb->table[vtlb->live[liveindex] - 1] = 0;
-
-		/* claim this new entry */
-		vtlb->live[liveindex] = tableindex + 1;
+		vtlb_claim_dynamic(vtlb, tableindex);
 
 		/* form a new blank entry */
 		entry = (taddress >> vtlb->pageshift) << vtlb->pageshift;
@@ -195,6 +279,22 @@ void vtlb_load(vtlb_state *vtlb, int entrynum, int numpages, offs_t address, vtl
 	if (PRINTF_TLB)
 		printf("vtlb_load %d for %d pages at %08X == %08X\n", entrynum, numpages, address, value);
 
+	/* reloading an entry with the same mapping is common on ASID changes; skip the table writes */
+	/* as long as nothing (a page flush, an overlapping entry) has changed the table since */
+	value |= VTLB_FLAG_FIXED;
+	vtlb->stats.fixed_loads++;
+	if (vtlb->live[liveindex] == tableindex + 1 && vtlb->fixedpages[entrynum] == numpages && (numpages == 0 || vtlb->fixedvalue[entrynum] == value))
+	{
+		for (pagenum = 0; pagenum < numpages; pagenum++)
+			if (vtlb->table[tableindex + pagenum] != value + (pagenum << vtlb->pageshift))
+				break;
+		if (pagenum == numpages)
+		{
+			vtlb->stats.fixed_unchanged++;
+			return;
+		}
+	}
+
 	/* if an entry already exists at this index, free it */
 	if (vtlb->live[liveindex] != 0)
 	{
@@ -207,9 +307,9 @@ void vtlb_load(vtlb_state *vtlb, int entrynum, int numpages, offs_t address, vtl
 	/* claim this new entry */
 	vtlb->live[liveindex] = tableindex + 1;
 
-	/* store the raw value, making sure the "fixed" flag is set */
-	value |= VTLB_FLAG_FIXED;
+	/* store the raw value, with the "fixed" flag set above */
 	vtlb->fixedpages[entrynum] = numpages;
+	vtlb->fixedvalue[entrynum] = value;
 	for (pagenum = 0; pagenum < numpages; pagenum++)
 		vtlb->table[tableindex + pagenum] = value + (pagenum << vtlb->pageshift);
 }
@@ -229,17 +329,10 @@ void vtlb_dynload(vtlb_state *vtlb, UINT32 index, offs_t address, vtlb_entry val
 		return;
 	}
 
-	int liveindex = vtlb->dynindex++ % vtlb->dynamic;
 	/* is entry already live? */
+	vtlb->stats.fills++;
 	if (!(entry & VTLB_FLAG_VALID))
-	{
-		/* if an entry already exists at this index, free it */
-		if (vtlb->live[liveindex] != 0)
-			vtlb->table[vtlb->live[liveindex] - 1] = 0;
-
-		/* claim this new entry */
-		vtlb->live[liveindex] = index + 1;
-	}
+		vtlb_claim_dynamic(vtlb, index);
 	/* form a new blank entry */
 	entry = (address >> vtlb->pageshift) << vtlb->pageshift;
 	entry |= VTLB_FLAG_VALID | value;
@@ -266,14 +359,36 @@ void vtlb_flush_dynamic(vtlb_state *vtlb)
 	if (PRINTF_TLB)
 		printf("vtlb_flush_dynamic\n");
 
-	/* loop over live entries and release them from the table */
-	for (liveindex = 0; liveindex < vtlb->dynamic; liveindex++)
-		if (vtlb->live[liveindex] != 0)
+	vtlb->stats.flushes++;
+
+	/* if the used list is complete, only visit the entries claimed since the last flush */
+	if (vtlb->usedcount < vtlb->dynamic)
+	{
+		for (int usedindex = 0; usedindex < vtlb->usedcount; usedindex++)
 		{
-			offs_t tableindex = vtlb->live[liveindex] - 1;
-			vtlb->table[tableindex] = 0;
-			vtlb->live[liveindex] = 0;
+			liveindex = vtlb->used[usedindex];
+			if (vtlb->live[liveindex] != 0)
+			{
+				vtlb->table[vtlb->live[liveindex] - 1] = 0;
+				vtlb->live[liveindex] = 0;
+				vtlb->stats.flushed_entries++;
+			}
 		}
+	}
+
+	/* otherwise, loop over live entries and release them from the table */
+	else
+	{
+		for (liveindex = 0; liveindex < vtlb->dynamic; liveindex++)
+			if (vtlb->live[liveindex] != 0)
+			{
+				offs_t tableindex = vtlb->live[liveindex] - 1;
+				vtlb->table[tableindex] = 0;
+				vtlb->live[liveindex] = 0;
+				vtlb->stats.flushed_entries++;
+			}
+	}
+	vtlb->usedcount = 0;
 }
 
 
@@ -289,7 +404,21 @@ void vtlb_flush_address(vtlb_state *vtlb, offs_t address)
 	if (PRINTF_TLB)
 		printf("vtlb_flush_address %08X\n", address);
 
-	/* free the entry in the table; for speed, we leave the entry in the live array */
+	vtlb->stats.page_flushes++;
+
+	/* with sets, the live entry is cheap to find; release it so the way can be reused */
+	if (vtlb->sets > 1 && (vtlb->table[tableindex] & (VTLB_FLAG_VALID | VTLB_FLAG_FIXED)) == VTLB_FLAG_VALID)
+	{
+		int base = (tableindex % vtlb->sets) * vtlb->ways;
+		for (int way = 0; way < vtlb->ways; way++)
+			if (vtlb->live[base + way] == tableindex + 1)
+			{
+				vtlb->live[base + way] = 0;
+				break;
+			}
+	}
+
+	/* free the entry in the table; otherwise for speed, we leave the entry in the live array */
 	vtlb->table[tableindex] = 0;
 }
 
@@ -308,3 +437,14 @@ const vtlb_entry *vtlb_table(vtlb_state *vtlb)
 {
 	return &vtlb->table[0];
 }
+
+
+/*-------------------------------------------------
+    vtlb_statistics - return the miss and flush
+    counts gathered so far
+-------------------------------------------------*/
+
+const vtlb_stats &vtlb_statistics(vtlb_state *vtlb)
+{
+	return vtlb->stats;
+}
@@ -44,6 +44,20 @@ typedef UINT32 vtlb_entry;
 struct vtlb_state;
 
 
+/* miss and flush statistics for a VTLB */
+struct vtlb_stats
+{
+	UINT64              fills;              /* calls to fill a missing entry */
+	UINT64              faults;             /* fills the CPU core could not translate */
+	UINT64              evictions;          /* dynamic entries replaced by a fill */
+	UINT64              flushes;            /* flushes of the dynamic entries */
+	UINT64              flushed_entries;    /* dynamic entries released by those flushes */
+	UINT64              page_flushes;       /* single address flushes */
+	UINT64              fixed_loads;        /* fixed entry loads */
+	UINT64              fixed_unchanged;    /* fixed entry loads that matched the existing mapping */
+};
+
+
 
 /***************************************************************************
     FUNCTION PROTOTYPES
@@ -52,8 +66,8 @@ struct vtlb_state;
 
 /* ----- initialization/teardown ----- */
 
-/* allocate a new VTLB for the given CPU */
-vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries, int dynamic_entries);
+/* allocate a new VTLB for the given CPU; dynamic entries are fully associative unless ways is given */
+vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries, int dynamic_entries, int ways = 0);
 
 /* free an allocated VTLB */
 void vtlb_free(vtlb_state *vtlb);
@@ -84,5 +98,8 @@ void vtlb_flush_address(vtlb_state *vtlb, offs_t address);
 /* return a pointer to the base of the linear VTLB lookup table */
 const vtlb_entry *vtlb_table(vtlb_state *vtlb);
 
+/* return the miss and flush statistics */
+const vtlb_stats &vtlb_statistics(vtlb_state *vtlb);
+
 
 #endif /* __VTLB_H__ */
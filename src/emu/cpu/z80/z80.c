@@ -150,7 +150,7 @@
 #define AFD     m_af.d
 #define AF      m_af.w.l
 #define A       m_af.b.h
-#define F       m_af.b.l
+#define F       flags()
 
 #define BCD     m_bc.d
 #define BC      m_bc.w.l
@@ -186,11 +186,6 @@ static bool tables_initialised = false;
 static UINT8 SZ[256];       /* zero and sign flags */
 static UINT8 SZ_BIT[256];   /* zero, sign and parity/overflow (=zero) flags for BIT opcode */
 static UINT8 SZP[256];      /* zero, sign and parity flags */
-static UINT8 SZHV_inc[256]; /* zero, sign, half carry and overflow flags INC r8 */
-static UINT8 SZHV_dec[256]; /* zero, sign, half carry and overflow flags DEC r8 */
-
-static UINT8 SZHVC_add[2*256*256];
-static UINT8 SZHVC_sub[2*256*256];
 
 static const UINT8 cc_op[0x100] = {
 	4,10, 7, 6, 4, 4, 7, 4, 4,11, 7, 6, 4, 4, 7, 4,
@@ -393,6 +388,106 @@ static const UINT8 cc_ex[0x100] = {
 	} \
 } while (0)
 
+/***************************************************************
+ * pre-decoded execution: handler groups and their dispatch
+ ***************************************************************/
+enum
+{
+	Z80_PD_OP = 0,      /* unprefixed */
+	Z80_PD_CB,          /* CB xx */
+	Z80_PD_ED,          /* ED xx */
+	Z80_PD_DD,          /* DD xx */
+	Z80_PD_FD,          /* FD xx */
+	Z80_PD_DDCB,        /* DD CB d xx */
+	Z80_PD_FDCB,        /* FD CB d xx */
+	Z80_PD_SLOW         /* not cacheable, interpret as usual */
+};
+
+#define PD_EACH(M,prefix) \
+	M(prefix,00) M(prefix,01) M(prefix,02) M(prefix,03) M(prefix,04) M(prefix,05) M(prefix,06) M(prefix,07) \
+	M(prefix,08) M(prefix,09) M(prefix,0a) M(prefix,0b) M(prefix,0c) M(prefix,0d) M(prefix,0e) M(prefix,0f) \
+	M(prefix,10) M(prefix,11) M(prefix,12) M(prefix,13) M(prefix,14) M(prefix,15) M(prefix,16) M(prefix,17) \
+	M(prefix,18) M(prefix,19) M(prefix,1a) M(prefix,1b) M(prefix,1c) M(prefix,1d) M(prefix,1e) M(prefix,1f) \
+	M(prefix,20) M(prefix,21) M(prefix,22) M(prefix,23) M(prefix,24) M(prefix,25) M(prefix,26) M(prefix,27) \
+	M(prefix,28) M(prefix,29) M(prefix,2a) M(prefix,2b) M(prefix,2c) M(prefix,2d) M(prefix,2e) M(prefix,2f) \
+	M(prefix,30) M(prefix,31) M(prefix,32) M(prefix,33) M(prefix,34) M(prefix,35) M(prefix,36) M(prefix,37) \
+	M(prefix,38) M(prefix,39) M(prefix,3a) M(prefix,3b) M(prefix,3c) M(prefix,3d) M(prefix,3e) M(prefix,3f) \
+	M(prefix,40) M(prefix,41) M(prefix,42) M(prefix,43) M(prefix,44) M(prefix,45) M(prefix,46) M(prefix,47) \
+	M(prefix,48) M(prefix,49) M(prefix,4a) M(prefix,4b) M(prefix,4c) M(prefix,4d) M(prefix,4e) M(prefix,4f) \
+	M(prefix,50) M(prefix,51) M(prefix,52) M(prefix,53) M(prefix,54) M(prefix,55) M(prefix,56) M(prefix,57) \
+	M(prefix,58) M(prefix,59) M(prefix,5a) M(prefix,5b) M(prefix,5c) M(prefix,5d) M(prefix,5e) M(prefix,5f) \
+	M(prefix,60) M(prefix,61) M(prefix,62) M(prefix,63) M(prefix,64) M(prefix,65) M(prefix,66) M(prefix,67) \
+	M(prefix,68) M(prefix,69) M(prefix,6a) M(prefix,6b) M(prefix,6c) M(prefix,6d) M(prefix,6e) M(prefix,6f) \
+	M(prefix,70) M(prefix,71) M(prefix,72) M(prefix,73) M(prefix,74) M(prefix,75) M(prefix,76) M(prefix,77) \
+	M(prefix,78) M(prefix,79) M(prefix,7a) M(prefix,7b) M(prefix,7c) M(prefix,7d) M(prefix,7e) M(prefix,7f) \
+	M(prefix,80) M(prefix,81) M(prefix,82) M(prefix,83) M(prefix,84) M(prefix,85) M(prefix,86) M(prefix,87) \
+	M(prefix,88) M(prefix,89) M(prefix,8a) M(prefix,8b) M(prefix,8c) M(prefix,8d) M(prefix,8e) M(prefix,8f) \
+	M(prefix,90) M(prefix,91) M(prefix,92) M(prefix,93) M(prefix,94) M(prefix,95) M(prefix,96) M(prefix,97) \
+	M(prefix,98) M(prefix,99) M(prefix,9a) M(prefix,9b) M(prefix,9c) M(prefix,9d) M(prefix,9e) M(prefix,9f) \
+	M(prefix,a0) M(prefix,a1) M(prefix,a2) M(prefix,a3) M(prefix,a4) M(prefix,a5) M(prefix,a6) M(prefix,a7) \
+	M(prefix,a8) M(prefix,a9) M(prefix,aa) M(prefix,ab) M(prefix,ac) M(prefix,ad) M(prefix,ae) M(prefix,af) \
+	M(prefix,b0) M(prefix,b1) M(prefix,b2) M(prefix,b3) M(prefix,b4) M(prefix,b5) M(prefix,b6) M(prefix,b7) \
+	M(prefix,b8) M(prefix,b9) M(prefix,ba) M(prefix,bb) M(prefix,bc) M(prefix,bd) M(prefix,be) M(prefix,bf) \
+	M(prefix,c0) M(prefix,c1) M(prefix,c2) M(prefix,c3) M(prefix,c4) M(prefix,c5) M(prefix,c6) M(prefix,c7) \
+	M(prefix,c8) M(prefix,c9) M(prefix,ca) M(prefix,cb) M(prefix,cc) M(prefix,cd) M(prefix,ce) M(prefix,cf) \
+	M(prefix,d0) M(prefix,d1) M(prefix,d2) M(prefix,d3) M(prefix,d4) M(prefix,d5) M(prefix,d6) M(prefix,d7) \
+	M(prefix,d8) M(prefix,d9) M(prefix,da) M(prefix,db) M(prefix,dc) M(prefix,dd) M(prefix,de) M(prefix,df) \
+	M(prefix,e0) M(prefix,e1) M(prefix,e2) M(prefix,e3) M(prefix,e4) M(prefix,e5) M(prefix,e6) M(prefix,e7) \
+	M(prefix,e8) M(prefix,e9) M(prefix,ea) M(prefix,eb) M(prefix,ec) M(prefix,ed) M(prefix,ee) M(prefix,ef) \
+	M(prefix,f0) M(prefix,f1) M(prefix,f2) M(prefix,f3) M(prefix,f4) M(prefix,f5) M(prefix,f6) M(prefix,f7) \
+	M(prefix,f8) M(prefix,f9) M(prefix,fa) M(prefix,fb) M(prefix,fc) M(prefix,fd) M(prefix,fe) M(prefix,ff)
+
+#define PD_LABEL(prefix,opcode) pd_##prefix##_##opcode
+#define PD_ADDRESS(prefix,opcode) &&PD_LABEL(prefix,opcode),
+
+#if PREDECODE_COMPUTED_GOTO
+#define PD_CASE(group,prefix,opcode) case (group << 8) | 0x##opcode: PD_LABEL(prefix,opcode):
+#else
+#define PD_CASE(group,prefix,opcode) case (group << 8) | 0x##opcode:
+#endif
+
+/* each handler consumes its opcode bytes and adjusts R and the cycle count as the prefix chain would */
+#define PD_OP(prefix,opcode)    PD_CASE(Z80_PD_OP,prefix,opcode) PC += 1; m_r += 1; m_icount -= m_cc_op[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_CB(prefix,opcode)    PD_CASE(Z80_PD_CB,prefix,opcode) PC += 2; m_r += 2; m_icount -= m_cc_op[0xcb] + m_cc_cb[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_ED(prefix,opcode)    PD_CASE(Z80_PD_ED,prefix,opcode) PC += 2; m_r += 2; m_icount -= m_cc_op[0xed] + m_cc_ed[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_DD(prefix,opcode)    PD_CASE(Z80_PD_DD,prefix,opcode) PC += 2; m_r += 2; m_icount -= m_cc_op[0xdd] + m_cc_dd[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_FD(prefix,opcode)    PD_CASE(Z80_PD_FD,prefix,opcode) PC += 2; m_r += 2; m_icount -= m_cc_op[0xfd] + m_cc_fd[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_DDCB(prefix,opcode)  PD_CASE(Z80_PD_DDCB,ddcb,opcode) PC += 4; m_r += 2; m_ea = (UINT32)(UINT16)(IX + entry->disp); WZ = m_ea; \
+	m_icount -= m_cc_op[0xdd] + m_cc_dd[0xcb] + m_cc_xycb[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_FDCB(prefix,opcode)  PD_CASE(Z80_PD_FDCB,fdcb,opcode) PC += 4; m_r += 2; m_ea = (UINT32)(UINT16)(IY + entry->disp); WZ = m_ea; \
+	m_icount -= m_cc_op[0xfd] + m_cc_fd[0xcb] + m_cc_xycb[0x##opcode]; prefix##_##opcode(); continue;
+#define PD_DDCB_ADDRESS(prefix,opcode) &&PD_LABEL(ddcb,opcode),
+#define PD_FDCB_ADDRESS(prefix,opcode) &&PD_LABEL(fdcb,opcode),
+
+/***************************************************************
+ * Lazily evaluated flags: the 8-bit ALU ops only record what
+ * they did, F is built when something actually reads it
+ ***************************************************************/
+inline void z80_device::sync_flags()
+{
+	if (m_lazy.pending())
+	{
+		m_af.b.l = z80_lazy_flags(m_lazy);
+		m_lazy.clear();
+	}
+}
+
+inline UINT8 &z80_device::flags()
+{
+	sync_flags();
+	return m_af.b.l;
+}
+
+inline UINT8 z80_device::carry()
+{
+	return m_lazy.pending() ? z80_lazy_carry(m_lazy) : (m_af.b.l & CF);
+}
+
+inline bool z80_device::flag(UINT8 mask)
+{
+	return m_lazy.pending() ? z80_lazy_flag(m_lazy, mask) : ((m_af.b.l & mask) != 0);
+}
+
 /***************************************************************
  * Enter halt state; write 1 to fake port on first execution
  ***************************************************************/
@@ -697,8 +792,8 @@ inline void z80_device::rst(UINT16 addr)
  ***************************************************************/
 inline UINT8 z80_device::inc(UINT8 value)
 {
-	UINT8 res = value + 1;
-	F = (F & CF) | SZHV_inc[res];
+	UINT32 res = value + 1;
+	m_lazy.set(LAZY_FLAGS_ADD, 8, value, 1, res, Z80_LAZY_INCDEC | (carry() << 7));
 	return (UINT8)res;
 }
 
@@ -707,9 +802,9 @@ inline UINT8 z80_device::inc(UINT8 value)
  ***************************************************************/
 inline UINT8 z80_device::dec(UINT8 value)
 {
-	UINT8 res = value - 1;
-	F = (F & CF) | SZHV_dec[res];
-	return res;
+	UINT32 res = value - 1;
+	m_lazy.set(LAZY_FLAGS_SUB, 8, value, 1, res, Z80_LAZY_INCDEC | (carry() << 7));
+	return (UINT8)res;
 }
 
 /***************************************************************
@@ -782,9 +877,8 @@ inline void z80_device::rld()
  ***************************************************************/
 inline void z80_device::add_a(UINT8 value)
 {
-	UINT32 ah = AFD & 0xff00;
-	UINT32 res = (UINT8)((ah >> 8) + value);
-	F = SZHVC_add[ah | res];
+	UINT32 res = A + value;
+	m_lazy.set(LAZY_FLAGS_ADD, 8, A, value, res);
 	A = res;
 }
 
@@ -793,9 +887,8 @@ inline void z80_device::add_a(UINT8 value)
  ***************************************************************/
 inline void z80_device::adc_a(UINT8 value)
 {
-	UINT32 ah = AFD & 0xff00, c = AFD & 1;
-	UINT32 res = (UINT8)((ah >> 8) + value + c);
-	F = SZHVC_add[(c << 16) | ah | res];
+	UINT32 res = A + value + carry();
+	m_lazy.set(LAZY_FLAGS_ADD, 8, A, value, res);
 	A = res;
 }
 
@@ -804,9 +897,8 @@ inline void z80_device::adc_a(UINT8 value)
  ***************************************************************/
 inline void z80_device::sub(UINT8 value)
 {
-	UINT32 ah = AFD & 0xff00;
-	UINT32 res = (UINT8)((ah >> 8) - value);
-	F = SZHVC_sub[ah | res];
+	UINT32 res = A - value;
+	m_lazy.set(LAZY_FLAGS_SUB, 8, A, value, res);
 	A = res;
 }
 
@@ -815,9 +907,8 @@ inline void z80_device::sub(UINT8 value)
  ***************************************************************/
 inline void z80_device::sbc_a(UINT8 value)
 {
-	UINT32 ah = AFD & 0xff00, c = AFD & 1;
-	UINT32 res = (UINT8)((ah >> 8) - value - c);
-	F = SZHVC_sub[(c<<16) | ah | res];
+	UINT32 res = A - value - carry();
+	m_lazy.set(LAZY_FLAGS_SUB, 8, A, value, res);
 	A = res;
 }
 
@@ -856,7 +947,7 @@ inline void z80_device::daa()
 inline void z80_device::and_a(UINT8 value)
 {
 	A &= value;
-	F = SZP[A] | HF;
+	m_lazy.set(LAZY_FLAGS_LOGIC, 8, A, value, A, Z80_LAZY_AND);
 }
 
 /***************************************************************
@@ -865,7 +956,7 @@ inline void z80_device::and_a(UINT8 value)
 inline void z80_device::or_a(UINT8 value)
 {
 	A |= value;
-	F = SZP[A];
+	m_lazy.set(LAZY_FLAGS_LOGIC, 8, A, value, A, Z80_LAZY_OR);
 }
 
 /***************************************************************
@@ -874,7 +965,7 @@ inline void z80_device::or_a(UINT8 value)
 inline void z80_device::xor_a(UINT8 value)
 {
 	A ^= value;
-	F = SZP[A];
+	m_lazy.set(LAZY_FLAGS_LOGIC, 8, A, value, A, Z80_LAZY_OR);
 }
 
 /***************************************************************
@@ -882,11 +973,7 @@ inline void z80_device::xor_a(UINT8 value)
  ***************************************************************/
 inline void z80_device::cp(UINT8 value)
 {
-	unsigned val = value;
-	UINT32 ah = AFD & 0xff00;
-	UINT32 res = (UINT8)((ah >> 8) - val);
-	F = (SZHVC_sub[ah | res] & ~(YF | XF)) |
-		(val & (YF | XF));
+	m_lazy.set(LAZY_FLAGS_SUB, 8, A, value, A - value, Z80_LAZY_CP);
 }
 
 /***************************************************************
@@ -895,6 +982,7 @@ inline void z80_device::cp(UINT8 value)
 inline void z80_device::ex_af()
 {
 	PAIR tmp;
+	sync_flags();
 	tmp = m_af; m_af = m_af2; m_af2 = tmp;
 }
 
@@ -2867,7 +2955,7 @@ OP(op,1d) { E = dec(E);
 OP(op,1e) { E = arg();                                                            } /* LD   E,n         */
 OP(op,1f) { rra();                                                                } /* RRA              */
 
-OP(op,20) { jr_cond(!(F & ZF), 0x20);                                             } /* JR   NZ,o        */
+OP(op,20) { jr_cond(!flag(ZF), 0x20);                                             } /* JR   NZ,o        */
 OP(op,21) { HL = arg16();                                                         } /* LD   HL,w        */
 OP(op,22) { m_ea = arg16(); wm16(m_ea, m_hl); WZ = m_ea + 1;                      } /* LD   (w),HL      */
 OP(op,23) { HL++;                                                                 } /* INC  HL          */
@@ -2876,7 +2964,7 @@ OP(op,25) { H = dec(H);
 OP(op,26) { H = arg();                                                            } /* LD   H,n         */
 OP(op,27) { daa();                                                                } /* DAA              */
 
-OP(op,28) { jr_cond(F & ZF, 0x28);                                                } /* JR   Z,o         */
+OP(op,28) { jr_cond(flag(ZF), 0x28);                                              } /* JR   Z,o         */
 OP(op,29) { add16(m_hl, m_hl);                                                    } /* ADD  HL,HL       */
 OP(op,2a) { m_ea = arg16(); rm16(m_ea, m_hl); WZ = m_ea+1;                        } /* LD   HL,(w)      */
 OP(op,2b) { HL--;                                                                 } /* DEC  HL          */
@@ -2885,7 +2973,7 @@ OP(op,2d) { L = dec(L);
 OP(op,2e) { L = arg();                                                            } /* LD   L,n         */
 OP(op,2f) { A ^= 0xff; F = (F & (SF | ZF | PF | CF)) | HF | NF | (A & (YF | XF)); } /* CPL              */
 
-OP(op,30) { jr_cond(!(F & CF), 0x30);                                             } /* JR   NC,o        */
+OP(op,30) { jr_cond(!flag(CF), 0x30);                                             } /* JR   NC,o        */
 OP(op,31) { SP = arg16();                                                         } /* LD   SP,w        */
 OP(op,32) { m_ea = arg16(); wm(m_ea, A); WZ_L = (m_ea + 1) & 0xFF; WZ_H = A;      } /* LD   (w),A       */
 OP(op,33) { SP++;                                                                 } /* INC  SP          */
@@ -2894,7 +2982,7 @@ OP(op,35) { wm(HL, dec(rm(HL)));
 OP(op,36) { wm(HL, arg());                                                        } /* LD   (HL),n      */
 OP(op,37) { F = (F & (SF | ZF | YF | XF | PF)) | CF | (A & (YF | XF));            } /* SCF              */
 
-OP(op,38) { jr_cond(F & CF, 0x38);                                                } /* JR   C,o         */
+OP(op,38) { jr_cond(flag(CF), 0x38);                                              } /* JR   C,o         */
 OP(op,39) { add16(m_hl, m_sp);                                                    } /* ADD  HL,SP       */
 OP(op,3a) { m_ea = arg16(); A = rm(m_ea); WZ = m_ea + 1;                          } /* LD   A,(w)       */
 OP(op,3b) { SP--;                                                                 } /* DEC  SP          */
@@ -3047,74 +3135,74 @@ OP(op,bd) { cp(L);
 OP(op,be) { cp(rm(HL));                                                           } /* CP   (HL)        */
 OP(op,bf) { cp(A);                                                                } /* CP   A           */
 
-OP(op,c0) { ret_cond(!(F & ZF), 0xc0);                                            } /* RET  NZ          */
+OP(op,c0) { ret_cond(!flag(ZF), 0xc0);                                            } /* RET  NZ          */
 OP(op,c1) { pop(m_bc);                                                            } /* POP  BC          */
-OP(op,c2) { jp_cond(!(F & ZF));                                                   } /* JP   NZ,a        */
+OP(op,c2) { jp_cond(!flag(ZF));                                                   } /* JP   NZ,a        */
 OP(op,c3) { jp();                                                                 } /* JP   a           */
-OP(op,c4) { call_cond(!(F & ZF), 0xc4);                                           } /* CALL NZ,a        */
+OP(op,c4) { call_cond(!flag(ZF), 0xc4);                                           } /* CALL NZ,a        */
 OP(op,c5) { push(m_bc);                                                           } /* PUSH BC          */
 OP(op,c6) { add_a(arg());                                                         } /* ADD  A,n         */
 OP(op,c7) { rst(0x00);                                                            } /* RST  0           */
 
-OP(op,c8) { ret_cond(F & ZF, 0xc8);                                               } /* RET  Z           */
+OP(op,c8) { ret_cond(flag(ZF), 0xc8);                                             } /* RET  Z           */
 OP(op,c9) { pop(m_pc); WZ = PCD;                                                  } /* RET              */
-OP(op,ca) { jp_cond(F & ZF);                                                      } /* JP   Z,a         */
+OP(op,ca) { jp_cond(flag(ZF));                                                    } /* JP   Z,a         */
 OP(op,cb) { m_r++; EXEC(cb,rop());                                                } /* **** CB xx       */
-OP(op,cc) { call_cond(F & ZF, 0xcc);                                              } /* CALL Z,a         */
+OP(op,cc) { call_cond(flag(ZF), 0xcc);                                            } /* CALL Z,a         */
 OP(op,cd) { call();                                                               } /* CALL a           */
 OP(op,ce) { adc_a(arg());                                                         } /* ADC  A,n         */
 OP(op,cf) { rst(0x08);                                                            } /* RST  1           */
 
-OP(op,d0) { ret_cond(!(F & CF), 0xd0);                                            } /* RET  NC          */
+OP(op,d0) { ret_cond(!flag(CF), 0xd0);                                            } /* RET  NC          */
 OP(op,d1) { pop(m_de);                                                            } /* POP  DE          */
-OP(op,d2) { jp_cond(!(F & CF));                                                   } /* JP   NC,a        */
+OP(op,d2) { jp_cond(!flag(CF));                                                   } /* JP   NC,a        */
 OP(op,d3) { unsigned n = arg() | (A << 8); out(n, A); WZ_L = ((n & 0xff) + 1) & 0xff;  WZ_H = A;   } /* OUT  (n),A       */
-OP(op,d4) { call_cond(!(F & CF), 0xd4);                                           } /* CALL NC,a        */
+OP(op,d4) { call_cond(!flag(CF), 0xd4);                                           } /* CALL NC,a        */
 OP(op,d5) { push(m_de);                                                           } /* PUSH DE          */
 OP(op,d6) { sub(arg());                                                           } /* SUB  n           */
 OP(op,d7) { rst(0x10);                                                            } /* RST  2           */
 
-OP(op,d8) { ret_cond(F & CF, 0xd8);                                               } /* RET  C           */
+OP(op,d8) { ret_cond(flag(CF), 0xd8);                                             } /* RET  C           */
 OP(op,d9) { exx();                                                                } /* EXX              */
-OP(op,da) { jp_cond(F & CF);                                                      } /* JP   C,a         */
+OP(op,da) { jp_cond(flag(CF));                                                    } /* JP   C,a         */
 OP(op,db) { unsigned n = arg() | (A << 8); A = in(n); WZ = n + 1;                 } /* IN   A,(n)  */
-OP(op,dc) { call_cond(F & CF, 0xdc);                                              } /* CALL C,a         */
+OP(op,dc) { call_cond(flag(CF), 0xdc);                                            } /* CALL C,a         */
 OP(op,dd) { m_r++; EXEC(dd,rop());                                                } /* **** DD xx       */
 OP(op,de) { sbc_a(arg());                                                         } /* SBC  A,n         */
 OP(op,df) { rst(0x18);                                                            } /* RST  3           */
 
-OP(op,e0) { ret_cond(!(F & PF), 0xe0);                                            } /* RET  PO          */
+OP(op,e0) { ret_cond(!flag(PF), 0xe0);                                            } /* RET  PO          */
 OP(op,e1) { pop(m_hl);                                                            } /* POP  HL          */
-OP(op,e2) { jp_cond(!(F & PF));                                                   } /* JP   PO,a        */
+OP(op,e2) { jp_cond(!flag(PF));                                                   } /* JP   PO,a        */
 OP(op,e3) { ex_sp(m_hl);                                                          } /* EX   HL,(SP)     */
-OP(op,e4) { call_cond(!(F & PF), 0xe4);                                           } /* CALL PO,a        */
+OP(op,e4) { call_cond(!flag(PF), 0xe4);                                           } /* CALL PO,a        */
 OP(op,e5) { push(m_hl);                                                           } /* PUSH HL          */
 OP(op,e6) { and_a(arg());                                                         } /* AND  n           */
 OP(op,e7) { rst(0x20);                                                            } /* RST  4           */
 
-OP(op,e8) { ret_cond(F & PF, 0xe8);                                               } /* RET  PE          */
+OP(op,e8) { ret_cond(flag(PF), 0xe8);                                             } /* RET  PE          */
 OP(op,e9) { PC = HL;                                                              } /* JP   (HL)        */
-OP(op,ea) { jp_cond(F & PF);                                                      } /* JP   PE,a        */
+OP(op,ea) { jp_cond(flag(PF));                                                    } /* JP   PE,a        */
 OP(op,eb) { ex_de_hl();                                                           } /* EX   DE,HL       */
-OP(op,ec) { call_cond(F & PF, 0xec);                                              } /* CALL PE,a        */
+OP(op,ec) { call_cond(flag(PF), 0xec);                                            } /* CALL PE,a        */
 OP(op,ed) { m_r++; EXEC(ed,rop());                                                } /* **** ED xx       */
 OP(op,ee) { xor_a(arg());                                                         } /* XOR  n           */
 OP(op,ef) { rst(0x28);                                                            } /* RST  5           */
 
-OP(op,f0) { ret_cond(!(F & SF), 0xf0);                                            } /* RET  P           */
-OP(op,f1) { pop(m_af);                                                            } /* POP  AF          */
-OP(op,f2) { jp_cond(!(F & SF));                                                   } /* JP   P,a         */
+OP(op,f0) { ret_cond(!flag(SF), 0xf0);                                            } /* RET  P           */
+OP(op,f1) { pop(m_af); m_lazy.clear();                                            } /* POP  AF          */
+OP(op,f2) { jp_cond(!flag(SF));                                                   } /* JP   P,a         */
 OP(op,f3) { m_iff1 = m_iff2 = 0;                                                  } /* DI               */
-OP(op,f4) { call_cond(!(F & SF), 0xf4);                                           } /* CALL P,a         */
-OP(op,f5) { push(m_af);                                                           } /* PUSH AF          */
+OP(op,f4) { call_cond(!flag(SF), 0xf4);                                           } /* CALL P,a         */
+OP(op,f5) { sync_flags(); push(m_af);                                             } /* PUSH AF          */
 OP(op,f6) { or_a(arg());                                                          } /* OR   n           */
 OP(op,f7) { rst(0x30);                                                            } /* RST  6           */
 
-OP(op,f8) { ret_cond(F & SF, 0xf8);                                               } /* RET  M           */
+OP(op,f8) { ret_cond(flag(SF), 0xf8);                                             } /* RET  M           */
 OP(op,f9) { SP = HL;                                                              } /* LD   SP,HL       */
-OP(op,fa) { jp_cond(F & SF);                                                      } /* JP   M,a         */
+OP(op,fa) { jp_cond(flag(SF));                                                    } /* JP   M,a         */
 OP(op,fb) { ei();                                                                 } /* EI               */
-OP(op,fc) { call_cond(F & SF, 0xfc);                                              } /* CALL M,a         */
+OP(op,fc) { call_cond(flag(SF), 0xfc);                                            } /* CALL M,a         */
 OP(op,fd) { m_r++; EXEC(fd,rop());                                                } /* **** FD xx       */
 OP(op,fe) { cp(arg());                                                            } /* CP   n           */
 OP(op,ff) { rst(0x38);                                                            } /* RST  7           */
@@ -3241,52 +3329,6 @@ void z80_device::device_start()
 {
 	if( !tables_initialised )
 	{
-		UINT8 *padd = &SZHVC_add[  0*256];
-		UINT8 *padc = &SZHVC_add[256*256];
-		UINT8 *psub = &SZHVC_sub[  0*256];
-		UINT8 *psbc = &SZHVC_sub[256*256];
-		for (int oldval = 0; oldval < 256; oldval++)
-		{
-			for (int newval = 0; newval < 256; newval++)
-			{
-				/* add or adc w/o carry set */
-				int val = newval - oldval;
-				*padd = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
-				*padd |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
-				if( (newval & 0x0f) < (oldval & 0x0f) ) *padd |= HF;
-				if( newval < oldval ) *padd |= CF;
-				if( (val^oldval^0x80) & (val^newval) & 0x80 ) *padd |= VF;
-				padd++;
-
-				/* adc with carry set */
-				val = newval - oldval - 1;
-				*padc = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
-				*padc |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
-				if( (newval & 0x0f) <= (oldval & 0x0f) ) *padc |= HF;
-				if( newval <= oldval ) *padc |= CF;
-				if( (val^oldval^0x80) & (val^newval) & 0x80 ) *padc |= VF;
-				padc++;
-
-				/* cp, sub or sbc w/o carry set */
-				val = oldval - newval;
-				*psub = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
-				*psub |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
-				if( (newval & 0x0f) > (oldval & 0x0f) ) *psub |= HF;
-				if( newval > oldval ) *psub |= CF;
-				if( (val^oldval) & (oldval^newval) & 0x80 ) *psub |= VF;
-				psub++;
-
-				/* sbc with carry set */
-				val = oldval - newval - 1;
-				*psbc = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
-				*psbc |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
-				if( (newval & 0x0f) >= (oldval & 0x0f) ) *psbc |= HF;
-				if( newval >= oldval ) *psbc |= CF;
-				if( (val^oldval) & (oldval^newval) & 0x80 ) *psbc |= VF;
-				psbc++;
-			}
-		}
-
 		for (int i = 0; i < 256; i++)
 		{
 			int p = 0;
@@ -3303,12 +3345,6 @@ void z80_device::device_start()
 			SZ_BIT[i] = i ? i & SF : ZF | PF;
 			SZ_BIT[i] |= (i & (YF | XF));   /* undocumented flag bits 5+3 */
 			SZP[i] = SZ[i] | ((p & 1) ? 0 : PF);
-			SZHV_inc[i] = SZ[i];
-			if( i == 0x80 ) SZHV_inc[i] |= VF;
-			if( (i & 0x0f) == 0x00 ) SZHV_inc[i] |= HF;
-			SZHV_dec[i] = SZ[i] | NF;
-			if( i == 0x7f ) SZHV_dec[i] |= VF;
-			if( (i & 0x0f) == 0x0f ) SZHV_dec[i] |= HF;
 		}
 
 		tables_initialised = true;
@@ -3348,6 +3384,7 @@ void z80_device::device_start()
 	PCD = 0;
 	SPD = 0;
 	AFD = 0;
+	m_lazy.clear();
 	BCD = 0;
 	DED = 0;
 	HLD = 0;
@@ -3393,7 +3430,7 @@ void z80_device::device_start()
 	state_add(STATE_GENPCBASE, "GENPCBASE", m_prvpc.w.l).noshow();
 	state_add(Z80_SP,          "SP",        SP);
 	state_add(STATE_GENSP,     "GENSP",     SP).noshow();
-	state_add(STATE_GENFLAGS,  "GENFLAGS",  F).noshow().formatstr("%8s");
+	state_add(STATE_GENFLAGS,  "GENFLAGS",  m_af.b.l).noshow().callexport().formatstr("%8s");
 	state_add(Z80_A,           "A",         A).noshow();
 	state_add(Z80_B,           "B",         B).noshow();
 	state_add(Z80_C,           "C",         C).noshow();
@@ -3401,7 +3438,7 @@ void z80_device::device_start()
 	state_add(Z80_E,           "E",         E).noshow();
 	state_add(Z80_H,           "H",         H).noshow();
 	state_add(Z80_L,           "L",         L).noshow();
-	state_add(Z80_AF,          "AF",        AF);
+	state_add(Z80_AF,          "AF",        AF).callimport().callexport();
 	state_add(Z80_BC,          "BC",        BC);
 	state_add(Z80_DE,          "DE",        DE);
 	state_add(Z80_HL,          "HL",        HL);
@@ -3429,6 +3466,30 @@ void z80_device::device_start()
 	m_cc_xy = cc_xy;
 	m_cc_xycb = cc_xycb;
 	m_cc_ex = cc_ex;
+
+	if (machine().options().predecode())
+		m_predecode = auto_alloc(machine(), z80_predecode_cache(*m_decrypted_opcodes_direct));
+}
+
+void z80_device::device_stop()
+{
+	if (m_predecode != NULL)
+	{
+		const predecode_stats &stats = m_predecode->stats();
+		UINT64 total = stats.hits + stats.decodes + stats.redecodes + stats.uncached;
+		osd_printf_verbose("%s: pre-decoded %d instructions (%d redecoded, %d pages remapped), %d%% of %d executed from the cache\n", tag(),
+				(int)stats.decodes, (int)stats.redecodes, (int)stats.remaps, total ? (int)(stats.hits * 100 / total) : 0, (int)total);
+	}
+}
+
+void z80_device::device_pre_save()
+{
+	sync_flags();
+}
+
+void z80_device::device_post_load()
+{
+	m_lazy.clear();
 }
 
 void nsc800_device::device_start()
@@ -3491,6 +3552,21 @@ void z80_device::execute_run()
 		m_nmi_pending = FALSE;
 	}
 
+	/* only pay for the debugger hook when it has something to do */
+	if (debugger_instruction_hook_armed(this))
+		execute_loop<true>();
+	else if (m_predecode != NULL)
+		execute_predecoded();
+	else
+		execute_loop<false>();
+
+	/* leave F current for anyone looking at it between timeslices */
+	sync_flags();
+}
+
+template<bool Debugger>
+void z80_device::execute_loop()
+{
 	do
 	{
 		/* check for IRQs before each instruction */
@@ -3506,12 +3582,150 @@ void z80_device::execute_run()
 		m_after_ldair = FALSE;
 
 		PRVPC = PCD;
-		debugger_instruction_hook(this, PCD);
+		if (Debugger)
+			debugger_instruction_hook(this, PCD);
 		m_r++;
 		EXEC(op,rop());
 	} while (m_icount > 0);
 }
 
+/****************************************************************************
+ * Decode the instruction at pc into a cache entry, following the same
+ * prefix chain the interpreter does
+ ****************************************************************************/
+void z80_device::predecode(const z80_predecode_cache::page &page, offs_t pc, z80_predecoded &entry)
+{
+	z80_predecode_cache &cache = *m_predecode;
+
+	entry.handler = (Z80_PD_SLOW << 8);
+	entry.length = 1;
+	entry.disp = 0;
+
+	/* if the opcode itself is not where the page says, interpret it every time */
+	if (!cache.is_linear(page, pc, 1))
+	{
+		entry.raw = cache.fetch(page, pc, 1);
+		return;
+	}
+
+	UINT8 op = cache.fetch(page, pc, 1);
+	entry.handler = (Z80_PD_OP << 8) | op;
+	if (op == 0xcb || op == 0xed || op == 0xdd || op == 0xfd)
+	{
+		/* prefixes need their second byte in the same page */
+		if (!cache.is_linear(page, pc, 2))
+			entry.handler = (Z80_PD_SLOW << 8);
+		else
+		{
+			UINT8 op2 = cache.fetch(page, pc + 1, 1);
+			entry.length = 2;
+			switch (op)
+			{
+				case 0xcb:  entry.handler = (Z80_PD_CB << 8) | op2; break;
+				case 0xed:  entry.handler = (Z80_PD_ED << 8) | op2; break;
+				case 0xdd:  entry.handler = (Z80_PD_DD << 8) | op2; break;
+				case 0xfd:  entry.handler = (Z80_PD_FD << 8) | op2; break;
+			}
+
+			/* DD CB d xx fetches its last two bytes as arguments; only resolve it */
+			/* here if those come from the same place as the opcodes */
+			if ((op == 0xdd || op == 0xfd) && op2 == 0xcb && m_direct == m_decrypted_opcodes_direct && cache.is_linear(page, pc, 4))
+			{
+				entry.length = 4;
+				entry.disp = (INT8)cache.fetch(page, pc + 2, 1);
+				entry.handler = ((op == 0xdd ? Z80_PD_DDCB : Z80_PD_FDCB) << 8) | cache.fetch(page, pc + 3, 1);
+			}
+		}
+	}
+	entry.raw = cache.fetch(page, pc, entry.length);
+}
+
+/****************************************************************************
+ * Execute from pre-decoded code; the same as execute_loop<false> except
+ * that prefix chains are resolved once per address
+ ****************************************************************************/
+void z80_device::execute_predecoded()
+{
+	z80_predecode_cache &cache = *m_predecode;
+	predecode_stats &stats = cache.stats();
+
+#if PREDECODE_COMPUTED_GOTO
+	static void *const s_handlers[] =
+	{
+		PD_EACH(PD_ADDRESS, op)
+		PD_EACH(PD_ADDRESS, cb)
+		PD_EACH(PD_ADDRESS, ed)
+		PD_EACH(PD_ADDRESS, dd)
+		PD_EACH(PD_ADDRESS, fd)
+		PD_EACH(PD_DDCB_ADDRESS, xycb)
+		PD_EACH(PD_FDCB_ADDRESS, xycb)
+		&&pd_slow
+	};
+#endif
+
+	do
+	{
+		/* check for IRQs before each instruction */
+		if (m_irq_state != CLEAR_LINE && m_iff1 && !m_after_ei)
+		{
+#if HAS_LDAIR_QUIRK
+			/* reset parity flag after LD A,I or LD A,R */
+			if (m_after_ldair) F &= ~PF;
+#endif
+			take_interrupt();
+		}
+		m_after_ei = FALSE;
+		m_after_ldair = FALSE;
+
+		PRVPC = PCD;
+
+		/* find the entry, decoding it if it is new or its bytes have changed */
+		z80_predecode_cache::page *page = cache.find(PCD);
+		if (page == NULL)
+		{
+			stats.uncached++;
+			m_r++;
+			EXEC(op,rop());
+			continue;
+		}
+		z80_predecoded *entry = &page->entry[PCD & z80_predecode_cache::PAGE_MASK];
+		if (UNEXPECTED(entry->length == 0))
+		{
+			predecode(*page, PCD, *entry);
+			stats.decodes++;
+		}
+		else if (UNEXPECTED(!cache.verify(*page, PCD, entry->raw, entry->length)))
+		{
+			predecode(*page, PCD, *entry);
+			stats.redecodes++;
+		}
+		else
+			stats.hits++;
+
+#if PREDECODE_COMPUTED_GOTO
+		goto *s_handlers[entry->handler];
+#endif
+		switch (entry->handler)
+		{
+			PD_EACH(PD_OP, op)
+			PD_EACH(PD_CB, cb)
+			PD_EACH(PD_ED, ed)
+			PD_EACH(PD_DD, dd)
+			PD_EACH(PD_FD, fd)
+			PD_EACH(PD_DDCB, xycb)
+			PD_EACH(PD_FDCB, xycb)
+
+			case Z80_PD_SLOW << 8:
+#if PREDECODE_COMPUTED_GOTO
+			pd_slow:
+#endif
+				m_r++;
+				EXEC(op,rop());
+				continue;
+		}
+	} while (m_icount > 0);
+}
+
 void nsc800_device::execute_run()
 {
 	/* check for NMIs on the way in; they can only be set externally */
@@ -3531,6 +3745,18 @@ void nsc800_device::execute_run()
 		m_nmi_pending = FALSE;
 	}
 
+	if (debugger_instruction_hook_armed(this))
+		execute_loop<true>();
+	else
+		execute_loop<false>();
+
+	/* leave F current for anyone looking at it between timeslices */
+	sync_flags();
+}
+
+template<bool Debugger>
+void nsc800_device::execute_loop()
+{
 	do
 	{
 		/* check for NSC800 IRQs line RSTA, RSTB, RSTC */
@@ -3544,7 +3770,8 @@ void nsc800_device::execute_run()
 		m_after_ei = FALSE;
 
 		PRVPC = PCD;
-		debugger_instruction_hook(this, PCD);
+		if (Debugger)
+			debugger_instruction_hook(this, PCD);
 		m_r++;
 		EXEC(op,rop());
 	} while (m_icount > 0);
@@ -3637,6 +3864,10 @@ void z80_device::state_import( const device_state_entry &entry )
 			m_r2 = m_rtemp & 0x80;
 			break;
 
+		case Z80_AF:
+			m_lazy.clear();
+			break;
+
 		default:
 			fatalerror("CPU_IMPORT_STATE() called for unexpected value\n");
 	}
@@ -3651,6 +3882,11 @@ void z80_device::state_export( const device_state_entry &entry )
 			m_rtemp = (m_r & 0x7f) | (m_r2 & 0x80);
 			break;
 
+		case Z80_AF:
+		case STATE_GENFLAGS:
+			sync_flags();
+			break;
+
 		default:
 			fatalerror("CPU_EXPORT_STATE() called for unexpected value\n");
 	}
@@ -3705,7 +3941,8 @@ z80_device::z80_device(const machine_config &mconfig, const char *tag, device_t
 	cpu_device(mconfig, Z80, "Z80", tag, owner, clock, "z80", __FILE__),
 	m_program_config("program", ENDIANNESS_LITTLE, 8, 16, 0),
 	m_decrypted_opcodes_config("decrypted_opcodes", ENDIANNESS_LITTLE, 8, 16, 0),
-	m_io_config("io", ENDIANNESS_LITTLE, 8, 16, 0)
+	m_io_config("io", ENDIANNESS_LITTLE, 8, 16, 0),
+	m_predecode(NULL)
 {
 }
 
@@ -3713,7 +3950,8 @@ z80_device::z80_device(const machine_config &mconfig, device_type type, const ch
 	cpu_device(mconfig, type, name, tag, owner, clock, shortname, source),
 	m_program_config("program", ENDIANNESS_LITTLE, 8, 16, 0),
 	m_decrypted_opcodes_config("decrypted_opcodes", ENDIANNESS_LITTLE, 8, 16, 0),
-	m_io_config("io", ENDIANNESS_LITTLE, 8, 16, 0)
+	m_io_config("io", ENDIANNESS_LITTLE, 8, 16, 0),
+	m_predecode(NULL)
 {
 }
 
@@ -6,6 +6,8 @@
 #define __Z80_H__
 
 #include "z80daisy.h"
+#include "cpu/predecode.h"
+#include "z80flags.h"
 
 enum
 {
@@ -30,6 +32,17 @@ enum
 	Z80_GENPCBASE = STATE_GENPCBASE
 };
 
+/* a pre-decoded instruction: the handler to run and the bytes it was decoded from */
+struct z80_predecoded
+{
+	UINT16          handler;        /* handler group << 8 | final opcode byte */
+	UINT8           length;         /* opcode bytes consumed before the handler runs, 0 if not decoded */
+	INT8            disp;           /* displacement for DD CB / FD CB */
+	UINT32          raw;            /* the opcode bytes, first byte in the low bits */
+};
+
+typedef predecode_cache<z80_predecoded> z80_predecode_cache;
+
 class z80_device : public cpu_device
 {
 public:
@@ -45,6 +58,9 @@ protected:
 	// device-level overrides
 	virtual void device_start();
 	virtual void device_reset();
+	virtual void device_stop();
+	virtual void device_pre_save();
+	virtual void device_post_load();
 
 	// device_execute_interface overrides
 	virtual UINT32 execute_min_cycles() const { return 2; }
@@ -53,6 +69,9 @@ protected:
 	virtual UINT32 execute_default_irq_vector() const { return 0xff; }
 	virtual void execute_run();
 	virtual void execute_set_input(int inputnum, int state);
+	template<bool Debugger> void execute_loop();
+	void execute_predecoded();
+	void predecode(const z80_predecode_cache::page &page, offs_t pc, z80_predecoded &entry);
 
 	// device_memory_interface overrides
 	virtual const address_space_config *memory_space_config(address_spacenum spacenum = AS_0) const;
@@ -144,6 +163,10 @@ protected:
 	PROTOTYPES(fd)
 	PROTOTYPES(xycb)
 
+	void sync_flags();
+	UINT8 &flags();
+	UINT8 carry();
+	bool flag(UINT8 mask);
 	void halt();
 	void leave_halt();
 	UINT8 in(UINT16 port);
@@ -269,6 +292,7 @@ protected:
 	int             m_busrq_state;        // bus request line state
 	UINT8           m_after_ei;           /* are we in the EI shadow? */
 	UINT8           m_after_ldair;        /* same, but for LD A,I or LD A,R */
+	lazy_flags      m_lazy;               /* last ALU op, while F is out of date */
 	UINT32          m_ea;
 	device_irq_acknowledge_delegate m_irq_callback;
 
@@ -281,6 +305,8 @@ protected:
 	const UINT8 *   m_cc_xy;
 	const UINT8 *   m_cc_xycb;
 	const UINT8 *   m_cc_ex;
+
+	z80_predecode_cache *m_predecode;     /* pre-decoded code, if enabled */
 };
 
 extern const device_type Z80;
@@ -299,6 +325,7 @@ protected:
 	virtual UINT32 execute_input_lines() const { return 7; }
 	virtual void execute_run();
 	virtual void execute_set_input(int inputnum, int state);
+	template<bool Debugger> void execute_loop();
 
 	void take_interrupt_nsc800();
 	UINT8 m_nsc800_irq_state[4]; /* state of NSC800 restart interrupts A, B, C */
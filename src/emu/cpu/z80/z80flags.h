@@ -0,0 +1,93 @@
+// license:BSD-3-Clause
+// copyright-holders:Juergen Buchmueller
+/***************************************************************************
+
+    z80flags.h
+
+    Lazily evaluated Z80 ALU flags, shared by the core and its tests.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __Z80FLAGS_H__
+#define __Z80FLAGS_H__
+
+#include "cpu/lazyflags.h"
+
+
+/* variants of the recorded operations; the low bits select the flavour, */
+/* the top bit holds the carry that INC and DEC leave alone */
+enum
+{
+	Z80_LAZY_ARITH = 0,     /* ADD, ADC, SUB, SBC, NEG */
+	Z80_LAZY_CP,            /* CP: undocumented bits 5+3 come from the operand */
+	Z80_LAZY_AND,           /* AND: H is set */
+	Z80_LAZY_OR,            /* OR and XOR */
+	Z80_LAZY_INCDEC,        /* INC and DEC: C is preserved */
+
+	Z80_LAZY_KIND_MASK = 0x7f,
+	Z80_LAZY_CARRY = 0x80
+};
+
+
+/*-------------------------------------------------
+    z80_lazy_carry - return the carry flag the
+    recorded operation leaves behind
+-------------------------------------------------*/
+
+inline UINT8 z80_lazy_carry(const lazy_flags &lazy)
+{
+	if ((lazy.variant() & Z80_LAZY_KIND_MASK) == Z80_LAZY_INCDEC)
+		return lazy.variant() >> 7;
+	return lazy.carry();
+}
+
+
+/*-------------------------------------------------
+    z80_lazy_flags - build the F register the
+    recorded operation leaves behind; bit for bit
+    what the SZHVC and SZ tables give
+-------------------------------------------------*/
+
+inline UINT8 z80_lazy_flags(const lazy_flags &lazy)
+{
+	UINT8 res = lazy.result();
+	int kind = lazy.variant() & Z80_LAZY_KIND_MASK;
+
+	/* S, Z, and the undocumented bits 5+3 */
+	UINT8 f = res ? (res & 0x80) : 0x40;
+	f |= ((kind == Z80_LAZY_CP) ? lazy.src() : res) & 0x28;
+
+	if (lazy.op() == LAZY_FLAGS_LOGIC)
+	{
+		if (lazy.parity()) f |= 0x04;
+		if (kind == Z80_LAZY_AND) f |= 0x10;
+		return f;
+	}
+
+	if (lazy.op() == LAZY_FLAGS_SUB) f |= 0x02;
+	if (lazy.half()) f |= 0x10;
+	if (lazy.overflow()) f |= 0x04;
+	return f | z80_lazy_carry(lazy);
+}
+
+
+/*-------------------------------------------------
+    z80_lazy_flag - test a single flag of the
+    recorded operation without building all of F
+-------------------------------------------------*/
+
+inline bool z80_lazy_flag(const lazy_flags &lazy, UINT8 mask)
+{
+	switch (mask)
+	{
+		case 0x01:  return z80_lazy_carry(lazy);
+		case 0x04:  return (lazy.op() == LAZY_FLAGS_LOGIC) ? lazy.parity() : lazy.overflow();
+		case 0x40:  return lazy.zero();
+		case 0x80:  return lazy.sign();
+		default:    return (z80_lazy_flags(lazy) & mask) != 0;
+	}
+}
+
+#endif /* __Z80FLAGS_H__ */
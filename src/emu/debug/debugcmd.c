@@ -141,6 +141,7 @@ static void execute_find(running_machine &machine, int ref, int params, const ch
 static void execute_trace(running_machine &machine, int ref, int params, const char **param);
 static void execute_traceover(running_machine &machine, int ref, int params, const char **param);
 static void execute_traceflush(running_machine &machine, int ref, int params, const char **param);
+static void execute_lockstep(running_machine &machine, int ref, int params, const char **param);
 static void execute_history(running_machine &machine, int ref, int params, const char **param);
 static void execute_trackpc(running_machine &machine, int ref, int params, const char **param);
 static void execute_trackmem(running_machine &machine, int ref, int params, const char **param);
@@ -373,6 +374,9 @@ void debug_command_init(running_machine &machine)
 	debug_console_register_command(machine, "traceover", CMDFLAG_NONE, 0, 1, 3, execute_traceover);
 	debug_console_register_command(machine, "traceflush",CMDFLAG_NONE, 0, 0, 0, execute_traceflush);
 
+	debug_console_register_command(machine, "lockrecord", CMDFLAG_NONE, 0, 1, 3, execute_lockstep);
+	debug_console_register_command(machine, "lockcompare",CMDFLAG_NONE, 1, 1, 3, execute_lockstep);
+
 	debug_console_register_command(machine, "history",   CMDFLAG_NONE, 0, 0, 2, execute_history);
 	debug_console_register_command(machine, "trackpc",   CMDFLAG_NONE, 0, 0, 3, execute_trackpc);
 
@@ -2642,6 +2646,62 @@ static void execute_traceflush(running_machine &machine, int ref, int params, co
 }
 
 
+/*-------------------------------------------------
+    execute_lockstep - execute the lockrecord and
+    lockcompare commands
+-------------------------------------------------*/
+
+static void execute_lockstep(running_machine &machine, int ref, int params, const char *param[])
+{
+	device_t *cpu;
+	FILE *f = NULL;
+	bool per_slice = false;
+	std::string filename = param[0];
+
+	/* replace macros */
+	strreplace(filename, "{game}", machine.basename());
+
+	/* validate parameters */
+	if (!debug_command_parameter_cpu(machine, (params > 1) ? param[1] : NULL, &cpu))
+		return;
+	if (cpu->debug() == NULL || dynamic_cast<device_state_interface *>(cpu) == NULL || dynamic_cast<device_execute_interface *>(cpu) == NULL)
+	{
+		debug_console_printf(machine, "CPU '%s' has no state to check\n", cpu->tag());
+		return;
+	}
+	if (params > 2)
+	{
+		if (core_stricmp(param[2], "slice") == 0)
+			per_slice = true;
+		else if (core_stricmp(param[2], "insn") != 0)
+		{
+			debug_console_printf(machine, "Invalid granularity '%s'; use 'insn' or 'slice'\n", param[2]);
+			return;
+		}
+	}
+
+	/* open the file */
+	if (core_stricmp(filename.c_str(), "off") != 0)
+	{
+		f = fopen(filename.c_str(), ref ? "rb" : "wb");
+		if (!f)
+		{
+			debug_console_printf(machine, "Error opening file '%s'\n", param[0]);
+			return;
+		}
+	}
+
+	/* do it */
+	cpu->debug()->lockstep(f, ref != 0, per_slice);
+	if (f == NULL)
+		debug_console_printf(machine, "Stopped lockstep checking on CPU '%s'\n", cpu->tag());
+	else if (ref)
+		debug_console_printf(machine, "Comparing CPU '%s' against %s each %s\n", cpu->tag(), filename.c_str(), per_slice ? "timeslice" : "instruction");
+	else
+		debug_console_printf(machine, "Recording CPU '%s' state to %s each %s\n", cpu->tag(), filename.c_str(), per_slice ? "timeslice" : "instruction");
+}
+
+
 /*-------------------------------------------------
     execute_history - execute the history command
 -------------------------------------------------*/
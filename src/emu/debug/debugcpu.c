@@ -1620,6 +1620,7 @@ device_debug::device_debug(device_t &device)
 		m_bplist(NULL),
 		m_rplist(NULL),
 		m_trace(NULL),
+		m_lockstep(NULL),
 		m_hotspot_threshhold(0),
 		m_track_pc_set(),
 		m_track_pc(false),
@@ -1687,6 +1688,7 @@ device_debug::device_debug(device_t &device)
 device_debug::~device_debug()
 {
 	auto_free(m_device.machine(), m_trace);
+	auto_free(m_device.machine(), m_lockstep);
 
 	// free breakpoints and watchpoints
 	breakpoint_clear_all();
@@ -1733,7 +1735,7 @@ void device_debug::start_hook(const attotime &endtime)
 		}
 
 		// check for pending breaks
-		else if (&m_device == global->breakcpu)
+		if (&m_device == global->breakcpu)
 		{
 			global->execution_state = EXECUTION_STATE_STOPPED;
 			global->breakcpu = NULL;
@@ -1772,6 +1774,16 @@ void device_debug::stop_hook()
 
 	assert(global->livecpu == &m_device);
 
+	// the timeslice is over, so there is nothing left to rearm
+	m_flags &= ~DEBUG_FLAG_UNHOOKED;
+
+	// check against the reference at the end of each timeslice
+	if (m_lockstep != NULL && m_lockstep->per_slice() && m_state != NULL && !m_lockstep->update(m_state->pc()))
+	{
+		global->execution_state = EXECUTION_STATE_STOPPED;
+		compute_debug_flags();
+	}
+
 	// clear the live CPU
 	global->livecpu = NULL;
 }
@@ -1846,6 +1858,10 @@ void device_debug::instruction_hook(offs_t curpc)
 	if (m_trace != NULL)
 		m_trace->update(curpc);
 
+	// are we checking against a lockstep reference?
+	if (m_lockstep != NULL && !m_lockstep->per_slice() && !m_lockstep->update(curpc))
+		global->execution_state = EXECUTION_STATE_STOPPED;
+
 	// per-instruction hook?
 	if (global->execution_state != EXECUTION_STATE_STOPPED && (m_flags & DEBUG_FLAG_HOOKED) != 0 && (*m_instrhook)(m_device, curpc))
 		global->execution_state = EXECUTION_STATE_STOPPED;
@@ -2766,6 +2782,24 @@ void device_debug::trace(FILE *file, bool trace_over, const char *action)
 }
 
 
+//-------------------------------------------------
+//  lockstep - record or compare the state of a
+//  given device against a lockstep file
+//-------------------------------------------------
+
+void device_debug::lockstep(FILE *file, bool compare, bool per_slice)
+{
+	// delete any existing checker
+	auto_free(m_device.machine(), m_lockstep);
+	m_lockstep = NULL;
+
+	// if we have a new file, make a new checker
+	if (file != NULL)
+		m_lockstep = auto_alloc(m_device.machine(), lockstep_checker(*this, *file, compare, per_slice));
+	compute_debug_flags();
+}
+
+
 //-------------------------------------------------
 //  trace_printf - output data into the given
 //  device's tracefile, if tracing
@@ -2805,18 +2839,54 @@ void device_debug::compute_debug_flags()
 	if (global->execution_state == EXECUTION_STATE_STOPPED)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
-	// if we're tracking history, or we're hooked, or stepping, or stopping at a breakpoint
-	// make sure we call the hook
-	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	// if we're hooked, or stepping, or stopping at a breakpoint make sure we call the hook;
+	// PC history alone doesn't need it, and is only kept while the hook is being called
+	if ((m_flags & (DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
-	// also call if we are tracing
-	if (m_trace != NULL)
+	// PC and memory tracking need every instruction
+	if (m_track_pc || m_track_mem)
+		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+
+	// also call if we are tracing or checking each instruction in lockstep
+	if (m_trace != NULL || (m_lockstep != NULL && !m_lockstep->per_slice()))
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
 	// if we are stopping at a particular time and that time is within the current timeslice, we need to be called
 	if ((m_flags & DEBUG_FLAG_STOP_TIME) && m_endexectime <= m_stoptime)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+
+	// a CPU running its hook-free loop won't notice; make it start a new timeslice
+	if ((machine.debug_flags & DEBUG_FLAG_CALL_HOOK) != 0 && global->livecpu != NULL)
+		global->livecpu->debug()->rearm_instruction_hook();
+}
+
+
+//-------------------------------------------------
+//  rearm_instruction_hook - called when the
+//  instruction hook is needed while this CPU is
+//  executing a timeslice without calling it
+//-------------------------------------------------
+
+void device_debug::rearm_instruction_hook()
+{
+	debugcpu_private *global = m_device.machine().debugcpu_data;
+
+	// nothing to do if the CPU core is calling the hook
+	if ((m_flags & DEBUG_FLAG_UNHOOKED) == 0)
+		return;
+	m_flags &= ~DEBUG_FLAG_UNHOOKED;
+
+	// any stop has to happen on this CPU, so defer it until it starts its next timeslice;
+	// otherwise the next CPU to execute would be the first to see it
+	if (global->execution_state == EXECUTION_STATE_STOPPED)
+	{
+		global->execution_state = EXECUTION_STATE_RUNNING;
+		global->breakcpu = &m_device;
+	}
+
+	// end the timeslice after the current instruction, so the next one starts hooked
+	m_exec->abort_timeslice();
 }
 
 
@@ -3535,6 +3605,216 @@ void device_debug::tracer::flush()
 }
 
 
+//**************************************************************************
+//  LOCKSTEP CHECKER
+//**************************************************************************
+
+// a lockstep file starts with a magic number and the list of state symbols
+// being captured; each checkpoint then holds the total cycle count, the PC
+// and one 64-bit value per symbol, all in host byte order
+static const char LOCKSTEP_MAGIC[8] = { 'M', 'A', 'M', 'E', 'L', 'K', 'S', '1' };
+
+//-------------------------------------------------
+//  lockstep_checker - constructor
+//-------------------------------------------------
+
+device_debug::lockstep_checker::lockstep_checker(device_debug &debug, FILE &file, bool compare, bool per_slice)
+	: m_debug(debug),
+		m_file(file),
+		m_compare(compare),
+		m_per_slice(per_slice),
+		m_active(true),
+		m_steps(0)
+{
+	if (m_compare)
+		m_active = read_header();
+	else
+		write_header();
+}
+
+
+//-------------------------------------------------
+//  ~lockstep_checker - destructor
+//-------------------------------------------------
+
+device_debug::lockstep_checker::~lockstep_checker()
+{
+	// make sure we close the file if we can
+	fclose(&m_file);
+}
+
+
+//-------------------------------------------------
+//  write_header - capture the list of visible
+//  state entries and write it out
+//-------------------------------------------------
+
+void device_debug::lockstep_checker::write_header()
+{
+	// the same entries the state view shows
+	for (const device_state_entry *entry = m_debug.m_state->state_first(); entry != NULL; entry = entry->next())
+		if (entry->visible() && !entry->divider())
+		{
+			m_index.push_back(entry->index());
+			m_symbol.push_back(entry->symbol());
+		}
+
+	UINT32 count = m_index.size();
+	fwrite(LOCKSTEP_MAGIC, sizeof(LOCKSTEP_MAGIC), 1, &m_file);
+	fwrite(&count, sizeof(count), 1, &m_file);
+	for (UINT32 col = 0; col < count; col++)
+	{
+		UINT8 length = MIN(m_symbol[col].length(), 255);
+		fwrite(&length, sizeof(length), 1, &m_file);
+		fwrite(m_symbol[col].c_str(), length, 1, &m_file);
+	}
+}
+
+
+//-------------------------------------------------
+//  read_header - read the reference symbol list
+//  and match it up against our own state
+//-------------------------------------------------
+
+bool device_debug::lockstep_checker::read_header()
+{
+	running_machine &machine = m_debug.m_device.machine();
+
+	// validate the magic number
+	char magic[sizeof(LOCKSTEP_MAGIC)];
+	UINT32 count;
+	if (fread(magic, sizeof(magic), 1, &m_file) != 1 || memcmp(magic, LOCKSTEP_MAGIC, sizeof(magic)) != 0 || fread(&count, sizeof(count), 1, &m_file) != 1)
+	{
+		debug_console_printf(machine, "Lockstep file is not a valid reference\n");
+		return false;
+	}
+
+	// match each reference column by symbol, so cores with slightly different state can still be compared
+	for (UINT32 col = 0; col < count; col++)
+	{
+		UINT8 length;
+		char symbol[256];
+		if (fread(&length, sizeof(length), 1, &m_file) != 1 || (length != 0 && fread(symbol, length, 1, &m_file) != 1))
+		{
+			debug_console_printf(machine, "Lockstep file is truncated\n");
+			return false;
+		}
+		symbol[length] = 0;
+
+		int index = -1;
+		for (const device_state_entry *entry = m_debug.m_state->state_first(); entry != NULL; entry = entry->next())
+			if (!entry->divider() && strcmp(entry->symbol(), symbol) == 0)
+			{
+				index = entry->index();
+				break;
+			}
+		if (index == -1)
+			debug_console_printf(machine, "Lockstep: CPU '%s' has no '%s' register; ignoring it\n", m_debug.m_device.tag(), symbol);
+		m_index.push_back(index);
+		m_symbol.push_back(symbol);
+	}
+	m_reference.resize(count);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  read_record - read the next checkpoint from
+//  the reference file
+//-------------------------------------------------
+
+bool device_debug::lockstep_checker::read_record(UINT64 &cycles, UINT32 &pc)
+{
+	if (fread(&cycles, sizeof(cycles), 1, &m_file) != 1 || fread(&pc, sizeof(pc), 1, &m_file) != 1)
+		return false;
+	return m_reference.empty() || fread(&m_reference[0], sizeof(m_reference[0]), m_reference.size(), &m_file) == m_reference.size();
+}
+
+
+//-------------------------------------------------
+//  update - record or check one checkpoint;
+//  returns false on the first divergence
+//-------------------------------------------------
+
+bool device_debug::lockstep_checker::update(offs_t pc)
+{
+	if (!m_active)
+		return true;
+
+	UINT64 cycles = m_debug.m_exec->total_cycles();
+
+	// capturing is just a dump of the current state
+	if (!m_compare)
+	{
+		UINT32 pc32 = pc;
+		fwrite(&cycles, sizeof(cycles), 1, &m_file);
+		fwrite(&pc32, sizeof(pc32), 1, &m_file);
+		for (int col = 0; col < m_index.size(); col++)
+		{
+			UINT64 value = m_debug.m_state->state_int(m_index[col]);
+			fwrite(&value, sizeof(value), 1, &m_file);
+		}
+		m_steps++;
+		return true;
+	}
+
+	// fetch the matching reference checkpoint; at timeslice granularity the two
+	// implementations may stop in different places, so skip to the same cycle
+	UINT64 refcycles;
+	UINT32 refpc;
+	do
+	{
+		if (!read_record(refcycles, refpc))
+		{
+			debug_console_printf(m_debug.m_device.machine(), "Lockstep reference for CPU '%s' ended after %d checkpoints with no divergence\n", m_debug.m_device.tag(), (int)m_steps);
+			m_active = false;
+			return true;
+		}
+	} while (m_per_slice && refcycles < cycles);
+
+	// compare everything
+	bool match = (refcycles == cycles && refpc == pc);
+	for (int col = 0; match && col < m_index.size(); col++)
+		if (m_index[col] != -1 && m_debug.m_state->state_int(m_index[col]) != m_reference[col])
+			match = false;
+
+	if (!match)
+	{
+		report_divergence(pc, cycles, refpc, refcycles);
+		m_active = false;
+		return false;
+	}
+	m_steps++;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  report_divergence - print the differences
+//  between our state and the reference
+//-------------------------------------------------
+
+void device_debug::lockstep_checker::report_divergence(offs_t pc, UINT64 cycles, UINT32 refpc, UINT64 refcycles)
+{
+	running_machine &machine = m_debug.m_device.machine();
+	int logaddrchars = m_debug.logaddrchars();
+
+	debug_console_printf(machine, "Lockstep divergence on CPU '%s' after %d checkpoints:\n", m_debug.m_device.tag(), (int)m_steps);
+	if (refpc != pc)
+		debug_console_printf(machine, "  PC: expected %0*X, got %0*X\n", logaddrchars, refpc, logaddrchars, pc);
+	if (refcycles != cycles)
+		debug_console_printf(machine, "  totalcycles: expected %s, got %s\n", core_i64_hex_format(refcycles, 1), core_i64_hex_format(cycles, 1));
+	for (int col = 0; col < m_index.size(); col++)
+		if (m_index[col] != -1)
+		{
+			UINT64 value = m_debug.m_state->state_int(m_index[col]);
+			if (value != m_reference[col])
+				debug_console_printf(machine, "  %s: expected %s, got %s\n", m_symbol[col].c_str(), core_i64_hex_format(m_reference[col], 1), core_i64_hex_format(value, 1));
+		}
+}
+
+
+
 //-------------------------------------------------
 //  dasm_pc_tag - constructor
 //-------------------------------------------------
@@ -183,6 +183,7 @@ public:
 	void interrupt_hook(int irqline);
 	void exception_hook(int exception);
 	void instruction_hook(offs_t curpc);
+	void instruction_hook_skipped() { m_flags |= DEBUG_FLAG_UNHOOKED; }
 	void memory_read_hook(address_space &space, offs_t address, UINT64 mem_mask);
 	void memory_write_hook(address_space &space, offs_t address, UINT64 data, UINT64 mem_mask);
 
@@ -270,6 +271,10 @@ public:
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != NULL) m_trace->flush(); }
 
+	// lockstep differential testing
+	void lockstep(FILE *file, bool compare, bool per_slice);
+	bool lockstep_active() const { return (m_lockstep != NULL); }
+
 	void reset_transient_flag() { m_flags &= ~DEBUG_FLAG_TRANSIENT; }
 
 	static const int HISTORY_SIZE = 256;
@@ -277,6 +282,7 @@ public:
 private:
 	// internal helpers
 	void compute_debug_flags();
+	void rearm_instruction_hook();
 	void prepare_for_step_overout(offs_t pc);
 	UINT32 dasm_wrapped(std::string &buffer, offs_t pc);
 
@@ -362,6 +368,34 @@ private:
 	};
 	tracer *                m_trace;                    // tracer state
 
+	// lockstep differential testing
+	class lockstep_checker
+	{
+	public:
+		lockstep_checker(device_debug &debug, FILE &file, bool compare, bool per_slice);
+		~lockstep_checker();
+
+		bool per_slice() const { return m_per_slice; }
+		bool update(offs_t pc);
+
+	private:
+		void write_header();
+		bool read_header();
+		bool read_record(UINT64 &cycles, UINT32 &pc);
+		void report_divergence(offs_t pc, UINT64 cycles, UINT32 refpc, UINT64 refcycles);
+
+		device_debug &      m_debug;                    // reference to our owner
+		FILE &              m_file;                     // reference or capture file
+		bool                m_compare;                  // true if comparing against the file
+		bool                m_per_slice;                // true if checking only at timeslice ends
+		bool                m_active;                   // false once the file ends or we diverge
+		UINT64              m_steps;                    // number of checkpoints so far
+		std::vector<int>    m_index;                    // state index per column, or -1 if missing
+		std::vector<std::string> m_symbol;              // symbol per column
+		std::vector<UINT64> m_reference;                // values read from the reference
+	};
+	lockstep_checker *      m_lockstep;                 // lockstep state
+
 	// hotspots
 	struct hotspot_entry
 	{
@@ -449,6 +483,7 @@ private:
 	static const UINT32 DEBUG_FLAG_STOP_VBLANK      = 0x00001000;       // there is a pending stop on the next VBLANK
 	static const UINT32 DEBUG_FLAG_STOP_TIME        = 0x00002000;       // there is a pending stop at cpu->stoptime
 	static const UINT32 DEBUG_FLAG_LIVE_BP          = 0x00010000;       // there are live breakpoints for this CPU
+	static const UINT32 DEBUG_FLAG_UNHOOKED         = 0x00020000;       // CPU is running a timeslice without instruction hooks
 
 	static const UINT32 DEBUG_FLAG_STEPPING_ANY     = DEBUG_FLAG_STEPPING | DEBUG_FLAG_STEPPING_OVER | DEBUG_FLAG_STEPPING_OUT;
 	static const UINT32 DEBUG_FLAG_TRACING_ANY      = DEBUG_FLAG_TRACING | DEBUG_FLAG_TRACING_OVER;
@@ -143,6 +143,8 @@ static const help_item static_help_list[] =
 		"  trace {<filename>|OFF}[,<cpu>[,<action>]] -- trace the given CPU to a file (defaults to active CPU)\n"
 		"  traceover {<filename>|OFF}[,<cpu>[,<action>]] -- trace the given CPU to a file, but skip subroutines (defaults to active CPU)\n"
 		"  traceflush -- flushes all open trace files\n"
+		"  lockrecord {<filename>|OFF}[,<cpu>[,<granularity>]] -- record the given CPU's register state for lockstep comparison\n"
+		"  lockcompare {<filename>|OFF}[,<cpu>[,<granularity>]] -- compare the given CPU's register state against a lockstep recording\n"
 	},
 	{
 		"breakpoints",
@@ -845,6 +847,49 @@ static const help_item static_help_list[] =
 		"  Begin tracing the execution of CPU #0, logging output to asteroid.tr. Before each line, "
 		"output A=<aval> to the tracelog.\n"
 	},
+	{
+		"lockrecord",
+		"\n"
+		"  lockrecord {<filename>|OFF}[,<cpu>[,<granularity>]]\n"
+		"\n"
+		"Starts or stops recording the register state of the specified <cpu> for later lockstep "
+		"comparison with the 'lockcompare' command. Every register shown in the state view is "
+		"written to <filename>, along with the PC and total cycle count. The <granularity> is "
+		"either 'insn' (the default) to record before each instruction, or 'slice' to record only "
+		"at the end of each timeslice. If <cpu> is omitted, the currently active CPU is specified. "
+		"To stop recording, substitute the keyword 'off' for <filename>.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"lockrecord gradius.lks,0\n"
+		"  Record the state of CPU #0 before each instruction to gradius.lks.\n"
+		"\n"
+		"lockrecord off,0\n"
+		"  Stop recording CPU #0.\n"
+	},
+	{
+		"lockcompare",
+		"\n"
+		"  lockcompare {<filename>|OFF}[,<cpu>[,<granularity>]]\n"
+		"\n"
+		"Starts or stops comparing the register state of the specified <cpu> against a recording "
+		"made with 'lockrecord', typically from a run using a different implementation of the same "
+		"CPU (for example with -nodrc or -drc_use_c). Registers are matched by name, so registers "
+		"missing from either implementation are skipped. Execution stops at the first checkpoint "
+		"where the PC, cycle count or any register differs, and the differences are printed. With "
+		"'slice' <granularity>, the state is only checked at the end of each timeslice, against the "
+		"recorded checkpoint with the same total cycle count; this lets an instruction-granular "
+		"recording from an interpreter be checked against a recompiler that only has consistent "
+		"state between blocks. If <cpu> is omitted, the currently active CPU is specified.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"lockcompare gradius.lks,0\n"
+		"  Compare CPU #0 against gradius.lks before each instruction.\n"
+		"\n"
+		"lockcompare gradius.lks,0,slice\n"
+		"  Compare CPU #0 against gradius.lks at the end of each timeslice.\n"
+	},
 	{
 		"traceover",
 		"\n"
@@ -50,6 +50,26 @@ INLINE void debugger_instruction_hook(device_t *device, offs_t curpc)
 }
 
 
+/*-------------------------------------------------
+    debugger_instruction_hook_armed - CPU cores
+    with an execute loop specialized on the
+    debugger call this once per timeslice to pick
+    the loop; if the hook is needed partway
+    through, the timeslice is cut short
+-------------------------------------------------*/
+
+INLINE bool debugger_instruction_hook_armed(device_t *device)
+{
+#ifndef MAME_DEBUG_FAST
+	if ((device->machine().debug_flags & DEBUG_FLAG_CALL_HOOK) != 0)
+		return true;
+	if ((device->machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+		device->debug()->instruction_hook_skipped();
+#endif
+	return false;
+}
+
+
 /*-------------------------------------------------
     debugger_exception_hook - CPU cores call this
     anytime an exception is generated
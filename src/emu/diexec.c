@@ -53,6 +53,8 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 		m_icountptr(NULL),
 		m_cycles_running(0),
 		m_cycles_stolen(0),
+		m_batch_idle(false),
+		m_batch_cycles(0),
 		m_suspend(0),
 		m_nextsuspend(0),
 		m_eatcycles(0),
@@ -179,6 +181,39 @@ void device_execute_interface::eat_cycles(int cycles)
 }
 
 
+//-------------------------------------------------
+//  batch_idle - called by a core that is spinning
+//  in a loop whose only way out is a change to an
+//  input (port, test pin, interrupt line, latch
+//  written by another CPU); skips whole iterations
+//  of the loop up to the end of the timeslice or
+//  'limit' cycles, and returns how many cycles
+//  were skipped so the core can account for them
+//  in its internal timers
+//-------------------------------------------------
+
+int device_execute_interface::batch_idle(int loopcycles, int limit)
+{
+	// ignore if not the executing device or not allowed
+	if (!m_batch_idle || !executing() || loopcycles <= 0)
+		return 0;
+
+	// Other devices only run, and timers only fire, between our timeslices,
+	// but machine time still moves with our icount: anything the loop derives
+	// from it (screen position, attotime-based status) exits late when skipped.
+	// This is why batching is opt-in. Leave the last iteration to the core so
+	// it sees the timeslice out as usual.
+	int cycles = MIN(*m_icountptr, limit) - 1;
+	cycles -= cycles % loopcycles;
+	if (cycles <= 0)
+		return 0;
+
+	*m_icountptr -= cycles;
+	m_batch_cycles += cycles;
+	return cycles;
+}
+
+
 //-------------------------------------------------
 //  adjust_icount - apply a +/- to the current
 //  icount
@@ -483,6 +518,9 @@ void device_execute_interface::interface_pre_start()
 	m_profiler = profile_type(index + PROFILER_DEVICE_FIRST);
 	m_inttrigger = index + TRIGGER_INT;
 
+	// batching is off under the debugger so stepping stays one instruction at a time
+	m_batch_idle = device().machine().options().batch_idle() && (device().machine().debug_flags & DEBUG_FLAG_ENABLED) == 0;
+
 	// allocate timers if we need them
 	if (m_timed_interrupt_period != attotime::zero)
 		m_timedint_timer = m_scheduler->timer_alloc(FUNC(static_trigger_periodic_interrupt), (void *)this);
@@ -523,6 +561,7 @@ void device_execute_interface::interface_pre_reset()
 {
 	// reset the total number of cycles
 	m_totalcycles = 0;
+	m_batch_cycles = 0;
 
 	// enable all devices (except for disabled devices)
 	if (!disabled())
@@ -563,6 +602,19 @@ void device_execute_interface::interface_post_reset()
 }
 
 
+//-------------------------------------------------
+//  interface_post_stop - work to be done after a
+//  device is stopped
+//-------------------------------------------------
+
+void device_execute_interface::interface_post_stop()
+{
+	if (m_batch_cycles != 0)
+		osd_printf_verbose("%s: skipped %d%% of %d cycles in idle polling loops\n", device().tag(),
+				m_totalcycles ? (int)(m_batch_cycles * 100 / m_totalcycles) : 0, (int)m_totalcycles);
+}
+
+
 //-------------------------------------------------
 //  interface_clock_changed - recomputes clock
 //  information for this device
@@ -162,6 +162,10 @@ public:
 	void adjust_icount(int delta);
 	void abort_timeslice();
 
+	// MCU batch mode
+	int batch_idle(int loopcycles, int limit = 0x7fffffff);
+	UINT64 batch_idle_cycles() const { return m_batch_cycles; }
+
 	// input and interrupt management
 	void set_input_line(int linenum, int state) { m_input[linenum].set_state_synced(state); }
 	void set_input_line_vector(int linenum, int vector) { m_input[linenum].set_vector(vector); }
@@ -219,6 +223,7 @@ protected:
 	virtual void interface_post_start();
 	virtual void interface_pre_reset();
 	virtual void interface_post_reset();
+	virtual void interface_post_stop();
 	virtual void interface_clock_changed();
 
 	// for use by devcpu for now...
@@ -278,6 +283,8 @@ protected:
 	int *                   m_icountptr;                // pointer to the icount
 	int                     m_cycles_running;           // number of cycles we are executing
 	int                     m_cycles_stolen;            // number of cycles we artificially stole
+	bool                    m_batch_idle;               // may idle polling loops be skipped?
+	UINT64                  m_batch_cycles;             // number of cycles skipped that way
 
 	// suspend states
 	UINT32                  m_suspend;                  // suspend reason mask (0 = not suspended)
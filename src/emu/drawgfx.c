@@ -61,6 +61,34 @@ static inline INT32 normalize_yscroll(bitmap_t &bitmap, INT32 yscroll)
 }
 
 
+/*-------------------------------------------------
+    clip_to_visible_rows - narrow a cliprect to
+    the destination rows covered by the rows of
+    an element that have a pen outside of
+    'trans_mask'; returns false if nothing is
+    left to draw
+-------------------------------------------------*/
+
+static inline bool clip_to_visible_rows(gfx_element &gfx, rectangle &clip, UINT32 code, int flipy, INT32 desty, UINT32 trans_mask)
+{
+	const UINT32 *rowusage = gfx.row_pen_usage(code);
+	INT32 first = 0, last = gfx.height() - 1;
+
+	// find the first and last rows with something to draw
+	while (first <= last && (rowusage[first] & ~trans_mask) == 0)
+		first++;
+	while (last >= first && (rowusage[last] & ~trans_mask) == 0)
+		last--;
+
+	// if there are none, this leaves the cliprect empty
+	if (!flipy)
+		clip &= rectangle(clip.min_x, clip.max_x, desty + first, desty + last);
+	else
+		clip &= rectangle(clip.min_x, clip.max_x, desty + gfx.height() - 1 - last, desty + gfx.height() - 1 - first);
+	return !clip.empty();
+}
+
+
 
 //**************************************************************************
 //  DEVICE DEFINITIONS
@@ -230,11 +258,17 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 	m_dirty.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
 
-	// allocate a pen usage array for entries with 32 pens or less
+	// allocate pen usage arrays for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_pen_usage.resize(m_total_elements * m_origheight);
+	}
 	else
+	{
 		m_pen_usage.clear();
+		m_row_pen_usage.clear();
+	}
 }
 
 
@@ -282,9 +316,12 @@ void gfx_element::set_source_and_total(const UINT8 *source, UINT32 total)
 	m_dirty.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
 
-	// allocate a pen usage array for entries with 32 pens or less
+	// allocate pen usage arrays for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_pen_usage.resize(m_total_elements * m_origheight);
+	}
 
 	if (m_layout_is_raw)
 	{
@@ -355,13 +392,17 @@ void gfx_element::decode(UINT32 code)
 	// (re)compute pen usage
 	if (code < m_pen_usage.size())
 	{
-		// iterate over data, creating a bitmask of live pens
+		// iterate over data, creating a bitmask of live pens for each row
 		const UINT8 *dp = m_gfxdata + code * m_char_modulo;
+		UINT32 *rowusage = &m_row_pen_usage[code * m_origheight];
 		UINT32 usage = 0;
 		for (int y = 0; y < m_origheight; y++)
 		{
+			UINT32 rowbits = 0;
 			for (int x = 0; x < m_origwidth; x++)
-				usage |= 1 << dp[x];
+				rowbits |= 1 << dp[x];
+			rowusage[y] = rowbits;
+			usage |= rowbits;
 			dp += m_line_modulo;
 		}
 
@@ -387,19 +428,19 @@ void gfx_element::decode(UINT32 code)
 void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 		UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty)
 {
-	color = colorbase() + granularity() * (color % colors());
+	drawgfx_op_rebase_opaque op;
+	op.color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE, NO_PRIORITY);
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
 		UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty)
 {
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	drawgfx_op_remap_opaque op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE, NO_PRIORITY);
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -430,10 +471,12 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
 
-	// render
-	color = colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	// render; rows here take the vector path, which costs less than
+	// trimming the transparent ones the way transmask does
+	drawgfx_op_rebase_transpen op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -446,6 +489,7 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// use pen usage to optimize
 	code %= elements();
+	rectangle clip = cliprect;
 	if (has_pen_usage())
 	{
 		// fully transparent; do nothing
@@ -456,12 +500,17 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 		// fully opaque; draw as such
 		if ((usage & (1 << trans_pen)) == 0)
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
+
+		// skip the fully transparent rows at the top and bottom
+		if (!clip_to_visible_rows(*this, clip, code, flipy, desty, 1 << trans_pen))
+			return;
 	}
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_remap_transpen op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	drawgfx_core<NO_PRIORITY>(*this, dest, clip, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -481,8 +530,10 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_rebase_transpen op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -495,8 +546,10 @@ void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_rebase_transpen op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -516,6 +569,7 @@ void gfx_element::transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// use pen usage to optimize
 	code %= elements();
+	rectangle clip = cliprect;
 	if (has_pen_usage())
 	{
 		// fully transparent; do nothing
@@ -526,12 +580,17 @@ void gfx_element::transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 		// fully opaque; draw as such
 		if ((usage & trans_mask) == 0)
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
+
+		// skip the fully transparent rows at the top and bottom
+		if (!clip_to_visible_rows(*this, clip, code, flipy, desty, trans_mask))
+			return;
 	}
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSMASK, NO_PRIORITY);
+	drawgfx_op_rebase_transmask op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	drawgfx_core<NO_PRIORITY>(*this, dest, clip, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -544,6 +603,7 @@ void gfx_element::transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// use pen usage to optimize
 	code %= elements();
+	rectangle clip = cliprect;
 	if (has_pen_usage())
 	{
 		// fully transparent; do nothing
@@ -554,12 +614,17 @@ void gfx_element::transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 		// fully opaque; draw as such
 		if ((usage & trans_mask) == 0)
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
+
+		// skip the fully transparent rows at the top and bottom
+		if (!clip_to_visible_rows(*this, clip, code, flipy, desty, trans_mask))
+			return;
 	}
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSMASK, NO_PRIORITY);
+	drawgfx_op_remap_transmask op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	drawgfx_core<NO_PRIORITY>(*this, dest, clip, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -576,11 +641,12 @@ void gfx_element::transtable(bitmap_ind16 &dest, const rectangle &cliprect,
 	assert(pentable != NULL);
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_rebase_transtable16 op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16, NO_PRIORITY);
+	op.pentable = pentable;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -590,11 +656,12 @@ void gfx_element::transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
 	assert(pentable != NULL);
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_remap_transtable32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32, NO_PRIORITY);
+	op.pentable = pentable;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -618,9 +685,11 @@ void gfx_element::alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return;
 
 	// get final code and color, and grab lookup tables
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_ALPHA32, NO_PRIORITY);
+	drawgfx_op_remap_transpen_alpha32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.alpha_val = alpha_val;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -643,10 +712,10 @@ void gfx_element::zoom_opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 		return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
+	drawgfx_op_rebase_opaque op;
+	op.color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE, NO_PRIORITY);
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::zoom_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -658,10 +727,10 @@ void gfx_element::zoom_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	drawgfx_op_remap_opaque op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE, NO_PRIORITY);
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -697,9 +766,10 @@ void gfx_element::zoom_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 	}
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_rebase_transpen op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -729,9 +799,10 @@ void gfx_element::zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 	}
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_remap_transpen op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -755,8 +826,10 @@ void gfx_element::zoom_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 		return;
 
 	// render
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_rebase_transpen op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -773,8 +846,10 @@ void gfx_element::zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 		return;
 
 	// render
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	drawgfx_op_rebase_transpen op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -811,9 +886,10 @@ void gfx_element::zoom_transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 	}
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSMASK, NO_PRIORITY);
+	drawgfx_op_rebase_transmask op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::zoom_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -843,9 +919,10 @@ void gfx_element::zoom_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 	}
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSMASK, NO_PRIORITY);
+	drawgfx_op_remap_transmask op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -866,11 +943,12 @@ void gfx_element::zoom_transtable(bitmap_ind16 &dest, const rectangle &cliprect,
 		return transtable(dest, cliprect, code, color, flipx, flipy, destx, desty, pentable);
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_rebase_transtable16 op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16, NO_PRIORITY);
+	op.pentable = pentable;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 void gfx_element::zoom_transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -884,11 +962,12 @@ void gfx_element::zoom_transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return transtable(dest, cliprect, code, color, flipx, flipy, destx, desty, pentable);
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_remap_transtable32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32, NO_PRIORITY);
+	op.pentable = pentable;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -916,9 +995,11 @@ void gfx_element::zoom_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DECLARE_NO_PRIORITY;
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_ALPHA32, NO_PRIORITY);
+	drawgfx_op_remap_transpen_alpha32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.alpha_val = alpha_val;
+	drawgfxzoom_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, drawgfx_dummy_priority_bitmap, op);
 }
 
 
@@ -941,9 +1022,11 @@ void gfx_element::prio_opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
+	drawgfx_op_rebase_opaque_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE_PRIORITY, UINT8);
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 void gfx_element::prio_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -954,9 +1037,11 @@ void gfx_element::prio_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	drawgfx_op_remap_opaque_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE_PRIORITY, UINT8);
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -992,8 +1077,11 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_rebase_transpen_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1022,8 +1110,11 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_remap_transpen_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -1046,7 +1137,11 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_rebase_transpen_priority op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1062,7 +1157,11 @@ void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_rebase_transpen_priority op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -1098,8 +1197,11 @@ void gfx_element::prio_transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSMASK_PRIORITY, UINT8);
+	drawgfx_op_rebase_transmask_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 void gfx_element::prio_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1128,8 +1230,11 @@ void gfx_element::prio_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSMASK_PRIORITY, UINT8);
+	drawgfx_op_remap_transmask_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -1150,10 +1255,13 @@ void gfx_element::prio_transtable(bitmap_ind16 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_rebase_transtable16_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16_PRIORITY, UINT8);
+	op.pentable = pentable;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 void gfx_element::prio_transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1166,10 +1274,13 @@ void gfx_element::prio_transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_remap_transtable32_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32_PRIORITY, UINT8);
+	op.pentable = pentable;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -1197,8 +1308,12 @@ void gfx_element::prio_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY, UINT8);
+	drawgfx_op_remap_transpen_alpha32_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.alpha_val = alpha_val;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -1225,9 +1340,11 @@ void gfx_element::prio_zoom_opaque(bitmap_ind16 &dest, const rectangle &cliprect
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
+	drawgfx_op_rebase_opaque_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE_PRIORITY, UINT8);
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 void gfx_element::prio_zoom_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1242,9 +1359,11 @@ void gfx_element::prio_zoom_opaque(bitmap_rgb32 &dest, const rectangle &cliprect
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	drawgfx_op_remap_opaque_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE_PRIORITY, UINT8);
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 
@@ -1285,8 +1404,11 @@ void gfx_element::prio_zoom_transpen(bitmap_ind16 &dest, const rectangle &clipre
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_rebase_transpen_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 void gfx_element::prio_zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1320,8 +1442,11 @@ void gfx_element::prio_zoom_transpen(bitmap_rgb32 &dest, const rectangle &clipre
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_remap_transpen_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 
@@ -1350,7 +1475,11 @@ void gfx_element::prio_zoom_transpen_raw(bitmap_ind16 &dest, const rectangle &cl
 	pmask |= 1 << 31;
 
 	// render
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_rebase_transpen_priority op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 void gfx_element::prio_zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1371,7 +1500,11 @@ void gfx_element::prio_zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cl
 	pmask |= 1 << 31;
 
 	// render
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	drawgfx_op_rebase_transpen_priority op;
+	op.color = color;
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 
@@ -1413,8 +1546,11 @@ void gfx_element::prio_zoom_transmask(bitmap_ind16 &dest, const rectangle &clipr
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSMASK_PRIORITY, UINT8);
+	drawgfx_op_rebase_transmask_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 void gfx_element::prio_zoom_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1448,8 +1584,11 @@ void gfx_element::prio_zoom_transmask(bitmap_rgb32 &dest, const rectangle &clipr
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSMASK_PRIORITY, UINT8);
+	drawgfx_op_remap_transmask_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_mask = trans_mask;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 
@@ -1475,10 +1614,13 @@ void gfx_element::prio_zoom_transtable(bitmap_ind16 &dest, const rectangle &clip
 	pmask |= 1 << 31;
 
 	// render
-	color = colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_rebase_transtable16_priority op;
+	op.color = colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16_PRIORITY, UINT8);
+	op.pentable = pentable;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 void gfx_element::prio_zoom_transtable(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1496,10 +1638,13 @@ void gfx_element::prio_zoom_transtable(bitmap_rgb32 &dest, const rectangle &clip
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	const pen_t *shadowtable = m_palette->shadow_table();
+	drawgfx_op_remap_transtable32_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.shadowtable = m_palette->shadow_table();
 	code %= elements();
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32_PRIORITY, UINT8);
+	op.pentable = pentable;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 
@@ -1533,8 +1678,12 @@ void gfx_element::prio_zoom_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 	pmask |= 1 << 31;
 
 	// render
-	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY, UINT8);
+	drawgfx_op_remap_transpen_alpha32_priority op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+	op.trans_pen = trans_pen;
+	op.alpha_val = alpha_val;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 
@@ -1563,12 +1712,12 @@ do
 	}                                                                               \
 }                                                                                   \
 while (0)
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transpen_priority_addiive32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY_ADDIIVE32);
 
 void gfx_element::prio_transpen_additive(bitmap_rgb32 &dest, const rectangle &cliprect,
 		UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty,
 		bitmap_ind8 &priority, UINT32 pmask, UINT32 trans_pen)
 {
-	const pen_t *paldata;
 
 	assert(dest.valid());
 	assert(dest.bpp() == 32);
@@ -1576,7 +1725,8 @@ void gfx_element::prio_transpen_additive(bitmap_rgb32 &dest, const rectangle &cl
 	/* get final code and color, and grab lookup tables */
 	code %= elements();
 	color %= colors();
-	paldata = m_palette->pens() + colorbase() + granularity() * color;
+	drawgfx_op_remap_transpen_priority_addiive32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * color;
 
 	/* use pen usage to optimize */
 	if (has_pen_usage())
@@ -1592,7 +1742,9 @@ void gfx_element::prio_transpen_additive(bitmap_rgb32 &dest, const rectangle &cl
 	pmask |= 1 << 31;
 
 	/* render based on dest bitmap depth */
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY_ADDIIVE32, UINT8);
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfx_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, priority, op);
 }
 
 
@@ -1601,7 +1753,6 @@ void gfx_element::prio_zoom_transpen_additive(bitmap_rgb32 &dest, const rectangl
 		UINT32 scalex, UINT32 scaley, bitmap_ind8 &priority, UINT32 pmask,
 		UINT32 trans_pen)
 {
-	const pen_t *paldata;
 
 	/* non-zoom case */
 
@@ -1617,7 +1768,8 @@ void gfx_element::prio_zoom_transpen_additive(bitmap_rgb32 &dest, const rectangl
 	/* get final code and color, and grab lookup tables */
 	code %= elements();
 	color %= colors();
-	paldata = m_palette->pens() + colorbase() + granularity() * color;
+	drawgfx_op_remap_transpen_priority_addiive32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * color;
 
 	/* use pen usage to optimize */
 	if (has_pen_usage())
@@ -1632,7 +1784,9 @@ void gfx_element::prio_zoom_transpen_additive(bitmap_rgb32 &dest, const rectangl
 	/* high bit of the mask is implicitly on */
 	pmask |= 1 << 31;
 
-	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY_ADDIIVE32, UINT8);
+	op.trans_pen = trans_pen;
+	op.pmask = pmask;
+	drawgfxzoom_core<UINT8>(*this, dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, op);
 }
 
 //#define MAKE_ARGB_RGB(a, rgb) rgb_t(a, rgb.r(), rgb.g(), rgb.b())
@@ -1647,6 +1801,7 @@ do
 		(DEST) = MAKE_ARGB_RGB(alpha,paldata[srcdata]);                                             \
 }                                                                                                   \
 while (0)
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_trans0_alphastore32, PIXEL_OP_REMAP_TRANS0_ALPHASTORE32);
 // combine in 'alphatable' value to store in ARGB
 #define PIXEL_OP_REMAP_TRANS0_ALPHATABLESTORE32(DEST, PRIORITY, SOURCE)                             \
 do                                                                                                  \
@@ -1656,6 +1811,7 @@ do
 		(DEST) = MAKE_ARGB_RGB(alphatable[srcdata], paldata[srcdata]);                              \
 }                                                                                                   \
 while (0)
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_trans0_alphatablestore32, PIXEL_OP_REMAP_TRANS0_ALPHATABLESTORE32);
 // drawgfxm.h macro to render alpha into 32-bit buffer
 #define PIXEL_OP_REMAP_TRANS0_ALPHATABLE32(DEST, PRIORITY, SOURCE)                                  \
 do                                                                                                  \
@@ -1665,6 +1821,7 @@ do
 		(DEST) = alpha_blend_r32((DEST), paldata[srcdata], alphatable[srcdata]);                    \
 }                                                                                                   \
 while (0)
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_trans0_alphatable32, PIXEL_OP_REMAP_TRANS0_ALPHATABLE32);
 
 /*-------------------------------------------------
     alphastore - render a gfx element with
@@ -1675,9 +1832,6 @@ void gfx_element::alphastore(bitmap_rgb32 &dest, const rectangle &cliprect,
 		UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty,
 		int fixedalpha, UINT8 *alphatable)
 {
-	DECLARE_NO_PRIORITY;
-	const pen_t *paldata;
-
 	assert(dest.bpp() == 32);
 	assert(dest.format() == BITMAP_FORMAT_ARGB32);
 	assert(alphatable != NULL);
@@ -1692,7 +1846,7 @@ void gfx_element::alphastore(bitmap_rgb32 &dest, const rectangle &cliprect,
 	/* get final code and color, and grab lookup tables */
 	code %= elements();
 	color %= colors();
-	paldata = m_palette->pens() + colorbase() + granularity() * color;
+	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * color;
 
 	/* early out if completely transparent */
 	if (has_pen_usage() && (pen_usage(code) & ~(1 << 0)) == 0)
@@ -1700,12 +1854,17 @@ void gfx_element::alphastore(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	if (fixedalpha >= 0)
 	{
-		UINT8 alpha = fixedalpha;
-		DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANS0_ALPHASTORE32, NO_PRIORITY);
+		drawgfx_op_remap_trans0_alphastore32 op;
+		op.paldata = paldata;
+		op.alpha = fixedalpha;
+		drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 	}
 	else
 	{
-		DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANS0_ALPHATABLESTORE32, NO_PRIORITY);
+		drawgfx_op_remap_trans0_alphatablestore32 op;
+		op.paldata = paldata;
+		op.alphatable = alphatable;
+		drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 	}
 }
 
@@ -1718,10 +1877,6 @@ void gfx_element::alphatable(bitmap_rgb32 &dest, const rectangle &cliprect,
 		UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty,
 		int fixedalpha ,UINT8 *alphatable)
 {
-	DECLARE_NO_PRIORITY;
-
-	const pen_t *paldata;
-
 	/* if we have a fixed alpha, call the standard drawgfx_alpha */
 	if (fixedalpha >= 0)
 	{
@@ -1735,13 +1890,15 @@ void gfx_element::alphatable(bitmap_rgb32 &dest, const rectangle &cliprect,
 	/* get final code and color, and grab lookup tables */
 	code %= elements();
 	color %= colors();
-	paldata = m_palette->pens() + colorbase() + granularity() * color;
+	drawgfx_op_remap_trans0_alphatable32 op;
+	op.paldata = m_palette->pens() + colorbase() + granularity() * color;
 
 	/* early out if completely transparent */
 	if (has_pen_usage() && (pen_usage(code) & ~(1 << 0)) == 0)
 		return;
 
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANS0_ALPHATABLE32, NO_PRIORITY);
+	op.alphatable = alphatable;
+	drawgfx_core<NO_PRIORITY>(*this, dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_dummy_priority_bitmap, op);
 }
 
 
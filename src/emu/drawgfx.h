@@ -197,6 +197,13 @@ public:
 		return m_pen_usage[code];
 	}
 
+	const UINT32 *row_pen_usage(UINT32 code)
+	{
+		assert(code < m_pen_usage.size());
+		if (m_dirty[code]) decode(code);
+		return &m_row_pen_usage[code * m_origheight + m_starty];
+	}
+
 	// ----- core graphics drawing -----
 
 	// specific drawgfx implementations for each transparency type
@@ -292,6 +299,7 @@ private:
 	dynamic_buffer  m_gfxdata_allocated;    // allocated decoded pixel data, 8bpp
 	dynamic_buffer  m_dirty;                // dirty array for detecting chars that need decoding
 	std::vector<UINT32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
+	std::vector<UINT32>  m_row_pen_usage;  // the same, for each row of each element
 
 	bool            m_layout_is_raw;        // raw layout?
 	UINT8           m_layout_planes;        // bit planes in the layout
@@ -27,6 +27,13 @@
     macros are written, leaving behind just the cases we are
     interested in.
 
+    The basic drawgfx and drawgfxzoom cores are function templates
+    instead: drawgfx_core and drawgfxzoom_core take the priority
+    type as a template argument and the pixel operation as an
+    object built with DRAWGFX_PIXEL_OP_CLASS. Unflipped rows of
+    operations that have a drawgfx_span specialization are drawn
+    with the vector helpers in gfxspan.h.
+
     The general approach for using these macros is:
 
     my_drawing_function(params)
@@ -51,6 +58,7 @@
 #define __DRAWGFXM_H__
 
 #include "profiler.h"
+#include "gfxspan.h"
 
 
 /* special priority type meaning "none" */
@@ -366,173 +374,245 @@ do
 while (0)
 
 
+/***************************************************************************
+    PIXEL OPERATION OBJECTS
+***************************************************************************/
+
+/*
+    The drawgfx cores below take their per-pixel operation as an object
+    rather than as a macro name, so they can be function templates.
+    DRAWGFX_PIXEL_OP_CLASS wraps one of the PIXEL_OP* macros in such an
+    object; the variables the macro refers to (color, paldata, trans_pen
+    and so on) are members the caller fills in before drawing. Drivers
+    can wrap their own PIXEL_OP* macros the same way.
+*/
+
+struct drawgfx_pixel_op_params
+{
+	drawgfx_pixel_op_params()
+		: color(0), paldata(NULL), trans_pen(0), trans_mask(0), pmask(0),
+			pentable(NULL), shadowtable(NULL), alpha_val(0xff), alpha(0xff), alphatable(NULL) { }
+
+	UINT32          color;          // pen base for the REBASE operations
+	const pen_t *   paldata;        // palette for the REMAP operations
+	UINT32          trans_pen;      // transparent pen for the TRANSPEN operations
+	UINT32          trans_mask;     // mask of transparent pens for the TRANSMASK operations
+	UINT32          pmask;          // priority mask for the PRIORITY operations
+	const UINT8 *   pentable;       // per-pen draw mode for the TRANSTABLE operations
+	const pen_t *   shadowtable;    // shadow lookup for the TRANSTABLE operations
+	UINT8           alpha_val;      // blend factor for the ALPHA32 operations
+	UINT8           alpha;          // stored alpha for the ALPHASTORE operations
+	const UINT8 *   alphatable;     // per-pen alpha for the ALPHATABLE operations
+};
+
+#define DRAWGFX_PIXEL_OP_CLASS(NAME, PIXEL_OP)                                      \
+struct NAME : public drawgfx_pixel_op_params                                        \
+{                                                                                   \
+	template<typename _PixelType, typename _PriorityType>                           \
+	void operator()(_PixelType &dest, _PriorityType &priority, UINT32 source) const \
+	{                                                                               \
+		PIXEL_OP(dest, priority, source);                                           \
+	}                                                                               \
+}
+
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_opaque, PIXEL_OP_REBASE_OPAQUE);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_opaque_priority, PIXEL_OP_REBASE_OPAQUE_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_opaque, PIXEL_OP_REMAP_OPAQUE);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_opaque_priority, PIXEL_OP_REMAP_OPAQUE_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_transpen, PIXEL_OP_REBASE_TRANSPEN);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_transpen_priority, PIXEL_OP_REBASE_TRANSPEN_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transpen, PIXEL_OP_REMAP_TRANSPEN);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transpen_priority, PIXEL_OP_REMAP_TRANSPEN_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_transmask, PIXEL_OP_REBASE_TRANSMASK);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_transmask_priority, PIXEL_OP_REBASE_TRANSMASK_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transmask, PIXEL_OP_REMAP_TRANSMASK);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transmask_priority, PIXEL_OP_REMAP_TRANSMASK_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_transtable16, PIXEL_OP_REBASE_TRANSTABLE16);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_rebase_transtable16_priority, PIXEL_OP_REBASE_TRANSTABLE16_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transtable32, PIXEL_OP_REMAP_TRANSTABLE32);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transtable32_priority, PIXEL_OP_REMAP_TRANSTABLE32_PRIORITY);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transpen_alpha32, PIXEL_OP_REMAP_TRANSPEN_ALPHA32);
+DRAWGFX_PIXEL_OP_CLASS(drawgfx_op_remap_transpen_alpha32_priority, PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY);
+
+
+/*-------------------------------------------------
+    drawgfx_span - hook for drawing a whole
+    unflipped, unzoomed row with a vector version
+    of the operation; draw() returns false when
+    there isn't one, and the core falls back to
+    the per-pixel loop
+-------------------------------------------------*/
+
+template<class _PixelOp, typename _PixelType, typename _PriorityType>
+struct drawgfx_span
+{
+	static bool draw(const _PixelOp &op, _PixelType *dest, const UINT8 *source, int count) { return false; }
+};
+
+template<>
+struct drawgfx_span<drawgfx_op_rebase_opaque, UINT16, NO_PRIORITY>
+{
+	static bool draw(const drawgfx_op_rebase_opaque &op, UINT16 *dest, const UINT8 *source, int count)
+	{
+		gfx_span_rebase_opaque(dest, source, count, op.color);
+		return true;
+	}
+};
+
+template<>
+struct drawgfx_span<drawgfx_op_rebase_transpen, UINT16, NO_PRIORITY>
+{
+	static bool draw(const drawgfx_op_rebase_transpen &op, UINT16 *dest, const UINT8 *source, int count)
+	{
+		gfx_span_rebase_transpen(dest, source, count, op.color, op.trans_pen);
+		return true;
+	}
+};
+
+
+
 /***************************************************************************
     BASIC DRAWGFX CORE
 ***************************************************************************/
 
 /*
-    Assumed input parameters or local variables:
+    Parameters:
 
-        bitmap_t &dest - the bitmap to render to
+        gfx_element &gfx - the gfx_element to render
+        _BitmapClass &dest - the bitmap to render to
         const rectangle &cliprect - a clipping rectangle (assumed to be clipped to the size of 'dest')
-        gfx_element *gfx - pointer to the gfx_element to render
         UINT32 code - index of the entry within gfx_element
-        UINT32 color - index of the color within gfx_element
         int flipx - non-zero means render right-to-left instead of left-to-right
         int flipy - non-zero means render bottom-to-top instead of top-to-bottom
         INT32 destx - the top-left X coordinate to render to
         INT32 desty - the top-left Y coordinate to render to
-        bitmap_t &priority - the priority bitmap (even if PRIORITY_TYPE is NO_PRIORITY, at least needs a dummy)
+        bitmap_t &priority - the priority bitmap (even if _PriorityType is NO_PRIORITY, at least needs a dummy)
+        const _PixelOp &op - the pixel operation, with its parameters filled in
 */
 
-
-#define DRAWGFX_CORE(PIXEL_TYPE, PIXEL_OP, PRIORITY_TYPE)                               \
-do {                                                                                    \
-	g_profiler.start(PROFILER_DRAWGFX);                                                 \
-	do {                                                                                \
-		const UINT8 *srcdata;                                                           \
-		INT32 destendx, destendy;                                                       \
-		INT32 srcx, srcy;                                                               \
-		INT32 curx, cury;                                                               \
-		INT32 dy;                                                                       \
-																						\
-		assert(dest.valid());                                                           \
-		assert(!PRIORITY_VALID(PRIORITY_TYPE) || priority.valid());                     \
-		assert(dest.cliprect().contains(cliprect));                                     \
-		assert(code < elements());                                             \
-																						\
-		/* ignore empty/invalid cliprects */                                            \
-		if (cliprect.empty())                                                           \
-			break;                                                                      \
-																						\
-		/* compute final pixel in X and exit if we are entirely clipped */              \
-		destendx = destx + width() - 1;                                                \
-		if (destx > cliprect.max_x || destendx < cliprect.min_x)                        \
-			break;                                                                      \
-																						\
-		/* apply left clip */                                                           \
-		srcx = 0;                                                                       \
-		if (destx < cliprect.min_x)                                                     \
-		{                                                                               \
-			srcx = cliprect.min_x - destx;                                              \
-			destx = cliprect.min_x;                                                     \
-		}                                                                               \
-																						\
-		/* apply right clip */                                                          \
-		if (destendx > cliprect.max_x)                                                  \
-			destendx = cliprect.max_x;                                                  \
-																						\
-		/* compute final pixel in Y and exit if we are entirely clipped */              \
-		destendy = desty + height() - 1;                                               \
-		if (desty > cliprect.max_y || destendy < cliprect.min_y)                        \
-			break;                                                                      \
-																						\
-		/* apply top clip */                                                            \
-		srcy = 0;                                                                       \
-		if (desty < cliprect.min_y)                                                     \
-		{                                                                               \
-			srcy = cliprect.min_y - desty;                                              \
-			desty = cliprect.min_y;                                                     \
-		}                                                                               \
-																						\
-		/* apply bottom clip */                                                         \
-		if (destendy > cliprect.max_y)                                                  \
-			destendy = cliprect.max_y;                                                  \
-																						\
-		/* apply X flipping */                                                          \
-		if (flipx)                                                                      \
-			srcx = width() - 1 - srcx;                                             \
-																						\
-		/* apply Y flipping */                                                          \
-		dy = rowbytes();                                                           \
-		if (flipy)                                                                      \
-		{                                                                               \
-			srcy = height() - 1 - srcy;                                                \
-			dy = -dy;                                                                   \
-		}                                                                               \
-																						\
-		/* fetch the source data */                                                     \
-		srcdata = get_data(code);                                      \
-																						\
-		/* compute how many blocks of 4 pixels we have */                           \
-		UINT32 numblocks = (destendx + 1 - destx) / 4;                              \
-		UINT32 leftovers = (destendx + 1 - destx) - 4 * numblocks;                  \
-																					\
-		/* adjust srcdata to point to the first source pixel of the row */          \
-		srcdata += srcy * rowbytes() + srcx;                                   \
-																					\
-		/* non-flipped 8bpp case */                                                 \
-		if (!flipx)                                                                 \
-		{                                                                           \
-			/* iterate over pixels in Y */                                          \
-			for (cury = desty; cury <= destendy; cury++)                            \
-			{                                                                       \
-				PRIORITY_TYPE *priptr = PRIORITY_ADDR(priority, PRIORITY_TYPE, cury, destx); \
-				PIXEL_TYPE *destptr = &dest.pixt<PIXEL_TYPE>(cury, destx);          \
-				const UINT8 *srcptr = srcdata;                                      \
-				srcdata += dy;                                                      \
-																					\
-				/* iterate over unrolled blocks of 4 */                             \
-				for (curx = 0; curx < numblocks; curx++)                            \
-				{                                                                   \
-					PIXEL_OP(destptr[0], priptr[0], srcptr[0]);                     \
-					PIXEL_OP(destptr[1], priptr[1], srcptr[1]);                     \
-					PIXEL_OP(destptr[2], priptr[2], srcptr[2]);                     \
-					PIXEL_OP(destptr[3], priptr[3], srcptr[3]);                     \
-																					\
-					srcptr += 4;                                                    \
-					destptr += 4;                                                   \
-					PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 4);                     \
-				}                                                                   \
-																					\
-				/* iterate over leftover pixels */                                  \
-				for (curx = 0; curx < leftovers; curx++)                            \
-				{                                                                   \
-					PIXEL_OP(destptr[0], priptr[0], srcptr[0]);                     \
-					srcptr++;                                                       \
-					destptr++;                                                      \
-					PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 1);                     \
-				}                                                                   \
-			}                                                                       \
-		}                                                                           \
-																					\
-		/* flipped 8bpp case */                                                     \
-		else                                                                        \
-		{                                                                           \
-			/* iterate over pixels in Y */                                          \
-			for (cury = desty; cury <= destendy; cury++)                            \
-			{                                                                       \
-				PRIORITY_TYPE *priptr = PRIORITY_ADDR(priority, PRIORITY_TYPE, cury, destx); \
-				PIXEL_TYPE *destptr = &dest.pixt<PIXEL_TYPE>(cury, destx);          \
-				const UINT8 *srcptr = srcdata;                                      \
-				srcdata += dy;                                                      \
-																					\
-				/* iterate over unrolled blocks of 4 */                             \
-				for (curx = 0; curx < numblocks; curx++)                            \
-				{                                                                   \
-					PIXEL_OP(destptr[0], priptr[0], srcptr[ 0]);                    \
-					PIXEL_OP(destptr[1], priptr[1], srcptr[-1]);                    \
-					PIXEL_OP(destptr[2], priptr[2], srcptr[-2]);                    \
-					PIXEL_OP(destptr[3], priptr[3], srcptr[-3]);                    \
-																					\
-					srcptr -= 4;                                                    \
-					destptr += 4;                                                   \
-					PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 4);                     \
-				}                                                                   \
-																					\
-				/* iterate over leftover pixels */                                  \
-				for (curx = 0; curx < leftovers; curx++)                            \
-				{                                                                   \
-					PIXEL_OP(destptr[0], priptr[0], srcptr[0]);                     \
-					srcptr--;                                                       \
-					destptr++;                                                      \
-					PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 1);                     \
-				}                                                                   \
-			}                                                                       \
-		}                                                                           \
-	} while (0);                                                                        \
-	g_profiler.stop();                                                                  \
-} while (0)
+template<typename _PriorityType, bool _FlipX, class _BitmapClass, class _PixelOp>
+inline void drawgfx_core_rows(_BitmapClass &dest, bitmap_t &priority, const UINT8 *srcdata, INT32 dy,
+		INT32 destx, INT32 desty, INT32 destendx, INT32 destendy, const _PixelOp &op)
+{
+	typedef typename _BitmapClass::pixel_t pixel_t;
+	const int dx = _FlipX ? -1 : 1;
+
+	// compute how many blocks of 4 pixels we have
+	int count = destendx + 1 - destx;
+	UINT32 numblocks = count / 4;
+	UINT32 leftovers = count - 4 * numblocks;
+
+	// without a priority bitmap, the operation gets a dummy that is never advanced
+	_PriorityType nopriority[4];
+
+	// iterate over pixels in Y
+	for (INT32 cury = desty; cury <= destendy; cury++)
+	{
+		_PriorityType *priptr = PRIORITY_VALID(_PriorityType) ? &priority.pixt<_PriorityType>(cury, destx) : nopriority;
+		pixel_t *destptr = &dest.pix(cury, destx);
+		const UINT8 *srcptr = srcdata;
+		srcdata += dy;
+
+		// use the vector version of the operation if there is one
+		if (!_FlipX && drawgfx_span<_PixelOp, pixel_t, _PriorityType>::draw(op, destptr, srcptr, count))
+			continue;
+
+		// iterate over unrolled blocks of 4
+		for (UINT32 curx = 0; curx < numblocks; curx++)
+		{
+			op(destptr[0], priptr[0], srcptr[0 * dx]);
+			op(destptr[1], priptr[1], srcptr[1 * dx]);
+			op(destptr[2], priptr[2], srcptr[2 * dx]);
+			op(destptr[3], priptr[3], srcptr[3 * dx]);
+
+			srcptr += 4 * dx;
+			destptr += 4;
+			PRIORITY_ADVANCE(_PriorityType, priptr, 4);
+		}
+
+		// iterate over leftover pixels
+		for (UINT32 curx = 0; curx < leftovers; curx++)
+		{
+			op(destptr[0], priptr[0], srcptr[0]);
+			srcptr += dx;
+			destptr++;
+			PRIORITY_ADVANCE(_PriorityType, priptr, 1);
+		}
+	}
+}
+
+template<typename _PriorityType, class _BitmapClass, class _PixelOp>
+void drawgfx_core(gfx_element &gfx, _BitmapClass &dest, const rectangle &cliprect, UINT32 code,
+		int flipx, int flipy, INT32 destx, INT32 desty, bitmap_t &priority, const _PixelOp &op)
+{
+	assert(dest.valid());
+	assert(!PRIORITY_VALID(_PriorityType) || priority.valid());
+	assert(dest.cliprect().contains(cliprect));
+	assert(code < gfx.elements());
+
+	// ignore empty/invalid cliprects
+	if (cliprect.empty())
+		return;
+
+	// compute final pixel in X and exit if we are entirely clipped
+	INT32 destendx = destx + gfx.width() - 1;
+	if (destx > cliprect.max_x || destendx < cliprect.min_x)
+		return;
+
+	// apply left clip
+	INT32 srcx = 0;
+	if (destx < cliprect.min_x)
+	{
+		srcx = cliprect.min_x - destx;
+		destx = cliprect.min_x;
+	}
+
+	// apply right clip
+	if (destendx > cliprect.max_x)
+		destendx = cliprect.max_x;
+
+	// compute final pixel in Y and exit if we are entirely clipped
+	INT32 destendy = desty + gfx.height() - 1;
+	if (desty > cliprect.max_y || destendy < cliprect.min_y)
+		return;
+
+	// apply top clip
+	INT32 srcy = 0;
+	if (desty < cliprect.min_y)
+	{
+		srcy = cliprect.min_y - desty;
+		desty = cliprect.min_y;
+	}
+
+	// apply bottom clip
+	if (destendy > cliprect.max_y)
+		destendy = cliprect.max_y;
+
+	// apply X flipping
+	if (flipx)
+		srcx = gfx.width() - 1 - srcx;
+
+	// apply Y flipping
+	INT32 dy = gfx.rowbytes();
+	if (flipy)
+	{
+		srcy = gfx.height() - 1 - srcy;
+		dy = -dy;
+	}
+
+	g_profiler.start(PROFILER_DRAWGFX);
+
+	// fetch the source data, pointing at the first source pixel of the row
+	const UINT8 *srcdata = gfx.get_data(code) + srcy * gfx.rowbytes() + srcx;
+
+	// draw with the X direction fixed at compile time
+	if (!flipx)
+		drawgfx_core_rows<_PriorityType, false>(dest, priority, srcdata, dy, destx, desty, destendx, destendy, op);
+	else
+		drawgfx_core_rows<_PriorityType, true>(dest, priority, srcdata, dy, destx, desty, destendx, destendy, op);
+
+	g_profiler.stop();
+}
 
 
 
@@ -541,148 +621,133 @@ do {
 ***************************************************************************/
 
 /*
-    Assumed input parameters or local variables:
+    Parameters are as for drawgfx_core, plus:
 
-        bitmap_t &dest - the bitmap to render to
-        const rectangle &cliprect - a clipping rectangle (assumed to be clipped to the size of 'dest')
-        gfx_element *gfx - pointer to the gfx_element to render
-        UINT32 code - index of the entry within gfx_element
-        UINT32 color - index of the color within gfx_element
-        int flipx - non-zero means render right-to-left instead of left-to-right
-        int flipy - non-zero means render bottom-to-top instead of top-to-bottom
-        INT32 destx - the top-left X coordinate to render to
-        INT32 desty - the top-left Y coordinate to render to
         UINT32 scalex - the 16.16 scale factor in the X dimension
         UINT32 scaley - the 16.16 scale factor in the Y dimension
-        bitmap_t &priority - the priority bitmap (even if PRIORITY_TYPE is NO_PRIORITY, at least needs a dummy)
 */
 
-
-#define DRAWGFXZOOM_CORE(PIXEL_TYPE, PIXEL_OP, PRIORITY_TYPE)                           \
-do {                                                                                    \
-	g_profiler.start(PROFILER_DRAWGFX);                                                 \
-	do {                                                                                \
-		const UINT8 *srcdata;                                                           \
-		UINT32 dstwidth, dstheight;                                                     \
-		INT32 destendx, destendy;                                                       \
-		INT32 srcx, srcy;                                                               \
-		INT32 curx, cury;                                                               \
-		INT32 dx, dy;                                                                   \
-																						\
-		assert(dest.valid());                                                           \
-		assert(!PRIORITY_VALID(PRIORITY_TYPE) || priority.valid());                     \
-		assert(dest.cliprect().contains(cliprect));                                     \
-																						\
-		/* ignore empty/invalid cliprects */                                            \
-		if (cliprect.empty())                                                           \
-			break;                                                                      \
-																						\
-		/* compute scaled size */                                                       \
-		dstwidth = (scalex * width() + 0x8000) >> 16;                              \
-		dstheight = (scaley * height() + 0x8000) >> 16;                                \
-		if (dstwidth < 1 || dstheight < 1)                                              \
-			break;                                                                      \
-																						\
-		/* compute 16.16 source steps in dx and dy */                                   \
-		dx = (width() << 16) / dstwidth;                                               \
-		dy = (height() << 16) / dstheight;                                         \
-																						\
-		/* compute final pixel in X and exit if we are entirely clipped */              \
-		destendx = destx + dstwidth - 1;                                                \
-		if (destx > cliprect.max_x || destendx < cliprect.min_x)                        \
-			break;                                                                      \
-																						\
-		/* apply left clip */                                                           \
-		srcx = 0;                                                                       \
-		if (destx < cliprect.min_x)                                                 \
-		{                                                                               \
-			srcx = (cliprect.min_x - destx) * dx;                                       \
-			destx = cliprect.min_x;                                                 \
-		}                                                                               \
-																						\
-		/* apply right clip */                                                          \
-		if (destendx > cliprect.max_x)                                                  \
-			destendx = cliprect.max_x;                                                  \
-																						\
-		/* compute final pixel in Y and exit if we are entirely clipped */              \
-		destendy = desty + dstheight - 1;                                               \
-		if (desty > cliprect.max_y || destendy < cliprect.min_y)                        \
-		{                                                                               \
-			g_profiler.stop();                                                  \
-			return;                                                                     \
-		}                                                                               \
-																						\
-		/* apply top clip */                                                            \
-		srcy = 0;                                                                       \
-		if (desty < cliprect.min_y)                                                 \
-		{                                                                               \
-			srcy = (cliprect.min_y - desty) * dy;                                       \
-			desty = cliprect.min_y;                                                 \
-		}                                                                               \
-																						\
-		/* apply bottom clip */                                                         \
-		if (destendy > cliprect.max_y)                                                  \
-			destendy = cliprect.max_y;                                                  \
-																						\
-		/* apply X flipping */                                                          \
-		if (flipx)                                                                      \
-		{                                                                               \
-			srcx = (dstwidth - 1) * dx - srcx;                                          \
-			dx = -dx;                                                                   \
-		}                                                                               \
-																						\
-		/* apply Y flipping */                                                          \
-		if (flipy)                                                                      \
-		{                                                                               \
-			srcy = (dstheight - 1) * dy - srcy;                                         \
-			dy = -dy;                                                                   \
-		}                                                                               \
-																						\
-		/* fetch the source data */                                                     \
-		srcdata = get_data(code);                                      \
-																						\
-		/* compute how many blocks of 4 pixels we have */                           \
-		UINT32 numblocks = (destendx + 1 - destx) / 4;                              \
-		UINT32 leftovers = (destendx + 1 - destx) - 4 * numblocks;                  \
-																					\
-		/* iterate over pixels in Y */                                              \
-		for (cury = desty; cury <= destendy; cury++)                                \
-		{                                                                           \
-			PRIORITY_TYPE *priptr = PRIORITY_ADDR(priority, PRIORITY_TYPE, cury, destx); \
-			PIXEL_TYPE *destptr = &dest.pixt<PIXEL_TYPE>(cury, destx);              \
-			const UINT8 *srcptr = srcdata + (srcy >> 16) * rowbytes();     \
-			INT32 cursrcx = srcx;                                                   \
-			srcy += dy;                                                             \
-																					\
-			/* iterate over unrolled blocks of 4 */                                 \
-			for (curx = 0; curx < numblocks; curx++)                                \
-			{                                                                       \
-				PIXEL_OP(destptr[0], priptr[0], srcptr[cursrcx >> 16]);             \
-				cursrcx += dx;                                                      \
-				PIXEL_OP(destptr[1], priptr[1], srcptr[cursrcx >> 16]);             \
-				cursrcx += dx;                                                      \
-				PIXEL_OP(destptr[2], priptr[2], srcptr[cursrcx >> 16]);             \
-				cursrcx += dx;                                                      \
-				PIXEL_OP(destptr[3], priptr[3], srcptr[cursrcx >> 16]);             \
-				cursrcx += dx;                                                      \
-																					\
-				destptr += 4;                                                       \
-				PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 4);                         \
-			}                                                                       \
-																					\
-			/* iterate over leftover pixels */                                      \
-			for (curx = 0; curx < leftovers; curx++)                                \
-			{                                                                       \
-				PIXEL_OP(destptr[0], priptr[0], srcptr[cursrcx >> 16]);             \
-				cursrcx += dx;                                                      \
-				destptr++;                                                          \
-				PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 1);                         \
-			}                                                                       \
-		}                                                                           \
-	} while (0);                                                                        \
-	g_profiler.stop();                                                      \
-} while (0)
-
+template<typename _PriorityType, class _BitmapClass, class _PixelOp>
+void drawgfxzoom_core(gfx_element &gfx, _BitmapClass &dest, const rectangle &cliprect, UINT32 code,
+		int flipx, int flipy, INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, bitmap_t &priority, const _PixelOp &op)
+{
+	typedef typename _BitmapClass::pixel_t pixel_t;
+
+	assert(dest.valid());
+	assert(!PRIORITY_VALID(_PriorityType) || priority.valid());
+	assert(dest.cliprect().contains(cliprect));
+
+	// ignore empty/invalid cliprects
+	if (cliprect.empty())
+		return;
+
+	// compute scaled size
+	UINT32 dstwidth = (scalex * gfx.width() + 0x8000) >> 16;
+	UINT32 dstheight = (scaley * gfx.height() + 0x8000) >> 16;
+	if (dstwidth < 1 || dstheight < 1)
+		return;
+
+	// compute 16.16 source steps in dx and dy
+	INT32 dx = (gfx.width() << 16) / dstwidth;
+	INT32 dy = (gfx.height() << 16) / dstheight;
+
+	// compute final pixel in X and exit if we are entirely clipped
+	INT32 destendx = destx + dstwidth - 1;
+	if (destx > cliprect.max_x || destendx < cliprect.min_x)
+		return;
+
+	// apply left clip
+	INT32 srcx = 0;
+	if (destx < cliprect.min_x)
+	{
+		srcx = (cliprect.min_x - destx) * dx;
+		destx = cliprect.min_x;
+	}
+
+	// apply right clip
+	if (destendx > cliprect.max_x)
+		destendx = cliprect.max_x;
+
+	// compute final pixel in Y and exit if we are entirely clipped
+	INT32 destendy = desty + dstheight - 1;
+	if (desty > cliprect.max_y || destendy < cliprect.min_y)
+		return;
+
+	// apply top clip
+	INT32 srcy = 0;
+	if (desty < cliprect.min_y)
+	{
+		srcy = (cliprect.min_y - desty) * dy;
+		desty = cliprect.min_y;
+	}
+
+	// apply bottom clip
+	if (destendy > cliprect.max_y)
+		destendy = cliprect.max_y;
+
+	// apply X flipping
+	if (flipx)
+	{
+		srcx = (dstwidth - 1) * dx - srcx;
+		dx = -dx;
+	}
+
+	// apply Y flipping
+	if (flipy)
+	{
+		srcy = (dstheight - 1) * dy - srcy;
+		dy = -dy;
+	}
+
+	g_profiler.start(PROFILER_DRAWGFX);
+
+	// fetch the source data
+	const UINT8 *srcdata = gfx.get_data(code);
+
+	// compute how many blocks of 4 pixels we have
+	UINT32 numblocks = (destendx + 1 - destx) / 4;
+	UINT32 leftovers = (destendx + 1 - destx) - 4 * numblocks;
+
+	// without a priority bitmap, the operation gets a dummy that is never advanced
+	_PriorityType nopriority[4];
+
+	// iterate over pixels in Y
+	for (INT32 cury = desty; cury <= destendy; cury++)
+	{
+		_PriorityType *priptr = PRIORITY_VALID(_PriorityType) ? &priority.pixt<_PriorityType>(cury, destx) : nopriority;
+		pixel_t *destptr = &dest.pix(cury, destx);
+		const UINT8 *srcptr = srcdata + (srcy >> 16) * gfx.rowbytes();
+		INT32 cursrcx = srcx;
+		srcy += dy;
+
+		// iterate over unrolled blocks of 4
+		for (UINT32 curx = 0; curx < numblocks; curx++)
+		{
+			op(destptr[0], priptr[0], srcptr[cursrcx >> 16]);
+			cursrcx += dx;
+			op(destptr[1], priptr[1], srcptr[cursrcx >> 16]);
+			cursrcx += dx;
+			op(destptr[2], priptr[2], srcptr[cursrcx >> 16]);
+			cursrcx += dx;
+			op(destptr[3], priptr[3], srcptr[cursrcx >> 16]);
+			cursrcx += dx;
+
+			destptr += 4;
+			PRIORITY_ADVANCE(_PriorityType, priptr, 4);
+		}
+
+		// iterate over leftover pixels
+		for (UINT32 curx = 0; curx < leftovers; curx++)
+		{
+			op(destptr[0], priptr[0], srcptr[cursrcx >> 16]);
+			cursrcx += dx;
+			destptr++;
+			PRIORITY_ADVANCE(_PriorityType, priptr, 1);
+		}
+	}
+
+	g_profiler.stop();
+}
 
 
 /***************************************************************************
@@ -100,6 +100,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_USE_BEZELS ";bezel",                        "1",         OPTION_BOOLEAN,    "enable bezels if artwork is enabled and available" },
 	{ OPTION_USE_CPANELS ";cpanel",                      "1",         OPTION_BOOLEAN,    "enable cpanels if artwork is enabled and available" },
 	{ OPTION_USE_MARQUEES ";marquee",                    "1",         OPTION_BOOLEAN,    "enable marquees if artwork is enabled and available" },
+	{ OPTION_ARTWORK_CACHE,                              "0",         OPTION_INTEGER,    "megabytes of scaled artwork to keep across all targets (0 = no limit)" },
 
 	// screen options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE SCREEN OPTIONS" },
@@ -173,6 +174,12 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_PASSES,                                 "0",         OPTION_BOOLEAN,    "run the experimental UML optimizer passes in DRC cores" },
+	{ OPTION_DRC_M68K,                                   "0",         OPTION_BOOLEAN,    "enable the experimental 68000/68010/68020 DRC core (needs -drc)" },
+	{ OPTION_DRC_I386,                                   "0",         OPTION_BOOLEAN,    "enable the experimental i386 family DRC core (needs -drc)" },
+	{ OPTION_DRC_SH4,                                    "0",         OPTION_BOOLEAN,    "enable the experimental SH-4 DRC core (needs -drc)" },
+	{ OPTION_PREDECODE,                                  "0",         OPTION_BOOLEAN,    "run interpreters from pre-decoded code if available" },
+	{ OPTION_BATCH_IDLE,                                 "0",         OPTION_BOOLEAN,    "let CPUs that support it skip loops polling unchanged inputs" },
 	{ OPTION_BIOS,                                       NULL,        OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the information screen at startup" },
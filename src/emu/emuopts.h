@@ -109,6 +109,7 @@ enum
 #define OPTION_USE_BEZELS           "use_bezels"
 #define OPTION_USE_CPANELS          "use_cpanels"
 #define OPTION_USE_MARQUEES         "use_marquees"
+#define OPTION_ARTWORK_CACHE        "artwork_cache"
 
 // core screen options
 #define OPTION_BRIGHTNESS           "brightness"
@@ -168,6 +169,12 @@ enum
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_PASSES           "drc_passes"
+#define OPTION_DRC_M68K             "drc_m68k"
+#define OPTION_DRC_I386             "drc_i386"
+#define OPTION_DRC_SH4              "drc_sh4"
+#define OPTION_PREDECODE            "predecode"
+#define OPTION_BATCH_IDLE           "batchidle"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -286,6 +293,7 @@ public:
 	bool use_bezels() const { return bool_value(OPTION_USE_BEZELS); }
 	bool use_cpanels() const { return bool_value(OPTION_USE_CPANELS); }
 	bool use_marquees() const { return bool_value(OPTION_USE_MARQUEES); }
+	int artwork_cache() const { return int_value(OPTION_ARTWORK_CACHE); }
 
 	// core screen options
 	float brightness() const { return float_value(OPTION_BRIGHTNESS); }
@@ -343,6 +351,12 @@ public:
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_passes() const { return bool_value(OPTION_DRC_PASSES); }
+	bool drc_m68k() const { return bool_value(OPTION_DRC_M68K); }
+	bool drc_i386() const { return bool_value(OPTION_DRC_I386); }
+	bool drc_sh4() const { return bool_value(OPTION_DRC_SH4); }
+	bool predecode() const { return bool_value(OPTION_PREDECODE); }
+	bool batch_idle() const { return bool_value(OPTION_BATCH_IDLE); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -0,0 +1,190 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    gfxspan.h
+
+    SIMD helpers for drawing one unflipped, unzoomed row of an 8bpp
+    gfx element into a 16bpp indexed bitmap.
+
+****************************************************************************
+
+    Each helper has a plain C version with a _c suffix that does exactly
+    what the matching PIXEL_OP_* macro in drawgfxm.h does per pixel, and
+    a vector version that must produce the same result bit for bit. The
+    vector version is chosen at compile time the same way rendspan.h does
+    it: SSE2 on 64-bit x86 builds, NEON when the compiler targets it, and
+    the C versions otherwise.
+
+    Rows are processed 16 source pixels at a time, which covers the usual
+    8 and 16 pixel wide tiles and sprites without a scalar tail.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __GFXSPAN_H__
+#define __GFXSPAN_H__
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define GFXSPAN_SSE2        1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define GFXSPAN_NEON        1
+#include <arm_neon.h>
+#endif
+
+
+
+/***************************************************************************
+    REFERENCE IMPLEMENTATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    gfx_span_rebase_opaque_c - add 'color' to
+    every pen (PIXEL_OP_REBASE_OPAQUE)
+-------------------------------------------------*/
+
+inline void gfx_span_rebase_opaque_c(UINT16 *dest, const UINT8 *source, int count, UINT32 color)
+{
+	for (int i = 0; i < count; i++)
+		dest[i] = color + source[i];
+}
+
+
+/*-------------------------------------------------
+    gfx_span_rebase_transpen_c - add 'color' to
+    every pen except 'trans_pen', which is left
+    undrawn (PIXEL_OP_REBASE_TRANSPEN)
+-------------------------------------------------*/
+
+inline void gfx_span_rebase_transpen_c(UINT16 *dest, const UINT8 *source, int count, UINT32 color, UINT32 trans_pen)
+{
+	for (int i = 0; i < count; i++)
+		if (source[i] != trans_pen)
+			dest[i] = color + source[i];
+}
+
+
+
+/***************************************************************************
+    VECTOR IMPLEMENTATIONS
+***************************************************************************/
+
+#if defined(GFXSPAN_SSE2)
+
+inline void gfx_span_rebase_opaque(UINT16 *dest, const UINT8 *source, int count, UINT32 color)
+{
+	const __m128i vcolor = _mm_set1_epi16(color);
+	const __m128i zero = _mm_setzero_si128();
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		__m128i pens = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i + 0]), _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), vcolor));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i + 8]), _mm_add_epi16(_mm_unpackhi_epi8(pens, zero), vcolor));
+	}
+	if (i + 8 <= count)
+	{
+		__m128i pens = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), vcolor));
+		i += 8;
+	}
+	gfx_span_rebase_opaque_c(&dest[i], &source[i], count - i, color);
+}
+
+inline void gfx_span_rebase_transpen(UINT16 *dest, const UINT8 *source, int count, UINT32 color, UINT32 trans_pen)
+{
+	// byte compares can't see pens above 8 bits; nothing matches them anyway
+	if (trans_pen > 0xff)
+	{
+		gfx_span_rebase_opaque(dest, source, count, color);
+		return;
+	}
+
+	const __m128i vcolor = _mm_set1_epi16(color);
+	const __m128i vtrans = _mm_set1_epi8(trans_pen);
+	const __m128i zero = _mm_setzero_si128();
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		// widen the byte results to one per 16-bit pixel
+		__m128i pens = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		__m128i skip = _mm_cmpeq_epi8(pens, vtrans);
+		__m128i skiplo = _mm_unpacklo_epi8(skip, skip);
+		__m128i skiphi = _mm_unpackhi_epi8(skip, skip);
+		__m128i pixlo = _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), vcolor);
+		__m128i pixhi = _mm_add_epi16(_mm_unpackhi_epi8(pens, zero), vcolor);
+		__m128i oldlo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[i + 0]));
+		__m128i oldhi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[i + 8]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i + 0]), _mm_or_si128(_mm_and_si128(skiplo, oldlo), _mm_andnot_si128(skiplo, pixlo)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i + 8]), _mm_or_si128(_mm_and_si128(skiphi, oldhi), _mm_andnot_si128(skiphi, pixhi)));
+	}
+	if (i + 8 <= count)
+	{
+		__m128i pens = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[i]));
+		__m128i skip = _mm_cmpeq_epi8(pens, vtrans);
+		skip = _mm_unpacklo_epi8(skip, skip);
+		__m128i pix = _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), vcolor);
+		__m128i old = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_or_si128(_mm_and_si128(skip, old), _mm_andnot_si128(skip, pix)));
+		i += 8;
+	}
+	gfx_span_rebase_transpen_c(&dest[i], &source[i], count - i, color, trans_pen);
+}
+
+#elif defined(GFXSPAN_NEON)
+
+inline void gfx_span_rebase_opaque(UINT16 *dest, const UINT8 *source, int count, UINT32 color)
+{
+	const uint16x8_t vcolor = vdupq_n_u16(color);
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		uint8x16_t pens = vld1q_u8(&source[i]);
+		vst1q_u16(&dest[i + 0], vaddq_u16(vmovl_u8(vget_low_u8(pens)), vcolor));
+		vst1q_u16(&dest[i + 8], vaddq_u16(vmovl_u8(vget_high_u8(pens)), vcolor));
+	}
+	if (i + 8 <= count)
+	{
+		vst1q_u16(&dest[i], vaddq_u16(vmovl_u8(vld1_u8(&source[i])), vcolor));
+		i += 8;
+	}
+	gfx_span_rebase_opaque_c(&dest[i], &source[i], count - i, color);
+}
+
+inline void gfx_span_rebase_transpen(UINT16 *dest, const UINT8 *source, int count, UINT32 color, UINT32 trans_pen)
+{
+	// byte compares can't see pens above 8 bits; nothing matches them anyway
+	if (trans_pen > 0xff)
+	{
+		gfx_span_rebase_opaque(dest, source, count, color);
+		return;
+	}
+
+	const uint16x8_t vcolor = vdupq_n_u16(color);
+	const uint8x8_t vtrans = vdup_n_u8(trans_pen);
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		// widen the byte results to one per 16-bit pixel
+		uint8x8_t pens = vld1_u8(&source[i]);
+		uint16x8_t skip = vmovl_u8(vceq_u8(pens, vtrans));
+		skip = vorrq_u16(skip, vshlq_n_u16(skip, 8));
+		vst1q_u16(&dest[i], vbslq_u16(skip, vld1q_u16(&dest[i]), vaddq_u16(vmovl_u8(pens), vcolor)));
+	}
+	gfx_span_rebase_transpen_c(&dest[i], &source[i], count - i, color, trans_pen);
+}
+
+#else
+
+inline void gfx_span_rebase_opaque(UINT16 *dest, const UINT8 *source, int count, UINT32 color) { gfx_span_rebase_opaque_c(dest, source, count, color); }
+inline void gfx_span_rebase_transpen(UINT16 *dest, const UINT8 *source, int count, UINT32 color, UINT32 trans_pen) { gfx_span_rebase_transpen_c(dest, source, count, color, trans_pen); }
+
+#endif
+
+#endif  /* __GFXSPAN_H__ */
@@ -3658,7 +3658,8 @@ direct_read_data::direct_read_data(address_space &space)
 		m_bytemask(space.bytemask()),
 		m_bytestart(1),
 		m_byteend(0),
-		m_entry(STATIC_UNMAP)
+		m_entry(STATIC_UNMAP),
+		m_generation(0)
 {
 }
 
@@ -3783,6 +3784,7 @@ direct_update_delegate direct_read_data::set_direct_update(direct_update_delegat
 {
 	direct_update_delegate old = m_directupdate;
 	m_directupdate = function;
+	m_generation++;
 	return old;
 }
 
@@ -3799,6 +3801,7 @@ void direct_read_data::explicit_configure(offs_t bytestart, offs_t byteend, offs
 	m_byteend = byteend;
 	m_bytemask = bytemask;
 	m_ptr = reinterpret_cast<UINT8 *>(ptr) - (bytestart & bytemask);
+	m_generation++;
 }
 
 
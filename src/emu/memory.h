@@ -168,13 +168,15 @@ public:
 	// getters
 	address_space &space() const { return m_space; }
 	UINT8 *ptr() const { return m_ptr; }
+	UINT32 generation() const { return m_generation; }
 
 	// see if an address is within bounds, or attempt to update it if not
 	bool address_is_valid(offs_t byteaddress) { return EXPECTED(byteaddress >= m_bytestart && byteaddress <= m_byteend) || set_direct_region(byteaddress); }
 
-	// force a recomputation on the next read
-	void force_update() { m_byteend = 0; m_bytestart = 1; }
-	void force_update(UINT16 if_match) { if (m_entry == if_match) force_update(); }
+	// force a recomputation on the next read; the generation moves on every
+	// change to the table, as other users may have looked up other entries
+	void force_update() { m_byteend = 0; m_bytestart = 1; m_generation++; }
+	void force_update(UINT16 if_match) { if (m_entry == if_match) force_update(); else m_generation++; }
 
 	// custom update callbacks and configuration
 	direct_update_delegate set_direct_update(direct_update_delegate function);
@@ -200,6 +202,7 @@ private:
 	offs_t                      m_bytestart;            // minimum valid byte address
 	offs_t                      m_byteend;              // maximum valid byte address
 	UINT16                      m_entry;                // live entry
+	UINT32                      m_generation;           // bumped whenever the mapping may have changed
 	simple_list<direct_range>   m_rangelist[TOTAL_MEMORY_BANKS];  // list of ranges for each entry
 	simple_list<direct_range>   m_freerangelist;        // list of recycled range entries
 	direct_update_delegate      m_directupdate;         // fast direct-access update callback
@@ -335,7 +335,10 @@ render_texture::render_texture()
 		m_osddata(~0L),
 		m_scaler(NULL),
 		m_param(NULL),
-		m_curseq(0)
+		m_curseq(0),
+		m_async(false),
+		m_pending(NULL),
+		m_pending_bitmap(NULL)
 {
 	m_sbounds.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
@@ -367,6 +370,7 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 		m_param = param;
 	}
 	m_osddata = ~0L;
+	m_async = false;
 }
 
 
@@ -376,14 +380,19 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 
 void render_texture::release()
 {
-	// free all scaled versions
-	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+	// wait for any scaling still in flight
+	if (m_pending != NULL)
 	{
-		m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-		global_free(m_scaled[scalenum].bitmap);
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
+		osd_work_item_wait(m_pending, osd_ticks_per_second() * 100);
+		osd_work_item_release(m_pending);
+		m_pending = NULL;
 	}
+	global_free(m_pending_bitmap);
+	m_pending_bitmap = NULL;
+
+	// free all scaled versions
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		free_scaled(scalenum);
 
 	// invalidate references to the original bitmap as well
 	m_manager->invalidate_all(m_bitmap);
@@ -417,15 +426,7 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 
 	// invalidate all scaled versions
 	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-	{
-		if (m_scaled[scalenum].bitmap != NULL)
-		{
-			m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-			global_free(m_scaled[scalenum].bitmap);
-		}
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
-	}
+		free_scaled(scalenum);
 }
 
 
@@ -443,10 +444,13 @@ void render_texture::hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const
 
 
 //-------------------------------------------------
-//  get_scaled - get a scaled bitmap (if we can)
+//  get_scaled - get a scaled bitmap (if we can);
+//  returns the bitmap the primitive list now
+//  holds a reference to, or NULL if it is only
+//  standing in for a size still being scaled
 //-------------------------------------------------
 
-void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist)
+void *render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist)
 {
 	// source width/height come from the source bounds
 	int swidth = m_sbounds.width();
@@ -469,6 +473,7 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		texinfo.height = sheight;
 		// palette will be set later
 		texinfo.seqid = ++m_curseq;
+		return m_bitmap;
 	}
 	else
 	{
@@ -476,6 +481,11 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		bitmap_argb32 dummy;
 		bitmap_argb32 &srcbitmap = (m_bitmap != NULL) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
 
+		// pick up anything the worker thread has finished
+		UINT64 oldbytes = m_manager->m_scaled_bytes;
+		if (m_pending != NULL && osd_work_item_wait(m_pending, 0))
+			finish_async_scale(primlist);
+
 		// is it a size we already have?
 		scaled_texture *scaled = NULL;
 		int scalenum;
@@ -489,44 +499,155 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		}
 
 		// did we get one?
+		bool standin = false;
 		if (scalenum == ARRAY_LENGTH(m_scaled))
 		{
-			int lowest = -1;
-
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
-					lowest = scalenum;
-			assert_always(lowest != -1, "Too many live texture instances!");
-
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap != NULL)
+			// if we can scale on the worker thread, show the closest size we have in the meantime
+			scaled = NULL;
+			if (m_async && m_bitmap == NULL && m_manager->m_scale_queue != NULL)
+				for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+					if (m_scaled[scalenum].bitmap != NULL && (scaled == NULL ||
+						abs(m_scaled[scalenum].bitmap->width() * m_scaled[scalenum].bitmap->height() - int(dwidth * dheight)) <
+						abs(scaled->bitmap->width() * scaled->bitmap->height() - int(dwidth * dheight))))
+						scaled = &m_scaled[scalenum];
+
+			if (scaled != NULL)
 			{
-				m_manager->invalidate_all(scaled->bitmap);
-				global_free(scaled->bitmap);
+				// only one size is scaled at a time; a newer request waits until it is done
+				standin = true;
+				if (m_pending == NULL)
+				{
+					m_pending_bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
+					m_pending = osd_work_item_queue(m_manager->m_scale_queue, async_scale, this, 0);
+				}
+			}
+			else
+			{
+				// otherwise scale it now
+				scaled = &m_scaled[alloc_scaled(primlist)];
+				scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
+				scaled->seqid = ++m_curseq;
+				m_manager->m_scaled_bytes += scaled->bitmap->rowbytes() * scaled->bitmap->height();
+
+				// let the scaler do the work
+				(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
 			}
-
-			// allocate a new bitmap
-			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
-			scaled->seqid = ++m_curseq;
-
-			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
 		}
 
 		// finally fill out the new info
+		scaled->lastuse = ++m_manager->m_scaled_clock;
 		primlist.add_reference(scaled->bitmap);
 		texinfo.base = &scaled->bitmap->pix32(0);
 		texinfo.rowpixels = scaled->bitmap->rowpixels();
-		texinfo.width = dwidth;
-		texinfo.height = dheight;
+		texinfo.width = scaled->bitmap->width();
+		texinfo.height = scaled->bitmap->height();
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
+
+		// keep the shared cache within its budget, now that this one is referenced
+		if (m_manager->m_scaled_bytes > oldbytes)
+			m_manager->trim_scaled_textures(primlist);
+		return standin ? NULL : scaled->bitmap;
 	}
 }
 
 
+//-------------------------------------------------
+//  alloc_scaled - pick a slot for a new scaled
+//  bitmap, throwing out the least recently used
+//  one if they are all full
+//-------------------------------------------------
+
+int render_texture::alloc_scaled(render_primitive_list &primlist)
+{
+	int lowest = -1;
+
+	// take the entry that was drawn longest ago; empty ones have never been drawn
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if ((lowest == -1 || m_scaled[scalenum].lastuse < m_scaled[lowest].lastuse) && !primlist.has_reference(m_scaled[scalenum].bitmap))
+			lowest = scalenum;
+	assert_always(lowest != -1, "Too many live texture instances!");
+
+	// throw out any existing entry
+	free_scaled(lowest);
+	return lowest;
+}
+
+
+//-------------------------------------------------
+//  free_scaled - throw out a scaled bitmap
+//-------------------------------------------------
+
+void render_texture::free_scaled(int scalenum)
+{
+	scaled_texture &scaled = m_scaled[scalenum];
+	if (scaled.bitmap != NULL)
+	{
+		m_manager->invalidate_all(scaled.bitmap);
+		m_manager->m_scaled_bytes -= scaled.bitmap->rowbytes() * scaled.bitmap->height();
+		global_free(scaled.bitmap);
+	}
+	scaled.bitmap = NULL;
+	scaled.seqid = 0;
+	scaled.lastuse = 0;
+}
+
+
+//-------------------------------------------------
+//  finish_async_scale - move a bitmap the worker
+//  thread has finished into the scaled array
+//-------------------------------------------------
+
+void render_texture::finish_async_scale(render_primitive_list &primlist)
+{
+	osd_work_item_release(m_pending);
+	m_pending = NULL;
+
+	// drop it if the same size was scaled some other way in the meantime
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if (m_scaled[scalenum].bitmap != NULL && m_scaled[scalenum].bitmap->width() == m_pending_bitmap->width() && m_scaled[scalenum].bitmap->height() == m_pending_bitmap->height())
+		{
+			global_free(m_pending_bitmap);
+			m_pending_bitmap = NULL;
+			return;
+		}
+
+	scaled_texture &scaled = m_scaled[alloc_scaled(primlist)];
+	scaled.bitmap = m_pending_bitmap;
+	scaled.seqid = ++m_curseq;
+	m_manager->m_scaled_bytes += scaled.bitmap->rowbytes() * scaled.bitmap->height();
+	m_pending_bitmap = NULL;
+}
+
+
+//-------------------------------------------------
+//  touch_scaled - note that a scaled bitmap is
+//  still being drawn without going through
+//  get_scaled
+//-------------------------------------------------
+
+void render_texture::touch_scaled(void *refptr)
+{
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if (m_scaled[scalenum].bitmap == refptr)
+			m_scaled[scalenum].lastuse = ++m_manager->m_scaled_clock;
+}
+
+
+//-------------------------------------------------
+//  async_scale - work item callback that runs
+//  the scaler for a pending size
+//-------------------------------------------------
+
+void *render_texture::async_scale(void *param, int threadid)
+{
+	render_texture *texture = reinterpret_cast<render_texture *>(param);
+	bitmap_argb32 dummy;
+	(*texture->m_scaler)(*texture->m_pending_bitmap, dummy, texture->m_sbounds, texture->m_param);
+	return NULL;
+}
+
+
 //-------------------------------------------------
 //  get_adjusted_palette - return the adjusted
 //  palette for a texture
@@ -924,7 +1045,9 @@ render_target::render_target(render_manager &manager, const char *layoutfile, UI
 		m_base_view(NULL),
 		m_base_orientation(ROT0),
 		m_maxtexwidth(65536),
-		m_maxtexheight(65536)
+		m_maxtexheight(65536),
+		m_prims_reused(0),
+		m_prims_rebuilt(0)
 {
 	// determine the base layer configuration based on options
 	m_base_layerconfig.set_backdrops_enabled(manager.machine().options().use_backdrops());
@@ -973,6 +1096,8 @@ render_target::render_target(render_manager &manager, const char *layoutfile, UI
 
 render_target::~render_target()
 {
+	if (m_prims_reused + m_prims_rebuilt != 0)
+		osd_printf_verbose("Render target: %d primitives reused, %d rebuilt\n", (int)m_prims_reused, (int)m_prims_rebuilt);
 }
 
 
@@ -1271,6 +1396,8 @@ render_primitive_list &render_target::get_primitives()
 
 	// free any previous primitives
 	list.release_all();
+	UINT64 reused = m_prims_reused;
+	int elemindex = 0;
 
 	// compute the visible width/height
 	INT32 viswidth, visheight;
@@ -1319,7 +1446,7 @@ render_primitive_list &render_target::get_primitives()
 					if (curitem->screen() != NULL)
 						add_container_primitives(list, item_xform, curitem->screen()->container(), blendmode);
 					else
-						add_element_primitives(list, item_xform, *curitem->element(), curitem->state(), blendmode);
+						add_cached_element_primitives(list, item_xform, *curitem, blendmode, elemindex++);
 				}
 			}
 		}
@@ -1379,6 +1506,9 @@ render_primitive_list &render_target::get_primitives()
 		add_container_primitives(list, ui_xform, m_manager.ui_container(), BLENDMODE_ALPHA);
 	}
 
+	// everything we didn't copy from the element cache was built from scratch
+	m_prims_rebuilt += list.m_primlist.count() - (m_prims_reused - reused);
+
 	// optimize the list before handing it off
 	add_clear_and_optimize_primitive_list(list);
 	list.release_lock();
@@ -1412,6 +1542,21 @@ bool render_target::map_point_input(INT32 target_x, INT32 target_y, ioport_port
 }
 
 
+//-------------------------------------------------
+//  has_reference - return true if any of our
+//  primitive lists holds the given pointer
+//-------------------------------------------------
+
+bool render_target::has_reference(void *refptr) const
+{
+	// the lists are only rebuilt on this thread, so there is no need to lock
+	for (int listnum = 0; listnum < ARRAY_LENGTH(m_primlist); listnum++)
+		if (m_primlist[listnum].has_reference(refptr))
+			return true;
+	return false;
+}
+
+
 //-------------------------------------------------
 //  invalidate_all - if any of our primitive lists
 //  contain a reference to the given pointer,
@@ -1431,6 +1576,11 @@ void render_target::invalidate_all(void *refptr)
 			list.release_all();
 		list.release_lock();
 	}
+
+	// forget any element primitives built from it
+	for (int cachenum = 0; cachenum < (int)m_element_cache.size(); cachenum++)
+		if (m_element_cache[cachenum].refptr == refptr)
+			m_element_cache[cachenum].item = NULL;
 }
 
 
@@ -1823,11 +1973,11 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 //  for an element in the current state
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode)
+void *render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode)
 {
 	// if we're out of range, bail
 	if (state > element.maxstate())
-		return;
+		return NULL;
 	if (state < 0)
 		state = 0;
 
@@ -1851,8 +2001,7 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		height = MIN(height, m_maxtexheight);
 
 		// get the scaled texture and append it
-
-		texture->get_scaled(width, height, prim->texture, list);
+		void *refptr = texture->get_scaled(width, height, prim->texture, list);
 
 		// compute the clip rect
 		render_bounds cliprect;
@@ -1868,7 +2017,78 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 		// add to the list or free if we're clipped out
 		list.append_or_return(*prim, clipped);
+		return refptr;
 	}
+	return NULL;
+}
+
+
+//-------------------------------------------------
+//  add_cached_element_primitives - add the
+//  primitive for a layout element item, copying
+//  it from the last frame if nothing it depends
+//  on has changed
+//-------------------------------------------------
+
+void render_target::add_cached_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view::item &item, int blendmode, int cacheindex)
+{
+	if (cacheindex >= (int)m_element_cache.size())
+	{
+		element_cache empty;
+		memset(&empty, 0, sizeof(empty));
+		m_element_cache.resize(cacheindex + 1, empty);
+	}
+	element_cache &cache = m_element_cache[cacheindex];
+
+	// if everything matches, copy the primitive we built last time
+	if (cache.item == &item && cache.state == item.state() && cache.blendmode == blendmode &&
+		cache.xoffs == xform.xoffs && cache.yoffs == xform.yoffs && cache.xscale == xform.xscale && cache.yscale == xform.yscale &&
+		cache.orientation == xform.orientation && memcmp(&cache.color, &xform.color, sizeof(cache.color)) == 0 &&
+		memcmp(&cache.cliprect, &m_bounds, sizeof(cache.cliprect)) == 0 &&
+		cache.maxtexwidth == m_maxtexwidth && cache.maxtexheight == m_maxtexheight)
+	{
+		if (cache.visible)
+		{
+			render_primitive *prim = list.alloc(render_primitive::QUAD);
+			prim->bounds = cache.prim.bounds;
+			prim->color = cache.prim.color;
+			prim->flags = cache.prim.flags;
+			prim->texture = cache.prim.texture;
+			prim->texcoords = cache.prim.texcoords;
+			list.add_reference(cache.refptr);
+			list.append(*prim);
+			cache.texture->touch_scaled(cache.refptr);
+			m_prims_reused++;
+		}
+		return;
+	}
+
+	// otherwise, build it from scratch and remember what we built it from; don't
+	// keep anything drawn with a stand-in while the real size is being scaled
+	int count = list.m_primlist.count();
+	cache.refptr = add_element_primitives(list, xform, *item.element(), item.state(), blendmode);
+	cache.visible = (list.m_primlist.count() != count);
+	if (cache.visible)
+		cache.prim = *list.m_primlist.last();
+	if (cache.refptr == NULL)
+	{
+		cache.item = NULL;
+		return;
+	}
+
+	cache.item = &item;
+	cache.texture = item.element()->state_texture(MAX(item.state(), 0));
+	cache.state = item.state();
+	cache.blendmode = blendmode;
+	cache.xoffs = xform.xoffs;
+	cache.yoffs = xform.yoffs;
+	cache.xscale = xform.xscale;
+	cache.yscale = xform.yscale;
+	cache.orientation = xform.orientation;
+	cache.color = xform.color;
+	cache.cliprect = m_bounds;
+	cache.maxtexwidth = m_maxtexwidth;
+	cache.maxtexheight = m_maxtexheight;
 }
 
 
@@ -2393,6 +2613,10 @@ done:
 
 render_manager::render_manager(running_machine &machine)
 	: m_machine(machine),
+		m_scaled_bytes(0),
+		m_scaled_budget(UINT64(machine.options().artwork_cache()) << 20),
+		m_scaled_clock(0),
+		m_scale_queue((machine.options().artwork_cache() != 0) ? osd_work_queue_alloc(0) : NULL),
 		m_ui_target(NULL),
 		m_live_textures(0),
 		m_ui_container(global_alloc(render_container(*this)))
@@ -2417,6 +2641,11 @@ render_manager::~render_manager()
 	container_free(m_ui_container);
 	m_screen_container_list.reset();
 
+	// free the targets too, so their textures are done scaling before the queue goes away
+	m_targetlist.reset();
+	if (m_scale_queue != NULL)
+		osd_work_queue_free(m_scale_queue);
+
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
 }
@@ -2548,6 +2777,8 @@ render_texture *render_manager::texture_alloc(texture_scaler_func scaler, void *
 	render_texture *tex = m_texture_allocator.alloc();
 	tex->reset(*this, scaler, param);
 	m_live_textures++;
+	if (scaler != NULL)
+		m_scaled_textures.push_back(tex);
 	return tex;
 }
 
@@ -2562,11 +2793,67 @@ void render_manager::texture_free(render_texture *texture)
 	{
 		m_live_textures--;
 		texture->release();
+		for (int texnum = 0; texnum < (int)m_scaled_textures.size(); texnum++)
+			if (m_scaled_textures[texnum] == texture)
+			{
+				m_scaled_textures.erase(m_scaled_textures.begin() + texnum);
+				break;
+			}
 	}
 	m_texture_allocator.reclaim(texture);
 }
 
 
+//-------------------------------------------------
+//  trim_scaled_textures - throw out the least
+//  recently drawn scaled bitmaps until we are
+//  within the memory budget
+//-------------------------------------------------
+
+void render_manager::trim_scaled_textures(render_primitive_list &primlist)
+{
+	while (m_scaled_budget != 0 && m_scaled_bytes > m_scaled_budget)
+	{
+		// find the oldest bitmap neither the list being built nor any target's current lists need
+		render_texture *oldest = NULL;
+		int oldestnum = 0;
+		for (int texnum = 0; texnum < (int)m_scaled_textures.size(); texnum++)
+		{
+			render_texture *texture = m_scaled_textures[texnum];
+			for (int scalenum = 0; scalenum < ARRAY_LENGTH(texture->m_scaled); scalenum++)
+			{
+				bitmap_argb32 *bitmap = texture->m_scaled[scalenum].bitmap;
+				if (bitmap != NULL && (oldest == NULL || texture->m_scaled[scalenum].lastuse < oldest->m_scaled[oldestnum].lastuse) && !primlist.has_reference(bitmap) && !target_references(bitmap))
+				{
+					oldest = texture;
+					oldestnum = scalenum;
+				}
+			}
+		}
+
+		// if everything is in use, we'll have to go over
+		if (oldest == NULL)
+			break;
+		oldest->free_scaled(oldestnum);
+	}
+}
+
+
+//-------------------------------------------------
+//  target_references - return true if any target
+//  still has primitives drawing from the given
+//  pointer
+//-------------------------------------------------
+
+bool render_manager::target_references(void *refptr) const
+{
+	for (render_target *target = m_targetlist.first(); target != NULL; target = target->next())
+		if (target->has_reference(refptr))
+			return true;
+	return false;
+}
+
+
 //-------------------------------------------------
 //  font_alloc - allocate a new font instance
 //-------------------------------------------------
@@ -428,13 +428,21 @@ public:
 	// set any necessary aux data
 	void set_osd_data(UINT64 data) { m_osddata = data; }
 
+	// allow new sizes to be scaled on a worker thread; the scaler must not touch shared state
+	void set_async_scaling(bool async) { m_async = async; }
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
 private:
 	// internal helpers
-	void get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist);
+	void *get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist);
 	const rgb_t *get_adjusted_palette(render_container &container);
+	int alloc_scaled(render_primitive_list &primlist);
+	void free_scaled(int scalenum);
+	void finish_async_scale(render_primitive_list &primlist);
+	void touch_scaled(void *refptr);
+	static void *async_scale(void *param, int threadid);
 
 	static const int MAX_TEXTURE_SCALES = 16;
 
@@ -443,6 +451,7 @@ private:
 	{
 		bitmap_argb32 *     bitmap;                 // final bitmap
 		UINT32              seqid;                  // sequence number
+		UINT64              lastuse;                // manager clock when last drawn
 	};
 
 	// internal state
@@ -458,6 +467,9 @@ private:
 	void *              m_param;                    // scaling callback parameter
 	UINT32              m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+	bool                m_async;                    // true if new sizes may be scaled on a worker thread
+	osd_work_item *     m_pending;                  // work item scaling a new size, or NULL
+	bitmap_argb32 *     m_pending_bitmap;           // bitmap that work item is scaling into
 };
 
 
@@ -649,11 +661,16 @@ public:
 	// get a primitive list
 	render_primitive_list &get_primitives();
 
+	// primitive reuse statistics
+	UINT64 primitives_reused() const { return m_prims_reused; }
+	UINT64 primitives_rebuilt() const { return m_prims_rebuilt; }
+
 	// hit testing
 	bool map_point_container(INT32 target_x, INT32 target_y, render_container &container, float &container_x, float &container_y);
 	bool map_point_input(INT32 target_x, INT32 target_y, ioport_port *&input_port, ioport_value &input_mask, float &input_x, float &input_y);
 
 	// reference tracking
+	bool has_reference(void *refptr) const;
 	void invalidate_all(void *refptr);
 
 	// debug containers
@@ -670,7 +687,8 @@ private:
 	void load_layout_files(const char *layoutfile, bool singlefile);
 	bool load_layout_file(const char *dirname, const char *filename);
 	void add_container_primitives(render_primitive_list &list, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void *add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void add_cached_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view::item &item, int blendmode, int cacheindex);
 	bool map_point_internal(INT32 target_x, INT32 target_y, render_container *container, float &mapped_x, float &mapped_y, ioport_port *&mapped_input_port, ioport_value &mapped_input_mask);
 
 	// config callbacks
@@ -691,6 +709,25 @@ private:
 	static const int NUM_PRIMLISTS = 3;
 	static const int MAX_CLEAR_EXTENTS = 1000;
 
+	// the primitive built for a layout element item, and everything it was built from
+	struct element_cache
+	{
+		const layout_view::item *item;          // item this entry was built for, or NULL if invalid
+		float               xoffs, yoffs;       // item transform
+		float               xscale, yscale;
+		render_color        color;
+		int                 orientation;
+		int                 state;              // element state
+		int                 blendmode;          // layer blend mode
+		render_bounds       cliprect;           // target bounds
+		int                 maxtexwidth;        // maximum texture size
+		int                 maxtexheight;
+		bool                visible;            // true if a primitive was produced
+		render_primitive    prim;               // copy of the primitive
+		render_texture *    texture;            // the texture it was built from
+		void *              refptr;             // the scaled bitmap it references
+	};
+
 	// internal state
 	render_target *         m_next;                     // link to next target
 	render_manager &        m_manager;                  // reference to our owning manager
@@ -714,6 +751,9 @@ private:
 	simple_list<render_container> m_debug_containers;   // list of debug containers
 	INT32                   m_clear_extent_count;       // number of clear extents
 	INT32                   m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
+	std::vector<element_cache> m_element_cache;         // primitives built for layout elements, in drawing order
+	UINT64                  m_prims_reused;             // primitives copied from the element cache
+	UINT64                  m_prims_rebuilt;            // primitives built from scratch
 
 	static render_screen_list s_empty_screen_list;
 };
@@ -725,6 +765,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -775,9 +816,20 @@ private:
 	void config_load(int config_type, xml_data_node *parentnode);
 	void config_save(int config_type, xml_data_node *parentnode);
 
+	// scaled texture cache
+	void trim_scaled_textures(render_primitive_list &primlist);
+	bool target_references(void *refptr) const;
+
 	// internal state
 	running_machine &               m_machine;          // reference back to the machine
 
+	// scaled bitmaps shared by all targets
+	std::vector<render_texture *>   m_scaled_textures;  // live textures that have a scaler
+	UINT64                          m_scaled_bytes;     // memory held by their scaled bitmaps
+	UINT64                          m_scaled_budget;    // most memory we want them to hold, or 0
+	UINT64                          m_scaled_clock;     // clock for least recently used eviction
+	osd_work_queue *                m_scale_queue;      // queue for scaling off the render thread
+
 	// array of live targets
 	simple_list<render_target>      m_targetlist;       // list of targets
 	render_target *                 m_ui_target;        // current UI target
@@ -501,6 +501,13 @@ render_texture *layout_element::state_texture(int state)
 		m_elemtex[state].m_element = this;
 		m_elemtex[state].m_state = state;
 		m_elemtex[state].m_texture = machine().render().texture_alloc(element_scale, &m_elemtex[state]);
+
+		// components that draw with fonts must stay on this thread; the rest can be rescaled on a worker
+		bool async = true;
+		for (component *curcomp = m_complist.first(); curcomp != NULL; curcomp = curcomp->next())
+			if (curcomp->m_type == component::CTYPE_TEXT || curcomp->m_type == component::CTYPE_SIMPLECOUNTER || curcomp->m_type == component::CTYPE_REEL)
+				async = false;
+		m_elemtex[state].m_texture->set_async_scaling(async);
 	}
 	return m_elemtex[state].m_texture;
 }
@@ -0,0 +1,333 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    rendspan.h
+
+    SIMD helpers for combining a span of 32-bit source texels with a span
+    of 32-bit xRGB destination pixels in the software renderer.
+
+****************************************************************************
+
+    Each helper has a plain C version with a _c suffix that does exactly
+    what the per-pixel loops in rendersw.inc do for a destination in the
+    standard xRGB format, and a vector version that must produce the same
+    pixels bit for bit. The vector version is chosen at compile time, the
+    same way rgbutil.h chooses its implementation: SSE2 on 64-bit x86
+    builds, NEON when the compiler targets it, and the C versions
+    otherwise.
+
+    Source pixels are in MAME's standard ARGB format. Destination pixels
+    written by the helpers have zero in the top byte, as they do when
+    rendersw.inc assembles them from their components.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __RENDSPAN_H__
+#define __RENDSPAN_H__
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define RENDSPAN_SSE2       1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define RENDSPAN_NEON       1
+#include <arm_neon.h>
+#endif
+
+
+
+/***************************************************************************
+    REFERENCE IMPLEMENTATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    render_span_modulate_c - scale each color
+    component by a factor from 0 to 0x100
+-------------------------------------------------*/
+
+inline void render_span_modulate_c(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb)
+{
+	for (int x = 0; x < count; x++)
+	{
+		UINT32 pix = src[x];
+		UINT32 r = (((pix >> 16) & 0xff) * sr) >> 8;
+		UINT32 g = (((pix >> 8) & 0xff) * sg) >> 8;
+		UINT32 b = (((pix >> 0) & 0xff) * sb) >> 8;
+		dest[x] = (r << 16) | (g << 8) | b;
+	}
+}
+
+
+/*-------------------------------------------------
+    render_span_blend_c - blend scaled source
+    components over the destination with a
+    constant inverse alpha
+-------------------------------------------------*/
+
+inline void render_span_blend_c(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb, UINT32 invsa)
+{
+	for (int x = 0; x < count; x++)
+	{
+		UINT32 pix = src[x];
+		UINT32 dpix = dest[x];
+		UINT32 r = (((pix >> 16) & 0xff) * sr + ((dpix >> 16) & 0xff) * invsa) >> 8;
+		UINT32 g = (((pix >> 8) & 0xff) * sg + ((dpix >> 8) & 0xff) * invsa) >> 8;
+		UINT32 b = (((pix >> 0) & 0xff) * sb + ((dpix >> 0) & 0xff) * invsa) >> 8;
+		dest[x] = (r << 16) | (g << 8) | b;
+	}
+}
+
+
+/*-------------------------------------------------
+    render_span_alpha_c - blend the source over
+    the destination using the source alpha,
+    leaving fully transparent pixels untouched
+-------------------------------------------------*/
+
+inline void render_span_alpha_c(UINT32 *dest, const UINT32 *src, int count)
+{
+	for (int x = 0; x < count; x++)
+	{
+		UINT32 pix = src[x];
+		UINT32 ta = pix >> 24;
+		if (ta != 0)
+		{
+			UINT32 dpix = dest[x];
+			UINT32 invta = 0x100 - ta;
+			UINT32 r = (((pix >> 16) & 0xff) * ta + ((dpix >> 16) & 0xff) * invta) >> 8;
+			UINT32 g = (((pix >> 8) & 0xff) * ta + ((dpix >> 8) & 0xff) * invta) >> 8;
+			UINT32 b = (((pix >> 0) & 0xff) * ta + ((dpix >> 0) & 0xff) * invta) >> 8;
+			dest[x] = (r << 16) | (g << 8) | b;
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    render_span_add_c - add the source to the
+    destination, saturating each component
+-------------------------------------------------*/
+
+inline void render_span_add_c(UINT32 *dest, const UINT32 *src, int count)
+{
+	for (int x = 0; x < count; x++)
+	{
+		UINT32 pix = src[x];
+		UINT32 dpix = dest[x];
+		UINT32 r = ((pix >> 16) & 0xff) + ((dpix >> 16) & 0xff);
+		UINT32 g = ((pix >> 8) & 0xff) + ((dpix >> 8) & 0xff);
+		UINT32 b = ((pix >> 0) & 0xff) + ((dpix >> 0) & 0xff);
+		r = (r | -(r >> 8)) & 0xff;
+		g = (g | -(g >> 8)) & 0xff;
+		b = (b | -(b >> 8)) & 0xff;
+		dest[x] = (r << 16) | (g << 8) | b;
+	}
+}
+
+
+
+/***************************************************************************
+    VECTOR IMPLEMENTATIONS
+***************************************************************************/
+
+#if defined(RENDSPAN_SSE2)
+
+inline void render_span_modulate(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i scale = _mm_set_epi16(0, sr, sg, sb, 0, sr, sg, sb);
+	int x;
+
+	// factors are at most 0x100, so the products fit in 16 bits
+	for (x = 0; x + 4 <= count; x += 4)
+	{
+		__m128i pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[x]));
+		__m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(pix, zero), scale), 8);
+		__m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(pix, zero), scale), 8);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), _mm_packus_epi16(lo, hi));
+	}
+	render_span_modulate_c(&dest[x], &src[x], count - x, sr, sg, sb);
+}
+
+inline void render_span_blend(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb, UINT32 invsa)
+{
+	// components only stay within a byte if the factors sum to at most 0x100
+	if (sr + invsa > 0x100 || sg + invsa > 0x100 || sb + invsa > 0x100)
+	{
+		render_span_blend_c(dest, src, count, sr, sg, sb, invsa);
+		return;
+	}
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i factors = _mm_set_epi16(0, 0, invsa, sr, invsa, sg, invsa, sb);
+	int x;
+
+	for (x = 0; x + 4 <= count; x += 4)
+	{
+		__m128i pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[x]));
+		__m128i dpix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[x]));
+		__m128i slo = _mm_unpacklo_epi8(pix, zero);
+		__m128i shi = _mm_unpackhi_epi8(pix, zero);
+		__m128i dlo = _mm_unpacklo_epi8(dpix, zero);
+		__m128i dhi = _mm_unpackhi_epi8(dpix, zero);
+
+		// interleave source and dest components and multiply-add them one pixel at a time
+		__m128i p0 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(slo, dlo), factors), 8);
+		__m128i p1 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(slo, dlo), factors), 8);
+		__m128i p2 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(shi, dhi), factors), 8);
+		__m128i p3 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(shi, dhi), factors), 8);
+		__m128i result = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
+	}
+	render_span_blend_c(&dest[x], &src[x], count - x, sr, sg, sb, invsa);
+}
+
+inline void render_span_alpha(UINT32 *dest, const UINT32 *src, int count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphamask = _mm_set1_epi32(0xff000000);
+	const __m128i full = _mm_set1_epi16(0x100);
+	int x;
+
+	for (x = 0; x + 4 <= count; x += 4)
+	{
+		__m128i pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[x]));
+		__m128i dpix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[x]));
+		__m128i slo = _mm_unpacklo_epi8(pix, zero);
+		__m128i shi = _mm_unpackhi_epi8(pix, zero);
+		__m128i dlo = _mm_unpacklo_epi8(dpix, zero);
+		__m128i dhi = _mm_unpackhi_epi8(dpix, zero);
+
+		// spread each pixel's alpha across its components, and pair it with its inverse
+		__m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(slo, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+		__m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(shi, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+		__m128i ilo = _mm_sub_epi16(full, alo);
+		__m128i ihi = _mm_sub_epi16(full, ahi);
+
+		__m128i p0 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(slo, dlo), _mm_unpacklo_epi16(alo, ilo)), 8);
+		__m128i p1 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(slo, dlo), _mm_unpackhi_epi16(alo, ilo)), 8);
+		__m128i p2 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(shi, dhi), _mm_unpacklo_epi16(ahi, ihi)), 8);
+		__m128i p3 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(shi, dhi), _mm_unpackhi_epi16(ahi, ihi)), 8);
+		__m128i result = _mm_andnot_si128(alphamask, _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3)));
+
+		// fully transparent source pixels leave the destination alone
+		__m128i keep = _mm_cmpeq_epi32(_mm_and_si128(pix, alphamask), zero);
+		result = _mm_or_si128(_mm_and_si128(keep, dpix), _mm_andnot_si128(keep, result));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
+	}
+	render_span_alpha_c(&dest[x], &src[x], count - x);
+}
+
+inline void render_span_add(UINT32 *dest, const UINT32 *src, int count)
+{
+	const __m128i rgbmask = _mm_set1_epi32(0x00ffffff);
+	int x;
+
+	for (x = 0; x + 4 <= count; x += 4)
+	{
+		__m128i pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[x]));
+		__m128i dpix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[x]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), _mm_and_si128(_mm_adds_epu8(pix, dpix), rgbmask));
+	}
+	render_span_add_c(&dest[x], &src[x], count - x);
+}
+
+#elif defined(RENDSPAN_NEON)
+
+inline void render_span_modulate(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb)
+{
+	const UINT16 factors[8] = { UINT16(sb), UINT16(sg), UINT16(sr), 0, UINT16(sb), UINT16(sg), UINT16(sr), 0 };
+	const uint16x8_t scale = vld1q_u16(factors);
+	int x;
+
+	// factors are at most 0x100, so the products fit in 16 bits
+	for (x = 0; x + 4 <= count; x += 4)
+	{
+		uint8x16_t pix = vreinterpretq_u8_u32(vld1q_u32(&src[x]));
+		uint16x8_t lo = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(pix)), scale), 8);
+		uint16x8_t hi = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(pix)), scale), 8);
+		vst1q_u32(&dest[x], vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))));
+	}
+	render_span_modulate_c(&dest[x], &src[x], count - x, sr, sg, sb);
+}
+
+inline void render_span_blend(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb, UINT32 invsa)
+{
+	// components only stay within a byte if the factors sum to at most 0x100
+	if (sr + invsa > 0x100 || sg + invsa > 0x100 || sb + invsa > 0x100)
+	{
+		render_span_blend_c(dest, src, count, sr, sg, sb, invsa);
+		return;
+	}
+
+	const UINT16 factors[4] = { UINT16(sb), UINT16(sg), UINT16(sr), 0 };
+	const uint16x4_t scale = vld1_u16(factors);
+	const uint16x4_t inv = vdup_n_u16(invsa);
+	int x;
+
+	for (x = 0; x + 2 <= count; x += 2)
+	{
+		uint16x8_t pix = vmovl_u8(vreinterpret_u8_u32(vld1_u32(&src[x])));
+		uint16x8_t dpix = vmovl_u8(vreinterpret_u8_u32(vld1_u32(&dest[x])));
+		uint32x4_t p0 = vmlal_u16(vmull_u16(vget_low_u16(pix), scale), vget_low_u16(dpix), inv);
+		uint32x4_t p1 = vmlal_u16(vmull_u16(vget_high_u16(pix), scale), vget_high_u16(dpix), inv);
+		uint16x8_t result = vcombine_u16(vshrn_n_u32(p0, 8), vshrn_n_u32(p1, 8));
+		vst1_u32(&dest[x], vreinterpret_u32_u8(vmovn_u16(result)));
+	}
+	render_span_blend_c(&dest[x], &src[x], count - x, sr, sg, sb, invsa);
+}
+
+inline void render_span_alpha(UINT32 *dest, const UINT32 *src, int count)
+{
+	const uint16x4_t full = vdup_n_u16(0x100);
+	const uint32x2_t alphamask = vdup_n_u32(0xff000000);
+	int x;
+
+	for (x = 0; x + 2 <= count; x += 2)
+	{
+		uint32x2_t rawpix = vld1_u32(&src[x]);
+		uint32x2_t rawdest = vld1_u32(&dest[x]);
+		uint16x8_t pix = vmovl_u8(vreinterpret_u8_u32(rawpix));
+		uint16x8_t dpix = vmovl_u8(vreinterpret_u8_u32(rawdest));
+
+		// spread each pixel's alpha across its components, and pair it with its inverse
+		uint16x4_t a0 = vdup_lane_u16(vget_low_u16(pix), 3);
+		uint16x4_t a1 = vdup_lane_u16(vget_high_u16(pix), 3);
+		uint32x4_t p0 = vmlal_u16(vmull_u16(vget_low_u16(pix), a0), vget_low_u16(dpix), vsub_u16(full, a0));
+		uint32x4_t p1 = vmlal_u16(vmull_u16(vget_high_u16(pix), a1), vget_high_u16(dpix), vsub_u16(full, a1));
+		uint16x8_t blended = vcombine_u16(vshrn_n_u32(p0, 8), vshrn_n_u32(p1, 8));
+		uint32x2_t result = vbic_u32(vreinterpret_u32_u8(vmovn_u16(blended)), alphamask);
+
+		// fully transparent source pixels leave the destination alone
+		uint32x2_t keep = vceq_u32(vand_u32(rawpix, alphamask), vdup_n_u32(0));
+		vst1_u32(&dest[x], vbsl_u32(keep, rawdest, result));
+	}
+	render_span_alpha_c(&dest[x], &src[x], count - x);
+}
+
+inline void render_span_add(UINT32 *dest, const UINT32 *src, int count)
+{
+	const uint32x4_t rgbmask = vdupq_n_u32(0x00ffffff);
+	int x;
+
+	for (x = 0; x + 4 <= count; x += 4)
+	{
+		uint8x16_t pix = vreinterpretq_u8_u32(vld1q_u32(&src[x]));
+		uint8x16_t dpix = vreinterpretq_u8_u32(vld1q_u32(&dest[x]));
+		vst1q_u32(&dest[x], vandq_u32(vreinterpretq_u32_u8(vqaddq_u8(pix, dpix)), rgbmask));
+	}
+	render_span_add_c(&dest[x], &src[x], count - x);
+}
+
+#else
+
+inline void render_span_modulate(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb) { render_span_modulate_c(dest, src, count, sr, sg, sb); }
+inline void render_span_blend(UINT32 *dest, const UINT32 *src, int count, UINT32 sr, UINT32 sg, UINT32 sb, UINT32 invsa) { render_span_blend_c(dest, src, count, sr, sg, sb, invsa); }
+inline void render_span_alpha(UINT32 *dest, const UINT32 *src, int count) { render_span_alpha_c(dest, src, count); }
+inline void render_span_add(UINT32 *dest, const UINT32 *src, int count) { render_span_add_c(dest, src, count); }
+
+#endif
+
+#endif  /* __RENDSPAN_H__ */
@@ -9,6 +9,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "tilespan.h"
 
 
 //**************************************************************************
@@ -111,8 +112,7 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, UINT8 *pri, UINT32 p
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
-		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	tilemap_span_priority(pri, count, pcode);
 }
 
 
@@ -128,9 +128,7 @@ inline void tilemap_t::scanline_draw_masked_null(const UINT8 *maskptr, int mask,
 		return;
 
 	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
-		if ((maskptr[i] & mask) == value)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	tilemap_span_priority_masked(pri, maskptr, mask, value, count, pcode);
 }
 
 
@@ -148,32 +146,13 @@ inline void tilemap_t::scanline_draw_opaque_ind16(UINT16 *dest, const UINT16 *so
 	{
 		// use memcpy which should be well-optimized for the platform
 		memcpy(dest, source, count * 2);
-
-		// skip the rest if not changing priority
-		if (pcode == 0xff00)
-			return;
-
-		// update priority across the scanline
-		for (int i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-	}
-
-	// priority case
-	else if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
 	}
-
-	// no priority case
 	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = source[i] + pal;
-	}
+		tilemap_span_copy_ind16(dest, source, count, pal);
+
+	// update priority across the scanline if needed
+	if ((pcode & 0xffff) != 0xff00)
+		tilemap_span_priority(pri, count, pcode);
 }
 
 
@@ -184,26 +163,11 @@ inline void tilemap_t::scanline_draw_opaque_ind16(UINT16 *dest, const UINT16 *so
 
 inline void tilemap_t::scanline_draw_masked_ind16(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, UINT8 *pri, UINT32 pcode)
 {
-	int pal = pcode >> 16;
+	tilemap_span_masked_ind16(dest, source, maskptr, mask, value, count, pcode >> 16);
 
-	// priority case
+	// update priority across the scanline if needed
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
-	}
+		tilemap_span_priority_masked(pri, maskptr, mask, value, count, pcode);
 }
 
 
@@ -216,23 +180,12 @@ inline void tilemap_t::scanline_draw_masked_ind16(UINT16 *dest, const UINT16 *so
 inline void tilemap_t::scanline_draw_opaque_rgb32(UINT32 *dest, const UINT16 *source, int count, const rgb_t *pens, UINT8 *pri, UINT32 pcode)
 {
 	const rgb_t *clut = &pens[pcode >> 16];
+	for (int i = 0; i < count; i++)
+		dest[i] = clut[source[i]];
 
-	// priority case
+	// update priority across the scanline if needed
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = clut[source[i]];
-	}
+		tilemap_span_priority(pri, count, pcode);
 }
 
 
@@ -274,23 +227,12 @@ inline void tilemap_t::scanline_draw_masked_rgb32(UINT32 *dest, const UINT16 *so
 inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(UINT32 *dest, const UINT16 *source, int count, const rgb_t *pens, UINT8 *pri, UINT32 pcode, UINT8 alpha)
 {
 	const rgb_t *clut = &pens[pcode >> 16];
+	for (int i = 0; i < count; i++)
+		dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
 
-	// priority case
+	// update priority across the scanline if needed
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-	}
+		tilemap_span_priority(pri, count, pcode);
 }
 
 
@@ -701,6 +643,7 @@ inline void tilemap_t::realize_all_dirty_tiles()
 	{
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
 		m_all_tiles_dirty = false;
+		m_all_tiles_clean = false;
 		m_gfx_used = 0;
 	}
 }
@@ -721,6 +664,21 @@ void tilemap_t::pixmap_update()
 
 g_profiler.start(PROFILER_TILEMAP_DRAW);
 
+	// fetch the info for every dirty tile, then let the manager draw them
+	fetch_all_dirty_tiles();
+	m_manager->draw_dirty_tiles(this);
+
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  fetch_all_dirty_tiles - queue every dirty tile
+//  in the tilemap to be drawn
+//-------------------------------------------------
+
+void tilemap_t::fetch_all_dirty_tiles()
+{
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
@@ -729,12 +687,41 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	for (int row = 0; row < m_rows; row++)
 		for (int col = 0; col < m_cols; col++, logindex++)
 			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+				tile_fetch(logindex, col, row);
 
-	// mark it all clean
+	// mark it all clean; the queued tiles are drawn before anyone looks
 	m_all_tiles_clean = true;
+}
 
-g_profiler.stop();
+
+//-------------------------------------------------
+//  fetch_instance_tiles - queue the dirty tiles
+//  that draw_instance will touch for the same
+//  parameters
+//-------------------------------------------------
+
+void tilemap_t::fetch_instance_tiles(const blit_parameters &blit, int xpos, int ypos)
+{
+	// clip to the tilemap the same way draw_instance does
+	int x1 = MAX(xpos, blit.cliprect.min_x) - xpos;
+	int x2 = MIN(xpos + (int)m_width, blit.cliprect.max_x + 1) - xpos;
+	int y1 = MAX(ypos, blit.cliprect.min_y) - ypos;
+	int y2 = MIN(ypos + (int)m_height, blit.cliprect.max_y + 1) - ypos;
+	if (x1 >= x2 || y1 >= y2)
+		return;
+
+	// queue the dirty tiles in the covered rows and columns
+	int mincol = x1 / m_tilewidth;
+	int maxcol = (x2 + m_tilewidth - 1) / m_tilewidth;
+	int minrow = y1 / m_tileheight;
+	int maxrow = (y2 + m_tileheight - 1) / m_tileheight;
+	for (int row = minrow; row < maxrow; row++)
+		for (int col = mincol; col < maxcol; col++)
+		{
+			logical_index logindex = row * m_cols + col;
+			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+				tile_fetch(logindex, col, row);
+		}
 }
 
 
@@ -746,22 +733,38 @@ void tilemap_t::tile_update(logical_index logindex, UINT32 col, UINT32 row)
 {
 g_profiler.start(PROFILER_TILEMAP_UPDATE);
 
+	tile_fetch(logindex, col, row);
+	tile_realize(m_dirty_tiles.back());
+	m_dirty_tiles.pop_back();
+
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  tile_fetch - call the get info callback for a
+//  dirty tile and queue it to be drawn; this
+//  always happens on the calling thread, in
+//  tilemap order
+//-------------------------------------------------
+
+void tilemap_t::tile_fetch(logical_index logindex, UINT32 col, UINT32 row)
+{
 	// call the get info callback for the associated memory index
 	tilemap_memory_index memindex = m_logical_to_memory[logindex];
 	m_tile_get_info(*this, m_tileinfo, memindex);
 
-	// apply the global tilemap flip to the returned flip flags
-	UINT32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
-
-	// draw the tile, using either direct or transparent
-	UINT32 x0 = m_tilewidth * col;
-	UINT32 y0 = m_tileheight * row;
-	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
-		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
+	// queue the tile, applying the global tilemap flip to the returned flip flags
+	dirty_tile tile;
+	tile.info = m_tileinfo;
+	tile.logindex = logindex;
+	tile.x0 = m_tilewidth * col;
+	tile.y0 = m_tileheight * row;
+	tile.flags = m_tileinfo.flags ^ (m_attributes & 0x03);
+	m_dirty_tiles.push_back(tile);
 
-	// if mask data is specified, apply it
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != NULL)
-		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+	// no longer dirty; the real flags are filled in when it is drawn
+	m_tileflags[logindex] = 0;
 
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
@@ -769,8 +772,37 @@ g_profiler.start(PROFILER_TILEMAP_UPDATE);
 		m_gfx_used |= 1 << m_tileinfo.gfxnum;
 		m_gfx_dirtyseq[m_tileinfo.gfxnum] = m_tileinfo.decoder->gfx(m_tileinfo.gfxnum)->dirtyseq();
 	}
+}
 
-g_profiler.stop();
+
+//-------------------------------------------------
+//  draw_dirty_tiles - draw a range of the queued
+//  tiles; safe to call from worker threads, since
+//  every tile touches its own pixels and flags
+//-------------------------------------------------
+
+void tilemap_t::draw_dirty_tiles(int first, int count)
+{
+	for (int tilenum = first; tilenum < first + count; tilenum++)
+		tile_realize(m_dirty_tiles[tilenum]);
+}
+
+
+//-------------------------------------------------
+//  tile_realize - draw a fetched tile into the
+//  pixmap and compute its flags
+//-------------------------------------------------
+
+void tilemap_t::tile_realize(const dirty_tile &tile)
+{
+	// draw the tile, using either direct or transparent
+	const tile_data &info = tile.info;
+	m_tileflags[tile.logindex] = tile_draw(info.pen_data, tile.x0, tile.y0,
+		info.palette_base, info.category, info.group, tile.flags, info.pen_mask);
+
+	// if mask data is specified, apply it
+	if ((tile.flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && info.mask_data != NULL)
+		m_tileflags[tile.logindex] = tile_apply_bitmask(info.mask_data, tile.x0, tile.y0, info.category, tile.flags);
 }
 
 
@@ -953,6 +985,29 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	UINT32 width = visarea.min_x + visarea.max_x + 1;
 	UINT32 height = visarea.min_y + visarea.max_y + 1;
 
+	// fetch the info for the dirty tiles we will touch, and have the manager draw them
+	if (!m_all_tiles_clean)
+	{
+		draw_instances(screen, dest, blit, width, height, true);
+		m_manager->draw_dirty_tiles(this);
+	}
+
+	// then draw
+	draw_instances(screen, dest, blit, width, height, false);
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_instances - walk every instance of the
+//  tilemap the scroll settings put on screen,
+//  either drawing it or only queueing its dirty
+//  tiles
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_instances(screen_device &screen, _BitmapClass &dest, blit_parameters blit, UINT32 width, UINT32 height, bool fetchonly)
+{
 	// XY scrolling playfield
 	if (m_scrollrows == 1 && m_scrollcols == 1)
 	{
@@ -961,7 +1016,12 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 		int scrolly = effective_colscroll(0, height);
 		for (int ypos = scrolly - m_height; ypos <= blit.cliprect.max_y; ypos += m_height)
 			for (int xpos = scrollx - m_width; xpos <= blit.cliprect.max_x; xpos += m_width)
-				draw_instance(screen, dest, blit, xpos, ypos);
+			{
+				if (fetchonly)
+					fetch_instance_tiles(blit, xpos, ypos);
+				else
+					draw_instance(screen, dest, blit, xpos, ypos);
+			}
 	}
 
 	// scrolling rows + vertical scroll
@@ -998,7 +1058,12 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 
 				// iterate over X to handle wraparound
 				for (int xpos = scrollx - m_width; xpos <= original_cliprect.max_x; xpos += m_width)
-					draw_instance(screen, dest, blit, xpos, ypos);
+				{
+					if (fetchonly)
+						fetch_instance_tiles(blit, xpos, ypos);
+					else
+						draw_instance(screen, dest, blit, xpos, ypos);
+				}
 			}
 		}
 	}
@@ -1034,11 +1099,15 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 
 				// iterate over Y to handle wraparound
 				for (int ypos = scrolly - m_height; ypos <= original_cliprect.max_y; ypos += m_height)
-					draw_instance(screen, dest, blit, xpos, ypos);
+				{
+					if (fetchonly)
+						fetch_instance_tiles(blit, xpos, ypos);
+					else
+						draw_instance(screen, dest, blit, xpos, ypos);
+				}
 			}
 		}
 	}
-g_profiler.stop();
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask)
@@ -1366,84 +1435,90 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 		}
 	}
 
-	// wraparound case
-	else if (wraparound)
+	// rotated or wrapping cases
+	else
 	{
-		// loop over rows
-		while (sy <= ey)
+		// when a destination row runs down a source column (rotations near 90 or
+		// 270 degrees), every pixel lands on a different source row and a whole
+		// row's worth of cache lines is gone again by the time the next row wants
+		// them; walk the destination in small blocks instead so they get reused
+		int blockwidth = ex - sx + 1;
+		int blockheight = ey - sy + 1;
+		if (abs(incxy) / 8 >= abs(incxx))
+			blockwidth = blockheight = ROZ_BLOCK_SIZE;
+
+		for (int by = sy; by <= ey; by += blockheight)
 		{
-			// initialize X counters
-			int x = sx;
-			UINT32 cx = startx;
-			UINT32 cy = starty;
-
-			// get dest and priority pointers
-			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
-			UINT8 *pri = &priority_bitmap.pix8(sy, sx);
-
-			// loop over columns
-			while (x <= ex)
+			int bey = MIN(by + blockheight - 1, ey);
+			for (int bx = sx; bx <= ex; bx += blockwidth)
 			{
-				// plot if we match the mask
-				if ((m_flagsmap.pix8((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
-				{
-					ROZ_PLOT_PIXEL(m_pixmap.pix16((cy >> 16) & ymask, (cx >> 16) & xmask));
-					*pri = (*pri & (priority >> 8)) | priority;
-				}
+				int bex = MIN(bx + blockwidth - 1, ex);
 
-				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				dest++;
-				pri++;
-			}
+				// compute the source position of the block's top-left corner; this is the
+				// same modulo-2^32 sum the per-pixel stepping would have reached
+				UINT32 rowx = startx + (bx - sx) * (UINT32)incxx + (by - sy) * (UINT32)incyx;
+				UINT32 rowy = starty + (bx - sx) * (UINT32)incxy + (by - sy) * (UINT32)incyy;
 
-			// advance in Y
-			startx += incyx;
-			starty += incyy;
-			sy++;
-		}
-	}
+				// loop over rows within the block
+				for (int y = by; y <= bey; y++)
+				{
+					// initialize X counters
+					int x = bx;
+					UINT32 cx = rowx;
+					UINT32 cy = rowy;
 
-	// non-wraparound case
-	else
-	{
-		// loop over rows
-		while (sy <= ey)
-		{
-			// initialize X counters
-			int x = sx;
-			UINT32 cx = startx;
-			UINT32 cy = starty;
+					// get dest and priority pointers
+					typename _BitmapClass::pixel_t *dest = &destbitmap.pix(y, bx);
+					UINT8 *pri = &priority_bitmap.pix8(y, bx);
 
-			// get dest and priority pointers
-			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
-			UINT8 *pri = &priority_bitmap.pix8(sy, sx);
+					// wraparound case
+					if (wraparound)
+					{
+						while (x <= bex)
+						{
+							// plot if we match the mask
+							if ((m_flagsmap.pix8((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
+							{
+								ROZ_PLOT_PIXEL(m_pixmap.pix16((cy >> 16) & ymask, (cx >> 16) & xmask));
+								*pri = (*pri & (priority >> 8)) | priority;
+							}
+
+							// advance in X
+							cx += incxx;
+							cy += incxy;
+							x++;
+							dest++;
+							pri++;
+						}
+					}
 
-			// loop over columns
-			while (x <= ex)
-			{
-				// plot if we're within the bitmap and we match the mask
-				if (cx < widthshifted && cy < heightshifted)
-					if ((m_flagsmap.pix8(cy >> 16, cx >> 16) & mask) == value)
+					// non-wraparound case
+					else
 					{
-						ROZ_PLOT_PIXEL(m_pixmap.pix16(cy >> 16, cx >> 16));
-						*pri = (*pri & (priority >> 8)) | priority;
+						while (x <= bex)
+						{
+							// plot if we're within the bitmap and we match the mask
+							if (cx < widthshifted && cy < heightshifted)
+								if ((m_flagsmap.pix8(cy >> 16, cx >> 16) & mask) == value)
+								{
+									ROZ_PLOT_PIXEL(m_pixmap.pix16(cy >> 16, cx >> 16));
+									*pri = (*pri & (priority >> 8)) | priority;
+								}
+
+							// advance in X
+							cx += incxx;
+							cy += incxy;
+							x++;
+							dest++;
+							pri++;
+						}
 					}
 
-				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				dest++;
-				pri++;
+					// advance in Y
+					rowx += incyx;
+					rowy += incyy;
+				}
 			}
-
-			// advance in Y
-			startx += incyx;
-			starty += incyy;
-			sy++;
 		}
 	}
 }
@@ -1486,7 +1561,8 @@ void tilemap_t::draw_debug(screen_device &screen, bitmap_rgb32 &dest, UINT32 scr
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ))
 {
 }
 
@@ -1511,6 +1587,9 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_work_queue != NULL)
+		osd_work_queue_free(m_work_queue);
 }
 
 
@@ -1574,6 +1653,76 @@ void tilemap_manager::mark_all_dirty()
 }
 
 
+//-------------------------------------------------
+//  realize_dirty_tiles - bring the pixmaps of all
+//  the tilemaps up to date at once; the get info
+//  callbacks run here, in tilemap order, and the
+//  tiles of every tilemap are drawn together
+//-------------------------------------------------
+
+void tilemap_manager::realize_dirty_tiles()
+{
+	for (tilemap_t *tmap = m_tilemap_list.first(); tmap != NULL; tmap = tmap->next())
+	{
+		if (tmap->gfx_elements_changed())
+			tmap->mark_all_dirty();
+		if (!tmap->m_all_tiles_clean)
+			tmap->fetch_all_dirty_tiles();
+	}
+	draw_dirty_tiles(NULL);
+}
+
+
+//-------------------------------------------------
+//  draw_dirty_tiles - draw the tiles queued by
+//  one tilemap, or all of them if NULL, spreading
+//  them over the work queue; returns once every
+//  tile has been drawn
+//-------------------------------------------------
+
+void tilemap_manager::draw_dirty_tiles(tilemap_t *tmap)
+{
+	// split the queued tiles into work items
+	m_draw_work.clear();
+	for (tilemap_t *cur = (tmap != NULL) ? tmap : m_tilemap_list.first(); cur != NULL; cur = (tmap != NULL) ? NULL : cur->next())
+		for (int first = 0; first < (int)cur->m_dirty_tiles.size(); first += TILES_PER_WORK_ITEM)
+		{
+			draw_work work;
+			work.tilemap = cur;
+			work.first = first;
+			work.count = MIN(TILES_PER_WORK_ITEM, (int)cur->m_dirty_tiles.size() - first);
+			m_draw_work.push_back(work);
+		}
+
+	// a single item isn't worth handing off
+	if (m_work_queue != NULL && m_draw_work.size() > 1)
+	{
+		osd_work_item_queue_multiple(m_work_queue, draw_dirty_tiles_callback, m_draw_work.size(), &m_draw_work[0], sizeof(m_draw_work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 100);
+	}
+	else
+		for (int worknum = 0; worknum < (int)m_draw_work.size(); worknum++)
+			m_draw_work[worknum].tilemap->draw_dirty_tiles(m_draw_work[worknum].first, m_draw_work[worknum].count);
+
+	// everything is drawn now
+	for (tilemap_t *cur = (tmap != NULL) ? tmap : m_tilemap_list.first(); cur != NULL; cur = (tmap != NULL) ? NULL : cur->next())
+		cur->m_dirty_tiles.clear();
+}
+
+
+//-------------------------------------------------
+//  draw_dirty_tiles_callback - work item callback
+//  that draws one range of queued tiles
+//-------------------------------------------------
+
+void *tilemap_manager::draw_dirty_tiles_callback(void *param, int threadid)
+{
+	draw_work *work = reinterpret_cast<draw_work *>(param);
+	work->tilemap->draw_dirty_tiles(work->first, work->count);
+	return NULL;
+}
+
+
 
 //**************************************************************************
 //  TILEMAP DEVICE
@@ -486,6 +486,18 @@ class tilemap_t
 	// maximum index in each array
 	static const int MAX_PEN_TO_FLAGS = 256;
 
+	// width and height of the destination blocks draw_roz_core walks near 90 degrees
+	static const int ROZ_BLOCK_SIZE = 8;
+
+	// a dirty tile whose info has been fetched, waiting to be drawn into the pixmap
+	struct dirty_tile
+	{
+		tile_data       info;               // info returned by the get info callback
+		logical_index   logindex;           // logical index of the tile
+		UINT32          x0, y0;             // top-left corner in the pixmap
+		UINT32          flags;              // tile flags with the global flip applied
+	};
+
 protected:
 	// tilemap_manager controlls our allocations
 	tilemap_t();
@@ -611,10 +623,16 @@ private:
 	// internal drawing
 	void pixmap_update();
 	void tile_update(logical_index logindex, UINT32 col, UINT32 row);
+	void tile_fetch(logical_index logindex, UINT32 col, UINT32 row);
+	void fetch_all_dirty_tiles();
+	void fetch_instance_tiles(const blit_parameters &blit, int xpos, int ypos);
+	void draw_dirty_tiles(int first, int count);
+	void tile_realize(const dirty_tile &tile);
 	UINT8 tile_draw(const UINT8 *pendata, UINT32 x0, UINT32 y0, UINT32 palette_base, UINT8 category, UINT8 group, UINT8 flags, UINT8 pen_mask);
 	UINT8 tile_apply_bitmask(const UINT8 *maskdata, UINT32 x0, UINT32 y0, UINT8 category, UINT8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
+	template<class _BitmapClass> void draw_instances(screen_device &screen, _BitmapClass &dest, blit_parameters blit, UINT32 width, UINT32 height, bool fetchonly);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -673,6 +691,9 @@ private:
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<UINT8>               m_tileflags;            // per-tile flags
 	UINT8                       m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
+
+	// tiles fetched but not yet drawn
+	std::vector<dirty_tile>     m_dirty_tiles;          // queued for the manager's work queue
 };
 
 
@@ -702,15 +723,32 @@ public:
 	// global operations on all tilemaps
 	void mark_all_dirty();
 	void set_flip_all(UINT32 attributes);
+	void realize_dirty_tiles();
 
 private:
 	// allocate an instance index
 	int alloc_instance() { return ++m_instance; }
 
+	// drawing queued dirty tiles
+	void draw_dirty_tiles(tilemap_t *tmap);
+	static void *draw_dirty_tiles_callback(void *param, int threadid);
+
+	// a range of one tilemap's queued tiles for a worker to draw
+	struct draw_work
+	{
+		tilemap_t *         tilemap;
+		int                 first;
+		int                 count;
+	};
+
+	static const int TILES_PER_WORK_ITEM = 128;
+
 	// internal state
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;           // queue for drawing dirty tiles
+	std::vector<draw_work>  m_draw_work;            // work items for the current batch
 };
 
 
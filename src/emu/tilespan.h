@@ -0,0 +1,260 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    tilespan.h
+
+    SIMD helpers for copying a span of tilemap pixmap pixels to the
+    destination while applying the flagsmap mask and updating the
+    priority bitmap.
+
+****************************************************************************
+
+    Each helper has a plain C version with a _c suffix that does exactly
+    what the scanline rasterizers in tilemap.c did per pixel, and a vector
+    version that must produce the same result bit for bit. The vector
+    version is chosen at compile time the same way rendspan.h does it:
+    SSE2 on 64-bit x86 builds, NEON when the compiler targets it, and the
+    C versions otherwise.
+
+    A pixel passes the mask when (maskptr[i] & mask) == value. Masked
+    helpers rewrite the pixels that fail with their old values, so the
+    destination must not be shared with another thread while they run.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __TILESPAN_H__
+#define __TILESPAN_H__
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define TILESPAN_SSE2       1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define TILESPAN_NEON       1
+#include <arm_neon.h>
+#endif
+
+
+
+/***************************************************************************
+    REFERENCE IMPLEMENTATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    tilemap_span_priority_c - apply a priority
+    code to every pixel: the mask in bits 8-15
+    is ANDed in, then the value in bits 0-7 is
+    ORed in
+-------------------------------------------------*/
+
+inline void tilemap_span_priority_c(UINT8 *pri, int count, UINT32 pcode)
+{
+	for (int i = 0; i < count; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+/*-------------------------------------------------
+    tilemap_span_priority_masked_c - apply a
+    priority code to the pixels that pass the mask
+-------------------------------------------------*/
+
+inline void tilemap_span_priority_masked_c(UINT8 *pri, const UINT8 *maskptr, int mask, int value, int count, UINT32 pcode)
+{
+	for (int i = 0; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+/*-------------------------------------------------
+    tilemap_span_copy_ind16_c - copy pixels,
+    adding a palette offset
+-------------------------------------------------*/
+
+inline void tilemap_span_copy_ind16_c(UINT16 *dest, const UINT16 *source, int count, UINT32 pal)
+{
+	for (int i = 0; i < count; i++)
+		dest[i] = source[i] + pal;
+}
+
+
+/*-------------------------------------------------
+    tilemap_span_masked_ind16_c - copy the pixels
+    that pass the mask, adding a palette offset
+-------------------------------------------------*/
+
+inline void tilemap_span_masked_ind16_c(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, UINT32 pal)
+{
+	for (int i = 0; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			dest[i] = source[i] + pal;
+}
+
+
+
+/***************************************************************************
+    VECTOR IMPLEMENTATIONS
+***************************************************************************/
+
+#if defined(TILESPAN_SSE2)
+
+inline void tilemap_span_priority(UINT8 *pri, int count, UINT32 pcode)
+{
+	const __m128i andmask = _mm_set1_epi8(pcode >> 8);
+	const __m128i ormask = _mm_set1_epi8(pcode);
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(p, andmask), ormask));
+	}
+	tilemap_span_priority_c(&pri[i], count - i, pcode);
+}
+
+inline void tilemap_span_priority_masked(UINT8 *pri, const UINT8 *maskptr, int mask, int value, int count, UINT32 pcode)
+{
+	// byte compares can't see mask values above 8 bits
+	if (((mask | value) & ~0xff) != 0)
+	{
+		tilemap_span_priority_masked_c(pri, maskptr, mask, value, count, pcode);
+		return;
+	}
+
+	const __m128i vmask = _mm_set1_epi8(mask);
+	const __m128i vvalue = _mm_set1_epi8(value);
+	const __m128i andmask = _mm_set1_epi8(pcode >> 8);
+	const __m128i ormask = _mm_set1_epi8(pcode);
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		__m128i pass = _mm_cmpeq_epi8(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&maskptr[i])), vmask), vvalue);
+		__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		__m128i newp = _mm_or_si128(_mm_and_si128(p, andmask), ormask);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(pass, newp), _mm_andnot_si128(pass, p)));
+	}
+	tilemap_span_priority_masked_c(&pri[i], &maskptr[i], mask, value, count - i, pcode);
+}
+
+inline void tilemap_span_copy_ind16(UINT16 *dest, const UINT16 *source, int count, UINT32 pal)
+{
+	const __m128i vpal = _mm_set1_epi16(pal);
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		__m128i pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_add_epi16(pix, vpal));
+	}
+	tilemap_span_copy_ind16_c(&dest[i], &source[i], count - i, pal);
+}
+
+inline void tilemap_span_masked_ind16(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, UINT32 pal)
+{
+	if (((mask | value) & ~0xff) != 0)
+	{
+		tilemap_span_masked_ind16_c(dest, source, maskptr, mask, value, count, pal);
+		return;
+	}
+
+	const __m128i vmask = _mm_set1_epi8(mask);
+	const __m128i vvalue = _mm_set1_epi8(value);
+	const __m128i vpal = _mm_set1_epi16(pal);
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		// widen the byte results to one per 16-bit pixel
+		__m128i pass = _mm_cmpeq_epi8(_mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&maskptr[i])), vmask), vvalue);
+		pass = _mm_unpacklo_epi8(pass, pass);
+		__m128i pix = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])), vpal);
+		__m128i old = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_or_si128(_mm_and_si128(pass, pix), _mm_andnot_si128(pass, old)));
+	}
+	tilemap_span_masked_ind16_c(&dest[i], &source[i], &maskptr[i], mask, value, count - i, pal);
+}
+
+#elif defined(TILESPAN_NEON)
+
+inline void tilemap_span_priority(UINT8 *pri, int count, UINT32 pcode)
+{
+	const uint8x16_t andmask = vdupq_n_u8(pcode >> 8);
+	const uint8x16_t ormask = vdupq_n_u8(pcode);
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+		vst1q_u8(&pri[i], vorrq_u8(vandq_u8(vld1q_u8(&pri[i]), andmask), ormask));
+	tilemap_span_priority_c(&pri[i], count - i, pcode);
+}
+
+inline void tilemap_span_priority_masked(UINT8 *pri, const UINT8 *maskptr, int mask, int value, int count, UINT32 pcode)
+{
+	// byte compares can't see mask values above 8 bits
+	if (((mask | value) & ~0xff) != 0)
+	{
+		tilemap_span_priority_masked_c(pri, maskptr, mask, value, count, pcode);
+		return;
+	}
+
+	const uint8x16_t vmask = vdupq_n_u8(mask);
+	const uint8x16_t vvalue = vdupq_n_u8(value);
+	const uint8x16_t andmask = vdupq_n_u8(pcode >> 8);
+	const uint8x16_t ormask = vdupq_n_u8(pcode);
+	int i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		uint8x16_t pass = vceqq_u8(vandq_u8(vld1q_u8(&maskptr[i]), vmask), vvalue);
+		uint8x16_t p = vld1q_u8(&pri[i]);
+		vst1q_u8(&pri[i], vbslq_u8(pass, vorrq_u8(vandq_u8(p, andmask), ormask), p));
+	}
+	tilemap_span_priority_masked_c(&pri[i], &maskptr[i], mask, value, count - i, pcode);
+}
+
+inline void tilemap_span_copy_ind16(UINT16 *dest, const UINT16 *source, int count, UINT32 pal)
+{
+	const uint16x8_t vpal = vdupq_n_u16(pal);
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+		vst1q_u16(&dest[i], vaddq_u16(vld1q_u16(&source[i]), vpal));
+	tilemap_span_copy_ind16_c(&dest[i], &source[i], count - i, pal);
+}
+
+inline void tilemap_span_masked_ind16(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, UINT32 pal)
+{
+	if (((mask | value) & ~0xff) != 0)
+	{
+		tilemap_span_masked_ind16_c(dest, source, maskptr, mask, value, count, pal);
+		return;
+	}
+
+	const uint8x8_t vmask = vdup_n_u8(mask);
+	const uint8x8_t vvalue = vdup_n_u8(value);
+	const uint16x8_t vpal = vdupq_n_u16(pal);
+	int i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		// widen the byte results to one per 16-bit pixel
+		uint8x8_t pass8 = vceq_u8(vand_u8(vld1_u8(&maskptr[i]), vmask), vvalue);
+		uint16x8_t pass = vreinterpretq_u16_u8(vcombine_u8(vzip_u8(pass8, pass8).val[0], vzip_u8(pass8, pass8).val[1]));
+		vst1q_u16(&dest[i], vbslq_u16(pass, vaddq_u16(vld1q_u16(&source[i]), vpal), vld1q_u16(&dest[i])));
+	}
+	tilemap_span_masked_ind16_c(&dest[i], &source[i], &maskptr[i], mask, value, count - i, pal);
+}
+
+#else
+
+inline void tilemap_span_priority(UINT8 *pri, int count, UINT32 pcode) { tilemap_span_priority_c(pri, count, pcode); }
+inline void tilemap_span_priority_masked(UINT8 *pri, const UINT8 *maskptr, int mask, int value, int count, UINT32 pcode) { tilemap_span_priority_masked_c(pri, maskptr, mask, value, count, pcode); }
+inline void tilemap_span_copy_ind16(UINT16 *dest, const UINT16 *source, int count, UINT32 pal) { tilemap_span_copy_ind16_c(dest, source, count, pal); }
+inline void tilemap_span_masked_ind16(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, UINT32 pal) { tilemap_span_masked_ind16_c(dest, source, maskptr, mask, value, count, pal); }
+
+#endif
+
+#endif  /* __TILESPAN_H__ */
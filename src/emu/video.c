@@ -97,6 +97,7 @@ video_manager::video_manager(running_machine &machine)
 		m_skipping_this_frame(false),
 		m_average_oversleep(0),
 		m_snap_target(NULL),
+		m_snap_queue(NULL),
 		m_snap_native(true),
 		m_snap_width(0),
 		m_snap_height(0),
@@ -116,7 +117,8 @@ video_manager::video_manager(running_machine &machine)
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
 
-	// create a render target for snapshots
+	// create a render target for snapshots, and a queue to render them in bands
+	m_snap_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 	const char *viewname = machine.options().snap_view();
 	m_snap_native = (machine.first_screen() != NULL && (viewname[0] == 0 || strcmp(viewname, "native") == 0));
 
@@ -538,6 +540,9 @@ void video_manager::exit()
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_queue != NULL)
+		osd_work_queue_free(m_snap_queue);
+	m_snap_queue = NULL;
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (m_overall_emutime.seconds() >= 1)
@@ -1095,9 +1100,9 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	primlist.release_lock();
 }
 
@@ -160,6 +160,7 @@ private:
 
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
+	osd_work_queue *    m_snap_queue;               // work queue for rendering snapshots in bands
 	bitmap_rgb32        m_snap_bitmap;              // screen snapshot bitmap
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	INT32               m_snap_width;               // width of snapshots (0 == auto)
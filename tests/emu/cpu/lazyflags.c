@@ -0,0 +1,311 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+
+// Checks the lazily evaluated flags used by the Z80 and i86 cores against
+// the eager code they replaced: the Z80 flag tables as z80.c used to build
+// them, and the i86 set_* helpers from i86inline.h.
+
+#include "UnitTest++/UnitTest++.h"
+#include "osdcomm.h"
+#include "cpu/z80/z80flags.h"
+
+namespace
+{
+
+/***************************************************************************
+    Z80 REFERENCE
+***************************************************************************/
+
+enum { CF = 0x01, NF = 0x02, PF = 0x04, VF = PF, XF = 0x08, HF = 0x10, YF = 0x20, ZF = 0x40, SF = 0x80 };
+
+struct z80_tables
+{
+	UINT8 SZ[256];
+	UINT8 SZP[256];
+	UINT8 SZHV_inc[256];
+	UINT8 SZHV_dec[256];
+	UINT8 SZHVC_add[2*256*256];
+	UINT8 SZHVC_sub[2*256*256];
+
+	z80_tables()
+	{
+		UINT8 *padd = &SZHVC_add[  0*256];
+		UINT8 *padc = &SZHVC_add[256*256];
+		UINT8 *psub = &SZHVC_sub[  0*256];
+		UINT8 *psbc = &SZHVC_sub[256*256];
+		for (int oldval = 0; oldval < 256; oldval++)
+		{
+			for (int newval = 0; newval < 256; newval++)
+			{
+				/* add or adc w/o carry set */
+				int val = newval - oldval;
+				*padd = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
+				*padd |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
+				if( (newval & 0x0f) < (oldval & 0x0f) ) *padd |= HF;
+				if( newval < oldval ) *padd |= CF;
+				if( (val^oldval^0x80) & (val^newval) & 0x80 ) *padd |= VF;
+				padd++;
+
+				/* adc with carry set */
+				val = newval - oldval - 1;
+				*padc = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
+				*padc |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
+				if( (newval & 0x0f) <= (oldval & 0x0f) ) *padc |= HF;
+				if( newval <= oldval ) *padc |= CF;
+				if( (val^oldval^0x80) & (val^newval) & 0x80 ) *padc |= VF;
+				padc++;
+
+				/* cp, sub or sbc w/o carry set */
+				val = oldval - newval;
+				*psub = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
+				*psub |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
+				if( (newval & 0x0f) > (oldval & 0x0f) ) *psub |= HF;
+				if( newval > oldval ) *psub |= CF;
+				if( (val^oldval) & (oldval^newval) & 0x80 ) *psub |= VF;
+				psub++;
+
+				/* sbc with carry set */
+				val = oldval - newval - 1;
+				*psbc = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
+				*psbc |= (newval & (YF | XF));  /* undocumented flag bits 5+3 */
+				if( (newval & 0x0f) >= (oldval & 0x0f) ) *psbc |= HF;
+				if( newval >= oldval ) *psbc |= CF;
+				if( (val^oldval) & (oldval^newval) & 0x80 ) *psbc |= VF;
+				psbc++;
+			}
+		}
+
+		for (int i = 0; i < 256; i++)
+		{
+			int p = 0;
+			for (int bit = 0; bit < 8; bit++)
+				if (i & (1 << bit)) ++p;
+			SZ[i] = i ? i & SF : ZF;
+			SZ[i] |= (i & (YF | XF));       /* undocumented flag bits 5+3 */
+			SZP[i] = SZ[i] | ((p & 1) ? 0 : PF);
+			SZHV_inc[i] = SZ[i];
+			if( i == 0x80 ) SZHV_inc[i] |= VF;
+			if( (i & 0x0f) == 0x00 ) SZHV_inc[i] |= HF;
+			SZHV_dec[i] = SZ[i] | NF;
+			if( i == 0x7f ) SZHV_dec[i] |= VF;
+			if( (i & 0x0f) == 0x0f ) SZHV_dec[i] |= HF;
+		}
+	}
+};
+
+const z80_tables &tables()
+{
+	static z80_tables *s_tables = new z80_tables;
+	return *s_tables;
+}
+
+// a minimal accumulator machine running the ALU ops both ways
+struct z80_alu
+{
+	UINT8 a, f;
+	lazy_flags lazy;
+
+	z80_alu(UINT8 _a, UINT8 _f) : a(_a), f(_f) { }
+
+	// eager: the ALU ops as z80.c had them
+	void eager(int op, UINT8 value)
+	{
+		const z80_tables &t = tables();
+		UINT32 ah = a << 8, c = f & CF, res;
+		switch (op)
+		{
+			case 0: res = (UINT8)(a + value);     f = t.SZHVC_add[ah | res]; a = res; break;
+			case 1: res = (UINT8)(a + value + c); f = t.SZHVC_add[(c << 16) | ah | res]; a = res; break;
+			case 2: res = (UINT8)(a - value);     f = t.SZHVC_sub[ah | res]; a = res; break;
+			case 3: res = (UINT8)(a - value - c); f = t.SZHVC_sub[(c << 16) | ah | res]; a = res; break;
+			case 4: a &= value; f = t.SZP[a] | HF; break;
+			case 5: a |= value; f = t.SZP[a]; break;
+			case 6: a ^= value; f = t.SZP[a]; break;
+			case 7: res = (UINT8)(a - value); f = (t.SZHVC_sub[ah | res] & ~(YF | XF)) | (value & (YF | XF)); break;
+			case 8: a++; f = (f & CF) | t.SZHV_inc[a]; break;
+			case 9: a--; f = (f & CF) | t.SZHV_dec[a]; break;
+		}
+	}
+
+	// lazy: the ALU ops as z80.c has them now
+	UINT8 carry() const { return lazy.pending() ? z80_lazy_carry(lazy) : (f & CF); }
+	UINT8 flags() { if (lazy.pending()) { f = z80_lazy_flags(lazy); lazy.clear(); } return f; }
+
+	void deferred(int op, UINT8 value)
+	{
+		UINT32 res;
+		switch (op)
+		{
+			case 0: res = a + value;           lazy.set(LAZY_FLAGS_ADD, 8, a, value, res); a = res; break;
+			case 1: res = a + value + carry(); lazy.set(LAZY_FLAGS_ADD, 8, a, value, res); a = res; break;
+			case 2: res = a - value;           lazy.set(LAZY_FLAGS_SUB, 8, a, value, res); a = res; break;
+			case 3: res = a - value - carry(); lazy.set(LAZY_FLAGS_SUB, 8, a, value, res); a = res; break;
+			case 4: a &= value; lazy.set(LAZY_FLAGS_LOGIC, 8, a, value, a, Z80_LAZY_AND); break;
+			case 5: a |= value; lazy.set(LAZY_FLAGS_LOGIC, 8, a, value, a, Z80_LAZY_OR); break;
+			case 6: a ^= value; lazy.set(LAZY_FLAGS_LOGIC, 8, a, value, a, Z80_LAZY_OR); break;
+			case 7: lazy.set(LAZY_FLAGS_SUB, 8, a, value, a - value, Z80_LAZY_CP); break;
+			case 8: res = a + 1; lazy.set(LAZY_FLAGS_ADD, 8, a, 1, res, Z80_LAZY_INCDEC | (carry() << 7)); a = res; break;
+			case 9: res = a - 1; lazy.set(LAZY_FLAGS_SUB, 8, a, 1, res, Z80_LAZY_INCDEC | (carry() << 7)); a = res; break;
+		}
+	}
+};
+
+
+/***************************************************************************
+    i86 REFERENCE
+***************************************************************************/
+
+struct i86_flags
+{
+	bool of, af, sf, zf, pf;
+};
+
+// the eager helpers from i86inline.h, on their own
+i86_flags i86_eager(int op, int bits, UINT32 dst, UINT32 src)
+{
+	UINT32 top = 1 << (bits - 1);
+	UINT32 res, OverVal, AuxVal;
+	INT32 SZP;
+	switch (op)
+	{
+		case LAZY_FLAGS_ADD:
+			res = dst + src;
+			OverVal = (res ^ src) & (res ^ dst) & top;
+			AuxVal = (res ^ (src ^ dst)) & 0x10;
+			break;
+		case LAZY_FLAGS_SUB:
+			res = dst - src;
+			OverVal = (dst ^ src) & (dst ^ res) & top;
+			AuxVal = (res ^ (src ^ dst)) & 0x10;
+			break;
+		default:
+			res = dst & src;
+			OverVal = AuxVal = 0;
+			break;
+	}
+	SZP = (bits == 8) ? (INT32)(INT8)res : (INT32)(INT16)res;
+
+	int c = 0;
+	for (int bit = 0; bit < 8; bit++)
+		if (SZP & (1 << bit)) c++;
+
+	i86_flags result;
+	result.of = (OverVal != 0);
+	result.af = (AuxVal != 0);
+	result.sf = (SZP < 0);
+	result.zf = (SZP == 0);
+	result.pf = !(c & 1);
+	return result;
+}
+
+i86_flags i86_lazy(int op, int bits, UINT32 dst, UINT32 src)
+{
+	UINT32 res = (op == LAZY_FLAGS_ADD) ? dst + src : (op == LAZY_FLAGS_SUB) ? dst - src : dst & src;
+	lazy_flags lazy;
+	lazy.set(op, bits, dst, src, res);
+
+	i86_flags result;
+	result.of = lazy.overflow();
+	result.af = lazy.half();
+	result.sf = lazy.sign();
+	result.zf = lazy.zero();
+	result.pf = lazy.parity();
+	return result;
+}
+
+bool operator==(const i86_flags &a, const i86_flags &b)
+{
+	return a.of == b.of && a.af == b.af && a.sf == b.sf && a.zf == b.zf && a.pf == b.pf;
+}
+
+int i86_mismatches(int op, int bits, UINT32 dst, UINT32 src)
+{
+	return (i86_eager(op, bits, dst, src) == i86_lazy(op, bits, dst, src)) ? 0 : 1;
+}
+
+} // anonymous namespace
+
+
+/***************************************************************************
+    TESTS
+***************************************************************************/
+
+TEST(z80_every_operand)
+{
+	int mismatches = 0;
+	for (int op = 0; op < 10; op++)
+		for (int a = 0; a < 256; a++)
+			for (int value = 0; value < 256; value++)
+				for (int carry = 0; carry < 2; carry++)
+				{
+					z80_alu eager(a, carry ? 0xff : 0x00);
+					z80_alu lazy(a, carry ? 0xff : 0x00);
+					eager.eager(op, value);
+					lazy.deferred(op, value);
+
+					// conditional branches test single flags without building F
+					static const UINT8 conditions[] = { CF, PF, ZF, SF };
+					for (int index = 0; index < (int)ARRAY_LENGTH(conditions); index++)
+						if (z80_lazy_flag(lazy.lazy, conditions[index]) != ((eager.f & conditions[index]) != 0))
+							mismatches++;
+
+					if (eager.a != lazy.a || eager.f != lazy.flags())
+						mismatches++;
+				}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(z80_carry_through_pending_ops)
+{
+	// carry consumers (ADC/SBC/INC/DEC) following another op must see its
+	// carry without F having been built in between
+	UINT32 seed = 1;
+	z80_alu eager(0, 0);
+	z80_alu lazy(0, 0);
+	int mismatches = 0;
+	for (int step = 0; step < 1000000; step++)
+	{
+		seed = seed * 1103515245 + 12345;
+		int op = (seed >> 16) % 10;
+		UINT8 value = seed >> 24;
+		eager.eager(op, value);
+		lazy.deferred(op, value);
+
+		// read F now and again, the way branches do
+		if ((seed & 0x700) == 0 && eager.f != lazy.flags())
+			mismatches++;
+		if (eager.a != lazy.a)
+			mismatches++;
+	}
+	CHECK_EQUAL(0, mismatches);
+	CHECK_EQUAL((int)eager.f, (int)lazy.flags());
+}
+
+TEST(i86_every_byte_operand)
+{
+	int mismatches = 0;
+	for (int op = LAZY_FLAGS_ADD; op <= LAZY_FLAGS_LOGIC; op++)
+		for (UINT32 dst = 0; dst < 0x100; dst++)
+			for (UINT32 src = 0; src < 0x101; src++)    // ADC/SBB add the carry into the source
+				mismatches += i86_mismatches(op, 8, dst, src);
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(i86_word_operands)
+{
+	static const UINT32 interesting[] = { 0x0000, 0x0001, 0x000f, 0x0010, 0x007f, 0x0080, 0x00ff, 0x0100, 0x7fff, 0x8000, 0x8001, 0xfffe, 0xffff, 0x10000 };
+	int mismatches = 0;
+	UINT32 seed = 1;
+	for (int op = LAZY_FLAGS_ADD; op <= LAZY_FLAGS_LOGIC; op++)
+		for (UINT32 dst = 0; dst < 0x10000; dst++)
+		{
+			for (int index = 0; index < (int)ARRAY_LENGTH(interesting); index++)
+				mismatches += i86_mismatches(op, 16, dst, interesting[index]);
+			for (int index = 0; index < 16; index++)
+			{
+				seed = seed * 1103515245 + 12345;
+				mismatches += i86_mismatches(op, 16, dst, seed >> 16);
+			}
+		}
+	CHECK_EQUAL(0, mismatches);
+}
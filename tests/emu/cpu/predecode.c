@@ -0,0 +1,197 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+
+// Checks that the pre-decoded instruction cache follows memory map changes.
+// The memory system bumps the direct_read_data generation on every handler
+// install; this stands in for it with a small paged view whose installs do
+// the same, and compares what a core using the cache would run against what
+// is mapped at the time.
+
+#include "UnitTest++/UnitTest++.h"
+#include "osdcomm.h"
+#include <assert.h>
+#include <string.h>
+
+typedef UINT32 offs_t;
+class direct_read_data;
+
+#define global_alloc_clear(_type)                   new _type()
+#define global_alloc_array_clear(_type, _num)       new _type[_num]()
+#define global_free(_ptr)                           delete _ptr
+#define global_free_array(_ptr)                     delete[] _ptr
+
+#include "cpu/predecode.h"
+
+namespace
+{
+
+/***************************************************************************
+    FAKE MEMORY MAP
+***************************************************************************/
+
+// 16-bit address space mapped in 4k chunks, like a small CPU's program space
+class fake_space
+{
+public:
+	offs_t bytemask() const { return 0xffff; }
+	int addr_width() const { return 16; }
+};
+
+class fake_direct
+{
+public:
+	static const int CHUNK_SHIFT = 12;
+
+	fake_direct() : m_generation(0) { memset(m_chunk, 0, sizeof(m_chunk)); }
+
+	fake_space &space() { return m_space; }
+	UINT32 generation() const { return m_generation; }
+	void *read_ptr(offs_t byteaddress, offs_t directxor = 0)
+	{
+		UINT8 *base = m_chunk[(byteaddress & 0xffff) >> CHUNK_SHIFT];
+		return (base != NULL) ? base + (byteaddress & ((1 << CHUNK_SHIFT) - 1)) : NULL;
+	}
+
+	// map RAM/ROM over whole chunks, or unmap them with NULL
+	void install(offs_t start, offs_t end, UINT8 *base)
+	{
+		for (offs_t chunk = start >> CHUNK_SHIFT; chunk <= (end >> CHUNK_SHIFT); chunk++)
+			m_chunk[chunk] = (base != NULL) ? base + ((chunk << CHUNK_SHIFT) - start) : NULL;
+		m_generation++;
+	}
+
+	// what the CPU would read without the cache
+	int read_byte(offs_t byteaddress)
+	{
+		UINT8 *ptr = reinterpret_cast<UINT8 *>(read_ptr(byteaddress));
+		return (ptr != NULL) ? *ptr : -1;
+	}
+
+private:
+	fake_space m_space;
+	UINT32 m_generation;
+	UINT8 *m_chunk[0x10000 >> CHUNK_SHIFT];
+};
+
+
+/***************************************************************************
+    CORE MODEL
+***************************************************************************/
+
+struct fake_entry
+{
+	UINT8 length;               // 0 if not decoded
+	UINT32 raw;                 // byte it was decoded from
+};
+
+typedef predecode_cache<fake_entry, 8, fake_direct> cache_type;
+
+// fetch the opcode at an address the way the Z80 core does: from the entry
+// if it is valid and verified, decoding it otherwise, or uncached; returns -1
+// for unmapped memory
+int run_fetch(cache_type &cache, offs_t pc)
+{
+	cache_type::page *page = cache.find(pc);
+	if (page == NULL)
+	{
+		cache.stats().uncached++;
+		return cache.direct().read_byte(pc);
+	}
+	fake_entry &entry = page->entry[pc & cache_type::PAGE_MASK];
+	if (entry.length == 0)
+		cache.stats().decodes++;
+	else if (!cache.verify(*page, pc, entry.raw, entry.length))
+		cache.stats().redecodes++;
+	else
+	{
+		cache.stats().hits++;
+		return entry.raw;
+	}
+	entry.length = 1;
+	entry.raw = cache.fetch(*page, pc, 1);
+	return entry.raw;
+}
+
+struct cache_fixture
+{
+	UINT8 rom[0x4000];
+	UINT8 ram[0x1000];
+	UINT8 ram2[0x1000];
+	fake_direct direct;
+	cache_type cache;
+
+	cache_fixture() : cache(direct)
+	{
+		for (int index = 0; index < 0x4000; index++)
+			rom[index] = index * 7 + 3;
+		for (int index = 0; index < 0x1000; index++)
+		{
+			ram[index] = index ^ 0x5a;
+			ram2[index] = index ^ 0xa5;
+		}
+		direct.install(0x0000, 0x3fff, rom);
+		direct.install(0x8000, 0x8fff, ram);
+	}
+
+	// fetch a whole page twice, so that every entry is decoded and then hit
+	int mismatches(offs_t start)
+	{
+		int result = 0;
+		for (int pass = 0; pass < 2; pass++)
+			for (offs_t pc = start; pc < start + cache_type::PAGE_SIZE; pc++)
+				if (run_fetch(cache, pc) != direct.read_byte(pc))
+					result++;
+		return result;
+	}
+};
+
+
+/***************************************************************************
+    TESTS
+***************************************************************************/
+
+TEST_FIXTURE(cache_fixture, predecode_install_ram_over_cached_page)
+{
+	CHECK_EQUAL(0, mismatches(0x8000));
+	CHECK(cache.stats().hits > 0);
+
+	// the old page is still intact in memory, so only the host pointer tells
+	direct.install(0x8000, 0x8fff, ram2);
+	CHECK_EQUAL(0, mismatches(0x8000));
+	CHECK_EQUAL(1U, (UINT32)cache.stats().remaps);
+}
+
+TEST_FIXTURE(cache_fixture, predecode_install_rom_over_cached_page)
+{
+	CHECK_EQUAL(0, mismatches(0x1000));
+	direct.install(0x1000, 0x1fff, ram2);
+	CHECK_EQUAL(0, mismatches(0x1000));
+
+	// and back again
+	direct.install(0x1000, 0x1fff, rom + 0x1000);
+	CHECK_EQUAL(0, mismatches(0x1000));
+	CHECK_EQUAL(2U, (UINT32)cache.stats().remaps);
+}
+
+TEST_FIXTURE(cache_fixture, predecode_unmap_cached_page)
+{
+	CHECK_EQUAL(0, mismatches(0x8000));
+	UINT64 uncached = cache.stats().uncached;
+	direct.install(0x8000, 0x8fff, NULL);
+	CHECK_EQUAL(0, mismatches(0x8000));
+	CHECK_EQUAL(uncached + 2 * cache_type::PAGE_SIZE, cache.stats().uncached);
+}
+
+TEST_FIXTURE(cache_fixture, predecode_install_elsewhere_keeps_entries)
+{
+	CHECK_EQUAL(0, mismatches(0x0100));
+	UINT64 decodes = cache.stats().decodes;
+
+	// a change somewhere else must not throw away pages that still map the same way
+	direct.install(0xc000, 0xcfff, ram2);
+	CHECK_EQUAL(0, mismatches(0x0100));
+	CHECK_EQUAL(decodes, cache.stats().decodes);
+	CHECK_EQUAL(0U, (UINT32)cache.stats().remaps);
+}
+
+}
@@ -0,0 +1,668 @@
+// license:BSD-3-Clause
+// copyright-holders:Ryan Holtz,Tyler J. Stachecki
+
+// Checks the SIMD implementation of the RSP vector unit against the scalar
+// implementation in rspcp2.c, one opcode at a time.  Each reference below is
+// the per-element scalar code path, operating on the same register layout as
+// the SIMD code: accumulator split into hi/md/lo slices, flags as 0/0xffff.
+
+#include "UnitTest++/UnitTest++.h"
+#include "cpu/rsp/rspvops.h"
+
+namespace
+{
+
+struct vu_state
+{
+	UINT16 vd[8];
+	UINT16 acc_hi[8];
+	UINT16 acc_md[8];
+	UINT16 acc_lo[8];
+	UINT16 vco_hi[8];       // "not equal", ZERO in the scalar code
+	UINT16 vco_lo[8];       // CARRY
+	UINT16 vcc_hi[8];       // CLIP2
+	UINT16 vcc_lo[8];       // COMPARE
+	UINT16 vce[8];          // CLIP1
+};
+
+typedef void (*vector_op)(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt);
+
+struct vector_op_test
+{
+	const char *name;
+	UINT32 iw;
+	vector_op scalar;
+	vector_op simd;
+};
+
+
+/***************************************************************************
+    HELPERS
+***************************************************************************/
+
+class test_random
+{
+public:
+	test_random(UINT32 seed) : m_state(seed) { }
+
+	UINT32 next()
+	{
+		m_state ^= m_state << 13;
+		m_state ^= m_state >> 17;
+		m_state ^= m_state << 5;
+		return m_state;
+	}
+
+	// mostly random values, with a good share of the ones that hit the edge cases
+	UINT16 element()
+	{
+		static const UINT16 edges[] = { 0x0000, 0x0001, 0x0002, 0x7ffe, 0x7fff, 0x8000, 0x8001, 0xfffe, 0xffff, 0x4000, 0xc000, 0x00ff, 0xff00 };
+		UINT32 r = next();
+		if ((r & 3) == 0)
+			return edges[(r >> 2) % ARRAY_LENGTH(edges)];
+		return r >> 16;
+	}
+
+	UINT16 flag() { return (next() & 0x100) ? 0xffff : 0; }
+
+private:
+	UINT32 m_state;
+};
+
+inline rsp_vec_t load(const UINT16 *src) { return vec_loadu(src); }
+inline void store(UINT16 *dest, rsp_vec_t v) { vec_storeu(dest, v); }
+
+inline UINT16 flag(bool set) { return set ? 0xffff : 0; }
+
+inline INT16 clamp16(INT64 value)
+{
+	return (value < -32768) ? -32768 : (value > 32767) ? 32767 : value;
+}
+
+inline INT64 get_acc(const vu_state &st, int i)
+{
+	UINT64 acc = ((UINT64)st.acc_hi[i] << 32) | ((UINT64)st.acc_md[i] << 16) | st.acc_lo[i];
+	return (INT64)(acc << 16) >> 16;
+}
+
+inline void set_acc(vu_state &st, int i, INT64 acc)
+{
+	st.acc_hi[i] = acc >> 32;
+	st.acc_md[i] = acc >> 16;
+	st.acc_lo[i] = acc;
+}
+
+// rsp_cop2::SATURATE_ACCUM
+UINT16 saturate_acc(const vu_state &st, int i, int slice, UINT16 negative, UINT16 positive)
+{
+	if ((INT16)st.acc_hi[i] < 0)
+	{
+		if (st.acc_hi[i] != 0xffff || (INT16)st.acc_md[i] >= 0)
+			return negative;
+	}
+	else
+	{
+		if (st.acc_hi[i] != 0 || (INT16)st.acc_md[i] < 0)
+			return positive;
+	}
+	return (slice == 0) ? st.acc_lo[i] : st.acc_md[i];
+}
+
+
+/***************************************************************************
+    SCALAR REFERENCES
+***************************************************************************/
+
+void scalar_vmulf(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT64 r = (INT64)(INT16)vs[i] * (INT16)vt[i] * 2 + 0x8000;
+		set_acc(st, i, r);
+		if (iw & 1) // VMULU
+			st.vd[i] = (r < 0) ? 0 : (((INT16)st.acc_hi[i] ^ (INT16)st.acc_md[i]) < 0) ? 0xffff : st.acc_md[i];
+		else
+			st.vd[i] = ((INT16)vs[i] == -32768 && (INT16)vt[i] == -32768) ? 0x7fff : st.acc_md[i];
+	}
+}
+
+void scalar_vmudl(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		UINT32 r = (UINT32)vs[i] * vt[i];
+		if (iw & 8) // VMADL
+		{
+			set_acc(st, i, get_acc(st, i) + (r >> 16));
+			st.vd[i] = saturate_acc(st, i, 0, 0x0000, 0xffff);
+		}
+		else
+		{
+			set_acc(st, i, r >> 16);
+			st.vd[i] = st.acc_lo[i];
+		}
+	}
+}
+
+void scalar_vmudm(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT32 r = (INT32)(INT16)vs[i] * vt[i];
+		if (iw & 8) // VMADM
+		{
+			set_acc(st, i, get_acc(st, i) + r);
+			st.vd[i] = saturate_acc(st, i, 1, 0x8000, 0x7fff);
+		}
+		else
+		{
+			set_acc(st, i, r);
+			st.vd[i] = st.acc_md[i];
+		}
+	}
+}
+
+void scalar_vmudn(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT32 r = (INT32)vs[i] * (INT16)vt[i];
+		if (iw & 8) // VMADN
+		{
+			set_acc(st, i, get_acc(st, i) + r);
+			st.vd[i] = saturate_acc(st, i, 0, 0x0000, 0xffff);
+		}
+		else
+		{
+			set_acc(st, i, r);
+			st.vd[i] = st.acc_lo[i];
+		}
+	}
+}
+
+void scalar_vmudh(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT32 r = (INT32)(INT16)vs[i] * (INT16)vt[i];
+		if (iw & 8) // VMADH
+		{
+			INT32 acc = ((UINT32)st.acc_hi[i] << 16) | st.acc_md[i];
+			acc += r;
+			st.acc_hi[i] = acc >> 16;
+			st.acc_md[i] = acc;
+			st.vd[i] = saturate_acc(st, i, 1, 0x8000, 0x7fff);
+		}
+		else
+		{
+			st.acc_hi[i] = r >> 16;
+			st.acc_md[i] = r;
+			st.acc_lo[i] = 0;
+			st.vd[i] = clamp16(r);
+		}
+	}
+}
+
+void scalar_vmacf(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT64 r = (INT64)(INT16)vs[i] * (INT16)vt[i] * 2;
+		set_acc(st, i, get_acc(st, i) + r);
+		if (iw & 1) // VMACU
+			st.vd[i] = ((INT16)st.acc_hi[i] < 0) ? 0 : (st.acc_hi[i] != 0 || (INT16)st.acc_md[i] < 0) ? 0xffff : st.acc_md[i];
+		else
+			st.vd[i] = saturate_acc(st, i, 1, 0x8000, 0x7fff);
+	}
+}
+
+void scalar_vadd(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT32 carry = st.vco_lo[i] ? 1 : 0;
+		INT32 r = (iw & 1) ? (INT16)vs[i] - (INT16)vt[i] - carry : (INT16)vs[i] + (INT16)vt[i] + carry;
+		st.acc_lo[i] = r;
+		st.vd[i] = clamp16(r);
+		st.vco_hi[i] = st.vco_lo[i] = 0;
+	}
+}
+
+void scalar_vabs(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT16 s1 = vs[i], s2 = vt[i];
+		if (s1 < 0)
+			st.vd[i] = (s2 == -32768) ? 32767 : -s2;
+		else if (s1 > 0)
+			st.vd[i] = s2;
+		else
+			st.vd[i] = 0;
+
+		// the scalar code stores the saturated result; the accumulator
+		// really receives the unsaturated negation, 0x8000 for -(-32768)
+		st.acc_lo[i] = (s1 < 0 && s2 == -32768) ? 0x8000 : st.vd[i];
+	}
+}
+
+void scalar_vaddc(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT32 r = (iw & 1) ? (INT32)vs[i] - vt[i] : (INT32)vs[i] + vt[i];
+		st.vd[i] = st.acc_lo[i] = r;
+		st.vco_lo[i] = flag((r & 0xffff0000) != 0);
+		st.vco_hi[i] = flag((iw & 1) && (UINT16)r != 0);
+	}
+}
+
+void scalar_vcmp(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT16 s1 = vs[i], s2 = vt[i];
+		bool zero = st.vco_hi[i] != 0, carry = st.vco_lo[i] != 0;
+		bool compare;
+		switch (iw & 3)
+		{
+			case 0: compare = (s1 < s2) || (s1 == s2 && zero && carry); break;  // VLT
+			case 1: compare = (s1 == s2) && !zero; break;                       // VEQ
+			case 2: compare = (s1 != s2) || zero; break;                        // VNE
+			default: compare = (s1 == s2 && (!zero || !carry)) || s1 > s2; break; // VGE
+		}
+		st.vd[i] = st.acc_lo[i] = compare ? s1 : s2;
+		st.vcc_lo[i] = flag(compare);
+		st.vcc_hi[i] = 0;
+		st.vco_hi[i] = st.vco_lo[i] = 0;
+	}
+}
+
+void scalar_vcl(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		UINT16 s1 = vs[i], s2 = vt[i];
+		UINT32 sum = (UINT32)s1 + s2;
+		UINT16 result;
+
+		if (st.vco_lo[i])
+		{
+			if (st.vco_hi[i])
+				result = st.vcc_lo[i] ? -s2 : s1;
+			else
+			{
+				bool le = st.vce[i] ? (sum <= 0x10000) : (sum == 0);
+				result = le ? -s2 : s1;
+				st.vcc_lo[i] = flag(le);
+			}
+		}
+		else
+		{
+			if (st.vco_hi[i])
+				result = st.vcc_hi[i] ? s2 : s1;
+			else
+			{
+				bool ge = s1 >= s2;
+				result = ge ? s2 : s1;
+				st.vcc_hi[i] = flag(ge);
+			}
+		}
+
+		st.vd[i] = st.acc_lo[i] = result;
+		st.vco_hi[i] = st.vco_lo[i] = st.vce[i] = 0;
+	}
+}
+
+void scalar_vch(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT16 s1 = vs[i], s2 = vt[i];
+		bool compare = false, clip2 = false, zero = false, clip1 = false;
+		bool sign = (s1 ^ s2) < 0;
+
+		if (sign)
+		{
+			clip1 = (s1 + s2 == -1);
+			clip2 = s2 < 0;
+			compare = (s1 + s2 <= 0);
+			st.vd[i] = compare ? -(UINT16)s2 : s1;
+			zero = (s1 + s2 != 0) && (s1 != ~s2);
+		}
+		else
+		{
+			compare = s2 < 0;
+			clip2 = (s1 - s2 >= 0);
+			st.vd[i] = clip2 ? s2 : s1;
+			zero = (s1 - s2 != 0) && (s1 != ~s2);
+		}
+
+		st.acc_lo[i] = st.vd[i];
+		st.vco_lo[i] = flag(sign);
+		st.vco_hi[i] = flag(zero);
+		st.vcc_lo[i] = flag(compare);
+		st.vcc_hi[i] = flag(clip2);
+		st.vce[i] = flag(clip1);
+	}
+}
+
+void scalar_vcr(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		INT16 s1 = vs[i], s2 = vt[i];
+		bool compare, clip2;
+
+		if ((INT16)(s1 ^ s2) < 0)
+		{
+			clip2 = s2 < 0;
+			// VCR clips against the one's complement of vt
+			compare = (s1 + s2 + 1 <= 0);
+			st.acc_lo[i] = compare ? ~(UINT16)s2 : s1;
+		}
+		else
+		{
+			compare = s2 < 0;
+			clip2 = (s1 - s2 >= 0);
+			st.acc_lo[i] = clip2 ? s2 : s1;
+		}
+
+		st.vd[i] = st.acc_lo[i];
+		st.vcc_lo[i] = flag(compare);
+		st.vcc_hi[i] = flag(clip2);
+		st.vco_hi[i] = st.vco_lo[i] = st.vce[i] = 0;
+	}
+}
+
+void scalar_vmrg(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		st.vd[i] = st.acc_lo[i] = st.vcc_lo[i] ? vs[i] : vt[i];
+		st.vco_hi[i] = st.vco_lo[i] = 0;
+	}
+}
+
+void scalar_vlogic(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		UINT16 r;
+		switch (iw & 6)
+		{
+			case 0: r = vs[i] & vt[i]; break;
+			case 2: r = vs[i] | vt[i]; break;
+			default: r = vs[i] ^ vt[i]; break;
+		}
+		st.vd[i] = st.acc_lo[i] = (iw & 1) ? ~r : r;
+	}
+}
+
+
+/***************************************************************************
+    SIMD IMPLEMENTATIONS
+***************************************************************************/
+
+// these mirror the glue code in rsp_cop2::handle_vector_ops
+
+void simd_multiply(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t acc_lo = load(st.acc_lo), acc_md = load(st.acc_md), acc_hi = load(st.acc_hi);
+	rsp_vec_t vd;
+
+	switch (iw & 0x37)
+	{
+		case 0x00: case 0x01: vd = vec_vmulf_vmulu(iw, load(vs), load(vt), vec_setzero(), &acc_lo, &acc_md, &acc_hi); break;
+		case 0x04:            vd = vec_vmadl_vmudl(iw, load(vs), load(vt), vec_setzero(), &acc_lo, &acc_md, &acc_hi); break;
+		case 0x05:            vd = vec_vmadm_vmudm(iw, load(vs), load(vt), vec_setzero(), &acc_lo, &acc_md, &acc_hi); break;
+		case 0x06:            vd = vec_vmadn_vmudn(iw, load(vs), load(vt), vec_setzero(), &acc_lo, &acc_md, &acc_hi); break;
+		default:              vd = vec_vmadh_vmudh(iw, load(vs), load(vt), vec_setzero(), &acc_lo, &acc_md, &acc_hi); break;
+	}
+
+	store(st.vd, vd);
+	store(st.acc_lo, acc_lo);
+	store(st.acc_md, acc_md);
+	store(st.acc_hi, acc_hi);
+}
+
+void simd_vmacf(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t acc_lo = load(st.acc_lo), acc_md = load(st.acc_md), acc_hi = load(st.acc_hi);
+	store(st.vd, vec_vmacf_vmacu(iw, load(vs), load(vt), vec_setzero(), &acc_lo, &acc_md, &acc_hi));
+	store(st.acc_lo, acc_lo);
+	store(st.acc_md, acc_md);
+	store(st.acc_hi, acc_hi);
+}
+
+void simd_vadd(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t acc_lo;
+	rsp_vec_t carry = load(st.vco_lo);
+	store(st.vd, (iw & 1) ? vec_vsub(load(vs), load(vt), carry, &acc_lo) : vec_vadd(load(vs), load(vt), carry, &acc_lo));
+	store(st.vco_hi, vec_setzero());
+	store(st.vco_lo, vec_setzero());
+	store(st.acc_lo, acc_lo);
+}
+
+void simd_vabs(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t acc_lo;
+	store(st.vd, vec_vabs(load(vs), load(vt), vec_setzero(), &acc_lo));
+	store(st.acc_lo, acc_lo);
+}
+
+void simd_vaddc(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t vd, eq, sn;
+	if (iw & 1)
+		vd = vec_vsubc(load(vs), load(vt), vec_setzero(), &eq, &sn);
+	else
+	{
+		vd = vec_vaddc(load(vs), load(vt), vec_setzero(), &sn);
+		eq = vec_setzero();
+	}
+	store(st.vd, vd);
+	store(st.vco_hi, eq);
+	store(st.vco_lo, sn);
+	store(st.acc_lo, vd);
+}
+
+void simd_vcmp(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t le;
+	rsp_vec_t vd = vec_veq_vge_vlt_vne(iw, load(vs), load(vt), vec_setzero(), &le, load(st.vco_hi), load(st.vco_lo));
+	store(st.vd, vd);
+	store(st.vcc_hi, vec_setzero());
+	store(st.vcc_lo, le);
+	store(st.vco_hi, vec_setzero());
+	store(st.vco_lo, vec_setzero());
+	store(st.acc_lo, vd);
+}
+
+void simd_vcl(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t ge = load(st.vcc_hi), le = load(st.vcc_lo);
+	rsp_vec_t vd = vec_vcl(load(vs), load(vt), vec_setzero(), &ge, &le, load(st.vco_hi), load(st.vco_lo), load(st.vce));
+	store(st.vd, vd);
+	store(st.vcc_hi, ge);
+	store(st.vcc_lo, le);
+	store(st.vco_hi, vec_setzero());
+	store(st.vco_lo, vec_setzero());
+	store(st.vce, vec_setzero());
+	store(st.acc_lo, vd);
+}
+
+void simd_vch(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t ge, le, eq, sign, vce;
+	rsp_vec_t vd = vec_vch(load(vs), load(vt), vec_setzero(), &ge, &le, &eq, &sign, &vce);
+	store(st.vd, vd);
+	store(st.vcc_hi, ge);
+	store(st.vcc_lo, le);
+	store(st.vco_hi, eq);
+	store(st.vco_lo, sign);
+	store(st.vce, vce);
+	store(st.acc_lo, vd);
+}
+
+void simd_vcr(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t ge, le;
+	rsp_vec_t vd = vec_vcr(load(vs), load(vt), vec_setzero(), &ge, &le);
+	store(st.vd, vd);
+	store(st.vcc_hi, ge);
+	store(st.vcc_lo, le);
+	store(st.vco_hi, vec_setzero());
+	store(st.vco_lo, vec_setzero());
+	store(st.vce, vec_setzero());
+	store(st.acc_lo, vd);
+}
+
+void simd_vmrg(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t vd = vec_vmrg(load(vs), load(vt), load(st.vcc_lo));
+	store(st.vd, vd);
+	store(st.vco_hi, vec_setzero());
+	store(st.vco_lo, vec_setzero());
+	store(st.acc_lo, vd);
+}
+
+void simd_vlogic(UINT32 iw, vu_state &st, const UINT16 *vs, const UINT16 *vt)
+{
+	rsp_vec_t vd;
+	switch (iw & 6)
+	{
+		case 0: vd = vec_vand_vnand(iw, load(vs), load(vt)); break;
+		case 2: vd = vec_vor_vnor(iw, load(vs), load(vt)); break;
+		default: vd = vec_vxor_vnxor(iw, load(vs), load(vt)); break;
+	}
+	store(st.vd, vd);
+	store(st.acc_lo, vd);
+}
+
+
+const vector_op_test vector_op_tests[] =
+{
+	{ "VMULF", 0x00, scalar_vmulf, simd_multiply },
+	{ "VMULU", 0x01, scalar_vmulf, simd_multiply },
+	{ "VMUDL", 0x04, scalar_vmudl, simd_multiply },
+	{ "VMUDM", 0x05, scalar_vmudm, simd_multiply },
+	{ "VMUDN", 0x06, scalar_vmudn, simd_multiply },
+	{ "VMUDH", 0x07, scalar_vmudh, simd_multiply },
+	{ "VMACF", 0x08, scalar_vmacf, simd_vmacf },
+	{ "VMACU", 0x09, scalar_vmacf, simd_vmacf },
+	{ "VMADL", 0x0c, scalar_vmudl, simd_multiply },
+	{ "VMADM", 0x0d, scalar_vmudm, simd_multiply },
+	{ "VMADN", 0x0e, scalar_vmudn, simd_multiply },
+	{ "VMADH", 0x0f, scalar_vmudh, simd_multiply },
+	{ "VADD",  0x10, scalar_vadd,  simd_vadd },
+	{ "VSUB",  0x11, scalar_vadd,  simd_vadd },
+	{ "VABS",  0x13, scalar_vabs,  simd_vabs },
+	{ "VADDC", 0x14, scalar_vaddc, simd_vaddc },
+	{ "VSUBC", 0x15, scalar_vaddc, simd_vaddc },
+	{ "VLT",   0x20, scalar_vcmp,  simd_vcmp },
+	{ "VEQ",   0x21, scalar_vcmp,  simd_vcmp },
+	{ "VNE",   0x22, scalar_vcmp,  simd_vcmp },
+	{ "VGE",   0x23, scalar_vcmp,  simd_vcmp },
+	{ "VCL",   0x24, scalar_vcl,   simd_vcl },
+	{ "VCH",   0x25, scalar_vch,   simd_vch },
+	{ "VCR",   0x26, scalar_vcr,   simd_vcr },
+	{ "VMRG",  0x27, scalar_vmrg,  simd_vmrg },
+	{ "VAND",  0x28, scalar_vlogic, simd_vlogic },
+	{ "VNAND", 0x29, scalar_vlogic, simd_vlogic },
+	{ "VOR",   0x2a, scalar_vlogic, simd_vlogic },
+	{ "VNOR",  0x2b, scalar_vlogic, simd_vlogic },
+	{ "VXOR",  0x2c, scalar_vlogic, simd_vlogic },
+	{ "VNXOR", 0x2d, scalar_vlogic, simd_vlogic },
+};
+
+}
+
+
+/***************************************************************************
+    TESTS
+***************************************************************************/
+
+TEST(rsp_vector_ops_match_scalar)
+{
+	for (int op = 0; op < ARRAY_LENGTH(vector_op_tests); op++)
+	{
+		const vector_op_test &test = vector_op_tests[op];
+		test_random random(0x9e3779b9 + op);
+
+		for (int iteration = 0; iteration < 100000; iteration++)
+		{
+			UINT16 vs[8], vt[8];
+			vu_state initial;
+
+			for (int i = 0; i < 8; i++)
+			{
+				vs[i] = random.element();
+				vt[i] = random.element();
+				initial.vd[i] = random.element();
+				initial.acc_hi[i] = random.element();
+				initial.acc_md[i] = random.element();
+				initial.acc_lo[i] = random.element();
+				initial.vco_hi[i] = random.flag();
+				initial.vco_lo[i] = random.flag();
+				initial.vcc_hi[i] = random.flag();
+				initial.vcc_lo[i] = random.flag();
+				initial.vce[i] = random.flag();
+			}
+
+			vu_state expected = initial, actual = initial;
+			(*test.scalar)(test.iw, expected, vs, vt);
+			(*test.simd)(test.iw, actual, vs, vt);
+
+			if (memcmp(&expected, &actual, sizeof(vu_state)) != 0)
+			{
+				UnitTest::MemoryOutStream message;
+				message << test.name << " differs from the scalar implementation (iteration " << iteration << ")";
+				UnitTest::CurrentTest::Results()->OnTestFailure(UnitTest::TestDetails(*UnitTest::CurrentTest::Details(), __LINE__), message.GetText());
+
+				CHECK_ARRAY_EQUAL(expected.vd, actual.vd, 8);
+				CHECK_ARRAY_EQUAL(expected.acc_hi, actual.acc_hi, 8);
+				CHECK_ARRAY_EQUAL(expected.acc_md, actual.acc_md, 8);
+				CHECK_ARRAY_EQUAL(expected.acc_lo, actual.acc_lo, 8);
+				CHECK_ARRAY_EQUAL(expected.vco_hi, actual.vco_hi, 8);
+				CHECK_ARRAY_EQUAL(expected.vco_lo, actual.vco_lo, 8);
+				CHECK_ARRAY_EQUAL(expected.vcc_hi, actual.vcc_hi, 8);
+				CHECK_ARRAY_EQUAL(expected.vcc_lo, actual.vcc_lo, 8);
+				CHECK_ARRAY_EQUAL(expected.vce, actual.vce, 8);
+				break;
+			}
+		}
+	}
+}
+
+TEST(rsp_vector_shuffle8)
+{
+	// vec_shuffle8 has pshufb semantics on every backend
+	__align16 UINT8 src[16], keys[16], result[16];
+	for (int i = 0; i < 16; i++)
+	{
+		src[i] = 0xa0 + i;
+		keys[i] = (i & 4) ? (0x80 | i) : (15 - i);
+	}
+
+	vec_store(result, vec_shuffle8(vec_load(src), vec_load(keys)));
+	for (int i = 0; i < 16; i++)
+		CHECK_EQUAL((keys[i] & 0x80) ? 0 : src[keys[i] & 0x0f], result[i]);
+}
+
+TEST(rsp_vector_blend)
+{
+	// vec_blend selects per byte on the top bit of the mask
+	__align16 UINT8 a[16], b[16], mask[16], result[16];
+	for (int i = 0; i < 16; i++)
+	{
+		a[i] = i;
+		b[i] = 0x80 + i;
+		mask[i] = (i % 3) ? 0x80 : 0x7f;
+	}
+
+	vec_store(result, vec_blend(vec_load(a), vec_load(b), vec_load(mask)));
+	for (int i = 0; i < 16; i++)
+		CHECK_EQUAL((mask[i] & 0x80) ? b[i] : a[i], result[i]);
+}
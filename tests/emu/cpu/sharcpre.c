@@ -0,0 +1,168 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+
+// Checks the SHARC pre-decoded instruction cache against the uncached fetch
+// path (the ROPCODE assembly in sharc.c) while internal RAM is written the
+// way the pm/dm write helpers in sharcmem.inc write it.
+
+#include "UnitTest++/UnitTest++.h"
+#include "osdcomm.h"
+#include <string.h>
+#include "cpu/sharc/sharcpre.h"
+
+namespace
+{
+
+// any pointer type will do as a handler; each table slot gets its own
+typedef const int *handler;
+typedef sharc_predecode_cache<handler> cache_type;
+
+struct fetch_stats
+{
+	UINT64 hits;
+	UINT64 decodes;
+	UINT64 redecodes;
+};
+
+struct sharc_model
+{
+	UINT16 ram[2 * 0x10000];
+	int marks[512];
+	handler table[512];
+	cache_type cache;
+	fetch_stats stats;
+	UINT32 seed;
+
+	sharc_model()
+	{
+		seed = 12345;
+		for (int index = 0; index < 512; index++)
+			table[index] = &marks[index];
+		for (int index = 0; index < 2 * 0x10000; index++)
+			ram[index] = random();
+		cache.flush();
+		memset(&stats, 0, sizeof(stats));
+	}
+
+	UINT32 random()
+	{
+		seed = seed * 1103515245 + 12345;
+		return seed >> 8;
+	}
+
+	// the uncached path
+	UINT64 ropcode(UINT32 pc) const
+	{
+		return ((UINT64)(ram[((pc - 0x20000) * 3) + 0]) << 32) |
+				((UINT64)(ram[((pc - 0x20000) * 3) + 1]) << 16) |
+				((UINT64)(ram[((pc - 0x20000) * 3) + 2]) << 0);
+	}
+
+	// the cached path; returns false on a mismatch
+	bool fetch_matches(UINT32 pc)
+	{
+		const cache_type::entry &entry = cache.fetch(ram, pc - 0x20000, table, stats);
+		UINT64 expected = ropcode(pc);
+		return entry.opcode == expected && entry.handler == table[(expected >> 39) & 0x1ff];
+	}
+
+	// the write paths of sharcmem.inc that land in internal RAM
+	void pm_write32(UINT32 block, UINT32 address, UINT32 data)
+	{
+		UINT32 addr = block * 0x10000 + (address & 0x7fff) * 3;
+		ram[addr + 0] = (UINT16)(data >> 16);
+		ram[addr + 1] = (UINT16)(data);
+		cache.invalidate(addr, 2);
+	}
+
+	void pm_write48(UINT32 block, UINT32 address, UINT64 data)
+	{
+		UINT32 addr = block * 0x10000 + (address & 0x7fff) * 3;
+		ram[addr + 0] = (UINT16)(data >> 32);
+		ram[addr + 1] = (UINT16)(data >> 16);
+		ram[addr + 2] = (UINT16)(data);
+		cache.invalidate(addr, 3);
+	}
+
+	void dm_write32(UINT32 block, UINT32 address, UINT32 data)
+	{
+		UINT32 addr = block * 0x10000 + (address & 0x7fff) * 2;
+		ram[addr + 0] = (UINT16)(data >> 16);
+		ram[addr + 1] = (UINT16)(data);
+		cache.invalidate(addr, 2);
+	}
+
+	void dm_write16(UINT32 block, UINT32 address, UINT32 data)
+	{
+		UINT32 addr = block * 0x10000 + ((address & 0xffff) ^ 1);
+		ram[addr] = data;
+		cache.invalidate(addr, 1);
+	}
+};
+
+
+TEST(sharc_predecode_block1_pm48_spans_two_entries)
+{
+	static sharc_model model;
+
+	// block 1 words 0-1 end instruction 0x25555, word 2 starts 0x25556
+	CHECK(model.fetch_matches(0x25555));
+	CHECK(model.fetch_matches(0x25556));
+	model.pm_write48(1, 0x28000, U64(0x123456789abc));
+	CHECK(model.fetch_matches(0x25555));
+	CHECK(model.fetch_matches(0x25556));
+	CHECK_EQUAL(2U, (UINT32)model.stats.redecodes);
+
+	// and the same for a 16-bit data write into each of them
+	model.dm_write16(1, 0x50001, 0x5a5a);
+	model.dm_write16(1, 0x50003, 0xa5a5);
+	CHECK(model.fetch_matches(0x25555));
+	CHECK(model.fetch_matches(0x25556));
+	CHECK_EQUAL(4U, (UINT32)model.stats.redecodes);
+}
+
+TEST(sharc_predecode_matches_uncached_fetch)
+{
+	static sharc_model model;
+	int mismatches = 0;
+
+	for (int step = 0; step < 2000000; step++)
+	{
+		// fetch from a small window most of the time, so that entries are reused
+		UINT32 pc = 0x20000 + ((model.random() & 3) ? (model.random() & 0xff) + 0x5500 : model.random() % cache_type::ENTRIES);
+		if (!model.fetch_matches(pc))
+			mismatches++;
+
+		// and write somewhere near it every few instructions; block 1 PM
+		// addresses are kept within RAM, as 0x10000 + 3 * 0x5555 is its end
+		if ((model.random() & 7) == 0)
+		{
+			UINT32 block = model.random() & 1;
+			UINT32 near = pc - 0x20000 - block * 0x5555 + (model.random() & 0x1f) - 0x10;
+			UINT32 data = model.random() ^ (model.random() << 16);
+			switch (model.random() & 3)
+			{
+				case 0: model.pm_write32(block, (near & 0x7fff) % (block ? 0x5555 : 0x8000), data); break;
+				case 1: model.pm_write48(block, (near & 0x7fff) % (block ? 0x5555 : 0x8000), ((UINT64)(data & 0xffff) << 32) | model.random()); break;
+				case 2: model.dm_write32(block, near * 3 / 2, data); break;
+				case 3: model.dm_write16(block, near * 3 + (model.random() % 3), data); break;
+			}
+		}
+	}
+	CHECK_EQUAL(0, mismatches);
+	CHECK(model.stats.hits > 0);
+	CHECK(model.stats.redecodes > 0);
+}
+
+TEST(sharc_predecode_flush)
+{
+	static sharc_model model;
+
+	CHECK(model.fetch_matches(0x20010));
+	model.ram[0x10 * 3 + 1] ^= 0xffff;
+	model.cache.flush();
+	CHECK(model.fetch_matches(0x20010));
+	CHECK_EQUAL(2U, (UINT32)model.stats.decodes);
+}
+
+}
@@ -0,0 +1,92 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+
+// Checks the vector span helpers the drawgfx cores use against their plain
+// C versions, which do what the PIXEL_OP_REBASE_* macros do per pixel.
+// Rows of every length up to a few vectors are tried at every alignment,
+// so the 8-pixel step and the scalar tails get exercised as well.
+
+#include "UnitTest++/UnitTest++.h"
+#include "osdcomm.h"
+#include "gfxspan.h"
+
+namespace
+{
+
+const int MAX_SPAN = 41;
+
+struct span_data
+{
+	UINT32 seed;
+	UINT8 source[MAX_SPAN + 8];
+	UINT16 dest[MAX_SPAN + 8];
+
+	span_data() : seed(1) { }
+
+	UINT32 random()
+	{
+		seed = seed * 1103515245 + 12345;
+		UINT32 result = seed >> 16;
+		seed = seed * 1103515245 + 12345;
+		return result | ((seed >> 16) << 16);
+	}
+
+	// fill with random pens, mostly from a small set so the transparent pen shows up often
+	void fill()
+	{
+		for (int x = 0; x < MAX_SPAN + 8; x++)
+		{
+			source[x] = (random() & 1) ? (random() & 0x03) : random();
+			dest[x] = random();
+		}
+	}
+};
+
+// pen bases, including ones that wrap when a pen is added
+const UINT32 colors[] = { 0x0000, 0x0010, 0x0100, 0x7ff0, 0xff80, 0xffff };
+
+// transparent pens, including ones no 8bpp pen can match
+const UINT32 trans_pens[] = { 0x00, 0x01, 0x03, 0x0f, 0xff, 0x100, 0xffffffff };
+
+TEST(gfxspan_rebase_opaque)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 16; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 8; offset++)
+			{
+				data.fill();
+				UINT32 color = colors[data.random() % ARRAY_LENGTH(colors)];
+				UINT16 expected[MAX_SPAN + 8], actual[MAX_SPAN + 8];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				gfx_span_rebase_opaque_c(&expected[offset], &data.source[offset], count, color);
+				gfx_span_rebase_opaque(&actual[offset], &data.source[offset], count, color);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(gfxspan_rebase_transpen)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 16; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 8; offset++)
+			{
+				data.fill();
+				UINT32 color = colors[data.random() % ARRAY_LENGTH(colors)];
+				UINT32 trans_pen = trans_pens[data.random() % ARRAY_LENGTH(trans_pens)];
+				UINT16 expected[MAX_SPAN + 8], actual[MAX_SPAN + 8];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				gfx_span_rebase_transpen_c(&expected[offset], &data.source[offset], count, color, trans_pen);
+				gfx_span_rebase_transpen(&actual[offset], &data.source[offset], count, color, trans_pen);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+}
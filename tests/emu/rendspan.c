@@ -0,0 +1,135 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+
+// Checks the vector span helpers the software renderer uses against their
+// plain C versions, which are the per-pixel loops from rendersw.inc. Spans
+// of every length up to a few vectors are tried at every alignment, so the
+// scalar tails get exercised as well.
+
+#include "UnitTest++/UnitTest++.h"
+#include "osdcomm.h"
+#include "rendspan.h"
+
+namespace
+{
+
+const int MAX_SPAN = 19;
+
+struct span_data
+{
+	UINT32 seed;
+	UINT32 src[MAX_SPAN + 3];
+	UINT32 dest[MAX_SPAN + 3];
+
+	span_data() : seed(1) { }
+
+	UINT32 random()
+	{
+		seed = seed * 1103515245 + 12345;
+		UINT32 result = seed >> 16;
+		seed = seed * 1103515245 + 12345;
+		return result | ((seed >> 16) << 16);
+	}
+
+	// fill with random pixels, favoring the alpha values that take special paths
+	void fill()
+	{
+		static const UINT32 alphas[] = { 0x00, 0x01, 0x7f, 0x80, 0xfe, 0xff };
+		for (int x = 0; x < MAX_SPAN + 3; x++)
+		{
+			src[x] = random();
+			dest[x] = random();
+			if (random() & 1)
+				src[x] = (src[x] & 0x00ffffff) | (alphas[random() % ARRAY_LENGTH(alphas)] << 24);
+		}
+	}
+};
+
+// the scale factors the renderer produces after clamping to 0-256
+const UINT32 factors[] = { 0x00, 0x01, 0x40, 0x7f, 0x80, 0xc0, 0xff, 0x100 };
+
+TEST(rendspan_modulate)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 64; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 4; offset++)
+			{
+				data.fill();
+				UINT32 sr = factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 sg = factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 sb = factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 expected[MAX_SPAN + 3], actual[MAX_SPAN + 3];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				render_span_modulate_c(&expected[offset], &data.src[offset], count, sr, sg, sb);
+				render_span_modulate(&actual[offset], &data.src[offset], count, sr, sg, sb);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(rendspan_blend)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 64; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 4; offset++)
+			{
+				// include over-bright colors, whose factors sum past 0x100
+				data.fill();
+				UINT32 invsa = factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 sr = factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 sg = (pass & 1) ? 0x100 - invsa : factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 sb = (pass & 2) ? 0x100 - invsa : factors[data.random() % ARRAY_LENGTH(factors)];
+				UINT32 expected[MAX_SPAN + 3], actual[MAX_SPAN + 3];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				render_span_blend_c(&expected[offset], &data.src[offset], count, sr, sg, sb, invsa);
+				render_span_blend(&actual[offset], &data.src[offset], count, sr, sg, sb, invsa);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(rendspan_alpha)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 256; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 4; offset++)
+			{
+				data.fill();
+				UINT32 expected[MAX_SPAN + 3], actual[MAX_SPAN + 3];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				render_span_alpha_c(&expected[offset], &data.src[offset], count);
+				render_span_alpha(&actual[offset], &data.src[offset], count);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(rendspan_add)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 256; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 4; offset++)
+			{
+				data.fill();
+				UINT32 expected[MAX_SPAN + 3], actual[MAX_SPAN + 3];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				render_span_add_c(&expected[offset], &data.src[offset], count);
+				render_span_add(&actual[offset], &data.src[offset], count);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+}
@@ -0,0 +1,138 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+
+// Checks the vector span helpers the tilemap scanline rasterizers use
+// against their plain C versions. Spans of every length up to a few
+// vectors are tried at every alignment, so the scalar tails get exercised
+// as well.
+
+#include "UnitTest++/UnitTest++.h"
+#include "osdcomm.h"
+#include "tilespan.h"
+
+namespace
+{
+
+const int MAX_SPAN = 37;
+
+struct span_data
+{
+	UINT32 seed;
+	UINT16 source[MAX_SPAN + 8];
+	UINT16 dest[MAX_SPAN + 8];
+	UINT8 flags[MAX_SPAN + 8];
+	UINT8 pri[MAX_SPAN + 8];
+
+	span_data() : seed(1) { }
+
+	UINT32 random()
+	{
+		seed = seed * 1103515245 + 12345;
+		UINT32 result = seed >> 16;
+		seed = seed * 1103515245 + 12345;
+		return result | ((seed >> 16) << 16);
+	}
+
+	// fill with random pixels and flags drawn from a few categories, so masks match often
+	void fill()
+	{
+		for (int x = 0; x < MAX_SPAN + 8; x++)
+		{
+			source[x] = random();
+			dest[x] = random();
+			pri[x] = random();
+		}
+		for (int x = 0; x < MAX_SPAN + 8; x++)
+			flags[x] = random() & 0x33;
+	}
+};
+
+// mask/value pairs like the ones configure_blit_parameters builds
+const int masks[][2] = { { 0x10, 0x10 }, { 0x30, 0x10 }, { 0x33, 0x11 }, { 0x13, 0x00 }, { 0xff, 0x22 }, { 0x10, 0x100 } };
+
+// priority codes, with and without a palette offset in the top bits
+const UINT32 pcodes[] = { 0xff00, 0xff01, 0x0f04, 0x00ff, 0x3c80, 0x12345a5 };
+
+TEST(tilespan_priority)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 16; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 8; offset++)
+			{
+				data.fill();
+				UINT32 pcode = pcodes[data.random() % ARRAY_LENGTH(pcodes)];
+				UINT8 expected[MAX_SPAN + 8], actual[MAX_SPAN + 8];
+				memcpy(expected, data.pri, sizeof(expected));
+				memcpy(actual, data.pri, sizeof(actual));
+				tilemap_span_priority_c(&expected[offset], count, pcode);
+				tilemap_span_priority(&actual[offset], count, pcode);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(tilespan_priority_masked)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 16; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 8; offset++)
+			{
+				data.fill();
+				UINT32 pcode = pcodes[data.random() % ARRAY_LENGTH(pcodes)];
+				int which = data.random() % ARRAY_LENGTH(masks);
+				UINT8 expected[MAX_SPAN + 8], actual[MAX_SPAN + 8];
+				memcpy(expected, data.pri, sizeof(expected));
+				memcpy(actual, data.pri, sizeof(actual));
+				tilemap_span_priority_masked_c(&expected[offset], &data.flags[offset], masks[which][0], masks[which][1], count, pcode);
+				tilemap_span_priority_masked(&actual[offset], &data.flags[offset], masks[which][0], masks[which][1], count, pcode);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(tilespan_copy_ind16)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 16; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 8; offset++)
+			{
+				data.fill();
+				UINT32 pal = pcodes[data.random() % ARRAY_LENGTH(pcodes)] >> 16;
+				UINT16 expected[MAX_SPAN + 8], actual[MAX_SPAN + 8];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				tilemap_span_copy_ind16_c(&expected[offset], &data.source[offset], count, pal);
+				tilemap_span_copy_ind16(&actual[offset], &data.source[offset], count, pal);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+TEST(tilespan_masked_ind16)
+{
+	span_data data;
+	int mismatches = 0;
+	for (int pass = 0; pass < 16; pass++)
+		for (int count = 0; count <= MAX_SPAN; count++)
+			for (int offset = 0; offset < 8; offset++)
+			{
+				data.fill();
+				UINT32 pal = pcodes[data.random() % ARRAY_LENGTH(pcodes)] >> 16;
+				int which = data.random() % ARRAY_LENGTH(masks);
+				UINT16 expected[MAX_SPAN + 8], actual[MAX_SPAN + 8];
+				memcpy(expected, data.dest, sizeof(expected));
+				memcpy(actual, data.dest, sizeof(actual));
+				tilemap_span_masked_ind16_c(&expected[offset], &data.source[offset], &data.flags[offset], masks[which][0], masks[which][1], count, pal);
+				tilemap_span_masked_ind16(&actual[offset], &data.source[offset], &data.flags[offset], masks[which][0], masks[which][1], count, pal);
+				mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+			}
+	CHECK_EQUAL(0, mismatches);
+}
+
+}